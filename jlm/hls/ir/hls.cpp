@@ -171,7 +171,7 @@ loop_node::add_backedge(std::shared_ptr<const jlm::rvsdg::Type> type)
 loop_node *
 loop_node::create(rvsdg::Region * parent, bool init)
 {
-  auto ln = new loop_node(parent);
+  auto ln = new (*parent) loop_node(parent);
   if (init)
   {
     auto predicate = jlm::rvsdg::control_false(ln->subregion());
@@ -207,7 +207,7 @@ get_mem_req_type(std::shared_ptr<const rvsdg::ValueType> elementType, bool write
     elements.emplace_back("data", std::move(elementType));
     elements.emplace_back("write", jlm::rvsdg::bittype::Create(1));
   }
-  return std::make_shared<bundletype>(std::move(elements));
+  return rvsdg::TypeTable::Intern(std::make_shared<const bundletype>(std::move(elements)));
 }
 
 std::shared_ptr<const bundletype>
@@ -216,6 +216,6 @@ get_mem_res_type(std::shared_ptr<const jlm::rvsdg::ValueType> dataType)
   std::vector<std::pair<std::string, std::shared_ptr<const jlm::rvsdg::Type>>> elements;
   elements.emplace_back("data", std::move(dataType));
   elements.emplace_back("id", jlm::rvsdg::bittype::Create(8));
-  return std::make_shared<bundletype>(std::move(elements));
+  return rvsdg::TypeTable::Intern(std::make_shared<const bundletype>(std::move(elements)));
 }
 }
@@ -13,6 +13,7 @@
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
 
 #include <memory>
 #include <utility>
@@ -42,6 +43,16 @@ public:
         && *ot->result(0) == *result(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(branch_op).hash_code(),
+        static_cast<std::size_t>(loop),
+        argument(0)->ComputeHash(),
+        result(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -123,6 +134,16 @@ public:
         && forkOp->IsConstant() == IsConstant_;
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(fork_op).hash_code(),
+        argument(0)->ComputeHash(),
+        nresults(),
+        static_cast<std::size_t>(IsConstant_));
+  }
+
   /**
    * Debug string for the fork operation.
    * /return HLS_CFORK if the fork is a constant fork, else HLS_FORK.
@@ -188,6 +209,15 @@ public:
     return ot && ot->narguments() == narguments() && *ot->argument(0) == *argument(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(merge_op).hash_code(),
+        narguments(),
+        argument(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -238,6 +268,16 @@ public:
         && ot->discarding == discarding;
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(mux_op).hash_code(),
+        argument(0)->ComputeHash(),
+        result(0)->ComputeHash(),
+        static_cast<std::size_t>(discarding));
+  }
+
   std::string
   debug_string() const override
   {
@@ -306,6 +346,12 @@ public:
     return ot && *ot->argument(0) == *argument(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(typeid(sink_op).hash_code(), argument(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -342,6 +388,12 @@ public:
     return ot && *ot->result(0) == *result(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(typeid(predicate_buffer_op).hash_code(), result(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -384,6 +436,15 @@ public:
     return ot && *ot->result(0) == *result(0) && *ot->argument(0) == *argument(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(loop_constant_buffer_op).hash_code(),
+        result(0)->ComputeHash(),
+        argument(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -431,6 +492,16 @@ public:
         && *ot->result(0) == *result(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(buffer_op).hash_code(),
+        capacity,
+        static_cast<std::size_t>(pass_through),
+        result(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -504,6 +575,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && *ot->result(0) == *result(0);
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(trigger_op).hash_code(),
+        argument(1)->ComputeHash(),
+        result(0)->ComputeHash());
+  }
+
   std::string
   debug_string() const override
   {
@@ -631,7 +711,7 @@ public:
       rvsdg::StructuralInput & input,
       const std::shared_ptr<const rvsdg::Type> type)
   {
-    auto argument = new EntryArgument(region, input, std::move(type));
+    auto argument = new (region) EntryArgument(region, input, std::move(type));
     region.append_argument(argument);
     return *argument;
   }
@@ -663,7 +743,7 @@ private:
   static backedge_argument *
   create(rvsdg::Region * region, std::shared_ptr<const jlm::rvsdg::Type> type)
   {
-    auto argument = new backedge_argument(region, std::move(type));
+    auto argument = new (*region) backedge_argument(region, std::move(type));
     region->append_argument(argument);
     return argument;
   }
@@ -697,7 +777,7 @@ private:
   static backedge_result *
   create(jlm::rvsdg::output * origin)
   {
-    auto result = new backedge_result(origin);
+    auto result = new (*origin->region()) backedge_result(origin);
     origin->region()->append_result(result);
     return result;
   }
@@ -731,7 +811,7 @@ public:
   static ExitResult &
   Create(rvsdg::output & origin, rvsdg::StructuralOutput & output)
   {
-    auto result = new ExitResult(origin, output);
+    auto result = new (*origin.region()) ExitResult(origin, output);
     origin.region()->append_result(result);
     return *result;
   }
@@ -890,6 +970,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(load_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(std::shared_ptr<const rvsdg::ValueType> pointeeType, size_t numStates)
   {
@@ -981,6 +1070,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(addr_queue_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(std::shared_ptr<const llvm::PointerType> pointerType)
   {
@@ -1050,6 +1148,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(state_gate_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInOutTypes(const std::shared_ptr<const jlm::rvsdg::Type> & type, size_t numStates)
   {
@@ -1101,6 +1208,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(decoupled_load_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(std::shared_ptr<const rvsdg::ValueType> pointeeType)
   {
@@ -1172,6 +1288,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(mem_resp_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(const std::vector<std::shared_ptr<const rvsdg::ValueType>> &)
   {
@@ -1259,6 +1384,12 @@ public:
         && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(typeid(mem_req_op).hash_code(), narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(
       const std::vector<std::shared_ptr<const rvsdg::ValueType>> & load_types,
@@ -1376,6 +1507,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(store_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(const std::shared_ptr<const rvsdg::ValueType> & pointeeType, size_t numStates)
   {
@@ -1504,6 +1644,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(local_mem_resp_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateOutTypes(const std::shared_ptr<const jlm::llvm::ArrayType> & at, size_t resp_count)
   {
@@ -1552,6 +1701,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(local_load_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(const std::shared_ptr<const jlm::rvsdg::ValueType> & valuetype, size_t numStates)
   {
@@ -1630,6 +1788,15 @@ public:
     return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(
+        typeid(local_store_op).hash_code(),
+        argument(1)->ComputeHash(),
+        narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(const std::shared_ptr<const jlm::rvsdg::ValueType> & valuetype, size_t numStates)
   {
@@ -1712,6 +1879,12 @@ public:
         && ot->narguments() == narguments();
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(typeid(local_mem_req_op).hash_code(), narguments());
+  }
+
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
   CreateInTypes(
       const std::shared_ptr<const llvm::ArrayType> & at,
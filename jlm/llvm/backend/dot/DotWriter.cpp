@@ -162,7 +162,7 @@ CreateGraphNodes(util::Graph & graph, rvsdg::Region & region, util::Graph * type
 
   // Create a node for each node in the region in topological order.
   // Inputs expect the node representing their origin to exist before being visited.
-  rvsdg::TopDownTraverser traverser(&region);
+  rvsdg::TopDownConstTraverser traverser(&region);
   for (const auto rvsdgNode : traverser)
   {
     auto & node = graph.CreateInOutNode(rvsdgNode->ninputs(), rvsdgNode->noutputs());
@@ -307,6 +307,7 @@ public:
   {
     AddTimer(Label::Timer).stop();
     AddMeasurement(Label::NumRvsdgNodes, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddMeasurement(Label::NumRvsdgAllocatedBytes, graph.NumAllocatedBytes());
   }
 
   static std::unique_ptr<InterProceduralGraphToRvsdgStatistics>
@@ -0,0 +1,1881 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
+#include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <typeindex>
+
+namespace jlm::llvm
+{
+
+namespace
+{
+
+const char FormatMagic[8] = { 'J', 'L', 'M', 'R', 'V', 'S', 'D', 'G' };
+
+/**
+ * Tags of the type table entries. The values are part of the format and must not change.
+ */
+enum class TypeTag : uint8_t
+{
+  Bit = 0,
+  Control = 1,
+  Pointer = 2,
+  IOState = 3,
+  MemoryState = 4,
+  VariableArgument = 5,
+  FloatingPoint = 6,
+  Array = 7,
+  Struct = 8,
+  FixedVector = 9,
+  ScalableVector = 10,
+  Function = 11,
+  StructDeclaration = 12,
+};
+
+/**
+ * Tags of the node records. The values are part of the format and must not change.
+ */
+enum class NodeTag : uint8_t
+{
+  Simple = 0,
+  Gamma = 1,
+  Theta = 2,
+  Lambda = 3,
+  Delta = 4,
+  Phi = 5,
+};
+
+class ByteBuffer final
+{
+public:
+  void
+  WriteByte(uint8_t byte)
+  {
+    Bytes_.push_back(byte);
+  }
+
+  void
+  WriteVarint(uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      Bytes_.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    Bytes_.push_back(static_cast<uint8_t>(value));
+  }
+
+  void
+  WriteString(const std::string & string)
+  {
+    WriteVarint(string.size());
+    Bytes_.insert(Bytes_.end(), string.begin(), string.end());
+  }
+
+  void
+  Append(const ByteBuffer & other)
+  {
+    Bytes_.insert(Bytes_.end(), other.Bytes_.begin(), other.Bytes_.end());
+  }
+
+  [[nodiscard]] std::string
+  ToString() const
+  {
+    return { Bytes_.begin(), Bytes_.end() };
+  }
+
+  void
+  WriteTo(std::ostream & stream) const
+  {
+    stream.write(reinterpret_cast<const char *>(Bytes_.data()), Bytes_.size());
+  }
+
+private:
+  std::vector<uint8_t> Bytes_;
+};
+
+class ByteReader final
+{
+public:
+  ByteReader(const uint8_t * data, size_t size)
+      : Data_(data),
+        Size_(size),
+        Position_(0)
+  {}
+
+  [[nodiscard]] bool
+  AtEnd() const noexcept
+  {
+    return Position_ == Size_;
+  }
+
+  uint8_t
+  ReadByte()
+  {
+    if (AtEnd())
+      throw util::error("Unexpected end of binary RVSDG.");
+
+    return Data_[Position_++];
+  }
+
+  uint64_t
+  ReadVarint()
+  {
+    uint64_t value = 0;
+    for (size_t shift = 0; shift < 64; shift += 7)
+    {
+      auto byte = ReadByte();
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return value;
+    }
+
+    throw util::error("Malformed varint in binary RVSDG.");
+  }
+
+  std::string
+  ReadString()
+  {
+    auto size = ReadVarint();
+    if (size > Size_ - Position_)
+      throw util::error("Unexpected end of binary RVSDG.");
+
+    std::string string(reinterpret_cast<const char *>(Data_ + Position_), size);
+    Position_ += size;
+    return string;
+  }
+
+  void
+  ReadBytes(void * destination, size_t size)
+  {
+    if (size > Size_ - Position_)
+      throw util::error("Unexpected end of binary RVSDG.");
+
+    memcpy(destination, Data_ + Position_, size);
+    Position_ += size;
+  }
+
+private:
+  const uint8_t * Data_;
+  size_t Size_;
+  size_t Position_;
+};
+
+/**
+ * Numbers the outputs of a region in the order they are written: region arguments first, then
+ * the outputs of the nodes in topological order.
+ */
+class OutputNumbering final
+{
+public:
+  void
+  Add(const rvsdg::output & output)
+  {
+    auto index = Indices_.size();
+    Indices_[&output] = index;
+  }
+
+  [[nodiscard]] uint64_t
+  Encode(const rvsdg::output & origin) const
+  {
+    auto it = Indices_.find(&origin);
+    JLM_ASSERT(it != Indices_.end());
+    return Indices_.size() - 1 - it->second;
+  }
+
+private:
+  std::unordered_map<const rvsdg::output *, uint64_t> Indices_;
+};
+
+/**
+ * Counterpart of OutputNumbering for decoding edges.
+ */
+class OriginTable final
+{
+public:
+  void
+  Add(rvsdg::output & output)
+  {
+    Outputs_.push_back(&output);
+  }
+
+  [[nodiscard]] rvsdg::output &
+  Decode(uint64_t distance) const
+  {
+    if (distance >= Outputs_.size())
+      throw util::error("Invalid edge in binary RVSDG.");
+
+    return *Outputs_[Outputs_.size() - 1 - distance];
+  }
+
+private:
+  std::vector<rvsdg::output *> Outputs_;
+};
+
+class RvsdgBinaryWriter;
+class RvsdgBinaryReader;
+
+/**
+ * Encodes and decodes the parameters of one kind of simple operation. The position of a codec in
+ * the list returned by GetOperationCodecs() is its opcode in the format.
+ */
+struct OperationCodec
+{
+  std::type_index Type;
+  void (*Write)(RvsdgBinaryWriter &, const rvsdg::SimpleOperation &, ByteBuffer &);
+  std::unique_ptr<rvsdg::SimpleOperation> (*Read)(RvsdgBinaryReader &);
+};
+
+const std::vector<OperationCodec> &
+GetOperationCodecs();
+
+template<typename T>
+std::shared_ptr<const T>
+CheckedTypeCast(const std::shared_ptr<const rvsdg::Type> & type)
+{
+  auto result = std::dynamic_pointer_cast<const T>(type);
+  if (!result)
+    throw util::error("Unexpected type in binary RVSDG: " + type->debug_string());
+
+  return result;
+}
+
+class RvsdgBinaryWriter final
+{
+public:
+  void
+  Write(const RvsdgModule & rvsdgModule, std::ostream & stream);
+
+  void
+  WriteType(const rvsdg::Type & type, ByteBuffer & buffer)
+  {
+    buffer.WriteVarint(GetTypeIndex(type));
+  }
+
+  void
+  WriteAttributes(const attributeset & attributes, ByteBuffer & buffer);
+
+private:
+  uint64_t
+  GetTypeIndex(const rvsdg::Type & type);
+
+  uint64_t
+  GetDeclarationIndex(const StructType::Declaration & declaration);
+
+  uint64_t
+  GetOperationIndex(const rvsdg::SimpleOperation & operation);
+
+  void
+  WriteRootRegion(const rvsdg::Region & region, ByteBuffer & buffer);
+
+  void
+  WriteRegion(const rvsdg::Region & region, ByteBuffer & buffer);
+
+  void
+  WriteNodes(const rvsdg::Region & region, OutputNumbering & numbering, ByteBuffer & buffer);
+
+  void
+  WriteNode(const rvsdg::Node & node, const OutputNumbering & numbering, ByteBuffer & buffer);
+
+  static void
+  WriteOrigin(const rvsdg::input & input, const OutputNumbering & numbering, ByteBuffer & buffer)
+  {
+    buffer.WriteVarint(numbering.Encode(*input.origin()));
+  }
+
+  ByteBuffer TypeTable_;
+  uint64_t NumTypeTableEntries_ = 0;
+  uint64_t NumTypes_ = 0;
+  std::unordered_map<const rvsdg::Type *, uint64_t> TypeIndices_;
+  std::unordered_map<std::string, uint64_t> TypeEntries_;
+  std::unordered_map<const StructType::Declaration *, uint64_t> DeclarationIndices_;
+
+  ByteBuffer OperationTable_;
+  std::unordered_map<std::string, uint64_t> OperationEntries_;
+};
+
+class RvsdgBinaryReader final
+{
+public:
+  RvsdgBinaryReader(const uint8_t * data, size_t size)
+      : Reader_(data, size)
+  {}
+
+  std::unique_ptr<RvsdgModule>
+  Read();
+
+  uint8_t
+  ReadByte()
+  {
+    return Reader_.ReadByte();
+  }
+
+  uint64_t
+  ReadVarint()
+  {
+    return Reader_.ReadVarint();
+  }
+
+  std::string
+  ReadString()
+  {
+    return Reader_.ReadString();
+  }
+
+  std::shared_ptr<const rvsdg::Type>
+  ReadType()
+  {
+    auto index = ReadVarint();
+    if (index >= Types_.size())
+      throw util::error("Invalid type index in binary RVSDG.");
+
+    return Types_[index];
+  }
+
+  template<typename T>
+  std::shared_ptr<const T>
+  ReadType()
+  {
+    return CheckedTypeCast<T>(ReadType());
+  }
+
+  llvm::linkage
+  ReadLinkage()
+  {
+    auto value = ReadVarint();
+    if (value > static_cast<uint64_t>(linkage::common_linkage))
+      throw util::error("Invalid linkage in binary RVSDG.");
+
+    return static_cast<llvm::linkage>(value);
+  }
+
+  attributeset
+  ReadAttributes();
+
+private:
+  void
+  ReadTypeTableEntry(RvsdgModule & rvsdgModule);
+
+  void
+  ReadOperation();
+
+  void
+  ReadRootRegion(rvsdg::Graph & graph);
+
+  std::vector<rvsdg::output *>
+  ReadRegion(rvsdg::Region & region);
+
+  void
+  ReadNodes(rvsdg::Region & region, OriginTable & origins);
+
+  rvsdg::Node &
+  ReadNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadSimpleNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadGammaNode(const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadThetaNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadLambdaNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadDeltaNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::Node &
+  ReadPhiNode(rvsdg::Region & region, const OriginTable & origins);
+
+  rvsdg::output &
+  ReadOrigin(const OriginTable & origins)
+  {
+    return origins.Decode(ReadVarint());
+  }
+
+  ByteReader Reader_;
+  std::vector<std::shared_ptr<const rvsdg::Type>> Types_;
+  std::vector<const StructType::Declaration *> Declarations_;
+  std::vector<std::unique_ptr<rvsdg::SimpleOperation>> Operations_;
+};
+
+void
+RvsdgBinaryWriter::Write(const RvsdgModule & rvsdgModule, std::ostream & stream)
+{
+  // The graph is encoded first as it populates the type and operation tables
+  ByteBuffer graph;
+  WriteRootRegion(rvsdgModule.Rvsdg().GetRootRegion(), graph);
+
+  ByteBuffer header;
+  for (auto byte : FormatMagic)
+    header.WriteByte(static_cast<uint8_t>(byte));
+  header.WriteVarint(RvsdgBinaryFormatVersion);
+  header.WriteString(rvsdgModule.SourceFileName().to_str());
+  header.WriteString(rvsdgModule.TargetTriple());
+  header.WriteString(rvsdgModule.DataLayout());
+  header.WriteVarint(NumTypeTableEntries_);
+
+  header.WriteTo(stream);
+  TypeTable_.WriteTo(stream);
+
+  ByteBuffer numOperations;
+  numOperations.WriteVarint(OperationEntries_.size());
+  numOperations.WriteTo(stream);
+  OperationTable_.WriteTo(stream);
+
+  graph.WriteTo(stream);
+}
+
+uint64_t
+RvsdgBinaryWriter::GetTypeIndex(const rvsdg::Type & type)
+{
+  if (auto it = TypeIndices_.find(&type); it != TypeIndices_.end())
+    return it->second;
+
+  ByteBuffer entry;
+  auto writeTag = [&](TypeTag tag)
+  {
+    entry.WriteByte(static_cast<uint8_t>(tag));
+  };
+
+  // Nested types are added to the table before the entry itself
+  if (auto bitType = dynamic_cast<const rvsdg::bittype *>(&type))
+  {
+    writeTag(TypeTag::Bit);
+    entry.WriteVarint(bitType->nbits());
+  }
+  else if (auto controlType = dynamic_cast<const rvsdg::ControlType *>(&type))
+  {
+    writeTag(TypeTag::Control);
+    entry.WriteVarint(controlType->nalternatives());
+  }
+  else if (rvsdg::is<PointerType>(type))
+  {
+    writeTag(TypeTag::Pointer);
+  }
+  else if (rvsdg::is<IOStateType>(type))
+  {
+    writeTag(TypeTag::IOState);
+  }
+  else if (rvsdg::is<MemoryStateType>(type))
+  {
+    writeTag(TypeTag::MemoryState);
+  }
+  else if (rvsdg::is<VariableArgumentType>(type))
+  {
+    writeTag(TypeTag::VariableArgument);
+  }
+  else if (auto floatingPointType = dynamic_cast<const FloatingPointType *>(&type))
+  {
+    writeTag(TypeTag::FloatingPoint);
+    entry.WriteVarint(static_cast<uint64_t>(floatingPointType->size()));
+  }
+  else if (auto arrayType = dynamic_cast<const ArrayType *>(&type))
+  {
+    auto elementType = GetTypeIndex(arrayType->element_type());
+    writeTag(TypeTag::Array);
+    entry.WriteVarint(elementType);
+    entry.WriteVarint(arrayType->nelements());
+  }
+  else if (auto structType = dynamic_cast<const StructType *>(&type))
+  {
+    auto declaration = GetDeclarationIndex(structType->GetDeclaration());
+    writeTag(TypeTag::Struct);
+    entry.WriteVarint(declaration);
+    entry.WriteByte(structType->IsPacked());
+    entry.WriteString(structType->GetName());
+  }
+  else if (auto vectorType = dynamic_cast<const VectorType *>(&type))
+  {
+    auto elementType = GetTypeIndex(vectorType->type());
+    writeTag(rvsdg::is<FixedVectorType>(type) ? TypeTag::FixedVector : TypeTag::ScalableVector);
+    entry.WriteVarint(elementType);
+    entry.WriteVarint(vectorType->size());
+  }
+  else if (auto functionType = dynamic_cast<const rvsdg::FunctionType *>(&type))
+  {
+    std::vector<uint64_t> arguments, results;
+    for (auto & argumentType : functionType->Arguments())
+      arguments.push_back(GetTypeIndex(*argumentType));
+    for (auto & resultType : functionType->Results())
+      results.push_back(GetTypeIndex(*resultType));
+
+    writeTag(TypeTag::Function);
+    entry.WriteVarint(arguments.size());
+    for (auto argument : arguments)
+      entry.WriteVarint(argument);
+    entry.WriteVarint(results.size());
+    for (auto result : results)
+      entry.WriteVarint(result);
+  }
+  else
+  {
+    throw util::error("Binary RVSDG format does not support type: " + type.debug_string());
+  }
+
+  auto [it, wasInserted] = TypeEntries_.emplace(entry.ToString(), NumTypes_);
+  if (wasInserted)
+  {
+    NumTypes_++;
+    NumTypeTableEntries_++;
+    TypeTable_.Append(entry);
+  }
+
+  TypeIndices_[&type] = it->second;
+  return it->second;
+}
+
+uint64_t
+RvsdgBinaryWriter::GetDeclarationIndex(const StructType::Declaration & declaration)
+{
+  if (auto it = DeclarationIndices_.find(&declaration); it != DeclarationIndices_.end())
+    return it->second;
+
+  std::vector<uint64_t> elements;
+  for (size_t n = 0; n < declaration.NumElements(); n++)
+    elements.push_back(GetTypeIndex(declaration.GetElement(n)));
+
+  TypeTable_.WriteByte(static_cast<uint8_t>(TypeTag::StructDeclaration));
+  TypeTable_.WriteVarint(elements.size());
+  for (auto element : elements)
+    TypeTable_.WriteVarint(element);
+  NumTypeTableEntries_++;
+
+  auto index = DeclarationIndices_.size();
+  DeclarationIndices_[&declaration] = index;
+  return index;
+}
+
+uint64_t
+RvsdgBinaryWriter::GetOperationIndex(const rvsdg::SimpleOperation & operation)
+{
+  static auto opcodes = []()
+  {
+    std::unordered_map<std::type_index, uint64_t> opcodes;
+    auto & codecs = GetOperationCodecs();
+    for (size_t n = 0; n < codecs.size(); n++)
+      opcodes.emplace(codecs[n].Type, n);
+    return opcodes;
+  }();
+
+  auto opcode = opcodes.find(typeid(operation));
+  if (opcode == opcodes.end())
+    throw util::error(
+        "Binary RVSDG format does not support operation: " + operation.debug_string());
+
+  ByteBuffer entry;
+  entry.WriteVarint(opcode->second);
+  GetOperationCodecs()[opcode->second].Write(*this, operation, entry);
+
+  auto [it, wasInserted] = OperationEntries_.emplace(entry.ToString(), OperationEntries_.size());
+  if (wasInserted)
+    OperationTable_.Append(entry);
+
+  return it->second;
+}
+
+void
+RvsdgBinaryWriter::WriteAttributes(const attributeset & attributes, ByteBuffer & buffer)
+{
+  // The attributes are sorted to render the encoding independent of the hash set order
+  std::vector<uint64_t> enumAttributes;
+  for (auto & attribute : attributes.EnumAttributes())
+    enumAttributes.push_back(static_cast<uint64_t>(attribute.kind()));
+  std::sort(enumAttributes.begin(), enumAttributes.end());
+
+  std::vector<std::pair<uint64_t, uint64_t>> intAttributes;
+  for (auto & attribute : attributes.IntAttributes())
+    intAttributes.emplace_back(static_cast<uint64_t>(attribute.kind()), attribute.value());
+  std::sort(intAttributes.begin(), intAttributes.end());
+
+  std::vector<std::pair<uint64_t, uint64_t>> typeAttributes;
+  for (auto & attribute : attributes.TypeAttributes())
+    typeAttributes.emplace_back(
+        static_cast<uint64_t>(attribute.kind()),
+        GetTypeIndex(attribute.type()));
+  std::sort(typeAttributes.begin(), typeAttributes.end());
+
+  std::vector<std::pair<std::string, std::string>> stringAttributes;
+  for (auto & attribute : attributes.StringAttributes())
+    stringAttributes.emplace_back(attribute.kind(), attribute.value());
+  std::sort(stringAttributes.begin(), stringAttributes.end());
+
+  buffer.WriteVarint(enumAttributes.size());
+  for (auto kind : enumAttributes)
+    buffer.WriteVarint(kind);
+
+  buffer.WriteVarint(intAttributes.size());
+  for (auto & [kind, value] : intAttributes)
+  {
+    buffer.WriteVarint(kind);
+    buffer.WriteVarint(value);
+  }
+
+  buffer.WriteVarint(typeAttributes.size());
+  for (auto & [kind, type] : typeAttributes)
+  {
+    buffer.WriteVarint(kind);
+    buffer.WriteVarint(type);
+  }
+
+  buffer.WriteVarint(stringAttributes.size());
+  for (auto & [kind, value] : stringAttributes)
+  {
+    buffer.WriteString(kind);
+    buffer.WriteString(value);
+  }
+}
+
+void
+RvsdgBinaryWriter::WriteRootRegion(const rvsdg::Region & region, ByteBuffer & buffer)
+{
+  OutputNumbering numbering;
+
+  buffer.WriteVarint(region.narguments());
+  for (size_t n = 0; n < region.narguments(); n++)
+  {
+    auto graphImport = dynamic_cast<const GraphImport *>(region.argument(n));
+    if (!graphImport)
+      throw util::error("Binary RVSDG format only supports LLVM graph imports.");
+
+    buffer.WriteString(graphImport->Name());
+    WriteType(*graphImport->ValueType(), buffer);
+    WriteType(*graphImport->ImportedType(), buffer);
+    buffer.WriteVarint(static_cast<uint64_t>(graphImport->Linkage()));
+    numbering.Add(*graphImport);
+  }
+
+  WriteNodes(region, numbering, buffer);
+
+  buffer.WriteVarint(region.nresults());
+  for (size_t n = 0; n < region.nresults(); n++)
+  {
+    auto graphExport = dynamic_cast<const rvsdg::GraphExport *>(region.result(n));
+    if (!graphExport)
+      throw util::error("Binary RVSDG format only supports graph exports.");
+
+    WriteOrigin(*graphExport, numbering, buffer);
+    buffer.WriteString(graphExport->Name());
+  }
+}
+
+void
+RvsdgBinaryWriter::WriteRegion(const rvsdg::Region & region, ByteBuffer & buffer)
+{
+  OutputNumbering numbering;
+
+  buffer.WriteVarint(region.narguments());
+  for (size_t n = 0; n < region.narguments(); n++)
+    numbering.Add(*region.argument(n));
+
+  WriteNodes(region, numbering, buffer);
+
+  buffer.WriteVarint(region.nresults());
+  for (size_t n = 0; n < region.nresults(); n++)
+    WriteOrigin(*region.result(n), numbering, buffer);
+}
+
+void
+RvsdgBinaryWriter::WriteNodes(
+    const rvsdg::Region & region,
+    OutputNumbering & numbering,
+    ByteBuffer & buffer)
+{
+  buffer.WriteVarint(region.nnodes());
+  for (auto node : rvsdg::TopDownConstTraverser(&region))
+  {
+    WriteNode(*node, numbering, buffer);
+    for (size_t n = 0; n < node->noutputs(); n++)
+      numbering.Add(*node->output(n));
+  }
+}
+
+void
+RvsdgBinaryWriter::WriteNode(
+    const rvsdg::Node & node,
+    const OutputNumbering & numbering,
+    ByteBuffer & buffer)
+{
+  auto writeTag = [&](NodeTag tag)
+  {
+    buffer.WriteByte(static_cast<uint8_t>(tag));
+  };
+
+  if (auto simpleNode = dynamic_cast<const rvsdg::SimpleNode *>(&node))
+  {
+    writeTag(NodeTag::Simple);
+    buffer.WriteVarint(GetOperationIndex(simpleNode->GetOperation()));
+    for (size_t n = 0; n < node.ninputs(); n++)
+      WriteOrigin(*node.input(n), numbering, buffer);
+  }
+  else if (auto gammaNode = dynamic_cast<const rvsdg::GammaNode *>(&node))
+  {
+    writeTag(NodeTag::Gamma);
+    WriteOrigin(*gammaNode->predicate(), numbering, buffer);
+    buffer.WriteVarint(gammaNode->nsubregions());
+    buffer.WriteVarint(gammaNode->ninputs() - 1);
+    for (size_t n = 1; n < gammaNode->ninputs(); n++)
+      WriteOrigin(*gammaNode->input(n), numbering, buffer);
+
+    for (size_t n = 0; n < gammaNode->nsubregions(); n++)
+      WriteRegion(*gammaNode->subregion(n), buffer);
+  }
+  else if (auto thetaNode = dynamic_cast<const rvsdg::ThetaNode *>(&node))
+  {
+    writeTag(NodeTag::Theta);
+    buffer.WriteVarint(thetaNode->ninputs());
+    for (size_t n = 0; n < thetaNode->ninputs(); n++)
+      WriteOrigin(*thetaNode->input(n), numbering, buffer);
+
+    WriteRegion(*thetaNode->subregion(), buffer);
+  }
+  else if (auto lambdaNode = dynamic_cast<const rvsdg::LambdaNode *>(&node))
+  {
+    auto operation = dynamic_cast<const LlvmLambdaOperation *>(&lambdaNode->GetOperation());
+    if (!operation)
+      throw util::error("Binary RVSDG format only supports LLVM lambda nodes.");
+
+    writeTag(NodeTag::Lambda);
+    WriteType(operation->type(), buffer);
+    buffer.WriteString(operation->name());
+    buffer.WriteVarint(static_cast<uint64_t>(operation->linkage()));
+    WriteAttributes(operation->attributes(), buffer);
+    for (size_t n = 0; n < operation->type().NumArguments(); n++)
+      WriteAttributes(operation->GetArgumentAttributes(n), buffer);
+
+    buffer.WriteVarint(lambdaNode->ninputs());
+    for (size_t n = 0; n < lambdaNode->ninputs(); n++)
+      WriteOrigin(*lambdaNode->input(n), numbering, buffer);
+
+    WriteRegion(*lambdaNode->subregion(), buffer);
+  }
+  else if (auto deltaNode = dynamic_cast<const delta::node *>(&node))
+  {
+    writeTag(NodeTag::Delta);
+    WriteType(deltaNode->type(), buffer);
+    buffer.WriteString(deltaNode->name());
+    buffer.WriteVarint(static_cast<uint64_t>(deltaNode->linkage()));
+    buffer.WriteString(deltaNode->Section());
+    buffer.WriteByte(deltaNode->constant());
+
+    buffer.WriteVarint(deltaNode->ninputs());
+    for (size_t n = 0; n < deltaNode->ninputs(); n++)
+      WriteOrigin(*deltaNode->input(n), numbering, buffer);
+
+    WriteRegion(*deltaNode->subregion(), buffer);
+  }
+  else if (auto phiNode = dynamic_cast<const phi::node *>(&node))
+  {
+    // The region arguments of recursion and context variables can be interleaved, so the kind of
+    // every argument is recorded to recreate them in the same order.
+    writeTag(NodeTag::Phi);
+    auto subregion = phiNode->subregion();
+    buffer.WriteVarint(subregion->narguments());
+    for (size_t n = 0; n < subregion->narguments(); n++)
+    {
+      auto argument = subregion->argument(n);
+      if (auto recursionArgument = dynamic_cast<const phi::rvargument *>(argument))
+      {
+        buffer.WriteByte(0);
+        WriteType(*argument->Type(), buffer);
+        buffer.WriteVarint(recursionArgument->result()->index());
+      }
+      else
+      {
+        buffer.WriteByte(1);
+        WriteOrigin(*argument->input(), numbering, buffer);
+      }
+    }
+
+    WriteRegion(*subregion, buffer);
+  }
+  else
+  {
+    throw util::error(
+        "Binary RVSDG format does not support node: " + node.GetOperation().debug_string());
+  }
+}
+
+std::unique_ptr<RvsdgModule>
+RvsdgBinaryReader::Read()
+{
+  char magic[sizeof(FormatMagic)];
+  Reader_.ReadBytes(magic, sizeof(magic));
+  if (memcmp(magic, FormatMagic, sizeof(magic)) != 0)
+    throw util::error("Not a binary RVSDG.");
+
+  auto version = ReadVarint();
+  if (version != RvsdgBinaryFormatVersion)
+    throw util::error(util::strfmt("Unsupported binary RVSDG version: ", version));
+
+  auto sourceFileName = ReadString();
+  auto targetTriple = ReadString();
+  auto dataLayout = ReadString();
+  auto rvsdgModule =
+      RvsdgModule::Create(util::filepath(sourceFileName), targetTriple, dataLayout);
+
+  auto numTypeTableEntries = ReadVarint();
+  for (uint64_t n = 0; n < numTypeTableEntries; n++)
+    ReadTypeTableEntry(*rvsdgModule);
+
+  auto numOperations = ReadVarint();
+  for (uint64_t n = 0; n < numOperations; n++)
+    ReadOperation();
+
+  ReadRootRegion(rvsdgModule->Rvsdg());
+
+  if (!Reader_.AtEnd())
+    throw util::error("Trailing bytes after binary RVSDG.");
+
+  return rvsdgModule;
+}
+
+void
+RvsdgBinaryReader::ReadTypeTableEntry(RvsdgModule & rvsdgModule)
+{
+  auto tag = static_cast<TypeTag>(ReadByte());
+  switch (tag)
+  {
+  case TypeTag::Bit:
+    Types_.push_back(rvsdg::bittype::Create(ReadVarint()));
+    break;
+  case TypeTag::Control:
+    Types_.push_back(rvsdg::ControlType::Create(ReadVarint()));
+    break;
+  case TypeTag::Pointer:
+    Types_.push_back(PointerType::Create());
+    break;
+  case TypeTag::IOState:
+    Types_.push_back(IOStateType::Create());
+    break;
+  case TypeTag::MemoryState:
+    Types_.push_back(MemoryStateType::Create());
+    break;
+  case TypeTag::VariableArgument:
+    Types_.push_back(VariableArgumentType::Create());
+    break;
+  case TypeTag::FloatingPoint:
+  {
+    auto size = ReadVarint();
+    if (size > static_cast<uint64_t>(fpsize::fp128))
+      throw util::error("Invalid floating point size in binary RVSDG.");
+    Types_.push_back(FloatingPointType::Create(static_cast<fpsize>(size)));
+    break;
+  }
+  case TypeTag::Array:
+  {
+    auto elementType = ReadType<rvsdg::ValueType>();
+    Types_.push_back(ArrayType::Create(std::move(elementType), ReadVarint()));
+    break;
+  }
+  case TypeTag::Struct:
+  {
+    auto index = ReadVarint();
+    if (index >= Declarations_.size())
+      throw util::error("Invalid struct declaration index in binary RVSDG.");
+    auto isPacked = ReadByte() != 0;
+    auto name = ReadString();
+    Types_.push_back(
+        name.empty() ? StructType::Create(isPacked, *Declarations_[index])
+                     : StructType::Create(name, isPacked, *Declarations_[index]));
+    break;
+  }
+  case TypeTag::FixedVector:
+  {
+    auto elementType = ReadType<rvsdg::ValueType>();
+    Types_.push_back(FixedVectorType::Create(std::move(elementType), ReadVarint()));
+    break;
+  }
+  case TypeTag::ScalableVector:
+  {
+    auto elementType = ReadType<rvsdg::ValueType>();
+    Types_.push_back(ScalableVectorType::Create(std::move(elementType), ReadVarint()));
+    break;
+  }
+  case TypeTag::Function:
+  {
+    std::vector<std::shared_ptr<const rvsdg::Type>> arguments(ReadVarint());
+    for (auto & argument : arguments)
+      argument = ReadType();
+    std::vector<std::shared_ptr<const rvsdg::Type>> results(ReadVarint());
+    for (auto & result : results)
+      result = ReadType();
+    Types_.push_back(rvsdg::FunctionType::Create(std::move(arguments), std::move(results)));
+    break;
+  }
+  case TypeTag::StructDeclaration:
+  {
+    auto declaration = StructType::Declaration::Create();
+    auto numElements = ReadVarint();
+    for (uint64_t n = 0; n < numElements; n++)
+      declaration->Append(ReadType<rvsdg::ValueType>());
+    Declarations_.push_back(&rvsdgModule.AddStructTypeDeclaration(std::move(declaration)));
+    break;
+  }
+  default:
+    throw util::error("Invalid type tag in binary RVSDG.");
+  }
+}
+
+void
+RvsdgBinaryReader::ReadOperation()
+{
+  auto & codecs = GetOperationCodecs();
+  auto opcode = ReadVarint();
+  if (opcode >= codecs.size())
+    throw util::error("Invalid opcode in binary RVSDG.");
+
+  Operations_.push_back(codecs[opcode].Read(*this));
+}
+
+attributeset
+RvsdgBinaryReader::ReadAttributes()
+{
+  auto readKind = [&]()
+  {
+    auto kind = ReadVarint();
+    if (kind >= static_cast<uint64_t>(attribute::kind::EndAttrKinds))
+      throw util::error("Invalid attribute kind in binary RVSDG.");
+    return static_cast<attribute::kind>(kind);
+  };
+
+  attributeset attributes;
+
+  auto numEnumAttributes = ReadVarint();
+  for (uint64_t n = 0; n < numEnumAttributes; n++)
+    attributes.InsertEnumAttribute(enum_attribute(readKind()));
+
+  auto numIntAttributes = ReadVarint();
+  for (uint64_t n = 0; n < numIntAttributes; n++)
+  {
+    auto kind = readKind();
+    attributes.InsertIntAttribute(int_attribute(kind, ReadVarint()));
+  }
+
+  auto numTypeAttributes = ReadVarint();
+  for (uint64_t n = 0; n < numTypeAttributes; n++)
+  {
+    auto kind = readKind();
+    attributes.InsertTypeAttribute(type_attribute(kind, ReadType<rvsdg::ValueType>()));
+  }
+
+  auto numStringAttributes = ReadVarint();
+  for (uint64_t n = 0; n < numStringAttributes; n++)
+  {
+    auto kind = ReadString();
+    attributes.InsertStringAttribute(string_attribute(kind, ReadString()));
+  }
+
+  return attributes;
+}
+
+void
+RvsdgBinaryReader::ReadRootRegion(rvsdg::Graph & graph)
+{
+  OriginTable origins;
+
+  auto numImports = ReadVarint();
+  for (uint64_t n = 0; n < numImports; n++)
+  {
+    auto name = ReadString();
+    auto valueType = ReadType<rvsdg::ValueType>();
+    auto importedType = ReadType<rvsdg::ValueType>();
+    auto linkage = ReadLinkage();
+    origins.Add(GraphImport::Create(graph, valueType, importedType, name, linkage));
+  }
+
+  ReadNodes(graph.GetRootRegion(), origins);
+
+  auto numExports = ReadVarint();
+  for (uint64_t n = 0; n < numExports; n++)
+  {
+    auto & origin = ReadOrigin(origins);
+    GraphExport::Create(origin, ReadString());
+  }
+}
+
+std::vector<rvsdg::output *>
+RvsdgBinaryReader::ReadRegion(rvsdg::Region & region)
+{
+  OriginTable origins;
+
+  if (ReadVarint() != region.narguments())
+    throw util::error("Unexpected number of region arguments in binary RVSDG.");
+  for (size_t n = 0; n < region.narguments(); n++)
+    origins.Add(*region.argument(n));
+
+  ReadNodes(region, origins);
+
+  std::vector<rvsdg::output *> results(ReadVarint());
+  for (auto & result : results)
+    result = &ReadOrigin(origins);
+
+  return results;
+}
+
+void
+RvsdgBinaryReader::ReadNodes(rvsdg::Region & region, OriginTable & origins)
+{
+  auto numNodes = ReadVarint();
+  for (uint64_t n = 0; n < numNodes; n++)
+  {
+    auto & node = ReadNode(region, origins);
+    for (size_t i = 0; i < node.noutputs(); i++)
+      origins.Add(*node.output(i));
+  }
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  auto tag = static_cast<NodeTag>(ReadByte());
+  switch (tag)
+  {
+  case NodeTag::Simple:
+    return ReadSimpleNode(region, origins);
+  case NodeTag::Gamma:
+    return ReadGammaNode(origins);
+  case NodeTag::Theta:
+    return ReadThetaNode(region, origins);
+  case NodeTag::Lambda:
+    return ReadLambdaNode(region, origins);
+  case NodeTag::Delta:
+    return ReadDeltaNode(region, origins);
+  case NodeTag::Phi:
+    return ReadPhiNode(region, origins);
+  default:
+    throw util::error("Invalid node tag in binary RVSDG.");
+  }
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadSimpleNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  auto index = ReadVarint();
+  if (index >= Operations_.size())
+    throw util::error("Invalid operation index in binary RVSDG.");
+  auto & operation = *Operations_[index];
+
+  std::vector<rvsdg::output *> operands(operation.narguments());
+  for (size_t n = 0; n < operands.size(); n++)
+  {
+    operands[n] = &ReadOrigin(origins);
+    if (*operands[n]->Type() != *operation.argument(n))
+      throw util::error("Operand type mismatch in binary RVSDG.");
+  }
+
+  // Some operations are represented by dedicated node classes
+  if (auto loadOperation = dynamic_cast<const LoadNonVolatileOperation *>(&operation))
+    return LoadNonVolatileNode::CreateNode(
+        region,
+        std::make_unique<LoadNonVolatileOperation>(*loadOperation),
+        operands);
+  if (auto loadOperation = dynamic_cast<const LoadVolatileOperation *>(&operation))
+    return LoadVolatileNode::CreateNode(
+        region,
+        std::make_unique<LoadVolatileOperation>(*loadOperation),
+        operands);
+  if (auto storeOperation = dynamic_cast<const StoreNonVolatileOperation *>(&operation))
+    return StoreNonVolatileNode::CreateNode(
+        region,
+        std::make_unique<StoreNonVolatileOperation>(*storeOperation),
+        operands);
+  if (auto storeOperation = dynamic_cast<const StoreVolatileOperation *>(&operation))
+    return StoreVolatileNode::CreateNode(
+        region,
+        std::make_unique<StoreVolatileOperation>(*storeOperation),
+        operands);
+  if (auto callOperation = dynamic_cast<const CallOperation *>(&operation))
+    return CallNode::CreateNode(region, std::make_unique<CallOperation>(*callOperation), operands);
+
+  return rvsdg::SimpleNode::Create(region, operation, operands);
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadGammaNode(const OriginTable & origins)
+{
+  auto & predicate = ReadOrigin(origins);
+  auto numSubregions = ReadVarint();
+  auto controlType = dynamic_cast<const rvsdg::ControlType *>(predicate.Type().get());
+  if (!controlType || controlType->nalternatives() != numSubregions)
+    throw util::error("Invalid gamma predicate in binary RVSDG.");
+
+  auto gammaNode = rvsdg::GammaNode::create(&predicate, numSubregions);
+
+  auto numEntryVars = ReadVarint();
+  for (uint64_t n = 0; n < numEntryVars; n++)
+    gammaNode->AddEntryVar(&ReadOrigin(origins));
+
+  std::vector<std::vector<rvsdg::output *>> results;
+  for (size_t n = 0; n < gammaNode->nsubregions(); n++)
+  {
+    results.push_back(ReadRegion(*gammaNode->subregion(n)));
+    if (results.back().size() != results.front().size())
+      throw util::error("Unexpected number of gamma exit variables in binary RVSDG.");
+  }
+
+  for (size_t n = 0; n < results.front().size(); n++)
+  {
+    std::vector<rvsdg::output *> values;
+    for (auto & subregionResults : results)
+      values.push_back(subregionResults[n]);
+    gammaNode->AddExitVar(std::move(values));
+  }
+
+  return *gammaNode;
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadThetaNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  auto thetaNode = rvsdg::ThetaNode::create(&region);
+
+  auto numLoopVars = ReadVarint();
+  for (uint64_t n = 0; n < numLoopVars; n++)
+    thetaNode->AddLoopVar(&ReadOrigin(origins));
+
+  auto results = ReadRegion(*thetaNode->subregion());
+  if (results.size() != numLoopVars + 1)
+    throw util::error("Unexpected number of theta results in binary RVSDG.");
+
+  thetaNode->set_predicate(results[0]);
+  auto loopVars = thetaNode->GetLoopVars();
+  for (size_t n = 0; n < loopVars.size(); n++)
+    loopVars[n].post->divert_to(results[n + 1]);
+
+  return *thetaNode;
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadLambdaNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  auto functionType = ReadType<rvsdg::FunctionType>();
+  auto name = ReadString();
+  auto linkage = ReadLinkage();
+  auto attributes = ReadAttributes();
+  auto operation = LlvmLambdaOperation::Create(functionType, name, linkage, attributes);
+  for (size_t n = 0; n < functionType->NumArguments(); n++)
+    operation->SetArgumentAttributes(n, ReadAttributes());
+
+  auto lambdaNode = rvsdg::LambdaNode::Create(region, std::move(operation));
+
+  auto numContextVars = ReadVarint();
+  for (uint64_t n = 0; n < numContextVars; n++)
+    lambdaNode->AddContextVar(ReadOrigin(origins));
+
+  auto results = ReadRegion(*lambdaNode->subregion());
+  if (results.size() != functionType->NumResults())
+    throw util::error("Unexpected number of lambda results in binary RVSDG.");
+
+  lambdaNode->finalize(results);
+  return *lambdaNode;
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadDeltaNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  auto type = ReadType<rvsdg::ValueType>();
+  auto name = ReadString();
+  auto linkage = ReadLinkage();
+  auto section = ReadString();
+  auto constant = ReadByte() != 0;
+  auto deltaNode = delta::node::Create(&region, type, name, linkage, section, constant);
+
+  auto numContextVars = ReadVarint();
+  for (uint64_t n = 0; n < numContextVars; n++)
+    deltaNode->add_ctxvar(&ReadOrigin(origins));
+
+  auto results = ReadRegion(*deltaNode->subregion());
+  if (results.size() != 1)
+    throw util::error("Unexpected number of delta results in binary RVSDG.");
+
+  deltaNode->finalize(results[0]);
+  return *deltaNode;
+}
+
+rvsdg::Node &
+RvsdgBinaryReader::ReadPhiNode(rvsdg::Region & region, const OriginTable & origins)
+{
+  phi::builder builder;
+  builder.begin(&region);
+
+  std::vector<std::pair<phi::rvoutput *, uint64_t>> recursionVars;
+  auto numArguments = ReadVarint();
+  for (uint64_t n = 0; n < numArguments; n++)
+  {
+    if (ReadByte() == 0)
+    {
+      auto output = builder.add_recvar(ReadType());
+      recursionVars.emplace_back(output, ReadVarint());
+    }
+    else
+    {
+      builder.add_ctxvar(&ReadOrigin(origins));
+    }
+  }
+
+  auto results = ReadRegion(*builder.subregion());
+  if (results.size() != recursionVars.size())
+    throw util::error("Unexpected number of phi results in binary RVSDG.");
+
+  for (auto & [output, resultIndex] : recursionVars)
+  {
+    if (resultIndex >= results.size())
+      throw util::error("Invalid phi result index in binary RVSDG.");
+    output->set_rvorigin(results[resultIndex]);
+  }
+
+  return *builder.end();
+}
+
+/**
+ * Codec for operations that are fully determined by the bit width of their first operand.
+ */
+template<typename TOperation>
+OperationCodec
+CreateBitWidthCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter &, const rvsdg::SimpleOperation & operation, ByteBuffer & buffer)
+           {
+             buffer.WriteVarint(
+                 std::static_pointer_cast<const rvsdg::bittype>(operation.argument(0))->nbits());
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             return std::make_unique<TOperation>(reader.ReadVarint());
+           } };
+}
+
+/**
+ * Codec for unary operations that are fully determined by their operand and result type.
+ */
+template<typename TOperation>
+OperationCodec
+CreateConversionCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter & writer,
+              const rvsdg::SimpleOperation & operation,
+              ByteBuffer & buffer)
+           {
+             writer.WriteType(*operation.argument(0), buffer);
+             writer.WriteType(*operation.result(0), buffer);
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             auto operandType = reader.ReadType();
+             auto resultType = reader.ReadType();
+             return std::make_unique<TOperation>(operandType, resultType);
+           } };
+}
+
+/**
+ * Codec for operations that are fully determined by their (first) result type.
+ */
+template<typename TOperation, typename TType>
+OperationCodec
+CreateResultTypeCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter & writer,
+              const rvsdg::SimpleOperation & operation,
+              ByteBuffer & buffer)
+           {
+             writer.WriteType(*operation.result(0), buffer);
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             return std::make_unique<TOperation>(reader.ReadType<TType>());
+           } };
+}
+
+/**
+ * Codec for memory state operations that are fully determined by their number of operands.
+ */
+template<typename TOperation>
+OperationCodec
+CreateMemoryStateMergeCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter &, const rvsdg::SimpleOperation & operation, ByteBuffer & buffer)
+           {
+             buffer.WriteVarint(operation.narguments());
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             return std::make_unique<TOperation>(reader.ReadVarint());
+           } };
+}
+
+/**
+ * Codec for memory state operations that are fully determined by their number of results.
+ */
+template<typename TOperation>
+OperationCodec
+CreateMemoryStateSplitCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter &, const rvsdg::SimpleOperation & operation, ByteBuffer & buffer)
+           {
+             buffer.WriteVarint(operation.nresults());
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             return std::make_unique<TOperation>(reader.ReadVarint());
+           } };
+}
+
+/**
+ * Codec for load and store operations.
+ */
+template<typename TOperation>
+OperationCodec
+CreateMemoryAccessCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter & writer,
+              const rvsdg::SimpleOperation & operation,
+              ByteBuffer & buffer)
+           {
+             auto & accessOperation = *util::AssertedCast<const TOperation>(&operation);
+             if constexpr (std::is_base_of_v<LoadOperation, TOperation>)
+               writer.WriteType(*accessOperation.GetLoadedType(), buffer);
+             else
+               writer.WriteType(accessOperation.GetStoredType(), buffer);
+             buffer.WriteVarint(accessOperation.NumMemoryStates());
+             buffer.WriteVarint(accessOperation.GetAlignment());
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             auto type = reader.ReadType<rvsdg::ValueType>();
+             auto numMemoryStates = reader.ReadVarint();
+             return std::make_unique<TOperation>(type, numMemoryStates, reader.ReadVarint());
+           } };
+}
+
+template<typename TOperation>
+OperationCodec
+CreateMemCpyCodec()
+{
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter & writer,
+              const rvsdg::SimpleOperation & operation,
+              ByteBuffer & buffer)
+           {
+             auto & memCpyOperation = *util::AssertedCast<const TOperation>(&operation);
+             writer.WriteType(memCpyOperation.LengthType(), buffer);
+             buffer.WriteVarint(memCpyOperation.NumMemoryStates());
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             auto lengthType = reader.ReadType();
+             return std::make_unique<TOperation>(lengthType, reader.ReadVarint());
+           } };
+}
+
+template<typename TOperation>
+OperationCodec
+CreateFunctionTypeCodec(
+    const std::shared_ptr<const rvsdg::FunctionType> & (TOperation::*getFunctionType)()
+        const noexcept)
+{
+  // The member function pointer cannot be captured by the codec functions, so the function type
+  // is retrieved through a static
+  static auto functionTypeGetter = getFunctionType;
+  return { typeid(TOperation),
+           [](RvsdgBinaryWriter & writer,
+              const rvsdg::SimpleOperation & operation,
+              ByteBuffer & buffer)
+           {
+             auto & typedOperation = *util::AssertedCast<const TOperation>(&operation);
+             writer.WriteType(*(typedOperation.*functionTypeGetter)(), buffer);
+           },
+           [](RvsdgBinaryReader & reader) -> std::unique_ptr<rvsdg::SimpleOperation>
+           {
+             return std::make_unique<TOperation>(reader.ReadType<rvsdg::FunctionType>());
+           } };
+}
+
+template<typename TOperation>
+const TOperation &
+CastOperation(const rvsdg::SimpleOperation & operation)
+{
+  return *util::AssertedCast<const TOperation>(&operation);
+}
+
+const ::llvm::fltSemantics &
+GetFloatingPointSemantics(fpsize size)
+{
+  switch (size)
+  {
+  case fpsize::half:
+    return ::llvm::APFloat::IEEEhalf();
+  case fpsize::flt:
+    return ::llvm::APFloat::IEEEsingle();
+  case fpsize::dbl:
+    return ::llvm::APFloat::IEEEdouble();
+  case fpsize::x86fp80:
+    return ::llvm::APFloat::x87DoubleExtended();
+  case fpsize::fp128:
+    return ::llvm::APFloat::IEEEquad();
+  default:
+    JLM_UNREACHABLE("Unhandled floating point size.");
+  }
+}
+
+std::vector<OperationCodec>
+CreateOperationCodecs()
+{
+  using namespace rvsdg;
+
+  // The position of a codec in this list is its opcode. New codecs must only be appended.
+  return {
+    CreateBitWidthCodec<bitneg_op>(),
+    CreateBitWidthCodec<bitnot_op>(),
+    CreateBitWidthCodec<bitadd_op>(),
+    CreateBitWidthCodec<bitand_op>(),
+    CreateBitWidthCodec<bitashr_op>(),
+    CreateBitWidthCodec<bitmul_op>(),
+    CreateBitWidthCodec<bitor_op>(),
+    CreateBitWidthCodec<bitsdiv_op>(),
+    CreateBitWidthCodec<bitshl_op>(),
+    CreateBitWidthCodec<bitshr_op>(),
+    CreateBitWidthCodec<bitsmod_op>(),
+    CreateBitWidthCodec<bitsmulh_op>(),
+    CreateBitWidthCodec<bitsub_op>(),
+    CreateBitWidthCodec<bitudiv_op>(),
+    CreateBitWidthCodec<bitumod_op>(),
+    CreateBitWidthCodec<bitumulh_op>(),
+    CreateBitWidthCodec<bitxor_op>(),
+    CreateBitWidthCodec<biteq_op>(),
+    CreateBitWidthCodec<bitne_op>(),
+    CreateBitWidthCodec<bitsge_op>(),
+    CreateBitWidthCodec<bitsgt_op>(),
+    CreateBitWidthCodec<bitsle_op>(),
+    CreateBitWidthCodec<bitslt_op>(),
+    CreateBitWidthCodec<bituge_op>(),
+    CreateBitWidthCodec<bitugt_op>(),
+    CreateBitWidthCodec<bitule_op>(),
+    CreateBitWidthCodec<bitult_op>(),
+    CreateBitWidthCodec<IntegerAddOperation>(),
+    CreateBitWidthCodec<IntegerSubOperation>(),
+    CreateBitWidthCodec<IntegerMulOperation>(),
+    CreateBitWidthCodec<IntegerSDivOperation>(),
+    CreateBitWidthCodec<IntegerUDivOperation>(),
+    CreateBitWidthCodec<IntegerSRemOperation>(),
+    CreateBitWidthCodec<IntegerURemOperation>(),
+    CreateBitWidthCodec<IntegerAShrOperation>(),
+    CreateBitWidthCodec<IntegerShlOperation>(),
+    CreateBitWidthCodec<IntegerLShrOperation>(),
+    CreateBitWidthCodec<IntegerAndOperation>(),
+    CreateBitWidthCodec<IntegerOrOperation>(),
+    CreateBitWidthCodec<IntegerXorOperation>(),
+    CreateConversionCodec<zext_op>(),
+    CreateConversionCodec<sext_op>(),
+    CreateConversionCodec<trunc_op>(),
+    CreateConversionCodec<fpext_op>(),
+    CreateConversionCodec<fptrunc_op>(),
+    CreateConversionCodec<sitofp_op>(),
+    CreateConversionCodec<uitofp_op>(),
+    CreateConversionCodec<fp2si_op>(),
+    CreateConversionCodec<fp2ui_op>(),
+    CreateConversionCodec<bits2ptr_op>(),
+    CreateConversionCodec<ptr2bits_op>(),
+    CreateConversionCodec<bitcast_op>(),
+    CreateResultTypeCodec<UndefValueOperation, Type>(),
+    CreateResultTypeCodec<PoisonValueOperation, ValueType>(),
+    CreateResultTypeCodec<ConstantPointerNullOperation, PointerType>(),
+    CreateResultTypeCodec<ConstantAggregateZero, Type>(),
+    CreateResultTypeCodec<ConstantStruct, StructType>(),
+    CreateResultTypeCodec<select_op, Type>(),
+    CreateResultTypeCodec<fpneg_op, FloatingPointType>(),
+    CreateResultTypeCodec<IOBarrierOperation, Type>(),
+    CreateMemoryStateMergeCodec<MemoryStateMergeOperation>(),
+    CreateMemoryStateSplitCodec<MemoryStateSplitOperation>(),
+    CreateMemoryStateSplitCodec<LambdaEntryMemoryStateSplitOperation>(),
+    CreateMemoryStateMergeCodec<LambdaExitMemoryStateMergeOperation>(),
+    CreateMemoryStateMergeCodec<CallEntryMemoryStateMergeOperation>(),
+    CreateMemoryStateSplitCodec<CallExitMemoryStateSplitOperation>(),
+    CreateMemoryAccessCodec<LoadNonVolatileOperation>(),
+    CreateMemoryAccessCodec<LoadVolatileOperation>(),
+    CreateMemoryAccessCodec<StoreNonVolatileOperation>(),
+    CreateMemoryAccessCodec<StoreVolatileOperation>(),
+    CreateMemCpyCodec<MemCpyNonVolatileOperation>(),
+    CreateMemCpyCodec<MemCpyVolatileOperation>(),
+    CreateFunctionTypeCodec<CallOperation>(&CallOperation::GetFunctionType),
+    CreateFunctionTypeCodec<FunctionToPointerOperation>(&FunctionToPointerOperation::FunctionType),
+    CreateFunctionTypeCodec<PointerToFunctionOperation>(&PointerToFunctionOperation::FunctionType),
+    { typeid(bitconstant_op),
+      [](RvsdgBinaryWriter &, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        // Known values are written in 64 bit chunks, all others as a string of bits
+        auto & value = CastOperation<bitconstant_op>(operation).value();
+        buffer.WriteVarint(value.nbits());
+        if (value.is_known())
+        {
+          buffer.WriteByte(0);
+          for (size_t low = 0; low < value.nbits(); low += 64)
+            buffer.WriteVarint(value.slice(low, std::min(low + 64, value.nbits())).to_uint());
+        }
+        else
+        {
+          buffer.WriteByte(1);
+          buffer.WriteString(value.str());
+        }
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto numBits = reader.ReadVarint();
+        if (numBits == 0)
+          throw util::error("Invalid bit constant in binary RVSDG.");
+
+        if (reader.ReadByte() == 0)
+        {
+          auto value = bitvalue_repr(std::min<uint64_t>(numBits, 64), reader.ReadVarint());
+          for (size_t low = 64; low < numBits; low += 64)
+          {
+            auto chunk = bitvalue_repr(std::min<uint64_t>(numBits - low, 64), reader.ReadVarint());
+            value = value.concat(chunk);
+          }
+          return std::make_unique<bitconstant_op>(value);
+        }
+
+        auto bits = reader.ReadString();
+        if (bits.size() != numBits)
+          throw util::error("Invalid bit constant in binary RVSDG.");
+        return std::make_unique<bitconstant_op>(bitvalue_repr(bits.c_str()));
+      } },
+    { typeid(ctlconstant_op),
+      [](RvsdgBinaryWriter &, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & value = CastOperation<ctlconstant_op>(operation).value();
+        buffer.WriteVarint(value.nalternatives());
+        buffer.WriteVarint(value.alternative());
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto numAlternatives = reader.ReadVarint();
+        auto alternative = reader.ReadVarint();
+        return std::make_unique<ctlconstant_op>(ctlvalue_repr(alternative, numAlternatives));
+      } },
+    { typeid(match_op),
+      [](RvsdgBinaryWriter &, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & matchOperation = CastOperation<match_op>(operation);
+        std::vector<std::pair<uint64_t, uint64_t>> mapping(
+            matchOperation.begin(),
+            matchOperation.end());
+        std::sort(mapping.begin(), mapping.end());
+
+        buffer.WriteVarint(matchOperation.nbits());
+        buffer.WriteVarint(matchOperation.nalternatives());
+        buffer.WriteVarint(matchOperation.default_alternative());
+        buffer.WriteVarint(mapping.size());
+        for (auto & [value, alternative] : mapping)
+        {
+          buffer.WriteVarint(value);
+          buffer.WriteVarint(alternative);
+        }
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto numBits = reader.ReadVarint();
+        auto numAlternatives = reader.ReadVarint();
+        auto defaultAlternative = reader.ReadVarint();
+        std::unordered_map<uint64_t, uint64_t> mapping;
+        auto numMappings = reader.ReadVarint();
+        for (uint64_t n = 0; n < numMappings; n++)
+        {
+          auto value = reader.ReadVarint();
+          mapping[value] = reader.ReadVarint();
+        }
+        return std::make_unique<match_op>(numBits, mapping, defaultAlternative, numAlternatives);
+      } },
+    { typeid(bitslice_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & sliceOperation = CastOperation<bitslice_op>(operation);
+        writer.WriteType(*sliceOperation.argument(0), buffer);
+        buffer.WriteVarint(sliceOperation.low());
+        buffer.WriteVarint(sliceOperation.high());
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto type = reader.ReadType<bittype>();
+        auto low = reader.ReadVarint();
+        auto high = reader.ReadVarint();
+        if (low >= high || high > type->nbits())
+          throw util::error("Invalid bit slice in binary RVSDG.");
+        return std::make_unique<bitslice_op>(type, low, high);
+      } },
+    { typeid(bitconcat_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        buffer.WriteVarint(operation.narguments());
+        for (size_t n = 0; n < operation.narguments(); n++)
+          writer.WriteType(*operation.argument(n), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        std::vector<std::shared_ptr<const bittype>> types(reader.ReadVarint());
+        for (auto & type : types)
+          type = reader.ReadType<bittype>();
+        return std::make_unique<bitconcat_op>(types);
+      } },
+    { typeid(ConstantFP),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto bits = CastOperation<ConstantFP>(operation).constant().bitcastToAPInt();
+        writer.WriteType(*operation.result(0), buffer);
+        buffer.WriteVarint(bits.getNumWords());
+        for (size_t n = 0; n < bits.getNumWords(); n++)
+          buffer.WriteVarint(bits.getRawData()[n]);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto type = reader.ReadType<FloatingPointType>();
+        std::vector<uint64_t> words(reader.ReadVarint());
+        for (auto & word : words)
+          word = reader.ReadVarint();
+
+        auto & semantics = GetFloatingPointSemantics(type->size());
+        ::llvm::APInt bits(::llvm::APFloat::getSizeInBits(semantics), words);
+        return std::make_unique<ConstantFP>(type, ::llvm::APFloat(semantics, bits));
+      } },
+    { typeid(ConstantDataArray),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & arrayType = *std::static_pointer_cast<const ArrayType>(operation.result(0));
+        writer.WriteType(arrayType.element_type(), buffer);
+        buffer.WriteVarint(arrayType.nelements());
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto elementType = reader.ReadType<ValueType>();
+        return std::make_unique<ConstantDataArray>(elementType, reader.ReadVarint());
+      } },
+    { typeid(ConstantArray),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & arrayType = *std::static_pointer_cast<const ArrayType>(operation.result(0));
+        writer.WriteType(arrayType.element_type(), buffer);
+        buffer.WriteVarint(arrayType.nelements());
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto elementType = reader.ReadType<ValueType>();
+        return std::make_unique<ConstantArray>(elementType, reader.ReadVarint());
+      } },
+    { typeid(fpbin_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        buffer.WriteVarint(static_cast<uint64_t>(CastOperation<fpbin_op>(operation).fpop()));
+        writer.WriteType(*operation.result(0), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto fpop = reader.ReadVarint();
+        if (fpop > static_cast<uint64_t>(llvm::fpop::mod))
+          throw util::error("Invalid floating point operation in binary RVSDG.");
+        auto type = reader.ReadType<FloatingPointType>();
+        return std::make_unique<fpbin_op>(static_cast<llvm::fpop>(fpop), type);
+      } },
+    { typeid(fpcmp_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        buffer.WriteVarint(static_cast<uint64_t>(CastOperation<fpcmp_op>(operation).cmp()));
+        writer.WriteType(*operation.argument(0), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto cmp = reader.ReadVarint();
+        if (cmp > static_cast<uint64_t>(fpcmp::uno))
+          throw util::error("Invalid floating point comparison in binary RVSDG.");
+        auto type = reader.ReadType<FloatingPointType>();
+        return std::make_unique<fpcmp_op>(static_cast<fpcmp>(cmp), type);
+      } },
+    { typeid(ptrcmp_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        buffer.WriteVarint(static_cast<uint64_t>(CastOperation<ptrcmp_op>(operation).cmp()));
+        writer.WriteType(*operation.argument(0), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto cmp = reader.ReadVarint();
+        if (cmp > static_cast<uint64_t>(llvm::cmp::le))
+          throw util::error("Invalid pointer comparison in binary RVSDG.");
+        auto type = reader.ReadType<PointerType>();
+        return std::make_unique<ptrcmp_op>(type, static_cast<llvm::cmp>(cmp));
+      } },
+    { typeid(ExtractValue),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & extractValue = CastOperation<ExtractValue>(operation);
+        writer.WriteType(*operation.argument(0), buffer);
+        buffer.WriteVarint(std::distance(extractValue.begin(), extractValue.end()));
+        for (auto index : extractValue)
+          buffer.WriteVarint(index);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto type = reader.ReadType();
+        std::vector<unsigned> indices(reader.ReadVarint());
+        for (auto & index : indices)
+          index = reader.ReadVarint();
+        return std::make_unique<ExtractValue>(type, indices);
+      } },
+    { typeid(valist_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        buffer.WriteVarint(operation.narguments());
+        for (size_t n = 0; n < operation.narguments(); n++)
+          writer.WriteType(*operation.argument(n), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        std::vector<std::shared_ptr<const Type>> types(reader.ReadVarint());
+        for (auto & type : types)
+          type = reader.ReadType();
+        return std::make_unique<valist_op>(std::move(types));
+      } },
+    { typeid(alloca_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        auto & allocaOperation = CastOperation<alloca_op>(operation);
+        writer.WriteType(allocaOperation.value_type(), buffer);
+        writer.WriteType(allocaOperation.size_type(), buffer);
+        buffer.WriteVarint(allocaOperation.alignment());
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto valueType = reader.ReadType<ValueType>();
+        auto sizeType = reader.ReadType<bittype>();
+        return std::make_unique<alloca_op>(valueType, sizeType, reader.ReadVarint());
+      } },
+    { typeid(malloc_op),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        writer.WriteType(*operation.argument(0), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        return std::make_unique<malloc_op>(reader.ReadType<bittype>());
+      } },
+    { typeid(FreeOperation),
+      [](RvsdgBinaryWriter &, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        // The operands are the address, the memory states, and the I/O state
+        buffer.WriteVarint(operation.narguments() - 2);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        return std::make_unique<FreeOperation>(reader.ReadVarint());
+      } },
+    { typeid(GetElementPtrOperation),
+      [](RvsdgBinaryWriter & writer, const SimpleOperation & operation, ByteBuffer & buffer)
+      {
+        writer.WriteType(CastOperation<GetElementPtrOperation>(operation).GetPointeeType(), buffer);
+        buffer.WriteVarint(operation.narguments() - 1);
+        for (size_t n = 1; n < operation.narguments(); n++)
+          writer.WriteType(*operation.argument(n), buffer);
+      },
+      [](RvsdgBinaryReader & reader) -> std::unique_ptr<SimpleOperation>
+      {
+        auto pointeeType = reader.ReadType<ValueType>();
+        std::vector<std::shared_ptr<const bittype>> offsetTypes(reader.ReadVarint());
+        for (auto & offsetType : offsetTypes)
+          offsetType = reader.ReadType<bittype>();
+        return std::make_unique<GetElementPtrOperation>(offsetTypes, pointeeType);
+      } },
+  };
+}
+
+const std::vector<OperationCodec> &
+GetOperationCodecs()
+{
+  static const std::vector<OperationCodec> codecs = CreateOperationCodecs();
+  return codecs;
+}
+
+}
+
+void
+WriteRvsdgBinary(const RvsdgModule & rvsdgModule, std::ostream & stream)
+{
+  RvsdgBinaryWriter writer;
+  writer.Write(rvsdgModule, stream);
+}
+
+std::unique_ptr<RvsdgModule>
+ReadRvsdgBinary(const uint8_t * data, size_t size)
+{
+  RvsdgBinaryReader reader(data, size);
+  return reader.Read();
+}
+
+std::unique_ptr<RvsdgModule>
+ReadRvsdgBinary(const util::filepath & file)
+{
+  auto fileDescriptor = open(file.to_str().c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+    throw util::error("Cannot open file: " + file.to_str());
+
+  struct stat fileStatus;
+  if (fstat(fileDescriptor, &fileStatus) != 0)
+  {
+    close(fileDescriptor);
+    throw util::error("Cannot read file: " + file.to_str());
+  }
+
+  size_t size = fileStatus.st_size;
+  if (size == 0)
+  {
+    close(fileDescriptor);
+    throw util::error("Not a binary RVSDG: " + file.to_str());
+  }
+
+  auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  close(fileDescriptor);
+  if (data == MAP_FAILED)
+    throw util::error("Cannot map file: " + file.to_str());
+
+  // The encoding is decoded front to back exactly once
+  madvise(data, size, MADV_SEQUENTIAL);
+
+  struct Unmapper
+  {
+    ~Unmapper()
+    {
+      munmap(Data, Size);
+    }
+
+    void * Data;
+    size_t Size;
+  } unmapper{ data, size };
+
+  return ReadRvsdgBinary(static_cast<const uint8_t *>(data), size);
+}
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_IR_RVSDGBINARYFORMAT_HPP
+#define JLM_LLVM_IR_RVSDGBINARYFORMAT_HPP
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+namespace jlm::llvm
+{
+
+/**
+ * Version of the binary RVSDG format written by \ref WriteRvsdgBinary(). Files with a different
+ * version are rejected by \ref ReadRvsdgBinary().
+ */
+static constexpr uint64_t RvsdgBinaryFormatVersion = 1;
+
+/**
+ * Writes \p rvsdgModule to \p stream in the binary RVSDG format.
+ *
+ * The format is a compact, versioned encoding of an RVSDG module intended for caching graphs
+ * between pipeline stages. All integers are LEB128 varints. A file consists of:
+ *
+ * 1. A header with the magic bytes "JLMRVSDG", the format version, and the module's source file
+ * name, target triple, and data layout.
+ * 2. A type table with all interned types and struct type declarations. An entry only refers to
+ * entries that precede it.
+ * 3. An operation table with all interned simple operations. Operations refer to types by their
+ * index in the type table.
+ * 4. The root region, i.e., the graph imports, the nodes of the region, and the graph exports.
+ *
+ * The nodes of a region are written in topological order. An edge is encoded as the distance
+ * from the most recently numbered output of the region to the origin of the edge, where region
+ * arguments are numbered before node outputs. The subregions of a structural node are written
+ * in place after the node's inputs. This permits a reader to reconstruct the module in a single
+ * forward pass over the encoding.
+ *
+ * @param rvsdgModule The module that is written.
+ * @param stream The stream the module is written to.
+ *
+ * @throws util::error if the module contains a node, operation, or type that the binary RVSDG
+ * format does not support.
+ */
+void
+WriteRvsdgBinary(const RvsdgModule & rvsdgModule, std::ostream & stream);
+
+/**
+ * Reads an RVSDG module from the binary RVSDG format in \p data.
+ *
+ * @param data The beginning of the encoded module.
+ * @param size The size of the encoded module in bytes.
+ * @return The decoded RVSDG module.
+ *
+ * @throws util::error if \p data is not a well-formed module of the current format version.
+ *
+ * @see WriteRvsdgBinary()
+ */
+std::unique_ptr<RvsdgModule>
+ReadRvsdgBinary(const uint8_t * data, size_t size);
+
+/**
+ * Reads an RVSDG module from the binary RVSDG format in \p file. The file is mapped into memory
+ * and decoded in a single pass.
+ *
+ * @param file The file containing the encoded module.
+ * @return The decoded RVSDG module.
+ *
+ * @throws util::error if \p file cannot be read or is not a well-formed module of the current
+ * format version.
+ *
+ * @see WriteRvsdgBinary()
+ */
+std::unique_ptr<RvsdgModule>
+ReadRvsdgBinary(const util::filepath & file);
+
+}
+
+#endif
@@ -327,6 +327,12 @@ public:
   [[nodiscard]] StringAttributeRange
   StringAttributes() const;
 
+  [[nodiscard]] bool
+  HasEnumAttribute(attribute::kind kind) const
+  {
+    return EnumAttributes_.Contains(enum_attribute(kind));
+  }
+
   void
   InsertEnumAttribute(const enum_attribute & attribute)
   {
@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/FunctionPointer.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -31,6 +32,14 @@ FunctionToPointerOperation::operator==(const Operation & other) const noexcept
   }
 }
 
+std::size_t
+FunctionToPointerOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(FunctionToPointerOperation).hash_code(),
+      FunctionType()->ComputeHash());
+}
+
 [[nodiscard]] std::string
 FunctionToPointerOperation::debug_string() const
 {
@@ -105,6 +114,14 @@ PointerToFunctionOperation::operator==(const Operation & other) const noexcept
   }
 }
 
+std::size_t
+PointerToFunctionOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(PointerToFunctionOperation).hash_code(),
+      FunctionType()->ComputeHash());
+}
+
 [[nodiscard]] std::string
 PointerToFunctionOperation::debug_string() const
 {
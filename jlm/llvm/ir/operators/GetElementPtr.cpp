@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -32,6 +33,12 @@ GetElementPtrOperation::operator==(const Operation & other) const noexcept
   return true;
 }
 
+std::size_t
+GetElementPtrOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), GetPointeeType().ComputeHash());
+}
+
 std::string
 GetElementPtrOperation::debug_string() const
 {
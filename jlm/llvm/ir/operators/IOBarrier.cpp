@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -17,6 +18,12 @@ IOBarrierOperation::operator==(const Operation & other) const noexcept
   return ioBarrier && ioBarrier->Type() == Type();
 }
 
+std::size_t
+IOBarrierOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(IOBarrierOperation).hash_code(), Type()->ComputeHash());
+}
+
 std::string
 IOBarrierOperation::debug_string() const
 {
@@ -59,6 +59,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   std::string
   debug_string() const override;
 
@@ -10,6 +10,12 @@ namespace jlm::llvm
 
 IntegerBinaryOperation::~IntegerBinaryOperation() = default;
 
+std::size_t
+IntegerBinaryOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 IntegerAddOperation::~IntegerAddOperation() noexcept = default;
 
 bool
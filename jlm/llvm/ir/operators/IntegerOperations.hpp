@@ -29,6 +29,9 @@ public:
   {
     return *util::AssertedCast<const rvsdg::bittype>(argument(0).get());
   }
+
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
 };
 
 /**
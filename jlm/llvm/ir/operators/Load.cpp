@@ -7,6 +7,7 @@
 #include <jlm/llvm/ir/operators/Load.hpp>
 #include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
 #include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/HashSet.hpp>
 
 namespace jlm::llvm
@@ -29,6 +30,12 @@ LoadNonVolatileOperation::operator==(const Operation & other) const noexcept
       && operation->GetAlignment() == GetAlignment();
 }
 
+std::size_t
+LoadNonVolatileOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), GetAlignment());
+}
+
 std::string
 LoadNonVolatileOperation::debug_string() const
 {
@@ -107,6 +114,12 @@ LoadVolatileOperation::operator==(const Operation & other) const noexcept
       && operation->GetAlignment() == GetAlignment();
 }
 
+std::size_t
+LoadVolatileOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), GetAlignment());
+}
+
 std::string
 LoadVolatileOperation::debug_string() const
 {
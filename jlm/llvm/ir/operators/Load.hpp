@@ -101,6 +101,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -300,7 +303,7 @@ public:
       std::unique_ptr<LoadVolatileOperation> loadOperation,
       const std::vector<rvsdg::output *> & operands)
   {
-    return *(new LoadVolatileNode(region, std::move(loadOperation), operands));
+    return *(new (region) LoadVolatileNode(region, std::move(loadOperation), operands));
   }
 
   static LoadVolatileNode &
@@ -354,6 +357,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -469,7 +475,7 @@ public:
       std::unique_ptr<LoadNonVolatileOperation> loadOperation,
       const std::vector<rvsdg::output *> & operands)
   {
-    return *(new LoadNonVolatileNode(region, std::move(loadOperation), operands));
+    return *(new (region) LoadNonVolatileNode(region, std::move(loadOperation), operands));
   }
 };
 
@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/operators/MemCpy.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -18,6 +19,12 @@ MemCpyNonVolatileOperation::operator==(const Operation & other) const noexcept
       && operation->NumMemoryStates() == NumMemoryStates();
 }
 
+std::size_t
+MemCpyNonVolatileOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 MemCpyNonVolatileOperation::debug_string() const
 {
@@ -81,6 +81,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -17,6 +18,12 @@ MemoryStateMergeOperation::operator==(const Operation & other) const noexcept
   return operation && operation->narguments() == narguments();
 }
 
+std::size_t
+MemoryStateMergeOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 MemoryStateMergeOperation::debug_string() const
 {
@@ -38,6 +45,12 @@ MemoryStateSplitOperation::operator==(const Operation & other) const noexcept
   return operation && operation->nresults() == nresults();
 }
 
+std::size_t
+MemoryStateSplitOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 MemoryStateSplitOperation::debug_string() const
 {
@@ -59,6 +72,12 @@ LambdaEntryMemoryStateSplitOperation::operator==(const Operation & other) const
   return operation && operation->nresults() == nresults();
 }
 
+std::size_t
+LambdaEntryMemoryStateSplitOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 LambdaEntryMemoryStateSplitOperation::debug_string() const
 {
@@ -80,6 +99,12 @@ LambdaExitMemoryStateMergeOperation::operator==(const Operation & other) const n
   return operation && operation->narguments() == narguments();
 }
 
+std::size_t
+LambdaExitMemoryStateMergeOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 LambdaExitMemoryStateMergeOperation::debug_string() const
 {
@@ -101,6 +126,12 @@ CallEntryMemoryStateMergeOperation::operator==(const Operation & other) const no
   return operation && operation->narguments() == narguments();
 }
 
+std::size_t
+CallEntryMemoryStateMergeOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 CallEntryMemoryStateMergeOperation::debug_string() const
 {
@@ -122,6 +153,12 @@ CallExitMemoryStateSplitOperation::operator==(const Operation & other) const noe
   return operation && operation->nresults() == nresults();
 }
 
+std::size_t
+CallExitMemoryStateSplitOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 CallExitMemoryStateSplitOperation::debug_string() const
 {
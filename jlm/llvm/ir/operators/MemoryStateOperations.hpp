@@ -44,6 +44,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -88,6 +91,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -126,6 +132,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -162,6 +171,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -201,6 +213,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -240,6 +255,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -307,7 +307,7 @@ private:
   static phi::node *
   create(rvsdg::Region * parent)
   {
-    return new phi::node(parent);
+    return new (*parent) phi::node(parent);
   }
 
 public:
@@ -671,7 +671,7 @@ private:
   static rvargument *
   create(rvsdg::Region * region, std::shared_ptr<const jlm::rvsdg::Type> type)
   {
-    auto argument = new rvargument(region, std::move(type));
+    auto argument = new (*region) rvargument(region, std::move(type));
     region->append_argument(argument);
     return argument;
   }
@@ -730,7 +730,7 @@ private:
   static cvargument *
   create(rvsdg::Region * region, phi::cvinput * input, std::shared_ptr<const rvsdg::Type> type)
   {
-    auto argument = new cvargument(region, input, std::move(type));
+    auto argument = new (*region) cvargument(region, input, std::move(type));
     region->append_argument(argument);
     return argument;
   }
@@ -781,7 +781,7 @@ private:
       rvoutput * output,
       std::shared_ptr<const rvsdg::Type> type)
   {
-    auto result = new rvresult(region, origin, output, type);
+    auto result = new (*region) rvresult(region, origin, output, type);
     region->append_result(result);
     return result;
   }
@@ -869,7 +869,8 @@ inline rvoutput *
 rvoutput::create(phi::node * node, rvargument * argument, std::shared_ptr<const rvsdg::Type> type)
 {
   JLM_ASSERT(argument->type() == *type);
-  auto output = std::unique_ptr<rvoutput>(new rvoutput(node, argument, std::move(type)));
+  auto output =
+      std::unique_ptr<rvoutput>(new (*node->region()) rvoutput(node, argument, std::move(type)));
   return static_cast<rvoutput *>(node->append_output(std::move(output)));
 }
 
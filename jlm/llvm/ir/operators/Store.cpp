@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/operators/alloca.hpp>
 #include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
 #include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/HashSet.hpp>
 
 namespace jlm::llvm
@@ -28,6 +29,12 @@ StoreNonVolatileOperation::operator==(const Operation & other) const noexcept
       && operation->GetAlignment() == GetAlignment();
 }
 
+std::size_t
+StoreNonVolatileOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), GetAlignment());
+}
+
 std::string
 StoreNonVolatileOperation::debug_string() const
 {
@@ -105,6 +112,12 @@ StoreVolatileOperation::operator==(const Operation & other) const noexcept
       && operation->GetAlignment() == GetAlignment();
 }
 
+std::size_t
+StoreVolatileOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), GetAlignment());
+}
+
 std::string
 StoreVolatileOperation::debug_string() const
 {
@@ -93,6 +93,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -310,7 +313,7 @@ public:
       std::unique_ptr<StoreNonVolatileOperation> storeOperation,
       const std::vector<rvsdg::output *> & operands)
   {
-    return *(new StoreNonVolatileNode(region, std::move(storeOperation), operands));
+    return *(new (region) StoreNonVolatileNode(region, std::move(storeOperation), operands));
   }
 
 private:
@@ -355,6 +358,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -462,7 +468,7 @@ public:
       std::unique_ptr<StoreVolatileOperation> storeOperation,
       const std::vector<rvsdg::output *> & operands)
   {
-    return *(new StoreVolatileNode(region, std::move(storeOperation), operands));
+    return *(new (region) StoreVolatileNode(region, std::move(storeOperation), operands));
   }
 
   static StoreVolatileNode &
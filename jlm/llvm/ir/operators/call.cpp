@@ -7,6 +7,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -141,6 +142,12 @@ CallOperation::operator==(const Operation & other) const noexcept
   return callOperation && FunctionType_ == callOperation->FunctionType_;
 }
 
+std::size_t
+CallOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(CallOperation).hash_code(), FunctionType_->ComputeHash());
+}
+
 std::string
 CallOperation::debug_string() const
 {
@@ -32,6 +32,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -477,7 +480,7 @@ public:
   {
     CheckFunctionType(*callOperation->GetFunctionType());
 
-    return *(new CallNode(region, std::move(callOperation), operands));
+    return *(new (region) CallNode(region, std::move(callOperation), operands));
   }
 
   static CallNode &
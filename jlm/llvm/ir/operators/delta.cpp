@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/delta.hpp>
 #include <jlm/rvsdg/substitution.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -37,6 +38,15 @@ operation::operator==(const Operation & other) const noexcept
       && op->Section_ == Section_ && *op->type_ == *type_;
 }
 
+std::size_t
+operation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(operation).hash_code(),
+      std::hash<std::string>()(name_),
+      type_->ComputeHash());
+}
+
 /* delta node */
 
 node::~node()
@@ -57,6 +57,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   const std::string &
   name() const noexcept
   {
@@ -292,7 +295,7 @@ public:
         linkage,
         std::move(section),
         constant);
-    return new delta::node(parent, std::move(op));
+    return new (*parent) delta::node(parent, std::move(op));
   }
 
   /**
@@ -326,7 +329,7 @@ private:
   static cvinput *
   create(delta::node * node, rvsdg::output * origin)
   {
-    auto input = std::unique_ptr<cvinput>(new cvinput(node, origin));
+    auto input = std::unique_ptr<cvinput>(new (*node->region()) cvinput(node, origin));
     return static_cast<cvinput *>(node->append_input(std::move(input)));
   }
 
@@ -430,7 +433,7 @@ private:
   static cvargument *
   create(rvsdg::Region * region, delta::cvinput * input)
   {
-    auto argument = new cvargument(region, input);
+    auto argument = new (*region) cvargument(region, input);
     region->append_argument(argument);
     return argument;
   }
@@ -463,7 +466,7 @@ private:
   static result *
   create(rvsdg::output * origin)
   {
-    auto result = new delta::result(origin);
+    auto result = new (*origin->region()) delta::result(origin);
     origin->region()->append_result(result);
     return result;
   }
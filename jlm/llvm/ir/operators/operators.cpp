@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/operators.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/util/Hash.hpp>
 
 #include <llvm/ADT/SmallVector.h>
 
@@ -20,6 +21,12 @@ SsaPhiOperation::operator==(const Operation & other) const noexcept
   return op && op->nodes_ == nodes_ && op->result(0) == result(0);
 }
 
+std::size_t
+SsaPhiOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(SsaPhiOperation).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 SsaPhiOperation::debug_string() const
 {
@@ -50,6 +57,12 @@ AssignmentOperation::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0);
 }
 
+std::size_t
+AssignmentOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(AssignmentOperation).hash_code(), argument(0)->ComputeHash());
+}
+
 std::string
 AssignmentOperation::debug_string() const
 {
@@ -74,6 +87,12 @@ select_op::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+select_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(select_op).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 select_op::debug_string() const
 {
@@ -98,6 +117,12 @@ vectorselect_op::operator==(const Operation & other) const noexcept
   return op && op->type() == type();
 }
 
+std::size_t
+vectorselect_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 vectorselect_op::debug_string() const
 {
@@ -122,6 +147,12 @@ fp2ui_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+fp2ui_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 fp2ui_op::debug_string() const
 {
@@ -158,6 +189,12 @@ fp2si_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+fp2si_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 fp2si_op::debug_string() const
 {
@@ -194,6 +231,12 @@ ctl2bits_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+ctl2bits_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 ctl2bits_op::debug_string() const
 {
@@ -218,6 +261,12 @@ branch_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0);
 }
 
+std::size_t
+branch_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(branch_op).hash_code(), argument(0)->ComputeHash());
+}
+
 std::string
 branch_op::debug_string() const
 {
@@ -239,6 +288,12 @@ ConstantPointerNullOperation::operator==(const Operation & other) const noexcept
   return op && op->GetPointerType() == GetPointerType();
 }
 
+std::size_t
+ConstantPointerNullOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 ConstantPointerNullOperation::debug_string() const
 {
@@ -263,6 +318,12 @@ bits2ptr_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+bits2ptr_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 bits2ptr_op::debug_string() const
 {
@@ -299,6 +360,12 @@ ptr2bits_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+ptr2bits_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 ptr2bits_op::debug_string() const
 {
@@ -333,6 +400,12 @@ ConstantDataArray::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+ConstantDataArray::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(ConstantDataArray).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 ConstantDataArray::debug_string() const
 {
@@ -357,6 +430,15 @@ ptrcmp_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->cmp_ == cmp_;
 }
 
+std::size_t
+ptrcmp_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(ptrcmp_op).hash_code(),
+      argument(0)->ComputeHash(),
+      static_cast<std::size_t>(cmp_));
+}
+
 std::string
 ptrcmp_op::debug_string() const
 {
@@ -402,6 +484,12 @@ zext_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+zext_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 zext_op::debug_string() const
 {
@@ -449,6 +537,15 @@ ConstantFP::operator==(const Operation & other) const noexcept
   return op && size() == op->size() && constant().bitwiseIsEqual(op->constant());
 }
 
+std::size_t
+ConstantFP::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(ConstantFP).hash_code(),
+      static_cast<std::size_t>(size()),
+      static_cast<std::size_t>(::llvm::hash_value(constant())));
+}
+
 std::string
 ConstantFP::debug_string() const
 {
@@ -481,6 +578,15 @@ fpcmp_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->cmp_ == cmp_;
 }
 
+std::size_t
+fpcmp_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(fpcmp_op).hash_code(),
+      argument(0)->ComputeHash(),
+      static_cast<std::size_t>(cmp_));
+}
+
 std::string
 fpcmp_op::debug_string() const
 {
@@ -530,6 +636,12 @@ UndefValueOperation::operator==(const Operation & other) const noexcept
   return op && op->GetType() == GetType();
 }
 
+std::size_t
+UndefValueOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 UndefValueOperation::debug_string() const
 {
@@ -551,6 +663,12 @@ PoisonValueOperation::operator==(const Operation & other) const noexcept
   return operation && operation->GetType() == GetType();
 }
 
+std::size_t
+PoisonValueOperation::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 PoisonValueOperation::debug_string() const
 {
@@ -575,6 +693,15 @@ fpbin_op::operator==(const Operation & other) const noexcept
   return op && op->fpop() == fpop() && op->size() == size();
 }
 
+std::size_t
+fpbin_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(fpbin_op).hash_code(),
+      static_cast<std::size_t>(fpop()),
+      static_cast<std::size_t>(size()));
+}
+
 std::string
 fpbin_op::debug_string() const
 {
@@ -618,6 +745,12 @@ fpext_op::operator==(const Operation & other) const noexcept
   return op && op->srcsize() == srcsize() && op->dstsize() == dstsize();
 }
 
+std::size_t
+fpext_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 fpext_op::debug_string() const
 {
@@ -654,6 +787,12 @@ fpneg_op::operator==(const Operation & other) const noexcept
   return op && op->size() == size();
 }
 
+std::size_t
+fpneg_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 fpneg_op::debug_string() const
 {
@@ -690,6 +829,12 @@ fptrunc_op::operator==(const Operation & other) const noexcept
   return op && op->srcsize() == srcsize() && op->dstsize() == dstsize();
 }
 
+std::size_t
+fptrunc_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 fptrunc_op::debug_string() const
 {
@@ -735,6 +880,12 @@ valist_op::operator==(const Operation & other) const noexcept
   return true;
 }
 
+std::size_t
+valist_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 valist_op::debug_string() const
 {
@@ -759,6 +910,12 @@ bitcast_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+bitcast_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 bitcast_op::debug_string() const
 {
@@ -800,6 +957,12 @@ ConstantStruct::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+ConstantStruct::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(ConstantStruct).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 ConstantStruct::debug_string() const
 {
@@ -824,6 +987,12 @@ trunc_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+trunc_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 trunc_op::debug_string() const
 {
@@ -860,6 +1029,12 @@ uitofp_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+uitofp_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 uitofp_op::debug_string() const
 {
@@ -896,6 +1071,12 @@ sitofp_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+sitofp_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 sitofp_op::debug_string() const
 {
@@ -932,6 +1113,12 @@ ConstantArray::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+ConstantArray::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(ConstantArray).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 ConstantArray::debug_string() const
 {
@@ -956,6 +1143,12 @@ ConstantAggregateZero::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+ConstantAggregateZero::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(ConstantAggregateZero).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 ConstantAggregateZero::debug_string() const
 {
@@ -980,6 +1173,12 @@ extractelement_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->argument(1) == argument(1);
 }
 
+std::size_t
+extractelement_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 extractelement_op::debug_string() const
 {
@@ -1004,6 +1203,16 @@ shufflevector_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->Mask() == Mask();
 }
 
+std::size_t
+shufflevector_op::ComputeHash() const noexcept
+{
+  auto seed = util::CombineHashes(typeid(shufflevector_op).hash_code(), argument(0)->ComputeHash());
+  for (auto index : Mask_)
+    util::CombineHashesWithSeed(seed, std::hash<int>()(index));
+
+  return seed;
+}
+
 std::string
 shufflevector_op::debug_string() const
 {
@@ -1028,6 +1237,12 @@ constantvector_op::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+constantvector_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(constantvector_op).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 constantvector_op::debug_string() const
 {
@@ -1053,6 +1268,12 @@ insertelement_op::operator==(const Operation & other) const noexcept
       && op->argument(2) == argument(2);
 }
 
+std::size_t
+insertelement_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 insertelement_op::debug_string() const
 {
@@ -1077,6 +1298,12 @@ vectorunary_op::operator==(const Operation & other) const noexcept
   return op && op->operation() == operation();
 }
 
+std::size_t
+vectorunary_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(vectorunary_op).hash_code(), operation().ComputeHash());
+}
+
 std::string
 vectorunary_op::debug_string() const
 {
@@ -1101,6 +1328,12 @@ vectorbinary_op::operator==(const Operation & other) const noexcept
   return op && op->operation() == operation();
 }
 
+std::size_t
+vectorbinary_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(vectorbinary_op).hash_code(), operation().ComputeHash());
+}
+
 std::string
 vectorbinary_op::debug_string() const
 {
@@ -1125,6 +1358,12 @@ constant_data_vector_op::operator==(const Operation & other) const noexcept
   return op && op->result(0) == result(0);
 }
 
+std::size_t
+constant_data_vector_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(constant_data_vector_op).hash_code(), result(0)->ComputeHash());
+}
+
 std::string
 constant_data_vector_op::debug_string() const
 {
@@ -1149,6 +1388,16 @@ ExtractValue::operator==(const Operation & other) const noexcept
   return op && op->indices_ == indices_ && op->type() == type();
 }
 
+std::size_t
+ExtractValue::ComputeHash() const noexcept
+{
+  auto seed = ComputeSignatureHash();
+  for (auto index : indices_)
+    util::CombineHashesWithSeed(seed, std::hash<unsigned>()(index));
+
+  return seed;
+}
+
 std::string
 ExtractValue::debug_string() const
 {
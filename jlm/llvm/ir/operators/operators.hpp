@@ -47,6 +47,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -109,6 +112,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -139,6 +145,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -183,6 +192,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -266,6 +278,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -329,6 +344,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -374,6 +392,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -410,6 +431,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -446,6 +470,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -513,6 +540,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -592,6 +622,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -644,6 +677,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -718,6 +754,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -798,6 +837,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -879,6 +921,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -956,6 +1001,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1023,6 +1071,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -1094,6 +1145,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   std::string
   debug_string() const override;
 
@@ -1165,6 +1219,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1251,6 +1308,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1310,6 +1370,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1386,6 +1449,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1449,6 +1515,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1514,6 +1583,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1577,6 +1649,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1669,6 +1744,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1754,6 +1832,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1813,6 +1894,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1859,6 +1943,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1927,6 +2014,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -1963,6 +2053,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2007,6 +2100,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2058,6 +2154,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2102,6 +2201,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2194,6 +2296,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2289,6 +2394,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2332,6 +2440,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -2387,6 +2498,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/operators.hpp>
 #include <jlm/llvm/ir/operators/sext.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -83,6 +84,12 @@ sext_op::operator==(const Operation & other) const noexcept
   return op && op->argument(0) == argument(0) && op->result(0) == result(0);
 }
 
+std::size_t
+sext_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 std::string
 sext_op::debug_string() const
 {
@@ -91,7 +91,7 @@ public:
   static std::shared_ptr<const ArrayType>
   Create(std::shared_ptr<const ValueType> type, size_t nelements)
   {
-    return std::make_shared<ArrayType>(std::move(type), nelements);
+    return rvsdg::TypeTable::Intern(std::make_shared<const ArrayType>(std::move(type), nelements));
   }
 
 private:
@@ -243,13 +243,14 @@ public:
   static std::shared_ptr<const StructType>
   Create(const std::string & name, bool isPacked, const Declaration & declaration)
   {
-    return std::make_shared<StructType>(name, isPacked, declaration);
+    return rvsdg::TypeTable::Intern(
+        std::make_shared<const StructType>(name, isPacked, declaration));
   }
 
   static std::shared_ptr<const StructType>
   Create(bool isPacked, const Declaration & declaration)
   {
-    return std::make_shared<StructType>(isPacked, declaration);
+    return rvsdg::TypeTable::Intern(std::make_shared<const StructType>(isPacked, declaration));
   }
 
 private:
@@ -383,7 +384,7 @@ public:
   static std::shared_ptr<const FixedVectorType>
   Create(std::shared_ptr<const rvsdg::ValueType> type, size_t size)
   {
-    return std::make_shared<FixedVectorType>(std::move(type), size);
+    return rvsdg::TypeTable::Intern(std::make_shared<const FixedVectorType>(std::move(type), size));
   }
 };
 
@@ -408,7 +409,8 @@ public:
   static std::shared_ptr<const ScalableVectorType>
   Create(std::shared_ptr<const rvsdg::ValueType> type, size_t size)
   {
-    return std::make_shared<ScalableVectorType>(std::move(type), size);
+    return rvsdg::TypeTable::Intern(
+        std::make_shared<const ScalableVectorType>(std::move(type), size));
   }
 };
 
@@ -0,0 +1,331 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/CallSummary.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/opt/CostModelInliner.hpp>
+#include <jlm/llvm/opt/inlining.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/RvsdgModule.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/TarjanScc.hpp>
+
+#include <unordered_map>
+
+namespace jlm::llvm
+{
+
+CostModelInliner::Statistics::~Statistics() noexcept = default;
+
+void
+CostModelInliner::Statistics::Start(const rvsdg::Graph & graph)
+{
+  AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(&graph.GetRootRegion()));
+  AddTimer(Label::Timer).start();
+}
+
+void
+CostModelInliner::Statistics::Stop(const rvsdg::Graph & graph)
+{
+  GetTimer(Label::Timer).stop();
+  AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
+
+  for (auto decision :
+       { Decision::InlinedAlwaysInline,
+         Decision::InlinedSingleCall,
+         Decision::InlinedWithinBudget,
+         Decision::RejectedNoInline,
+         Decision::RejectedRecursive,
+         Decision::RejectedUnsupported,
+         Decision::RejectedTooLarge,
+         Decision::RejectedCallerBudget,
+         Decision::RejectedModuleBudget })
+  {
+    AddMeasurement(std::string("#") + ToString(decision), GetNumCallSites(decision));
+  }
+
+  // The measurements are separated by spaces. Encode every call site as caller>callee=decision.
+  std::string callSites;
+  for (auto & callSite : CallSiteDecisions_)
+  {
+    if (!callSites.empty())
+      callSites += ",";
+    callSites +=
+        util::strfmt(callSite.caller, ">", callSite.callee, "=", ToString(callSite.decision));
+  }
+  AddMeasurement("CallSites", callSites);
+}
+
+size_t
+CostModelInliner::Statistics::GetNumCallSites(Decision decision) const noexcept
+{
+  return std::count_if(
+      CallSiteDecisions_.begin(),
+      CallSiteDecisions_.end(),
+      [&](const CallSiteDecision & callSite)
+      {
+        return callSite.decision == decision;
+      });
+}
+
+CostModelInliner::~CostModelInliner() noexcept = default;
+
+CostModelInliner::CostModelInliner()
+    : CostModelInliner(Configuration::CreateDefault())
+{}
+
+CostModelInliner::CostModelInliner(const Configuration & configuration)
+    : Configuration_(std::make_unique<Configuration>(configuration))
+{}
+
+bool
+CostModelInliner::IsInlined(Decision decision) noexcept
+{
+  return decision == Decision::InlinedAlwaysInline || decision == Decision::InlinedSingleCall
+      || decision == Decision::InlinedWithinBudget;
+}
+
+const char *
+CostModelInliner::ToString(Decision decision) noexcept
+{
+  switch (decision)
+  {
+  case Decision::InlinedAlwaysInline:
+    return "InlinedAlwaysInline";
+  case Decision::InlinedSingleCall:
+    return "InlinedSingleCall";
+  case Decision::InlinedWithinBudget:
+    return "InlinedWithinBudget";
+  case Decision::RejectedNoInline:
+    return "RejectedNoInline";
+  case Decision::RejectedRecursive:
+    return "RejectedRecursive";
+  case Decision::RejectedUnsupported:
+    return "RejectedUnsupported";
+  case Decision::RejectedTooLarge:
+    return "RejectedTooLarge";
+  case Decision::RejectedCallerBudget:
+    return "RejectedCallerBudget";
+  case Decision::RejectedModuleBudget:
+    return "RejectedModuleBudget";
+  }
+
+  JLM_UNREACHABLE("Unhandled inlining decision.");
+}
+
+/**
+ * Collects all lambda nodes of \p region, including the ones nested in phi nodes.
+ */
+static void
+CollectLambdaNodes(rvsdg::Region & region, std::vector<rvsdg::LambdaNode *> & lambdaNodes)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto lambdaNode = dynamic_cast<rvsdg::LambdaNode *>(&node))
+    {
+      lambdaNodes.push_back(lambdaNode);
+    }
+    else if (auto phiNode = dynamic_cast<phi::node *>(&node))
+    {
+      CollectLambdaNodes(*phiNode->subregion(), lambdaNodes);
+    }
+  }
+}
+
+/**
+ * Collects all call nodes of \p region, including the ones nested in structural nodes.
+ */
+static void
+CollectCallNodes(rvsdg::Region & region, std::vector<CallNode *> & callNodes)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto callNode = dynamic_cast<CallNode *>(&node))
+    {
+      callNodes.push_back(callNode);
+    }
+    else if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectCallNodes(*structuralNode->subregion(n), callNodes);
+    }
+  }
+}
+
+/**
+ * @return The lambda node called by \p callNode, or nullptr if it is not a direct call.
+ */
+static rvsdg::LambdaNode *
+GetCallee(const CallNode & callNode)
+{
+  const auto callTypeClassifier = CallNode::ClassifyCall(callNode);
+  if (!callTypeClassifier->IsNonRecursiveDirectCall()
+      && !callTypeClassifier->IsRecursiveDirectCall())
+  {
+    return nullptr;
+  }
+
+  return &rvsdg::AssertGetOwnerNode<rvsdg::LambdaNode>(callTypeClassifier->GetLambdaOutput());
+}
+
+/**
+ * Determines whether the context variables of \p lambdaNode can be routed to any call site, i.e.,
+ * whether all of them originate outside of phi recursion variables.
+ *
+ * @see inlineCall()
+ */
+static bool
+HasRoutableContextVariables(const rvsdg::LambdaNode & lambdaNode)
+{
+  auto & rootRegion = lambdaNode.region()->graph()->GetRootRegion();
+  for (size_t n = 0; n < lambdaNode.ninputs(); n++)
+  {
+    auto origin = lambdaNode.input(n)->origin();
+    while (auto argument = dynamic_cast<rvsdg::RegionArgument *>(origin))
+    {
+      if (argument->region() == &rootRegion)
+        break;
+
+      if (argument->input() == nullptr)
+        return false;
+
+      origin = argument->input()->origin();
+    }
+  }
+
+  return true;
+}
+
+static bool
+HasEnumAttribute(const rvsdg::LambdaNode & lambdaNode, attribute::kind kind)
+{
+  auto operation = dynamic_cast<const LlvmLambdaOperation *>(&lambdaNode.GetOperation());
+  return operation && operation->attributes().HasEnumAttribute(kind);
+}
+
+static std::string
+GetName(const rvsdg::LambdaNode & lambdaNode)
+{
+  auto operation = dynamic_cast<const LlvmLambdaOperation *>(&lambdaNode.GetOperation());
+  return operation ? operation->name() : lambdaNode.GetOperation().debug_string();
+}
+
+void
+CostModelInliner::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto & graph = module.Rvsdg();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+  statistics->Start(graph);
+
+  std::vector<rvsdg::LambdaNode *> lambdaNodes;
+  CollectLambdaNodes(graph.GetRootRegion(), lambdaNodes);
+
+  std::unordered_map<const rvsdg::LambdaNode *, size_t> indices;
+  for (size_t n = 0; n < lambdaNodes.size(); n++)
+    indices[lambdaNodes[n]] = n;
+
+  // Build the call graph from the direct calls
+  std::vector<std::vector<size_t>> callees(lambdaNodes.size());
+  for (size_t n = 0; n < lambdaNodes.size(); n++)
+  {
+    std::vector<CallNode *> callNodes;
+    CollectCallNodes(*lambdaNodes[n]->subregion(), callNodes);
+    for (auto callNode : callNodes)
+    {
+      if (auto callee = GetCallee(*callNode))
+        callees[n].push_back(indices.at(callee));
+    }
+  }
+
+  auto successors = [&](size_t node) -> const std::vector<size_t> &
+  {
+    return callees[node];
+  };
+  std::vector<size_t> sccIndex;
+  std::vector<size_t> topologicalOrder;
+  util::FindStronglyConnectedComponents(lambdaNodes.size(), successors, sccIndex, topologicalOrder);
+
+  const auto & configuration = GetConfiguration();
+  const auto moduleSize = rvsdg::nnodes(&graph.GetRootRegion());
+  const auto moduleBudget =
+      configuration.ComputeBudget(moduleSize, configuration.GetModuleGrowthPercent());
+  size_t moduleGrowth = 0;
+
+  // The topological order lists callers before their callees. Process it in reverse to visit the
+  // strongly connected components bottom-up.
+  for (auto it = topologicalOrder.rbegin(); it != topologicalOrder.rend(); it++)
+  {
+    auto & caller = *lambdaNodes[*it];
+    const auto callerBudget = configuration.ComputeBudget(
+        rvsdg::nnodes(caller.subregion()),
+        configuration.GetCallerGrowthPercent());
+    size_t callerGrowth = 0;
+
+    std::vector<CallNode *> callNodes;
+    CollectCallNodes(*caller.subregion(), callNodes);
+    for (auto callNode : callNodes)
+    {
+      auto callee = GetCallee(*callNode);
+      if (callee == nullptr)
+        continue;
+
+      const auto calleeSize = rvsdg::nnodes(callee->subregion());
+      Decision decision;
+      if (sccIndex[indices.at(callee)] == sccIndex[*it])
+      {
+        decision = Decision::RejectedRecursive;
+      }
+      else if (HasEnumAttribute(*callee, attribute::kind::NoInline))
+      {
+        decision = Decision::RejectedNoInline;
+      }
+      else if (!HasRoutableContextVariables(*callee))
+      {
+        decision = Decision::RejectedUnsupported;
+      }
+      else if (HasEnumAttribute(*callee, attribute::kind::AlwaysInline))
+      {
+        decision = Decision::InlinedAlwaysInline;
+      }
+      else if (auto callSummary = ComputeCallSummary(*callee);
+               callSummary.HasOnlyDirectCalls() && callSummary.NumDirectCalls() == 1)
+      {
+        decision = Decision::InlinedSingleCall;
+      }
+      else if (calleeSize > configuration.GetInlineThreshold())
+      {
+        decision = Decision::RejectedTooLarge;
+      }
+      else if (callerGrowth + calleeSize > callerBudget)
+      {
+        decision = Decision::RejectedCallerBudget;
+      }
+      else if (moduleGrowth + calleeSize > moduleBudget)
+      {
+        decision = Decision::RejectedModuleBudget;
+      }
+      else
+      {
+        decision = Decision::InlinedWithinBudget;
+      }
+
+      // The body of a callee with a single call becomes dead after inlining
+      if (IsInlined(decision) && decision != Decision::InlinedSingleCall)
+      {
+        callerGrowth += calleeSize;
+        moduleGrowth += calleeSize;
+      }
+
+      statistics->AddCallSiteDecision({ GetName(caller), GetName(*callee), calleeSize, decision });
+      if (IsInlined(decision))
+        inlineCall(callNode, callee);
+    }
+  }
+
+  statistics->Stop(graph);
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+}
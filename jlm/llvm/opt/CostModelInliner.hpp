@@ -0,0 +1,218 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_COSTMODELINLINER_HPP
+#define JLM_LLVM_OPT_COSTMODELINLINER_HPP
+
+#include <jlm/rvsdg/Transformation.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+class Graph;
+class LambdaNode;
+class SimpleNode;
+}
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Cost model driven function inlining
+ *
+ * The inliner visits the strongly connected components of the call graph bottom-up, i.e., the
+ * callees of a function are processed before the function itself. This ensures that the size of
+ * a callee already includes the calls that were inlined into it. Every direct call in a function
+ * is inlined if the callee is not part of the caller's strongly connected component, and if one of
+ * the following holds:
+ *
+ * 1. The callee has the alwaysinline attribute.
+ * 2. The call is the only use of the callee. Inlining it does not grow the module.
+ * 3. The callee size is at most Configuration::GetInlineThreshold(), and inlining it stays within
+ * the growth budgets of the caller and the module.
+ *
+ * Callees with the noinline attribute are never inlined. The size of a function is the number of
+ * nodes in its body, including the nodes in nested regions.
+ *
+ * \note Inlined functions are not removed, even if they become dead. This is left to dead node
+ * elimination.
+ */
+class CostModelInliner final : public rvsdg::Transformation
+{
+public:
+  class Configuration;
+  class Statistics;
+
+  /**
+   * The decision of the inliner for a single direct call.
+   */
+  enum class Decision
+  {
+    InlinedAlwaysInline,
+    InlinedSingleCall,
+    InlinedWithinBudget,
+    RejectedNoInline,
+    RejectedRecursive,
+    RejectedUnsupported,
+    RejectedTooLarge,
+    RejectedCallerBudget,
+    RejectedModuleBudget
+  };
+
+  ~CostModelInliner() noexcept override;
+
+  CostModelInliner();
+
+  explicit CostModelInliner(const Configuration & configuration);
+
+  CostModelInliner(const CostModelInliner &) = delete;
+
+  CostModelInliner &
+  operator=(const CostModelInliner &) = delete;
+
+  [[nodiscard]] const Configuration &
+  GetConfiguration() const noexcept
+  {
+    return *Configuration_;
+  }
+
+  void
+  Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * @return True if \p decision inlines the call, otherwise false.
+   */
+  [[nodiscard]] static bool
+  IsInlined(Decision decision) noexcept;
+
+  /**
+   * @return A human-readable name of \p decision.
+   */
+  [[nodiscard]] static const char *
+  ToString(Decision decision) noexcept;
+
+private:
+  std::unique_ptr<Configuration> Configuration_;
+};
+
+/**
+ * The thresholds of the inliner's cost model.
+ */
+class CostModelInliner::Configuration final
+{
+public:
+  /**
+   * @param inlineThreshold The maximum size of a callee that is inlined.
+   * @param callerGrowthPercent The maximum growth of a caller, in percent of its size before any
+   * call was inlined into it.
+   * @param moduleGrowthPercent The maximum growth of the module, in percent of its size before
+   * the inliner ran.
+   */
+  Configuration(size_t inlineThreshold, size_t callerGrowthPercent, size_t moduleGrowthPercent)
+      : InlineThreshold_(inlineThreshold),
+        CallerGrowthPercent_(callerGrowthPercent),
+        ModuleGrowthPercent_(moduleGrowthPercent)
+  {}
+
+  [[nodiscard]] size_t
+  GetInlineThreshold() const noexcept
+  {
+    return InlineThreshold_;
+  }
+
+  [[nodiscard]] size_t
+  GetCallerGrowthPercent() const noexcept
+  {
+    return CallerGrowthPercent_;
+  }
+
+  [[nodiscard]] size_t
+  GetModuleGrowthPercent() const noexcept
+  {
+    return ModuleGrowthPercent_;
+  }
+
+  /**
+   * Computes the growth budget of a function or module of size \p size. The budget is at least
+   * the inline threshold such that a callee of threshold size can always be inlined once into
+   * small functions.
+   */
+  [[nodiscard]] size_t
+  ComputeBudget(size_t size, size_t growthPercent) const noexcept
+  {
+    return std::max(InlineThreshold_, size * growthPercent / 100);
+  }
+
+  static Configuration
+  CreateDefault()
+  {
+    return { 40, 100, 20 };
+  }
+
+private:
+  size_t InlineThreshold_;
+  size_t CallerGrowthPercent_;
+  size_t ModuleGrowthPercent_;
+};
+
+/**
+ * The statistics of the CostModelInliner. Besides the aggregated number of calls per decision,
+ * the decision for every individual direct call is recorded.
+ */
+class CostModelInliner::Statistics final : public util::Statistics
+{
+public:
+  struct CallSiteDecision
+  {
+    std::string caller;
+    std::string callee;
+    size_t calleeSize;
+    Decision decision;
+  };
+
+  ~Statistics() noexcept override;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Id::FunctionInlining, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::Graph & graph);
+
+  void
+  Stop(const rvsdg::Graph & graph);
+
+  void
+  AddCallSiteDecision(CallSiteDecision decision)
+  {
+    CallSiteDecisions_.push_back(std::move(decision));
+  }
+
+  [[nodiscard]] const std::vector<CallSiteDecision> &
+  GetCallSiteDecisions() const noexcept
+  {
+    return CallSiteDecisions_;
+  }
+
+  [[nodiscard]] size_t
+  GetNumCallSites(Decision decision) const noexcept;
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+
+private:
+  std::vector<CallSiteDecision> CallSiteDecisions_;
+};
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
 #include <typeindex>
 
 namespace jlm::llvm
@@ -32,6 +33,13 @@ namespace jlm::llvm
  * to mark o2 alive in the future, we can immediately stop marking instead of reiterating through i1
  * ... iN again. Thus, by marking the entire simple node instead of just its outputs, we reduce the
  * runtime for marking Node2 from O(oN x iN) to O(oN + iN).
+ *
+ * The liveness of nodes and outputs is kept in dense bit vectors that are indexed with the
+ * identifiers of the nodes and outputs. No nodes or outputs are created while the context is in
+ * use, which means that the identifiers of all live nodes and outputs remain unique.
+ *
+ * @see Node::GetId()
+ * @see output::GetId()
  */
 class DeadNodeElimination::Context final
 {
@@ -41,11 +49,11 @@ public:
   {
     if (auto simpleOutput = dynamic_cast<const rvsdg::SimpleOutput *>(&output))
     {
-      SimpleNodes_.Insert(simpleOutput->node());
+      Set(SimpleNodes_, simpleOutput->node()->GetId());
       return;
     }
 
-    Outputs_.Insert(&output);
+    Set(Outputs_, output.GetId());
   }
 
   bool
@@ -53,10 +61,10 @@ public:
   {
     if (auto simpleOutput = dynamic_cast<const rvsdg::SimpleOutput *>(&output))
     {
-      return SimpleNodes_.Contains(simpleOutput->node());
+      return Test(SimpleNodes_, simpleOutput->node()->GetId());
     }
 
-    return Outputs_.Contains(&output);
+    return Test(Outputs_, output.GetId());
   }
 
   bool
@@ -64,7 +72,7 @@ public:
   {
     if (auto simpleNode = dynamic_cast<const jlm::rvsdg::SimpleNode *>(&node))
     {
-      return SimpleNodes_.Contains(simpleNode);
+      return Test(SimpleNodes_, simpleNode->GetId());
     }
 
     for (size_t n = 0; n < node.noutputs(); n++)
@@ -78,15 +86,42 @@ public:
     return false;
   }
 
+  /**
+   * @return The region the marking is confined to, or nullptr if the entire RVSDG is marked.
+   */
+  [[nodiscard]] const rvsdg::Region *
+  GetScope() const noexcept
+  {
+    return Scope_;
+  }
+
   static std::unique_ptr<Context>
-  Create()
+  Create(const rvsdg::Region * scope = nullptr)
   {
-    return std::make_unique<Context>();
+    auto context = std::make_unique<Context>();
+    context->Scope_ = scope;
+    return context;
   }
 
 private:
-  util::HashSet<const jlm::rvsdg::SimpleNode *> SimpleNodes_;
-  util::HashSet<const jlm::rvsdg::output *> Outputs_;
+  static void
+  Set(std::vector<bool> & bits, size_t id)
+  {
+    if (id >= bits.size())
+      bits.resize(std::max(id + 1, 2 * bits.size()));
+
+    bits[id] = true;
+  }
+
+  static bool
+  Test(const std::vector<bool> & bits, size_t id) noexcept
+  {
+    return id < bits.size() && bits[id];
+  }
+
+  const rvsdg::Region * Scope_ = nullptr;
+  std::vector<bool> SimpleNodes_;
+  std::vector<bool> Outputs_;
 };
 
 /** \brief Dead Node Elimination statistics class
@@ -146,7 +181,7 @@ DeadNodeElimination::DeadNodeElimination() = default;
 void
 DeadNodeElimination::run(rvsdg::Region & region)
 {
-  Context_ = Context::Create();
+  Context_ = Context::Create(&region);
 
   MarkRegion(region);
   SweepRegion(region);
@@ -155,6 +190,25 @@ DeadNodeElimination::run(rvsdg::Region & region)
   Context_.reset();
 }
 
+void
+DeadNodeElimination::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  // This method might be invoked concurrently. Keep the state in a separate transformation object.
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.run(*lambdaNode.subregion());
+}
+
+void
+DeadNodeElimination::RunOutsideLambdas(
+    rvsdg::RvsdgModule & module,
+    util::StatisticsCollector & statisticsCollector)
+{
+  // The liveness of context variables depends on the lambda subregions, which requires marking the
+  // entire RVSDG. The lambda subregions were already swept by RunOnLambda(), such that sweeping
+  // them again does not remove any further nodes from them.
+  Run(module, statisticsCollector);
+}
+
 void
 DeadNodeElimination::Run(
     rvsdg::RvsdgModule & module,
@@ -202,6 +256,12 @@ DeadNodeElimination::MarkOutput(const jlm::rvsdg::output & output)
     return;
   }
 
+  // Do not leave the region the marking is confined to
+  if (output.region() == Context_->GetScope() && is<rvsdg::RegionArgument>(&output))
+  {
+    return;
+  }
+
   if (auto gamma = rvsdg::TryGetOwnerNode<rvsdg::GammaNode>(output))
   {
     MarkOutput(*gamma->predicate()->origin());
@@ -320,30 +380,36 @@ DeadNodeElimination::SweepRvsdg(rvsdg::Graph & rvsdg) const
 void
 DeadNodeElimination::SweepRegion(rvsdg::Region & region) const
 {
+  // A node without users is dead, and so are all nodes whose users are exclusively dead nodes.
+  // Pruning the region therefore removes all dead nodes at once by starting at the bottom nodes,
+  // except the ones that are still used by the dead inputs of live structural nodes.
   region.prune(false);
 
-  std::vector<std::vector<rvsdg::Node *>> nodesTopDown(region.nnodes());
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
   for (auto & node : region.Nodes())
   {
-    nodesTopDown[node.depth()].push_back(&node);
-  }
-
-  for (auto it = nodesTopDown.rbegin(); it != nodesTopDown.rend(); it++)
-  {
-    for (auto node : *it)
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
     {
-      if (!Context_->IsAlive(*node))
-      {
-        remove(node);
-        continue;
-      }
+      if (Context_->IsAlive(*structuralNode))
+        structuralNodes.push_back(structuralNode);
+    }
+  }
 
-      if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+  // The dead outputs of a structural node can only be removed once all their users are gone.
+  // Sweep the structural nodes bottom-up and remove the nodes that became dead in between.
+  std::sort(
+      structuralNodes.begin(),
+      structuralNodes.end(),
+      [](const rvsdg::StructuralNode * a, const rvsdg::StructuralNode * b)
       {
-        SweepStructuralNode(*structuralNode);
-      }
-    }
+        return a->depth() > b->depth();
+      });
+  for (auto structuralNode : structuralNodes)
+  {
+    region.prune(false);
+    SweepStructuralNode(*structuralNode);
   }
+  region.prune(false);
 
   JLM_ASSERT(region.NumBottomNodes() == 0);
 }
@@ -372,7 +438,7 @@ DeadNodeElimination::SweepStructuralNode(rvsdg::StructuralNode & node) const
     d.SweepDelta(*util::AssertedCast<delta::node>(&n));
   };
 
-  static std::unordered_map<
+  static const std::unordered_map<
       std::type_index,
       std::function<void(const DeadNodeElimination &, rvsdg::StructuralNode &)>>
       map({ { typeid(rvsdg::GammaOperation), sweepGamma },
@@ -383,7 +449,7 @@ DeadNodeElimination::SweepStructuralNode(rvsdg::StructuralNode & node) const
 
   auto & op = node.GetOperation();
   JLM_ASSERT(map.find(typeid(op)) != map.end());
-  map[typeid(op)](*this, node);
+  map.at(typeid(op))(*this, node);
 }
 
 void
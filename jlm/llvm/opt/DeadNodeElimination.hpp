@@ -69,12 +69,48 @@ public:
   DeadNodeElimination &
   operator=(DeadNodeElimination &&) = delete;
 
+  /**
+   * Removes all dead nodes in \p region. The region's results are considered alive, and its
+   * arguments are not traced beyond \p region.
+   *
+   * @param region The region from which dead nodes are removed.
+   */
   void
   run(rvsdg::Region & region);
 
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::DeadNodeElimination;
+  }
+
+  [[nodiscard]] bool
+  HasPartOutsideLambdas() const noexcept override
+  {
+    return true;
+  }
+
+  /**
+   * Removes the dead nodes outside of the lambda subregions, such as lambda and delta nodes that
+   * are no longer used, as well as unused context variables and imports.
+   */
+  void
+  RunOutsideLambdas(
+      rvsdg::RvsdgModule & module,
+      util::StatisticsCollector & statisticsCollector) override;
+
 private:
   void
   MarkRegion(const rvsdg::Region & region);
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/LoopInvariantCodeMotion.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <deque>
+#include <unordered_map>
+
+namespace jlm::llvm
+{
+
+/**
+ * Collects the number of hoisted nodes.
+ */
+class LoopInvariantCodeMotion::Context final
+{
+public:
+  [[nodiscard]] size_t
+  NumHoistedNodes() const noexcept
+  {
+    return NumHoistedNodes_;
+  }
+
+  [[nodiscard]] size_t
+  NumHoistedLoads() const noexcept
+  {
+    return NumHoistedLoads_;
+  }
+
+  void
+  AddHoistedNode(const rvsdg::SimpleNode & node) noexcept
+  {
+    NumHoistedNodes_++;
+    if (is<LoadNonVolatileOperation>(&node))
+      NumHoistedLoads_++;
+  }
+
+private:
+  size_t NumHoistedNodes_ = 0;
+  size_t NumHoistedLoads_ = 0;
+};
+
+class LoopInvariantCodeMotion::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumHoistedNodesLabel_ = "#HoistedNodes";
+  static constexpr const char * NumHoistedLoadsLabel_ = "#HoistedLoads";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Id::LoopInvariantCodeMotion, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::Graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::Graph & graph, const Context & context) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddMeasurement(NumHoistedNodesLabel_, context.NumHoistedNodes());
+    AddMeasurement(NumHoistedLoadsLabel_, context.NumHoistedLoads());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * Determines whether \p node can be hoisted once its operands are invariant. State-typed operands
+ * only sequence a node, e.g., an IOBarrier, while state-typed results indicate side-effects.
+ */
+static bool
+IsHoistable(const rvsdg::SimpleNode & node)
+{
+  if (is<LoadNonVolatileOperation>(&node))
+    return true;
+
+  for (size_t n = 0; n < node.noutputs(); n++)
+  {
+    if (dynamic_cast<const rvsdg::StateType *>(&node.output(n)->type()))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Determines whether the memory state loop variable \p loopVar is read-only, i.e., whether it is
+ * only threaded through non-volatile loads and invariant loop variables of nested theta nodes.
+ */
+static bool
+IsReadOnly(const rvsdg::ThetaNode::LoopVar & loopVar)
+{
+  if (!is<MemoryStateType>(loopVar.pre->type()))
+    return false;
+
+  std::vector<const rvsdg::output *> outputs({ loopVar.pre });
+  while (!outputs.empty())
+  {
+    auto output = outputs.back();
+    outputs.pop_back();
+
+    for (auto & user : *output)
+    {
+      if (user == loopVar.post)
+        continue;
+
+      // The memory state operands and results of a load have the same indices
+      if (auto loadNode = rvsdg::TryGetOwnerNode<LoadNonVolatileNode>(*user))
+      {
+        outputs.push_back(loadNode->output(user->index()));
+        continue;
+      }
+
+      if (auto thetaNode = rvsdg::TryGetOwnerNode<rvsdg::ThetaNode>(*user))
+      {
+        auto innerLoopVar = thetaNode->MapInputLoopVar(*user);
+        if (rvsdg::ThetaLoopVarIsInvariant(innerLoopVar))
+        {
+          outputs.push_back(innerLoopVar.output);
+          continue;
+        }
+      }
+
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Copies \p node in front of \p thetaNode and routes the results of the copy into the theta
+ * node's subregion. The memory states of hoisted loads are threaded through the copy before they
+ * enter the theta node such that the load stays sequenced before the nodes following the loop.
+ *
+ * @return The inputs in the subregion of \p thetaNode whose origins became invariant.
+ */
+static std::vector<rvsdg::input *>
+Hoist(rvsdg::ThetaNode & thetaNode, rvsdg::SimpleNode & node)
+{
+  std::vector<rvsdg::output *> operands;
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto loopVar = thetaNode.MapPreLoopVar(*node.input(n)->origin());
+    operands.push_back(loopVar.input->origin());
+  }
+
+  auto copy = node.copy(thetaNode.region(), operands);
+
+  std::vector<rvsdg::input *> users;
+  for (size_t n = 0; n < node.noutputs(); n++)
+  {
+    auto output = node.output(n);
+    for (auto & user : *output)
+      users.push_back(user);
+
+    if (is<MemoryStateType>(output->type()))
+    {
+      JLM_ASSERT(is<LoadNonVolatileOperation>(&node));
+      auto origin = node.input(n)->origin();
+      thetaNode.MapPreLoopVar(*origin).input->divert_to(copy->output(n));
+      output->divert_users(origin);
+    }
+    else if (!output->IsDead())
+    {
+      output->divert_users(thetaNode.AddLoopVar(copy->output(n)).pre);
+    }
+  }
+
+  remove(&node);
+
+  return users;
+}
+
+static void
+HoistInvariantNodes(
+    rvsdg::ThetaNode & thetaNode,
+    LoopInvariantCodeMotion::Context & context)
+{
+  // The number of operands of a node that are invariant
+  std::unordered_map<const rvsdg::SimpleNode *, size_t> numInvariantInputs;
+  std::deque<rvsdg::SimpleNode *> worklist;
+
+  auto markInvariant = [&](rvsdg::input & input)
+  {
+    auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(input);
+    if (node && ++numInvariantInputs[node] == node->ninputs() && IsHoistable(*node))
+      worklist.push_back(node);
+  };
+
+  for (auto & node : thetaNode.subregion()->TopNodes())
+  {
+    auto simpleNode = dynamic_cast<rvsdg::SimpleNode *>(&node);
+    if (simpleNode && IsHoistable(*simpleNode))
+      worklist.push_back(simpleNode);
+  }
+
+  for (const auto & loopVar : thetaNode.GetLoopVars())
+  {
+    if (!rvsdg::ThetaLoopVarIsInvariant(loopVar) && !IsReadOnly(loopVar))
+      continue;
+
+    for (auto & user : *loopVar.pre)
+      markInvariant(*user);
+  }
+
+  while (!worklist.empty())
+  {
+    auto node = worklist.front();
+    worklist.pop_front();
+
+    context.AddHoistedNode(*node);
+    for (auto user : Hoist(thetaNode, *node))
+      markInvariant(*user);
+  }
+}
+
+static void
+HoistInvariantNodes(rvsdg::Region & region, LoopInvariantCodeMotion::Context & context)
+{
+  // Hoisted nodes are added to the region, so collect the structural nodes upfront
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      HoistInvariantNodes(*structuralNode->subregion(n), context);
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+      HoistInvariantNodes(*thetaNode, context);
+  }
+}
+
+LoopInvariantCodeMotion::~LoopInvariantCodeMotion() noexcept = default;
+
+void
+LoopInvariantCodeMotion::Run(
+    rvsdg::RvsdgModule & module,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto & graph = module.Rvsdg();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+
+  Context context;
+  statistics->Start(graph);
+  HoistInvariantNodes(graph.GetRootRegion(), context);
+  statistics->Stop(graph, context);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+void
+LoopInvariantCodeMotion::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  Context context;
+  HoistInvariantNodes(*lambdaNode.subregion(), context);
+}
+
+}
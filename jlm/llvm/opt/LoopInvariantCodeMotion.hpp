@@ -0,0 +1,73 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_LOOPINVARIANTCODEMOTION_HPP
+#define JLM_LLVM_OPT_LOOPINVARIANTCODEMOTION_HPP
+
+#include <jlm/rvsdg/Transformation.hpp>
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Loop-Invariant Code Motion
+ *
+ * Hoists loop-invariant simple nodes out of theta nodes. A node in the subregion of a theta node
+ * is loop-invariant if all its operands are invariant loop variables. The following nodes are
+ * hoisted:
+ *
+ * 1. Nodes without state-typed results, i.e., nodes without side-effects. The subregion of a theta
+ * node is executed at least once, and a hoisted node computes the same values as in the first
+ * iteration. These nodes are therefore speculatable. State-typed operands, e.g., the I/O state of
+ * an IOBarrier, only sequence a node and are invariant if the loop has no such side-effects.
+ * 2. Non-volatile loads whose memory states are read-only in the loop. A memory state loop
+ * variable is read-only if it is only threaded through non-volatile loads and invariant loop
+ * variables of nested theta nodes. The memory state encoding of the alias analyses sequences
+ * every node that might modify the memory of a load with its memory states, i.e., no node in
+ * the loop writes to the memory a hoisted load reads from.
+ *
+ * Nodes are hoisted in dependency order: a node is added to a worklist as soon as the last of its
+ * operands became invariant, such that every node is visited at most once. Nested theta nodes are
+ * processed before their enclosing theta node in order to hoist nodes through several loops.
+ *
+ * \note Nodes in gamma nodes are not hoisted. This is left to pushout.
+ */
+class LoopInvariantCodeMotion final : public rvsdg::Transformation
+{
+public:
+  class Context;
+  class Statistics;
+
+  ~LoopInvariantCodeMotion() noexcept override;
+
+  LoopInvariantCodeMotion() = default;
+
+  LoopInvariantCodeMotion(const LoopInvariantCodeMotion &) = delete;
+
+  LoopInvariantCodeMotion &
+  operator=(const LoopInvariantCodeMotion &) = delete;
+
+  void
+  Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::LoopInvariantCodeMotion;
+  }
+};
+
+}
+
+#endif
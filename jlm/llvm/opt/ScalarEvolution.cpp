@@ -0,0 +1,473 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
+#include <jlm/llvm/opt/ScalarEvolution.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+
+namespace jlm::llvm
+{
+
+static bool
+IsAddition(const rvsdg::SimpleNode & node)
+{
+  return rvsdg::is<rvsdg::bitadd_op>(&node) || rvsdg::is<IntegerAddOperation>(&node);
+}
+
+static bool
+IsSubtraction(const rvsdg::SimpleNode & node)
+{
+  return rvsdg::is<rvsdg::bitsub_op>(&node) || rvsdg::is<IntegerSubOperation>(&node);
+}
+
+namespace
+{
+
+/**
+ * Describes for every alternative of the predicate of a theta node whether the theta node
+ * repeats. The frontend creates theta nodes whose predicate is computed by a gamma node that
+ * returns a constant in every branch. The same gamma node selects the values of the loop
+ * variables for the next iteration if the loop repeats, and the values after the loop otherwise.
+ */
+struct ThetaRepetition
+{
+  const rvsdg::output * predicate;
+  const rvsdg::GammaNode * gammaNode;
+  std::vector<bool> repeats;
+};
+
+}
+
+static ThetaRepetition
+GetThetaRepetition(const rvsdg::ThetaNode & thetaNode)
+{
+  auto & predicate = *thetaNode.predicate()->origin();
+  ThetaRepetition repetition{ &predicate, nullptr, { false, true } };
+
+  auto gammaNode = rvsdg::TryGetOwnerNode<rvsdg::GammaNode>(predicate);
+  if (!gammaNode)
+    return repetition;
+
+  std::vector<bool> repeats;
+  for (auto result : gammaNode->MapOutputExitVar(predicate).branchResult)
+  {
+    auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*result->origin());
+    auto constantOperation =
+        node ? dynamic_cast<const rvsdg::ctlconstant_op *>(&node->GetOperation()) : nullptr;
+    if (!constantOperation)
+      return repetition;
+
+    repeats.push_back(constantOperation->value().alternative() == 1);
+  }
+
+  return { gammaNode->predicate()->origin(), gammaNode, std::move(repeats) };
+}
+
+/**
+ * @return The value of the next iteration that \p origin, the origin of a loop variable's result,
+ * has if \p thetaNode repeats.
+ */
+static const rvsdg::output &
+GetRepeatedValue(const rvsdg::ThetaNode & thetaNode, const rvsdg::output & origin)
+{
+  auto repetition = GetThetaRepetition(thetaNode);
+  auto gammaNode = rvsdg::TryGetOwnerNode<rvsdg::GammaNode>(origin);
+  if (!gammaNode || gammaNode != repetition.gammaNode)
+    return origin;
+
+  // The value must be the same in all branches in which the theta node repeats
+  const rvsdg::output * value = nullptr;
+  auto exitVar = repetition.gammaNode->MapOutputExitVar(origin);
+  for (size_t n = 0; n < exitVar.branchResult.size(); n++)
+  {
+    if (!repetition.repeats[n])
+      continue;
+
+    auto argument = exitVar.branchResult[n]->origin();
+    if (rvsdg::TryGetRegionParentNode<rvsdg::GammaNode>(*argument) != repetition.gammaNode)
+      return origin;
+
+    auto entryValue = repetition.gammaNode->MapBranchArgumentEntryVar(*argument).input->origin();
+    if (value && value != entryValue)
+      return origin;
+
+    value = entryValue;
+  }
+
+  return value ? *value : origin;
+}
+
+bool
+ScalarEvolution::ChainRecurrence::IsSubtractive() const noexcept
+{
+  return IsSubtraction(*UpdateNode_);
+}
+
+size_t
+ScalarEvolution::ChainRecurrence::NumBits() const noexcept
+{
+  return util::AssertedCast<const rvsdg::bittype>(&LoopVar_.pre->type())->nbits();
+}
+
+ScalarEvolution::~ScalarEvolution() noexcept = default;
+
+ScalarEvolution::ScalarEvolution() = default;
+
+void
+ScalarEvolution::AnalyzeRegion(const rvsdg::Region & region)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        AnalyzeRegion(*structuralNode->subregion(n));
+    }
+
+    if (auto thetaNode = dynamic_cast<const rvsdg::ThetaNode *>(&node))
+      AnalyzeTheta(*thetaNode);
+  }
+}
+
+void
+ScalarEvolution::AnalyzeTheta(const rvsdg::ThetaNode & thetaNode)
+{
+  for (const auto & loopVar : thetaNode.GetLoopVars())
+    AnalyzeLoopVar(thetaNode, loopVar);
+}
+
+const ScalarEvolution::ChainRecurrence *
+ScalarEvolution::AnalyzeLoopVar(
+    const rvsdg::ThetaNode & thetaNode,
+    const rvsdg::ThetaNode::LoopVar & loopVar)
+{
+  // Loop variables that are currently analyzed are treated as unknown in order to reject cyclic
+  // steps, e.g., two loop variables that are each other's step.
+  if (!AnalyzedLoopVars_.insert(loopVar.pre).second)
+    return GetChainRecurrence(*loopVar.pre);
+
+  if (!dynamic_cast<const rvsdg::bittype *>(&loopVar.pre->type()))
+    return nullptr;
+
+  auto & update = GetRepeatedValue(thetaNode, *loopVar.post->origin());
+  auto updateNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(update);
+  if (!updateNode || updateNode->ninputs() != 2)
+    return nullptr;
+
+  // A subtraction only describes a recurrence if the step is subtracted from the loop variable
+  rvsdg::output * step = nullptr;
+  if (IsAddition(*updateNode) || IsSubtraction(*updateNode))
+  {
+    if (updateNode->input(0)->origin() == loopVar.pre)
+      step = updateNode->input(1)->origin();
+    else if (IsAddition(*updateNode) && updateNode->input(1)->origin() == loopVar.pre)
+      step = updateNode->input(0)->origin();
+  }
+
+  if (step == nullptr || step == loopVar.pre)
+    return nullptr;
+
+  const ChainRecurrence * stepRecurrence = nullptr;
+  if (!IsLoopInvariant(*step))
+  {
+    auto stepArgument = dynamic_cast<const rvsdg::RegionArgument *>(step);
+    if (!stepArgument || stepArgument->region() != thetaNode.subregion())
+      return nullptr;
+
+    stepRecurrence = AnalyzeLoopVar(thetaNode, thetaNode.MapPreLoopVar(*step));
+    if (stepRecurrence == nullptr)
+      return nullptr;
+  }
+
+  auto chainRecurrence =
+      std::make_unique<ChainRecurrence>(thetaNode, loopVar, *updateNode, *step, stepRecurrence);
+  auto result = chainRecurrence.get();
+  ChainRecurrences_[loopVar.pre] = std::move(chainRecurrence);
+
+  return result;
+}
+
+const ScalarEvolution::ChainRecurrence *
+ScalarEvolution::GetChainRecurrence(const rvsdg::output & output) const noexcept
+{
+  auto it = ChainRecurrences_.find(&output);
+  return it != ChainRecurrences_.end() ? it->second.get() : nullptr;
+}
+
+const rvsdg::bitvalue_repr *
+ScalarEvolution::TryGetConstant(const rvsdg::output & output) noexcept
+{
+  auto origin = &output;
+  while (auto thetaNode = rvsdg::TryGetRegionParentNode<rvsdg::ThetaNode>(*origin))
+  {
+    auto loopVar = thetaNode->MapPreLoopVar(*origin);
+    if (!rvsdg::ThetaLoopVarIsInvariant(loopVar))
+      return nullptr;
+
+    origin = loopVar.input->origin();
+  }
+
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*origin);
+  if (!node)
+    return nullptr;
+
+  auto constantOperation = dynamic_cast<const rvsdg::bitconstant_op *>(&node->GetOperation());
+  if (!constantOperation || !constantOperation->value().is_known())
+    return nullptr;
+
+  return &constantOperation->value();
+}
+
+bool
+ScalarEvolution::IsLoopInvariant(const rvsdg::output & output) noexcept
+{
+  if (auto thetaNode = rvsdg::TryGetRegionParentNode<rvsdg::ThetaNode>(output))
+    return rvsdg::ThetaLoopVarIsInvariant(thetaNode->MapPreLoopVar(output));
+
+  return TryGetConstant(output) != nullptr;
+}
+
+namespace
+{
+
+/**
+ * The relation between an induction variable and the end value for which a loop is repeated.
+ */
+enum class Relation
+{
+  Equal,
+  NotEqual,
+  Less,
+  LessEqual,
+  Greater,
+  GreaterEqual
+};
+
+struct Comparison
+{
+  Relation relation;
+  bool isSigned;
+};
+
+}
+
+static std::optional<Comparison>
+GetComparison(const rvsdg::Operation & operation)
+{
+  if (rvsdg::is<rvsdg::biteq_op>(operation))
+    return Comparison{ Relation::Equal, true };
+  if (rvsdg::is<rvsdg::bitne_op>(operation))
+    return Comparison{ Relation::NotEqual, true };
+  if (rvsdg::is<rvsdg::bitslt_op>(operation))
+    return Comparison{ Relation::Less, true };
+  if (rvsdg::is<rvsdg::bitsle_op>(operation))
+    return Comparison{ Relation::LessEqual, true };
+  if (rvsdg::is<rvsdg::bitsgt_op>(operation))
+    return Comparison{ Relation::Greater, true };
+  if (rvsdg::is<rvsdg::bitsge_op>(operation))
+    return Comparison{ Relation::GreaterEqual, true };
+  if (rvsdg::is<rvsdg::bitult_op>(operation))
+    return Comparison{ Relation::Less, false };
+  if (rvsdg::is<rvsdg::bitule_op>(operation))
+    return Comparison{ Relation::LessEqual, false };
+  if (rvsdg::is<rvsdg::bitugt_op>(operation))
+    return Comparison{ Relation::Greater, false };
+  if (rvsdg::is<rvsdg::bituge_op>(operation))
+    return Comparison{ Relation::GreaterEqual, false };
+
+  return std::nullopt;
+}
+
+/**
+ * @return The relation that holds if the operands of \p relation are swapped.
+ */
+static Relation
+Swap(Relation relation)
+{
+  switch (relation)
+  {
+  case Relation::Less:
+    return Relation::Greater;
+  case Relation::LessEqual:
+    return Relation::GreaterEqual;
+  case Relation::Greater:
+    return Relation::Less;
+  case Relation::GreaterEqual:
+    return Relation::LessEqual;
+  default:
+    return relation;
+  }
+}
+
+/**
+ * @return The relation that holds if \p relation does not hold.
+ */
+static Relation
+Negate(Relation relation)
+{
+  switch (relation)
+  {
+  case Relation::Equal:
+    return Relation::NotEqual;
+  case Relation::NotEqual:
+    return Relation::Equal;
+  case Relation::Less:
+    return Relation::GreaterEqual;
+  case Relation::LessEqual:
+    return Relation::Greater;
+  case Relation::Greater:
+    return Relation::LessEqual;
+  case Relation::GreaterEqual:
+    return Relation::Less;
+  }
+
+  JLM_UNREACHABLE("Unhandled relation.");
+}
+
+std::optional<size_t>
+ScalarEvolution::GetTripCount(const rvsdg::ThetaNode & thetaNode) const
+{
+  // Wider induction variables are not supported in order to avoid overflows in the computation
+  // below.
+  static constexpr size_t maxNumBits = 62;
+
+  auto repetition = GetThetaRepetition(thetaNode);
+  auto matchNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*repetition.predicate);
+  auto matchOperation =
+      matchNode ? dynamic_cast<const rvsdg::match_op *>(&matchNode->GetOperation()) : nullptr;
+  if (!matchOperation)
+    return std::nullopt;
+
+  auto alternative0 = matchOperation->alternative(0);
+  auto alternative1 = matchOperation->alternative(1);
+  if (alternative0 >= repetition.repeats.size() || alternative1 >= repetition.repeats.size()
+      || repetition.repeats[alternative0] == repetition.repeats[alternative1])
+    return std::nullopt;
+
+  auto compareNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*matchNode->input(0)->origin());
+  auto comparison = compareNode ? GetComparison(compareNode->GetOperation()) : std::nullopt;
+  if (!comparison)
+    return std::nullopt;
+
+  // Find the induction variable operand of the comparison. It is either the value of the
+  // induction variable in the current iteration, or its value for the next iteration.
+  const ChainRecurrence * chainRecurrence = nullptr;
+  size_t ivIndex = 0;
+  int64_t offset = 0;
+  for (size_t n = 0; n < 2 && !chainRecurrence; n++)
+  {
+    auto origin = compareNode->input(n)->origin();
+    ivIndex = n;
+    if ((chainRecurrence = GetChainRecurrence(*origin)))
+    {
+      offset = 0;
+      continue;
+    }
+
+    auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*origin);
+    for (size_t i = 0; node && i < node->ninputs() && !chainRecurrence; i++)
+    {
+      auto candidate = GetChainRecurrence(*node->input(i)->origin());
+      if (candidate && &candidate->GetUpdateNode() == node)
+      {
+        chainRecurrence = candidate;
+        offset = 1;
+      }
+    }
+  }
+
+  if (!chainRecurrence || !chainRecurrence->IsAffine()
+      || &chainRecurrence->GetThetaNode() != &thetaNode || chainRecurrence->NumBits() > maxNumBits)
+    return std::nullopt;
+
+  auto startValue = TryGetConstant(chainRecurrence->GetStart());
+  auto stepValue = TryGetConstant(chainRecurrence->GetStep());
+  auto endValue = TryGetConstant(*compareNode->input(1 - ivIndex)->origin());
+  if (!startValue || !stepValue || !endValue)
+    return std::nullopt;
+
+  // Determine the relation for which the loop is repeated, with the induction variable as left
+  // operand.
+  auto relation = ivIndex == 0 ? comparison->relation : Swap(comparison->relation);
+  if (!repetition.repeats[alternative1])
+    relation = Negate(relation);
+
+  const auto isSigned = comparison->isSigned;
+  const auto numBits = chainRecurrence->NumBits();
+  const int64_t minValue = isSigned ? -(int64_t(1) << (numBits - 1)) : 0;
+  const int64_t maxValue =
+      isSigned ? (int64_t(1) << (numBits - 1)) - 1 : (int64_t(1) << numBits) - 1;
+
+  auto start = isSigned ? startValue->to_int() : static_cast<int64_t>(startValue->to_uint());
+  auto end = isSigned ? endValue->to_int() : static_cast<int64_t>(endValue->to_uint());
+  auto step = chainRecurrence->IsSubtractive() ? -stepValue->to_int() : stepValue->to_int();
+
+  // The value of the induction variable that is compared in the first iteration
+  auto first = start + offset * step;
+  if (first < minValue || first > maxValue)
+    return std::nullopt;
+
+  // Normalize greater relations to less relations by negating all values
+  const bool isNegated = relation == Relation::Greater || relation == Relation::GreaterEqual;
+  if (isNegated)
+  {
+    relation = relation == Relation::Greater ? Relation::Less : Relation::LessEqual;
+    first = -first;
+    end = -end;
+    step = -step;
+  }
+
+  if (relation == Relation::LessEqual)
+  {
+    relation = Relation::Less;
+    end = end + 1;
+  }
+
+  // The number of iterations after the first one
+  int64_t numIterations = 0;
+  switch (relation)
+  {
+  case Relation::Equal:
+    if (first == end)
+    {
+      if (step == 0)
+        return std::nullopt;
+      numIterations = 1;
+    }
+    break;
+  case Relation::NotEqual:
+    if (first != end)
+    {
+      auto distance = end - first;
+      if (step == 0 || distance % step != 0 || distance / step < 0)
+        return std::nullopt;
+      numIterations = distance / step;
+    }
+    break;
+  case Relation::Less:
+    if (first < end)
+    {
+      if (step <= 0)
+        return std::nullopt;
+      numIterations = (end - first + step - 1) / step;
+    }
+    break;
+  default:
+    JLM_UNREACHABLE("Unhandled relation.");
+  }
+
+  // The induction variable is monotonic, i.e., it does not wrap around if its last compared
+  // value is representable.
+  auto last = first + numIterations * step;
+  last = isNegated ? -last : last;
+  if (last < minValue || last > maxValue)
+    return std::nullopt;
+
+  return static_cast<size_t>(numIterations) + 1;
+}
+
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_SCALAREVOLUTION_HPP
+#define JLM_LLVM_OPT_SCALAREVOLUTION_HPP
+
+#include <jlm/rvsdg/theta.hpp>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm::rvsdg
+{
+class bitvalue_repr;
+class SimpleNode;
+}
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Scalar evolution analysis of theta nodes
+ *
+ * Describes the evolution of the integer loop variables of theta nodes as chains of recurrences.
+ * A chain of recurrences {start, +, step} describes a loop variable that has the value start in
+ * the first iteration and is incremented by step at the end of every iteration. The step is
+ * either loop-invariant, which renders the loop variable an affine induction variable, or the
+ * value of another loop variable of the same theta node that is itself described by a chain of
+ * recurrences. The latter results in nested recurrences such as {0, +, {1, +, 2}}.
+ *
+ * A loop variable is only recognized if its value at the end of an iteration is computed by a
+ * single addition or subtraction at the top-level of the theta node's subregion. The value might
+ * be routed through a gamma node that also computes the predicate of the theta node, as created by
+ * the frontend for tail-controlled loops. Loop-invariant steps must be constants or invariant loop
+ * variables, i.e., loop-invariant computations should be hoisted before the analysis is run.
+ *
+ * The start of a chain of recurrences is the origin of the loop variable's input. It can be
+ * passed to GetChainRecurrence() to obtain the evolution of the start in an enclosing theta node.
+ */
+class ScalarEvolution final
+{
+public:
+  class ChainRecurrence;
+
+  ~ScalarEvolution() noexcept;
+
+  ScalarEvolution();
+
+  ScalarEvolution(const ScalarEvolution &) = delete;
+
+  ScalarEvolution &
+  operator=(const ScalarEvolution &) = delete;
+
+  /**
+   * Computes the chains of recurrences of all theta nodes in \p region and its subregions.
+   */
+  void
+  AnalyzeRegion(const rvsdg::Region & region);
+
+  /**
+   * Computes the chains of recurrences of the loop variables of \p thetaNode. Nested theta nodes
+   * are not analyzed.
+   */
+  void
+  AnalyzeTheta(const rvsdg::ThetaNode & thetaNode);
+
+  /**
+   * @param output The argument of a loop variable in the subregion of an analyzed theta node.
+   * @return The chain of recurrences of the loop variable, or nullptr if its evolution is unknown.
+   */
+  [[nodiscard]] const ChainRecurrence *
+  GetChainRecurrence(const rvsdg::output & output) const noexcept;
+
+  /**
+   * Computes the number of times the subregion of \p thetaNode is executed. The trip count is
+   * known if the predicate of \p thetaNode compares an affine induction variable with a constant
+   * start and step, or its incremented value, against a constant, and the induction variable does
+   * not wrap around before the loop exits.
+   *
+   * @return The trip count of \p thetaNode, or std::nullopt if it is unknown.
+   */
+  [[nodiscard]] std::optional<size_t>
+  GetTripCount(const rvsdg::ThetaNode & thetaNode) const;
+
+  /**
+   * Determines whether \p output is a constant, or an invariant loop variable of an enclosing
+   * theta node whose value is a constant.
+   *
+   * @return The value of the constant, or nullptr if \p output is not a constant.
+   */
+  [[nodiscard]] static const rvsdg::bitvalue_repr *
+  TryGetConstant(const rvsdg::output & output) noexcept;
+
+  /**
+   * Determines whether \p output is loop-invariant in the theta node whose subregion it is in,
+   * i.e., whether it is a constant or an invariant loop variable.
+   */
+  [[nodiscard]] static bool
+  IsLoopInvariant(const rvsdg::output & output) noexcept;
+
+private:
+  const ChainRecurrence *
+  AnalyzeLoopVar(const rvsdg::ThetaNode & thetaNode, const rvsdg::ThetaNode::LoopVar & loopVar);
+
+  std::unordered_map<const rvsdg::output *, std::unique_ptr<ChainRecurrence>> ChainRecurrences_;
+  std::unordered_set<const rvsdg::output *> AnalyzedLoopVars_;
+};
+
+/**
+ * The chain of recurrences {start, +, step} of a loop variable.
+ */
+class ScalarEvolution::ChainRecurrence final
+{
+public:
+  ChainRecurrence(
+      const rvsdg::ThetaNode & thetaNode,
+      rvsdg::ThetaNode::LoopVar loopVar,
+      rvsdg::SimpleNode & updateNode,
+      rvsdg::output & step,
+      const ChainRecurrence * stepRecurrence)
+      : ThetaNode_(&thetaNode),
+        LoopVar_(std::move(loopVar)),
+        UpdateNode_(&updateNode),
+        Step_(&step),
+        StepRecurrence_(stepRecurrence)
+  {}
+
+  [[nodiscard]] const rvsdg::ThetaNode &
+  GetThetaNode() const noexcept
+  {
+    return *ThetaNode_;
+  }
+
+  [[nodiscard]] const rvsdg::ThetaNode::LoopVar &
+  GetLoopVar() const noexcept
+  {
+    return LoopVar_;
+  }
+
+  /**
+   * @return The value of the loop variable in the first iteration.
+   */
+  [[nodiscard]] rvsdg::output &
+  GetStart() const noexcept
+  {
+    return *LoopVar_.input->origin();
+  }
+
+  /**
+   * @return The step of the recurrence in the theta node's subregion. For nested recurrences,
+   * this is the argument of the loop variable described by GetStepRecurrence().
+   */
+  [[nodiscard]] rvsdg::output &
+  GetStep() const noexcept
+  {
+    return *Step_;
+  }
+
+  /**
+   * @return The chain of recurrences of the step, or nullptr if the step is loop-invariant.
+   */
+  [[nodiscard]] const ChainRecurrence *
+  GetStepRecurrence() const noexcept
+  {
+    return StepRecurrence_;
+  }
+
+  /**
+   * @return The addition or subtraction node that computes the value of the next iteration.
+   */
+  [[nodiscard]] rvsdg::SimpleNode &
+  GetUpdateNode() const noexcept
+  {
+    return *UpdateNode_;
+  }
+
+  /**
+   * @return True if the step is subtracted instead of added in every iteration.
+   */
+  [[nodiscard]] bool
+  IsSubtractive() const noexcept;
+
+  /**
+   * @return True if the step is loop-invariant, i.e., the loop variable is an affine induction
+   * variable.
+   */
+  [[nodiscard]] bool
+  IsAffine() const noexcept
+  {
+    return StepRecurrence_ == nullptr;
+  }
+
+  /**
+   * @return The degree of the polynomial described by the chain of recurrences, e.g., one for
+   * affine induction variables.
+   */
+  [[nodiscard]] size_t
+  GetDegree() const noexcept
+  {
+    return IsAffine() ? 1 : StepRecurrence_->GetDegree() + 1;
+  }
+
+  [[nodiscard]] size_t
+  NumBits() const noexcept;
+
+private:
+  const rvsdg::ThetaNode * ThetaNode_;
+  rvsdg::ThetaNode::LoopVar LoopVar_;
+  rvsdg::SimpleNode * UpdateNode_;
+  rvsdg::output * Step_;
+  const ChainRecurrence * StepRecurrence_;
+};
+
+}
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/ScalarPromotion.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace jlm::llvm
+{
+
+/**
+ * Collects the number of promoted locations and removed loads and stores.
+ */
+class ScalarPromotion::Context final
+{
+public:
+  [[nodiscard]] size_t
+  NumPromotedLocations() const noexcept
+  {
+    return NumPromotedLocations_;
+  }
+
+  [[nodiscard]] size_t
+  NumRemovedLoadsAndStores() const noexcept
+  {
+    return NumRemovedLoadsAndStores_;
+  }
+
+  void
+  AddPromotedLocation(size_t numRemovedLoadsAndStores) noexcept
+  {
+    NumPromotedLocations_++;
+    NumRemovedLoadsAndStores_ += numRemovedLoadsAndStores;
+  }
+
+private:
+  size_t NumPromotedLocations_ = 0;
+  size_t NumRemovedLoadsAndStores_ = 0;
+};
+
+class ScalarPromotion::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumPromotedLocationsLabel_ = "#PromotedLocations";
+  static constexpr const char * NumRemovedLoadsAndStoresLabel_ = "#RemovedLoadsAndStores";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Id::ScalarPromotion, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::Graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::Graph & graph, const Context & context) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddMeasurement(NumPromotedLocationsLabel_, context.NumPromotedLocations());
+    AddMeasurement(NumRemovedLoadsAndStoresLabel_, context.NumRemovedLoadsAndStores());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * Maps the address \p output in the subregion of \p thetaNode to its value in front of
+ * \p thetaNode. I/O barriers are looked through if their I/O state is invariant in the loop.
+ *
+ * @return The address in front of \p thetaNode, or nullptr if \p output is not loop-invariant.
+ */
+static rvsdg::output *
+GetInvariantAddress(const rvsdg::ThetaNode & thetaNode, const rvsdg::output & output)
+{
+  auto isInvariant = [&](const rvsdg::output & origin)
+  {
+    return rvsdg::TryGetRegionParentNode<rvsdg::ThetaNode>(origin) == &thetaNode
+        && rvsdg::ThetaLoopVarIsInvariant(thetaNode.MapPreLoopVar(origin));
+  };
+
+  auto origin = &output;
+  while (auto ioBarrierNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*origin))
+  {
+    if (!rvsdg::is<IOBarrierOperation>(ioBarrierNode)
+        || !isInvariant(*ioBarrierNode->input(1)->origin()))
+      return nullptr;
+
+    origin = ioBarrierNode->input(0)->origin();
+  }
+
+  return isInvariant(*origin) ? thetaNode.MapPreLoopVar(*origin).input->origin() : nullptr;
+}
+
+/**
+ * Collects the loads and stores the memory state of \p loopVar is threaded through in the order
+ * of the memory state.
+ *
+ * @return The loads and stores, or std::nullopt if the memory state is used by other nodes, or
+ * not threaded through a single sequence.
+ */
+static std::optional<std::vector<rvsdg::SimpleNode *>>
+GetLoadsAndStores(const rvsdg::ThetaNode::LoopVar & loopVar)
+{
+  std::vector<rvsdg::SimpleNode *> nodes;
+  auto output = loopVar.pre;
+  while (true)
+  {
+    if (output->nusers() != 1)
+      return std::nullopt;
+
+    auto user = *output->begin();
+    if (user == loopVar.post)
+      return nodes;
+
+    if (auto loadNode = rvsdg::TryGetOwnerNode<LoadNonVolatileNode>(*user))
+    {
+      if (loadNode->NumMemoryStates() != 1)
+        return std::nullopt;
+
+      nodes.push_back(loadNode);
+      output = loadNode->output(1);
+    }
+    else if (auto storeNode = rvsdg::TryGetOwnerNode<StoreNonVolatileNode>(*user))
+    {
+      if (storeNode->NumMemoryStates() != 1 || user != storeNode->input(2))
+        return std::nullopt;
+
+      nodes.push_back(storeNode);
+      output = storeNode->output(0);
+    }
+    else if (auto thetaNode = rvsdg::TryGetOwnerNode<rvsdg::ThetaNode>(*user))
+    {
+      auto innerLoopVar = thetaNode->MapInputLoopVar(*user);
+      if (!rvsdg::ThetaLoopVarIsInvariant(innerLoopVar))
+        return std::nullopt;
+
+      output = innerLoopVar.output;
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+}
+
+/**
+ * Promotes the location accessed by the loads and stores on the memory state of \p loopVar.
+ *
+ * @return The number of removed loads and stores, or zero if the location was not promoted.
+ */
+static size_t
+Promote(rvsdg::ThetaNode & thetaNode, const rvsdg::ThetaNode::LoopVar & loopVar)
+{
+  if (!is<MemoryStateType>(loopVar.pre->type()) || rvsdg::ThetaLoopVarIsInvariant(loopVar))
+    return 0;
+
+  auto nodes = GetLoadsAndStores(loopVar);
+  if (!nodes || nodes->empty())
+    return 0;
+
+  auto getValueType = [](const rvsdg::SimpleNode & node)
+  {
+    if (auto loadNode = dynamic_cast<const LoadNonVolatileNode *>(&node))
+      return loadNode->GetLoadedValueOutput().Type();
+
+    return util::AssertedCast<const StoreNonVolatileNode>(&node)->GetStoredValueInput().Type();
+  };
+
+  // All loads and stores must access the same address with the same type, and at least one of
+  // them must be a store. Otherwise, the loads are left to loop-invariant code motion.
+  auto valueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(getValueType(*nodes->front()));
+  auto address = GetInvariantAddress(thetaNode, *nodes->front()->input(0)->origin());
+  if (!address)
+    return 0;
+
+  size_t alignment = std::numeric_limits<size_t>::max();
+  bool hasStore = false;
+  for (auto node : *nodes)
+  {
+    if (*getValueType(*node) != *valueType
+        || GetInvariantAddress(thetaNode, *node->input(0)->origin()) != address)
+      return 0;
+
+    auto storeNode = dynamic_cast<const StoreNonVolatileNode *>(node);
+    auto loadNode = dynamic_cast<const LoadNonVolatileNode *>(node);
+    auto nodeAlignment = storeNode ? storeNode->GetAlignment() : loadNode->GetAlignment();
+    alignment = std::min(alignment, nodeAlignment);
+    hasStore |= storeNode != nullptr;
+  }
+
+  if (!hasStore)
+    return 0;
+
+  // The location is only loaded in front of the loop if its value is loaded before it is stored
+  auto region = thetaNode.region();
+  rvsdg::output * initialValue = nullptr;
+  if (rvsdg::is<LoadNonVolatileOperation>(nodes->front()))
+  {
+    auto & loadNode = LoadNonVolatileNode::CreateNode(
+        *address,
+        { loopVar.input->origin() },
+        valueType,
+        alignment);
+    loopVar.input->divert_to(loadNode.output(1));
+    initialValue = &loadNode.GetLoadedValueOutput();
+  }
+  else
+  {
+    initialValue = UndefValueOperation::Create(*region, valueType);
+  }
+
+  // Replace the loads and stores by a loop variable that holds the value of the location
+  auto valueLoopVar = thetaNode.AddLoopVar(initialValue);
+  rvsdg::output * value = valueLoopVar.pre;
+  for (auto node : *nodes)
+  {
+    if (auto loadNode = dynamic_cast<LoadNonVolatileNode *>(node))
+    {
+      loadNode->GetLoadedValueOutput().divert_users(value);
+      loadNode->output(1)->divert_users(loadNode->input(1)->origin());
+    }
+    else
+    {
+      value = node->input(1)->origin();
+      node->output(0)->divert_users(node->input(2)->origin());
+    }
+
+    remove(node);
+  }
+  valueLoopVar.post->divert_to(value);
+
+  // Store the value of the location after the loop
+  std::vector<rvsdg::input *> users;
+  for (auto & user : *loopVar.output)
+    users.push_back(user);
+
+  auto & storeNode = StoreNonVolatileNode::CreateNode(
+      *address,
+      *valueLoopVar.output,
+      { loopVar.output },
+      alignment);
+  for (auto user : users)
+    user->divert_to(storeNode.output(0));
+
+  return nodes->size();
+}
+
+static void
+Promote(rvsdg::ThetaNode & thetaNode, ScalarPromotion::Context & context)
+{
+  // Promotions add loop variables, so collect the memory state loop variables upfront
+  for (auto & loopVar : thetaNode.GetLoopVars())
+  {
+    if (auto numRemovedLoadsAndStores = Promote(thetaNode, loopVar))
+      context.AddPromotedLocation(numRemovedLoadsAndStores);
+  }
+}
+
+static void
+Promote(rvsdg::Region & region, ScalarPromotion::Context & context)
+{
+  // Promotions add nodes to the region, so collect the structural nodes upfront
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      Promote(*structuralNode->subregion(n), context);
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+      Promote(*thetaNode, context);
+  }
+}
+
+ScalarPromotion::~ScalarPromotion() noexcept = default;
+
+void
+ScalarPromotion::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto & graph = module.Rvsdg();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+
+  Context context;
+  statistics->Start(graph);
+  Promote(graph.GetRootRegion(), context);
+  statistics->Stop(graph, context);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+void
+ScalarPromotion::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  Context context;
+  Promote(*lambdaNode.subregion(), context);
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_SCALARPROMOTION_HPP
+#define JLM_LLVM_OPT_SCALARPROMOTION_HPP
+
+#include <jlm/rvsdg/Transformation.hpp>
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Scalar Promotion
+ *
+ * Promotes memory locations that are loaded and stored in every iteration of a theta node to loop
+ * variables. A memory state loop variable is promoted if its memory state is threaded through a
+ * sequence of non-volatile loads and stores, and invariant loop variables of nested theta nodes.
+ * All loads and stores must have a single memory state and access the same loop-invariant address
+ * with the same type. The memory state encoding of the alias analyses sequences every node that
+ * might access the memory of the loads and stores with this memory state, i.e., the location is
+ * not aliased by any other node in the loop.
+ *
+ * A promoted location is loaded in front of the theta node and stored after it. The loads and
+ * stores in the loop are replaced by a new loop variable that holds the value of the location. The
+ * location is only loaded in front of the theta node if its value is loaded before it is first
+ * stored in an iteration.
+ *
+ * Nested theta nodes are processed before their enclosing theta node in order to promote
+ * locations through several loops. The memory state loop variable of a promoted location is
+ * invariant, and the hoisted load and store can be promoted in the enclosing loop.
+ *
+ * \note The I/O barriers the front-end inserts on addresses are ignored if the I/O state is
+ * invariant in the loop.
+ */
+class ScalarPromotion final : public rvsdg::Transformation
+{
+public:
+  class Context;
+  class Statistics;
+
+  ~ScalarPromotion() noexcept override;
+
+  ScalarPromotion() = default;
+
+  ScalarPromotion(const ScalarPromotion &) = delete;
+
+  ScalarPromotion &
+  operator=(const ScalarPromotion &) = delete;
+
+  void
+  Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::ScalarPromotion;
+  }
+};
+
+}
+
+#endif
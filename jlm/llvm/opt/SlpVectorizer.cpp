@@ -0,0 +1,722 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
+#include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/ScalarEvolution.hpp>
+#include <jlm/llvm/opt/SlpVectorizer.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm::llvm
+{
+
+/**
+ * Collects the number of vectorized store groups and replaced scalar nodes.
+ */
+class SlpVectorizer::Context final
+{
+public:
+  explicit Context(size_t vectorWidth)
+      : VectorWidth_(vectorWidth)
+  {}
+
+  [[nodiscard]] size_t
+  GetVectorWidth() const noexcept
+  {
+    return VectorWidth_;
+  }
+
+  [[nodiscard]] size_t
+  NumVectorizedStoreGroups() const noexcept
+  {
+    return NumVectorizedStoreGroups_;
+  }
+
+  [[nodiscard]] size_t
+  NumVectorizedNodes() const noexcept
+  {
+    return NumVectorizedNodes_;
+  }
+
+  void
+  AddVectorizedStoreGroup(size_t numVectorizedNodes) noexcept
+  {
+    NumVectorizedStoreGroups_++;
+    NumVectorizedNodes_ += numVectorizedNodes;
+  }
+
+private:
+  size_t VectorWidth_;
+  size_t NumVectorizedStoreGroups_ = 0;
+  size_t NumVectorizedNodes_ = 0;
+};
+
+class SlpVectorizer::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumVectorizedStoreGroupsLabel_ = "#VectorizedStoreGroups";
+  static constexpr const char * NumVectorizedNodesLabel_ = "#VectorizedNodes";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Id::SlpVectorizer, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::Graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::Graph & graph, const Context & context) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddMeasurement(NumVectorizedStoreGroupsLabel_, context.NumVectorizedStoreGroups());
+    AddMeasurement(NumVectorizedNodesLabel_, context.NumVectorizedNodes());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+namespace
+{
+
+/**
+ * An address computed by a GetElementPtr node, where the last index is split into a symbolic
+ * index and a constant offset.
+ */
+struct Address
+{
+  const rvsdg::SimpleNode * getElementPtrNode;
+  std::vector<const rvsdg::output *> prefix;
+  const rvsdg::output * index;
+  int64_t offset;
+
+  [[nodiscard]] bool
+  IsAdjacentTo(const Address & other) const noexcept
+  {
+    return getElementPtrNode->GetOperation() == other.getElementPtrNode->GetOperation()
+        && prefix == other.prefix && index == other.index;
+  }
+};
+
+/**
+ * A group of scalar values, one per vector lane, that is replaced by a single vector value.
+ */
+struct Pack
+{
+  enum class Kind
+  {
+    Unary,
+    Binary,
+    Load,
+    Constant,
+    Gather
+  };
+
+  Kind kind;
+  std::vector<rvsdg::output *> lanes;
+  std::vector<std::unique_ptr<Pack>> operands;
+
+  /**
+   * @return The number of vector nodes that are created for the pack and its operands.
+   */
+  [[nodiscard]] size_t
+  NumVectorNodes() const noexcept
+  {
+    size_t numNodes = kind == Kind::Gather ? lanes.size() : 1;
+    for (auto & operand : operands)
+      numNodes += operand->NumVectorNodes();
+
+    return numNodes;
+  }
+
+  /**
+   * @return The number of scalar nodes that are replaced by the pack and its operands.
+   */
+  [[nodiscard]] size_t
+  NumScalarNodes() const noexcept
+  {
+    size_t numNodes = kind == Kind::Constant || kind == Kind::Gather ? 0 : lanes.size();
+    for (auto & operand : operands)
+      numNodes += operand->NumScalarNodes();
+
+    return numNodes;
+  }
+};
+
+}
+
+/**
+ * The maximal depth of packed operand trees
+ */
+static constexpr size_t MaxPackDepth = 16;
+
+/**
+ * @return The number of bits of \p type if it can be the element type of a vector, otherwise 0.
+ */
+static size_t
+GetElementNumBits(const rvsdg::Type & type)
+{
+  if (auto bitType = dynamic_cast<const rvsdg::bittype *>(&type))
+    return bitType->nbits();
+
+  if (auto floatingPointType = dynamic_cast<const FloatingPointType *>(&type))
+  {
+    switch (floatingPointType->size())
+    {
+    case fpsize::half:
+      return 16;
+    case fpsize::flt:
+      return 32;
+    case fpsize::dbl:
+      return 64;
+    default:
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+static std::shared_ptr<const FixedVectorType>
+CreateVectorType(const rvsdg::output & lane, size_t numLanes)
+{
+  auto elementType = std::dynamic_pointer_cast<const rvsdg::ValueType>(lane.Type());
+  JLM_ASSERT(elementType);
+  return FixedVectorType::Create(elementType, numLanes);
+}
+
+static bool
+IsAddition(const rvsdg::SimpleNode & node)
+{
+  return rvsdg::is<rvsdg::bitadd_op>(&node) || rvsdg::is<IntegerAddOperation>(&node);
+}
+
+/**
+ * Decomposes \p output, the address operand of a load or store of \p elementType.
+ *
+ * @return The decomposed address, or std::nullopt if \p output is not computed by a
+ * GetElementPtr node whose last index selects an element of \p elementType.
+ */
+static std::optional<Address>
+DecomposeAddress(const rvsdg::output & output, const rvsdg::Type & elementType)
+{
+  // The frontend sequences address computations with I/O barriers
+  auto origin = &output;
+  while (auto ioBarrierNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*origin))
+  {
+    if (!rvsdg::is<IOBarrierOperation>(ioBarrierNode))
+      break;
+
+    origin = ioBarrierNode->input(0)->origin();
+  }
+
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*origin);
+  auto operation =
+      node ? dynamic_cast<const GetElementPtrOperation *>(&node->GetOperation()) : nullptr;
+  if (!operation || node->ninputs() < 2)
+    return std::nullopt;
+
+  // All indices but the first select an element of an array
+  const rvsdg::ValueType * type = &operation->GetPointeeType();
+  for (size_t n = 2; n < node->ninputs(); n++)
+  {
+    auto arrayType = dynamic_cast<const ArrayType *>(type);
+    if (!arrayType)
+      return std::nullopt;
+
+    type = &arrayType->element_type();
+  }
+
+  if (*type != elementType)
+    return std::nullopt;
+
+  Address address{ node, {}, nullptr, 0 };
+  for (size_t n = 0; n < node->ninputs() - 1; n++)
+    address.prefix.push_back(node->input(n)->origin());
+
+  // Split the last index into additions of constants to a symbolic index
+  auto index = node->input(node->ninputs() - 1)->origin();
+  while (index)
+  {
+    if (auto value = ScalarEvolution::TryGetConstant(*index))
+    {
+      address.offset += value->to_int();
+      index = nullptr;
+      break;
+    }
+
+    auto additionNode = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*index);
+    if (!additionNode || !IsAddition(*additionNode))
+      break;
+
+    auto value0 = ScalarEvolution::TryGetConstant(*additionNode->input(0)->origin());
+    auto value1 = ScalarEvolution::TryGetConstant(*additionNode->input(1)->origin());
+    if (!value0 && !value1)
+      break;
+
+    address.offset += value1 ? value1->to_int() : value0->to_int();
+    index = additionNode->input(value1 ? 0 : 1)->origin();
+  }
+
+  address.index = index;
+  return address;
+}
+
+/**
+ * @return True if \p addresses are adjacent, and lane n accesses the n-th element.
+ */
+static bool
+AreConsecutive(const std::vector<std::optional<Address>> & addresses)
+{
+  for (size_t n = 0; n < addresses.size(); n++)
+  {
+    if (!addresses[n] || !addresses[n]->IsAdjacentTo(*addresses[0])
+        || addresses[n]->offset != addresses[0]->offset + static_cast<int64_t>(n))
+      return false;
+  }
+
+  return true;
+}
+
+static std::vector<rvsdg::output *>
+GetMemoryStateOrigins(const LoadNonVolatileNode & loadNode)
+{
+  std::vector<rvsdg::output *> origins;
+  for (auto & input : loadNode.MemoryStateInputs())
+    origins.push_back(input.origin());
+
+  return origins;
+}
+
+/**
+ * Determines whether \p loadNodes can be replaced by a single vector load. The loads must either
+ * consume the same memory states, or the memory states of another of the loads.
+ *
+ * @return The memory states the vector load consumes, or std::nullopt if the loads cannot be
+ * replaced.
+ */
+static std::optional<std::vector<rvsdg::output *>>
+GetVectorLoadMemoryStates(const std::vector<LoadNonVolatileNode *> & loadNodes)
+{
+  std::optional<std::vector<rvsdg::output *>> memoryStates;
+  for (auto loadNode : loadNodes)
+  {
+    auto origins = GetMemoryStateOrigins(*loadNode);
+    auto isLoadState = [&](const LoadNonVolatileNode * other)
+    {
+      for (size_t n = 0; n < origins.size(); n++)
+      {
+        if (origins[n] != other->output(n + 1))
+          return false;
+      }
+
+      return other != loadNode && !origins.empty();
+    };
+
+    if (std::any_of(loadNodes.begin(), loadNodes.end(), isLoadState))
+      continue;
+
+    if (memoryStates && *memoryStates != origins)
+      return std::nullopt;
+
+    memoryStates = std::move(origins);
+  }
+
+  return memoryStates;
+}
+
+/**
+ * Packs \p lanes, the values consumed by a packed parent computation.
+ */
+static std::unique_ptr<Pack>
+CreatePack(const std::vector<rvsdg::output *> & lanes, size_t depth)
+{
+  auto pack = std::make_unique<Pack>();
+  pack->lanes = lanes;
+  pack->kind = Pack::Kind::Gather;
+
+  std::vector<rvsdg::SimpleNode *> nodes;
+  for (auto lane : lanes)
+  {
+    auto node = rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*lane);
+    if (!node || GetElementNumBits(lane->type()) == 0)
+      return pack;
+
+    nodes.push_back(node);
+  }
+
+  auto & operation = nodes[0]->GetOperation();
+  auto isConstant = [](const rvsdg::SimpleNode * node)
+  {
+    return rvsdg::is<rvsdg::bitconstant_op>(node) || rvsdg::is<ConstantFP>(node);
+  };
+  if (std::all_of(nodes.begin(), nodes.end(), isConstant))
+  {
+    pack->kind = Pack::Kind::Constant;
+    return pack;
+  }
+
+  // Every scalar node must be distinct and exclusively used by the packed parent computation,
+  // such that it can be removed after vectorization.
+  for (size_t n = 0; n < nodes.size(); n++)
+  {
+    if (lanes[n]->nusers() != 1 || !(nodes[n]->GetOperation() == operation))
+      return pack;
+
+    if (std::find(nodes.begin(), nodes.begin() + n, nodes[n]) != nodes.begin() + n)
+      return pack;
+  }
+
+  if (auto loadNode = dynamic_cast<LoadNonVolatileNode *>(nodes[0]))
+  {
+    std::vector<LoadNonVolatileNode *> loadNodes;
+    std::vector<std::optional<Address>> addresses;
+    for (auto node : nodes)
+    {
+      loadNodes.push_back(util::AssertedCast<LoadNonVolatileNode>(node));
+      addresses.push_back(DecomposeAddress(*node->input(0)->origin(), lanes[0]->type()));
+    }
+
+    if (loadNode->output(0) == lanes[0] && AreConsecutive(addresses)
+        && GetVectorLoadMemoryStates(loadNodes))
+      pack->kind = Pack::Kind::Load;
+
+    return pack;
+  }
+
+  auto isUnary = dynamic_cast<const rvsdg::UnaryOperation *>(&operation) != nullptr;
+  auto isBinary = dynamic_cast<const rvsdg::BinaryOperation *>(&operation) != nullptr;
+  if ((!isUnary && !isBinary) || nodes[0]->noutputs() != 1 || depth >= MaxPackDepth)
+    return pack;
+
+  pack->kind = isUnary ? Pack::Kind::Unary : Pack::Kind::Binary;
+  for (size_t i = 0; i < nodes[0]->ninputs(); i++)
+  {
+    std::vector<rvsdg::output *> operandLanes;
+    for (auto node : nodes)
+      operandLanes.push_back(node->input(i)->origin());
+
+    pack->operands.push_back(CreatePack(operandLanes, depth + 1));
+  }
+
+  return pack;
+}
+
+/**
+ * Creates the vector nodes for \p pack in \p region.
+ *
+ * @return The vector value of \p pack.
+ */
+static rvsdg::output *
+EmitPack(rvsdg::Region & region, const Pack & pack)
+{
+  auto numLanes = pack.lanes.size();
+  auto vectorType = CreateVectorType(*pack.lanes[0], numLanes);
+
+  switch (pack.kind)
+  {
+  case Pack::Kind::Unary:
+  {
+    auto & node = *rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*pack.lanes[0]);
+    auto & operation = *util::AssertedCast<const rvsdg::UnaryOperation>(&node.GetOperation());
+    auto operand = EmitPack(region, *pack.operands[0]);
+    auto operandType = CreateVectorType(*pack.operands[0]->lanes[0], numLanes);
+    vectorunary_op vectorOperation(operation, operandType, vectorType);
+    return rvsdg::SimpleNode::Create(region, vectorOperation, { operand }).output(0);
+  }
+  case Pack::Kind::Binary:
+  {
+    auto & node = *rvsdg::TryGetOwnerNode<rvsdg::SimpleNode>(*pack.lanes[0]);
+    auto & operation = *util::AssertedCast<const rvsdg::BinaryOperation>(&node.GetOperation());
+    auto operand0 = EmitPack(region, *pack.operands[0]);
+    auto operand1 = EmitPack(region, *pack.operands[1]);
+    auto operandType = CreateVectorType(*pack.operands[0]->lanes[0], numLanes);
+    vectorbinary_op vectorOperation(operation, operandType, operandType, vectorType);
+    return rvsdg::SimpleNode::Create(region, vectorOperation, { operand0, operand1 }).output(0);
+  }
+  case Pack::Kind::Load:
+  {
+    std::vector<LoadNonVolatileNode *> loadNodes;
+    for (auto lane : pack.lanes)
+      loadNodes.push_back(rvsdg::TryGetOwnerNode<LoadNonVolatileNode>(*lane));
+
+    auto & loadNode = *loadNodes[0];
+    auto & vectorLoadNode = LoadNonVolatileNode::CreateNode(
+        *loadNode.GetAddressInput().origin(),
+        *GetVectorLoadMemoryStates(loadNodes),
+        vectorType,
+        loadNode.GetAlignment());
+
+    for (auto node : loadNodes)
+    {
+      for (size_t n = 1; n < node->noutputs(); n++)
+        node->output(n)->divert_users(vectorLoadNode.output(n));
+    }
+
+    return &vectorLoadNode.GetLoadedValueOutput();
+  }
+  case Pack::Kind::Constant:
+  {
+    constantvector_op vectorOperation(vectorType);
+    return rvsdg::SimpleNode::Create(region, vectorOperation, pack.lanes).output(0);
+  }
+  case Pack::Kind::Gather:
+  {
+    auto indexType = rvsdg::bittype::Create(32);
+    auto elementType = std::static_pointer_cast<const rvsdg::ValueType>(pack.lanes[0]->Type());
+    insertelement_op insertOperation(vectorType, elementType, indexType);
+
+    auto vector = UndefValueOperation::Create(region, vectorType);
+    for (size_t n = 0; n < numLanes; n++)
+    {
+      auto index = rvsdg::create_bitconstant(&region, 32, n);
+      vector = rvsdg::SimpleNode::Create(region, insertOperation, { vector, pack.lanes[n], index })
+                   .output(0);
+    }
+
+    return vector;
+  }
+  }
+
+  JLM_UNREACHABLE("Unhandled pack kind.");
+}
+
+/**
+ * Removes the scalar nodes replaced by \p pack, which must be dead after the vectorization.
+ */
+static void
+RemovePack(const Pack & pack)
+{
+  if (pack.kind == Pack::Kind::Constant || pack.kind == Pack::Kind::Gather)
+    return;
+
+  for (auto lane : pack.lanes)
+  {
+    auto node = rvsdg::TryGetOwnerNode<rvsdg::Node>(*lane);
+    JLM_ASSERT(node->IsDead());
+    remove(node);
+  }
+
+  for (auto & operand : pack.operands)
+    RemovePack(*operand);
+}
+
+/**
+ * @return The store that exclusively consumes all memory states of \p storeNode, or nullptr.
+ */
+static StoreNonVolatileNode *
+GetSuccessorStore(const StoreNonVolatileNode & storeNode)
+{
+  StoreNonVolatileNode * successor = nullptr;
+  for (auto & output : storeNode.MemoryStateOutputs())
+  {
+    if (output.nusers() != 1)
+      return nullptr;
+
+    auto user = *output.begin();
+    auto userNode = rvsdg::TryGetOwnerNode<StoreNonVolatileNode>(*user);
+    if (!userNode || (successor && userNode != successor)
+        || userNode->NumMemoryStates() != storeNode.NumMemoryStates()
+        || user->index() != output.index() + 2)
+      return nullptr;
+
+    successor = userNode;
+  }
+
+  return successor;
+}
+
+/**
+ * Tries to replace the \p numLanes stores starting at \p first in \p chain by a vector store.
+ *
+ * @return True if the stores were vectorized.
+ */
+static bool
+VectorizeStores(
+    const std::vector<StoreNonVolatileNode *> & chain,
+    size_t first,
+    size_t numLanes,
+    SlpVectorizer::Context & context)
+{
+  auto & elementType = chain[first]->GetStoredValueInput().type();
+
+  // Order the stores by their offsets
+  std::vector<std::pair<std::optional<Address>, StoreNonVolatileNode *>> stores;
+  for (size_t n = first; n < first + numLanes; n++)
+  {
+    auto storeNode = chain[n];
+    if (storeNode->GetStoredValueInput().type() != elementType)
+      return false;
+
+    auto address = DecomposeAddress(*storeNode->GetAddressInput().origin(), elementType);
+    if (!address)
+      return false;
+
+    stores.emplace_back(std::move(address), storeNode);
+  }
+
+  std::sort(
+      stores.begin(),
+      stores.end(),
+      [](const auto & a, const auto & b)
+      {
+        return a.first->offset < b.first->offset;
+      });
+
+  std::vector<std::optional<Address>> addresses;
+  std::vector<rvsdg::output *> lanes;
+  for (auto & [address, storeNode] : stores)
+  {
+    addresses.push_back(address);
+    lanes.push_back(storeNode->GetStoredValueInput().origin());
+  }
+
+  if (!AreConsecutive(addresses))
+    return false;
+
+  // The stores are replaced by a single vector store
+  auto pack = CreatePack(lanes, 0);
+  auto numVectorNodes = pack->NumVectorNodes() + 1;
+  auto numScalarNodes = pack->NumScalarNodes() + numLanes;
+  if (numVectorNodes >= numScalarNodes)
+    return false;
+
+  auto & region = *chain[first]->region();
+  auto & firstStoreNode = *chain[first];
+  auto & lastStoreNode = *chain[first + numLanes - 1];
+  auto & lowestStoreNode = *stores[0].second;
+
+  // Vector loads take over the memory states of the scalar loads, so the memory states of the
+  // stores are only collected after the packed values are emitted.
+  auto vector = EmitPack(region, *pack);
+
+  std::vector<rvsdg::output *> memoryStates;
+  for (auto & input : firstStoreNode.MemoryStateInputs())
+    memoryStates.push_back(input.origin());
+
+  auto & vectorStoreNode = StoreNonVolatileNode::CreateNode(
+      *lowestStoreNode.GetAddressInput().origin(),
+      *vector,
+      memoryStates,
+      lowestStoreNode.GetAlignment());
+
+  for (size_t n = 0; n < lastStoreNode.noutputs(); n++)
+    lastStoreNode.output(n)->divert_users(vectorStoreNode.output(n));
+
+  for (size_t n = first + numLanes; n > first; n--)
+    remove(chain[n - 1]);
+  RemovePack(*pack);
+
+  context.AddVectorizedStoreGroup(numScalarNodes);
+  return true;
+}
+
+static void
+VectorizeRegion(rvsdg::Region & region, SlpVectorizer::Context & context)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        VectorizeRegion(*structuralNode->subregion(n), context);
+    }
+  }
+
+  // Collect the chains of stores
+  std::vector<StoreNonVolatileNode *> storeNodes;
+  std::unordered_map<StoreNonVolatileNode *, StoreNonVolatileNode *> successors;
+  std::unordered_set<StoreNonVolatileNode *> hasPredecessor;
+  for (auto & node : region.Nodes())
+  {
+    auto storeNode = dynamic_cast<StoreNonVolatileNode *>(&node);
+    if (!storeNode)
+      continue;
+
+    auto successor = GetSuccessorStore(*storeNode);
+    storeNodes.push_back(storeNode);
+    successors[storeNode] = successor;
+    if (successor)
+      hasPredecessor.insert(successor);
+  }
+
+  std::vector<std::vector<StoreNonVolatileNode *>> chains;
+  for (auto storeNode : storeNodes)
+  {
+    if (hasPredecessor.find(storeNode) != hasPredecessor.end())
+      continue;
+
+    std::vector<StoreNonVolatileNode *> chain;
+    for (auto node = storeNode; node; node = successors[node])
+      chain.push_back(node);
+
+    if (chain.size() >= 2)
+      chains.push_back(std::move(chain));
+  }
+
+  for (auto & chain : chains)
+  {
+    size_t first = 0;
+    while (first + 1 < chain.size())
+    {
+      auto numBits = GetElementNumBits(chain[first]->GetStoredValueInput().type());
+      auto numLanes = numBits != 0 ? context.GetVectorWidth() / numBits : 0;
+      if (numLanes >= 2 && first + numLanes <= chain.size()
+          && VectorizeStores(chain, first, numLanes, context))
+      {
+        first += numLanes;
+        continue;
+      }
+
+      first++;
+    }
+  }
+}
+
+SlpVectorizer::~SlpVectorizer() noexcept = default;
+
+void
+SlpVectorizer::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto & graph = module.Rvsdg();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+
+  Context context(VectorWidth_);
+  statistics->Start(graph);
+  VectorizeRegion(graph.GetRootRegion(), context);
+  statistics->Stop(graph, context);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+void
+SlpVectorizer::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  Context context(VectorWidth_);
+  VectorizeRegion(*lambdaNode.subregion(), context);
+}
+
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_SLPVECTORIZER_HPP
+#define JLM_LLVM_OPT_SLPVECTORIZER_HPP
+
+#include <jlm/rvsdg/Transformation.hpp>
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Superword-level parallelism vectorizer
+ *
+ * Packs isomorphic scalar computations into vector operations. The vectorizer is seeded with
+ * chains of non-volatile stores in a region, where the memory states of every store are
+ * exclusively consumed by the next store. A group of stores in such a chain is vectorized if the
+ * stored values fill a vector of the target vector width, and the addresses are GetElementPtr nodes
+ * with adjacent last indices, i.e., indices that only differ in a constant offset.
+ *
+ * The stored values are packed bottom-up:
+ *
+ * 1. Values computed by isomorphic unary or binary operations are replaced by vectorunary_op or
+ * vectorbinary_op nodes, and their operands are packed recursively.
+ * 2. Values loaded from adjacent addresses by non-volatile loads on the same memory states are
+ * replaced by a single vector load.
+ * 3. Constants are replaced by a constantvector_op.
+ * 4. All other values are gathered with insertelement_op nodes.
+ *
+ * Only scalar nodes whose results are exclusively used by the packed computation are packed, such
+ * that no values need to be extracted from vectors. A group of stores is only vectorized if the
+ * number of created vector nodes, including the insertelement_op nodes for gathering, is smaller
+ * than the number of replaced scalar nodes.
+ *
+ * The vectorizer relies on the memory state encoding to separate independent memory operations,
+ * and is therefore best run after the alias analyses and loop unrolling.
+ */
+class SlpVectorizer final : public rvsdg::Transformation
+{
+public:
+  class Context;
+  class Statistics;
+
+  ~SlpVectorizer() noexcept override;
+
+  /**
+   * @param vectorWidth The width of the target's vector registers in bits.
+   */
+  explicit SlpVectorizer(size_t vectorWidth = 128)
+      : VectorWidth_(vectorWidth)
+  {}
+
+  SlpVectorizer(const SlpVectorizer &) = delete;
+
+  SlpVectorizer &
+  operator=(const SlpVectorizer &) = delete;
+
+  [[nodiscard]] size_t
+  GetVectorWidth() const noexcept
+  {
+    return VectorWidth_;
+  }
+
+  void
+  Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::SlpVectorizer;
+  }
+
+private:
+  size_t VectorWidth_;
+};
+
+}
+
+#endif
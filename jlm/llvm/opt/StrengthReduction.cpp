@@ -0,0 +1,322 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/ScalarEvolution.hpp>
+#include <jlm/llvm/opt/StrengthReduction.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/util/Statistics.hpp>
+
+namespace jlm::llvm
+{
+
+/**
+ * Collects the number of replaced nodes.
+ */
+class StrengthReduction::Context final
+{
+public:
+  [[nodiscard]] size_t
+  NumReducedMultiplications() const noexcept
+  {
+    return NumReducedMultiplications_;
+  }
+
+  [[nodiscard]] size_t
+  NumReducedGetElementPtrs() const noexcept
+  {
+    return NumReducedGetElementPtrs_;
+  }
+
+  void
+  AddReducedMultiplication() noexcept
+  {
+    NumReducedMultiplications_++;
+  }
+
+  void
+  AddReducedGetElementPtr() noexcept
+  {
+    NumReducedGetElementPtrs_++;
+  }
+
+private:
+  size_t NumReducedMultiplications_ = 0;
+  size_t NumReducedGetElementPtrs_ = 0;
+};
+
+class StrengthReduction::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumReducedMultiplicationsLabel_ = "#ReducedMultiplications";
+  static constexpr const char * NumReducedGetElementPtrsLabel_ = "#ReducedGetElementPtrs";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Id::StrengthReduction, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::Graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::Graph & graph, const Context & context) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
+    AddMeasurement(NumReducedMultiplicationsLabel_, context.NumReducedMultiplications());
+    AddMeasurement(NumReducedGetElementPtrsLabel_, context.NumReducedGetElementPtrs());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+static bool
+IsMultiplication(const rvsdg::SimpleNode & node)
+{
+  return rvsdg::is<rvsdg::bitmul_op>(&node) || rvsdg::is<IntegerMulOperation>(&node);
+}
+
+/**
+ * Maps the loop-invariant \p output in the subregion of \p thetaNode to its value in front of
+ * \p thetaNode.
+ *
+ * @return The value of \p output in front of \p thetaNode, or nullptr if \p output is not
+ * loop-invariant.
+ */
+static rvsdg::output *
+RouteOut(const rvsdg::ThetaNode & thetaNode, const rvsdg::output & output)
+{
+  if (rvsdg::TryGetRegionParentNode<rvsdg::ThetaNode>(output) == &thetaNode)
+  {
+    auto loopVar = thetaNode.MapPreLoopVar(output);
+    return rvsdg::ThetaLoopVarIsInvariant(loopVar) ? loopVar.input->origin() : nullptr;
+  }
+
+  if (auto value = ScalarEvolution::TryGetConstant(output))
+    return rvsdg::create_bitconstant(thetaNode.region(), *value);
+
+  return nullptr;
+}
+
+/**
+ * Replaces \p node by a new induction variable that starts at \p start and is advanced by the
+ * result of \p step in every iteration. The new value is computed by \p updateOperation from the
+ * value of the current iteration and the step.
+ */
+static void
+ReplaceByInductionVariable(
+    rvsdg::ThetaNode & thetaNode,
+    rvsdg::SimpleNode & node,
+    rvsdg::output & start,
+    rvsdg::output & step,
+    const rvsdg::SimpleOperation & updateOperation,
+    const std::vector<rvsdg::output *> & updateOperands)
+{
+  auto loopVar = thetaNode.AddLoopVar(&start);
+  auto stepLoopVar = thetaNode.AddLoopVar(&step);
+
+  std::vector<rvsdg::output *> operands({ loopVar.pre, stepLoopVar.pre });
+  operands.insert(operands.end(), updateOperands.begin(), updateOperands.end());
+  auto & updateNode = rvsdg::SimpleNode::Create(*thetaNode.subregion(), updateOperation, operands);
+
+  loopVar.post->divert_to(updateNode.output(0));
+  node.output(0)->divert_users(loopVar.pre);
+  remove(&node);
+}
+
+/**
+ * Replaces the multiplication \p node of the induction variable described by \p chainRecurrence
+ * with the loop-invariant \p factor.
+ */
+static bool
+ReduceMultiplication(
+    rvsdg::ThetaNode & thetaNode,
+    rvsdg::SimpleNode & node,
+    const ScalarEvolution::ChainRecurrence & chainRecurrence,
+    const rvsdg::output & factor)
+{
+  auto outerFactor = RouteOut(thetaNode, factor);
+  auto outerStep = RouteOut(thetaNode, chainRecurrence.GetStep());
+  if (!outerFactor || !outerStep)
+    return false;
+
+  // (start + k * step) * factor = start * factor + k * (step * factor)
+  auto region = thetaNode.region();
+  auto & operation = node.GetOperation();
+  auto start = rvsdg::SimpleNode::Create(
+                   *region,
+                   operation,
+                   { &chainRecurrence.GetStart(), outerFactor })
+                   .output(0);
+  auto step = rvsdg::SimpleNode::Create(*region, operation, { outerStep, outerFactor }).output(0);
+
+  ReplaceByInductionVariable(
+      thetaNode,
+      node,
+      *start,
+      *step,
+      chainRecurrence.GetUpdateNode().GetOperation(),
+      {});
+
+  return true;
+}
+
+/**
+ * Replaces the GetElementPtr \p node whose first index is the induction variable described by
+ * \p chainRecurrence.
+ */
+static bool
+ReduceGetElementPtr(
+    rvsdg::ThetaNode & thetaNode,
+    rvsdg::SimpleNode & node,
+    const ScalarEvolution::ChainRecurrence & chainRecurrence)
+{
+  auto region = thetaNode.region();
+
+  std::vector<rvsdg::output *> operands;
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto origin = node.input(n)->origin();
+    auto operand = n == 1 ? &chainRecurrence.GetStart() : RouteOut(thetaNode, *origin);
+    if (!operand)
+      return false;
+
+    operands.push_back(operand);
+  }
+
+  auto step = RouteOut(thetaNode, chainRecurrence.GetStep());
+  if (!step)
+    return false;
+
+  auto numBits = chainRecurrence.NumBits();
+  if (chainRecurrence.IsSubtractive())
+  {
+    auto zero = rvsdg::create_bitconstant(region, numBits, 0);
+    step = rvsdg::SimpleNode::Create(
+               *region,
+               chainRecurrence.GetUpdateNode().GetOperation(),
+               { zero, step })
+               .output(0);
+  }
+
+  // Advancing the first index by step advances the address by step elements, i.e., the remaining
+  // indices are zero for the update.
+  std::vector<rvsdg::output *> zeroIndices;
+  for (size_t n = 2; n < node.ninputs(); n++)
+  {
+    auto & type = *util::AssertedCast<const rvsdg::bittype>(&node.input(n)->type());
+    zeroIndices.push_back(rvsdg::create_bitconstant(thetaNode.subregion(), type.nbits(), 0));
+  }
+
+  auto & operation = node.GetOperation();
+  auto start = rvsdg::SimpleNode::Create(*region, operation, operands).output(0);
+  ReplaceByInductionVariable(thetaNode, node, *start, *step, operation, zeroIndices);
+
+  return true;
+}
+
+static void
+ReduceStrength(rvsdg::ThetaNode & thetaNode, StrengthReduction::Context & context)
+{
+  ScalarEvolution scalarEvolution;
+  scalarEvolution.AnalyzeTheta(thetaNode);
+
+  auto getAffineRecurrence =
+      [&](const rvsdg::input & input) -> const ScalarEvolution::ChainRecurrence *
+  {
+    auto chainRecurrence = scalarEvolution.GetChainRecurrence(*input.origin());
+    return chainRecurrence && chainRecurrence->IsAffine() ? chainRecurrence : nullptr;
+  };
+
+  // The reductions add nodes to the subregion, so collect the candidates upfront
+  std::vector<rvsdg::SimpleNode *> candidates;
+  for (auto & node : thetaNode.subregion()->Nodes())
+  {
+    auto simpleNode = dynamic_cast<rvsdg::SimpleNode *>(&node);
+    if (!simpleNode)
+      continue;
+
+    if (IsMultiplication(*simpleNode) || rvsdg::is<GetElementPtrOperation>(simpleNode))
+      candidates.push_back(simpleNode);
+  }
+
+  // The reductions remove the candidates, so they must not be accessed after a reduction
+  for (auto node : candidates)
+  {
+    if (rvsdg::is<GetElementPtrOperation>(node) && node->ninputs() >= 2)
+    {
+      auto chainRecurrence = getAffineRecurrence(*node->input(1));
+      if (chainRecurrence && ReduceGetElementPtr(thetaNode, *node, *chainRecurrence))
+        context.AddReducedGetElementPtr();
+    }
+    else if (IsMultiplication(*node) && node->ninputs() == 2)
+    {
+      for (size_t n = 0; n < 2; n++)
+      {
+        auto chainRecurrence = getAffineRecurrence(*node->input(n));
+        auto & factor = *node->input(1 - n)->origin();
+        if (chainRecurrence && ReduceMultiplication(thetaNode, *node, *chainRecurrence, factor))
+        {
+          context.AddReducedMultiplication();
+          break;
+        }
+      }
+    }
+  }
+}
+
+static void
+ReduceStrength(rvsdg::Region & region, StrengthReduction::Context & context)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        ReduceStrength(*structuralNode->subregion(n), context);
+    }
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(&node))
+      ReduceStrength(*thetaNode, context);
+  }
+}
+
+StrengthReduction::~StrengthReduction() noexcept = default;
+
+void
+StrengthReduction::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto & graph = module.Rvsdg();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+
+  Context context;
+  statistics->Start(graph);
+  ReduceStrength(graph.GetRootRegion(), context);
+  statistics->Stop(graph, context);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+void
+StrengthReduction::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  Context context;
+  ReduceStrength(*lambdaNode.subregion(), context);
+}
+
+}
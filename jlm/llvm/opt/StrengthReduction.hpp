@@ -0,0 +1,67 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_STRENGTHREDUCTION_HPP
+#define JLM_LLVM_OPT_STRENGTHREDUCTION_HPP
+
+#include <jlm/rvsdg/Transformation.hpp>
+
+namespace jlm::llvm
+{
+
+/**
+ * \brief Strength reduction of induction variable computations
+ *
+ * Replaces computations on affine induction variables of theta nodes, as determined by
+ * ScalarEvolution, with new induction variables that are updated incrementally. The following
+ * nodes at the top-level of a theta node's subregion are replaced:
+ *
+ * 1. Multiplications i * c of an affine induction variable i = {start, +, step} with a
+ * loop-invariant c. The new induction variable is {start * c, +, step * c}.
+ * 2. GetElementPtr nodes with a loop-invariant base address, the affine induction variable i as
+ * first index, and loop-invariant remaining indices. The new pointer induction variable starts at
+ * the address computed for start, and is advanced by step elements in every iteration.
+ *
+ * The start and step of the new induction variables are computed in front of the theta node. The
+ * replaced nodes are removed, while the original induction variables are left to dead node
+ * elimination.
+ */
+class StrengthReduction final : public rvsdg::Transformation
+{
+public:
+  class Context;
+  class Statistics;
+
+  ~StrengthReduction() noexcept override;
+
+  StrengthReduction() = default;
+
+  StrengthReduction(const StrengthReduction &) = delete;
+
+  StrengthReduction &
+  operator=(const StrengthReduction &) = delete;
+
+  void
+  Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::StrengthReduction;
+  }
+};
+
+}
+
+#endif
@@ -120,6 +120,9 @@ AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
   for (auto & importNode : pointsToGraph.ImportNodes())
     memoryNodes.Insert(&importNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    memoryNodes.Insert(&fieldNode);
+
   memoryNodes.Insert(&pointsToGraph.GetExternalMemoryNode());
 
   auto provisioning = AgnosticMemoryNodeProvisioning::Create(pointsToGraph, std::move(memoryNodes));
@@ -4,11 +4,23 @@
  */
 
 #include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/llvm/ir/TypeConverter.hpp>
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/AndersenConfigurationModel.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/LLVMContext.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
 namespace jlm::llvm::aa
 {
 
@@ -23,10 +35,213 @@ IsOrContainsPointerType(const rvsdg::Type & type)
   return IsOrContains<PointerType>(type) || is<rvsdg::FunctionType>(type);
 }
 
+/**
+ * Looks for a bit constant producing the given value.
+ * @param output the value
+ * @return the value of the constant, or std::nullopt if it is not a known constant
+ */
+static std::optional<int64_t>
+TryGetConstantInteger(const rvsdg::output & output)
+{
+  const auto constantNode = rvsdg::producer(&output);
+  if (!rvsdg::is<rvsdg::bitconstant_op>(constantNode))
+    return std::nullopt;
+
+  const auto & value =
+      static_cast<const rvsdg::bitconstant_op &>(constantNode->GetOperation()).value();
+  if (!value.is_known() || value.nbits() > 64)
+    return std::nullopt;
+
+  return value.to_int();
+}
+
+/**
+ * Class for finding the fields of memory objects, and the byte offsets of GEPs,
+ * based on the data layout of the module being analyzed.
+ */
+class Andersen::FieldLayout final
+{
+  // Offsets are limited to this magnitude, to make overflow impossible when adding them up
+  static constexpr int64_t MaxOffset_ = int64_t(1) << 48;
+
+public:
+  FieldLayout(const std::string & dataLayout, size_t maxFieldsPerObject)
+      : DataLayout_(dataLayout),
+        MaxFieldsPerObject_(maxFieldsPerObject)
+  {}
+
+  /**
+   * Flattens the given type into fields. Nested structs are flattened recursively,
+   * while arrays and vectors become a single field each. Fields without size are skipped.
+   * @param type the type of the memory object
+   * @param canPoint true if the memory object is marked as CanPoint
+   * @return the fields of the memory object, or an empty vector if it should not be split
+   */
+  std::vector<MemoryObjectField>
+  GetFields(const rvsdg::Type & type, bool canPoint)
+  {
+    std::vector<MemoryObjectField> fields;
+    const auto llvmType = TypeConverter_.ConvertJlmType(type, Context_);
+    if (!llvmType->isSized() || !AddFields(*llvmType, 0, canPoint, fields) || fields.size() < 2)
+      return {};
+
+    return fields;
+  }
+
+  /**
+   * @return the number of bytes occupied by a value of the given type,
+   * or std::nullopt if the size is not fixed.
+   */
+  std::optional<uint64_t>
+  GetStoreSize(const rvsdg::Type & type)
+  {
+    const auto llvmType = TypeConverter_.ConvertJlmType(type, Context_);
+    if (!llvmType->isSized())
+      return std::nullopt;
+
+    const auto storeSize = DataLayout_.getTypeStoreSize(llvmType);
+    if (storeSize.isScalable())
+      return std::nullopt;
+
+    return storeSize.getFixedValue();
+  }
+
+  /**
+   * Computes the byte offset added by a GEP, using all indices up to the first unknown index.
+   * @param pointeeType the type the GEP indexes into
+   * @param indices the indices of the GEP, where std::nullopt means unknown
+   * @return the byte offset, or std::nullopt if it can not be computed
+   */
+  std::optional<int64_t>
+  GetGepOffset(
+      const rvsdg::Type & pointeeType,
+      const std::vector<std::optional<int64_t>> & indices)
+  {
+    auto type = TypeConverter_.ConvertJlmType(pointeeType, Context_);
+
+    int64_t offset = 0;
+    for (size_t n = 0; n < indices.size() && indices[n].has_value(); n++)
+    {
+      const auto index = *indices[n];
+
+      // All indices but the first index into the type selected by the previous index
+      if (n != 0)
+      {
+        if (const auto structType = ::llvm::dyn_cast<::llvm::StructType>(type))
+        {
+          if (index < 0 || static_cast<uint64_t>(index) >= structType->getNumElements())
+            return std::nullopt;
+
+          const auto elementOffset =
+              DataLayout_.getStructLayout(structType)->getElementOffset(index);
+          offset = AddScaledOffset(offset, 1, elementOffset);
+          if (!IsValidOffset(offset))
+            return std::nullopt;
+          type = structType->getElementType(index);
+          continue;
+        }
+        else if (const auto arrayType = ::llvm::dyn_cast<::llvm::ArrayType>(type))
+          type = arrayType->getElementType();
+        else if (const auto vectorType = ::llvm::dyn_cast<::llvm::FixedVectorType>(type))
+          type = vectorType->getElementType();
+        else
+          return std::nullopt;
+      }
+
+      if (!type->isSized())
+        return std::nullopt;
+      const auto allocSize = DataLayout_.getTypeAllocSize(type);
+      if (allocSize.isScalable())
+        return std::nullopt;
+
+      offset = AddScaledOffset(offset, index, allocSize.getFixedValue());
+      if (!IsValidOffset(offset))
+        return std::nullopt;
+    }
+
+    return offset;
+  }
+
+private:
+  static bool
+  IsValidOffset(int64_t offset) noexcept
+  {
+    return offset <= MaxOffset_ && offset >= -MaxOffset_;
+  }
+
+  /**
+   * @return offset + index * scale, or an invalid offset if the result is too large
+   */
+  static int64_t
+  AddScaledOffset(int64_t offset, int64_t index, uint64_t scale) noexcept
+  {
+    JLM_ASSERT(IsValidOffset(offset));
+    if (!IsValidOffset(index) || scale > static_cast<uint64_t>(MaxOffset_))
+      return std::numeric_limits<int64_t>::max();
+
+    const auto signedScale = static_cast<int64_t>(scale);
+    if (signedScale != 0 && std::abs(index) > MaxOffset_ / signedScale)
+      return std::numeric_limits<int64_t>::max();
+
+    return offset + index * signedScale;
+  }
+
+  /**
+   * Adds the fields of the given type, placed at the given offset, to \p fields.
+   * @return false if the memory object should not be split, otherwise true
+   */
+  bool
+  AddFields(
+      ::llvm::Type & type,
+      uint64_t offset,
+      bool canPoint,
+      std::vector<MemoryObjectField> & fields)
+  {
+    if (const auto structType = ::llvm::dyn_cast<::llvm::StructType>(&type))
+    {
+      const auto structLayout = DataLayout_.getStructLayout(structType);
+      for (unsigned n = 0; n < structType->getNumElements(); n++)
+      {
+        const auto elementOffset = offset + structLayout->getElementOffset(n);
+        if (!AddFields(*structType->getElementType(n), elementOffset, canPoint, fields))
+          return false;
+      }
+      return true;
+    }
+
+    // Do not split objects where the offsets of fields are unknown
+    const auto allocSize = DataLayout_.getTypeAllocSize(&type);
+    if (allocSize.isScalable())
+      return false;
+
+    // Arrays and vectors are not split, as they are usually indexed with unknown indices
+    const bool isArray = type.isArrayTy() || type.isVectorTy();
+    const uint64_t size =
+        isArray ? allocSize.getFixedValue() : DataLayout_.getTypeStoreSize(&type).getFixedValue();
+    if (size == 0)
+      return true;
+
+    if (fields.size() >= MaxFieldsPerObject_)
+      return false;
+
+    fields.push_back({ offset, size, isArray, canPoint });
+    return true;
+  }
+
+  ::llvm::LLVMContext Context_;
+  ::llvm::DataLayout DataLayout_;
+  TypeConverter TypeConverter_;
+  size_t MaxFieldsPerObject_;
+};
+
 std::string
 Andersen::Configuration::ToString() const
 {
   std::ostringstream str;
+  if (PointsToSetRepresentation_ == PointsToSet::Representation::SparseBitVector)
+    str << "SBV_";
+  else if (PointsToSetRepresentation_ == PointsToSet::Representation::Shared)
+    str << "SharedPTS_";
   if (EnableOfflineVariableSubstitution_)
     str << "OVS_";
   if (EnableOfflineConstraintNormalization_)
@@ -53,6 +268,11 @@ Andersen::Configuration::ToString() const
     if (EnablePreferImplicitPointees_)
       str << "PIP_";
   }
+  else if (Solver_ == Solver::WavePropagation)
+  {
+    str << "Solver=WavePropagation_";
+    str << "Threads=" << NumThreads_ << "_";
+  }
   else
   {
     JLM_UNREACHABLE("Unknown solver type");
@@ -128,10 +348,19 @@ Andersen::Configuration::GetAllConfigurations()
     config.EnableOfflineConstraintNormalization(true);
     configs.push_back(config);
   };
+  auto PickNumThreads = [&](Configuration config)
+  {
+    config.SetNumThreads(1);
+    configs.push_back(config);
+    config.SetNumThreads(4);
+    configs.push_back(config);
+  };
   auto PickSolver = [&](Configuration config)
   {
     config.SetSolver(Solver::Worklist);
     PickWorklistPolicy(config);
+    config.SetSolver(Solver::WavePropagation);
+    PickNumThreads(config);
     config.SetSolver(Solver::Naive);
     PickOfflineNormalization(config);
   };
@@ -142,9 +371,18 @@ Andersen::Configuration::GetAllConfigurations()
     config.EnableOfflineVariableSubstitution(true);
     PickSolver(config);
   };
+  auto PickPointsToSetRepresentation = [&](Configuration config)
+  {
+    config.SetPointsToSetRepresentation(PointsToSet::Representation::HashSet);
+    PickOfflineVariableSubstitution(config);
+    config.SetPointsToSetRepresentation(PointsToSet::Representation::SparseBitVector);
+    PickOfflineVariableSubstitution(config);
+    config.SetPointsToSetRepresentation(PointsToSet::Representation::Shared);
+    PickOfflineVariableSubstitution(config);
+  };
 
   // Adds one configuration for all valid combinations of features
-  PickOfflineVariableSubstitution(NaiveSolverConfiguration());
+  PickPointsToSetRepresentation(NaiveSolverConfiguration());
 
   return configs;
 }
@@ -166,12 +404,15 @@ class Andersen::Statistics final : public util::Statistics
   static constexpr const char * NumGlobalPointerObjects = "#GlobalPointerObjects";
   static constexpr const char * NumFunctionPointerObjects = "#FunctionPointerObjects";
   static constexpr const char * NumImportPointerObjects = "#ImportPointerObjects";
+  // Memory objects split into fields are counted once per field, among the kinds above
+  static constexpr const char * NumFieldPointerObjects = "#FieldPointerObjects";
 
   static constexpr const char * NumBaseConstraints_ = "#BaseConstraints";
   static constexpr const char * NumSupersetConstraints_ = "#SupersetConstraints";
   static constexpr const char * NumStoreConstraints_ = "#StoreConstraints";
   static constexpr const char * NumLoadConstraints_ = "#LoadConstraints";
   static constexpr const char * NumFunctionCallConstraints_ = "#FunctionCallConstraints";
+  static constexpr const char * NumFieldOffsetConstraints_ = "#FieldOffsetConstraints";
   static constexpr const char * NumScalarFlagConstraints_ = "#ScalarFlagConstraints";
   static constexpr const char * NumOtherFlagConstraints_ = "#OtherFlagConstraints";
 
@@ -192,6 +433,14 @@ class Andersen::Statistics final : public util::Statistics
       "#WorklistSolverWorkItemsNewPointees";
   static constexpr const char * NumTopologicalWorklistSweeps_ = "#TopologicalWorklistSweeps";
 
+  static constexpr const char * NumWavePropagationThreads_ = "#WavePropagationThreads";
+  static constexpr const char * NumWavePropagationWaves_ = "#WavePropagationWaves";
+  static constexpr const char * NumWavePropagationCycleUnifications_ =
+      "#WavePropagationCycleUnifications";
+  static constexpr const char * NumWavePropagationLevels_ = "#WavePropagationLevels";
+  static constexpr const char * NumWavePropagationParallelLevels_ =
+      "#WavePropagationParallelLevels";
+
   // ====== Online technique statistics ======
   static constexpr const char * NumOnlineCyclesDetected_ = "#OnlineCyclesDetected";
   static constexpr const char * NumOnlineCycleUnifications_ = "#OnlineCycleUnifications";
@@ -212,6 +461,17 @@ class Andersen::Statistics final : public util::Statistics
   // Removal can only happen due to unification, or explicitly when using PIP
   static constexpr const char * NumExplicitPointeesRemoved_ = "#ExplicitPointeesRemoved";
 
+  // ====== Shared points-to set statistics ======
+  // Only reported when the shared points-to set representation is used.
+  // The number of distinct points-to sets created during solving, including the empty set.
+  static constexpr const char * NumUniquePointsToSets_ = "#UniquePointsToSets";
+  // How many unions, differences and insertions of shared sets were answered by the cache.
+  static constexpr const char * NumPointsToSetCacheHits_ = "#PointsToSetCacheHits";
+  static constexpr const char * NumPointsToSetCacheMisses_ = "#PointsToSetCacheMisses";
+  static constexpr const char * PointsToSetCacheHitRate_ = "PointsToSetCacheHitRate";
+  // The estimated number of bytes used by the distinct sets and the operation caches.
+  static constexpr const char * NumPointsToSetStoreBytes_ = "#PointsToSetStoreBytes";
+
   // ====== After solving statistics ======
   // How many disjoint sets of PointerObjects exist
   static constexpr const char * NumUnificationRoots_ = "#UnificationRoots";
@@ -261,6 +521,8 @@ class Andersen::Statistics final : public util::Statistics
   static constexpr const char * OfflineConstraintNormalizationTimer_ = "OfflineNormTimer";
   static constexpr const char * ConstraintSolvingNaiveTimer_ = "ConstraintSolvingNaiveTimer";
   static constexpr const char * ConstraintSolvingWorklistTimer_ = "ConstraintSolvingWorklistTimer";
+  static constexpr const char * ConstraintSolvingWavePropagationTimer_ =
+      "ConstraintSolvingWavePropagationTimer";
   static constexpr const char * PointsToGraphConstructionTimer_ = "PointsToGraphConstructionTimer";
   static constexpr const char * PointsToGraphConstructionExternalToEscapedTimer_ =
       "PointsToGraphConstructionExternalToEscapedTimer";
@@ -314,24 +576,28 @@ public:
     AddMeasurement(
         NumImportPointerObjects,
         set.NumPointerObjectsOfKind(PointerObjectKind::ImportMemoryObject));
+    AddMeasurement(NumFieldPointerObjects, set.NumFieldMemoryObjects());
 
     // Count the number of constraints of different kinds
     size_t numSupersetConstraints = 0;
     size_t numStoreConstraints = 0;
     size_t numLoadConstraints = 0;
     size_t numFunctionCallConstraints = 0;
+    size_t numFieldOffsetConstraints = 0;
     for (const auto & constraint : constraints.GetConstraints())
     {
       numSupersetConstraints += std::holds_alternative<SupersetConstraint>(constraint);
       numStoreConstraints += std::holds_alternative<StoreConstraint>(constraint);
       numLoadConstraints += std::holds_alternative<LoadConstraint>(constraint);
       numFunctionCallConstraints += std::holds_alternative<FunctionCallConstraint>(constraint);
+      numFieldOffsetConstraints += std::holds_alternative<FieldOffsetConstraint>(constraint);
     }
     AddMeasurement(NumBaseConstraints_, constraints.NumBaseConstraints());
     AddMeasurement(NumSupersetConstraints_, numSupersetConstraints);
     AddMeasurement(NumStoreConstraints_, numStoreConstraints);
     AddMeasurement(NumLoadConstraints_, numLoadConstraints);
     AddMeasurement(NumFunctionCallConstraints_, numFunctionCallConstraints);
+    AddMeasurement(NumFieldOffsetConstraints_, numFieldOffsetConstraints);
     const auto [scalarFlags, otherFlags] = constraints.NumFlagConstraints();
     AddMeasurement(NumScalarFlagConstraints_, scalarFlags);
     AddMeasurement(NumOtherFlagConstraints_, otherFlags);
@@ -422,18 +688,59 @@ public:
       AddMeasurement(NumPIPExplicitPointeesRemoved_, *statistics.NumPipExplicitPointeesRemoved);
   }
 
+  void
+  StartConstraintSolvingWavePropagationStatistics() noexcept
+  {
+    AddTimer(ConstraintSolvingWavePropagationTimer_).start();
+  }
+
+  void
+  StopConstraintSolvingWavePropagationStatistics(
+      const PointerObjectConstraintSet::WavePropagationStatistics & statistics) noexcept
+  {
+    GetTimer(ConstraintSolvingWavePropagationTimer_).stop();
+    AddMeasurement(NumWavePropagationThreads_, statistics.NumThreads);
+    AddMeasurement(NumWavePropagationWaves_, statistics.NumWaves);
+    AddMeasurement(NumWavePropagationCycleUnifications_, statistics.NumCycleUnifications);
+    AddMeasurement(NumWavePropagationLevels_, statistics.NumTopologicalLevels);
+    AddMeasurement(NumWavePropagationParallelLevels_, statistics.NumParallelTopologicalLevels);
+  }
+
   void
   AddStatisticFromConfiguration(const Configuration & config)
   {
     AddMeasurement(Configuration_, config.ToString());
   }
 
+  void
+  AddStatisticsFromFeatures(const ConstraintSetFeatures & features)
+  {
+    for (size_t n = 0; n < static_cast<size_t>(ConstraintSetFeatures::Feature::COUNT); n++)
+    {
+      const auto feature = static_cast<ConstraintSetFeatures::Feature>(n);
+      if (ConstraintSetFeatures::IsAddedToStatistics(feature))
+        AddMeasurement(ConstraintSetFeatures::GetName(feature), features.GetValue(feature));
+    }
+  }
+
   void
   AddStatisticsFromSolution(const PointerObjectSet & set)
   {
     AddMeasurement(NumSetInsertionAttempts_, set.GetNumSetInsertionAttempts());
     AddMeasurement(NumExplicitPointeesRemoved_, set.GetNumExplicitPointeesRemoved());
 
+    if (auto store = set.GetSharedPointsToSetStore())
+    {
+      const auto numCacheLookups = store->NumCacheHits() + store->NumCacheMisses();
+      const auto cacheHitRate =
+          numCacheLookups ? static_cast<double>(store->NumCacheHits()) / numCacheLookups : 0.0;
+      AddMeasurement(NumUniquePointsToSets_, store->NumSets());
+      AddMeasurement(NumPointsToSetCacheHits_, store->NumCacheHits());
+      AddMeasurement(NumPointsToSetCacheMisses_, store->NumCacheMisses());
+      AddMeasurement(PointsToSetCacheHitRate_, cacheHitRate);
+      AddMeasurement(NumPointsToSetStoreBytes_, store->NumBytes());
+    }
+
     size_t numUnificationRoots = 0;
 
     size_t numCanPointEscaped = 0;
@@ -581,6 +888,7 @@ public:
     AddMeasurement(Label::NumPointsToGraphImportNodes, pointsToGraph.NumImportNodes());
     AddMeasurement(Label::NumPointsToGraphLambdaNodes, pointsToGraph.NumLambdaNodes());
     AddMeasurement(Label::NumPointsToGraphMallocNodes, pointsToGraph.NumMallocNodes());
+    AddMeasurement(Label::NumPointsToGraphFieldNodes, pointsToGraph.NumFieldNodes());
     AddMeasurement(Label::NumPointsToGraphMemoryNodes, pointsToGraph.NumMemoryNodes());
     AddMeasurement(Label::NumPointsToGraphRegisterNodes, pointsToGraph.NumRegisterNodes());
     AddMeasurement(
@@ -677,6 +985,11 @@ Andersen::AnalyzeAlloca(const rvsdg::SimpleNode & node)
 
   const bool canPoint = IsOrContainsPointerType(*allocaOp->ValueType());
   const auto allocaPO = Set_->CreateAllocaMemoryObject(node, canPoint);
+
+  // Allocas of multiple elements are arrays, which are never split
+  if (TryGetConstantInteger(*node.input(0)->origin()) == 1)
+    CreateFieldMemoryObjects(allocaPO, *allocaOp->ValueType());
+
   Constraints_->AddPointerPointeeConstraint(outputRegisterPO, allocaPO);
 }
 
@@ -696,39 +1009,39 @@ Andersen::AnalyzeMalloc(const rvsdg::SimpleNode & node)
 void
 Andersen::AnalyzeLoad(const LoadNode & loadNode)
 {
-  const auto & addressRegister = *loadNode.GetAddressInput().origin();
   const auto & outputRegister = loadNode.GetLoadedValueOutput();
 
-  const auto addressRegisterPO = Set_->GetRegisterPointerObject(addressRegister);
+  const auto accessPO =
+      CreateAccessPointerObject(loadNode.GetAddressInput(), outputRegister.type());
 
   if (IsOrContainsPointerType(outputRegister.type()))
   {
     const auto outputRegisterPO = Set_->CreateRegisterPointerObject(outputRegister);
-    Constraints_->AddConstraint(LoadConstraint(outputRegisterPO, addressRegisterPO));
+    Constraints_->AddConstraint(LoadConstraint(outputRegisterPO, accessPO));
   }
   else
   {
-    Set_->MarkAsLoadingAsScalar(addressRegisterPO);
+    Set_->MarkAsLoadingAsScalar(accessPO);
   }
 }
 
 void
 Andersen::AnalyzeStore(const StoreNode & storeNode)
 {
-  const auto & addressRegister = *storeNode.GetAddressInput().origin();
   const auto & valueRegister = *storeNode.GetStoredValueInput().origin();
 
-  const auto addressRegisterPO = Set_->GetRegisterPointerObject(addressRegister);
+  const auto accessPO =
+      CreateAccessPointerObject(storeNode.GetAddressInput(), valueRegister.type());
 
   // If the written value is not a pointer, be conservative and mark the address
   if (IsOrContainsPointerType(valueRegister.type()))
   {
     const auto valueRegisterPO = Set_->GetRegisterPointerObject(valueRegister);
-    Constraints_->AddConstraint(StoreConstraint(addressRegisterPO, valueRegisterPO));
+    Constraints_->AddConstraint(StoreConstraint(accessPO, valueRegisterPO));
   }
   else
   {
-    Set_->MarkAsStoringAsScalar(addressRegisterPO);
+    Set_->MarkAsStoringAsScalar(accessPO);
   }
 }
 
@@ -758,14 +1071,55 @@ Andersen::AnalyzeGep(const rvsdg::SimpleNode & node)
 {
   JLM_ASSERT(is<GetElementPtrOperation>(&node));
 
-  // The analysis is field insensitive, so ignoring the offset and mapping the output
-  // to the same PointerObject as the input is sufficient.
   const auto & baseRegister = *node.input(0)->origin();
   JLM_ASSERT(is<PointerType>(baseRegister.type()));
 
   const auto baseRegisterPO = Set_->GetRegisterPointerObject(baseRegister);
   const auto & outputRegister = *node.output(0);
-  Set_->MapRegisterToExistingPointerObject(outputRegister, baseRegisterPO);
+
+  // If the analysis is field insensitive, ignoring the offset and mapping the output
+  // to the same PointerObject as the input is sufficient.
+  if (!FieldLayout_)
+  {
+    Set_->MapRegisterToExistingPointerObject(outputRegister, baseRegisterPO);
+    return;
+  }
+
+  const auto & gepOp = *util::AssertedCast<const GetElementPtrOperation>(&node.GetOperation());
+  std::vector<std::optional<int64_t>> indices;
+  for (size_t n = 1; n < node.ninputs(); n++)
+    indices.push_back(TryGetConstantInteger(*node.input(n)->origin()));
+  const bool allIndicesKnown = std::all_of(
+      indices.begin(),
+      indices.end(),
+      [](const std::optional<int64_t> & index)
+      {
+        return index.has_value();
+      });
+
+  const auto offset = FieldLayout_->GetGepOffset(gepOp.GetPointeeType(), indices);
+  if (allIndicesKnown && offset == 0)
+  {
+    Set_->MapRegisterToExistingPointerObject(outputRegister, baseRegisterPO);
+    return;
+  }
+
+  const auto outputRegisterPO = Set_->CreateRegisterPointerObject(outputRegister);
+  if (allIndicesKnown || !offset.has_value())
+  {
+    Constraints_->AddConstraint(FieldOffsetConstraint(outputRegisterPO, baseRegisterPO, offset, 0));
+    return;
+  }
+
+  // The GEP has a constant offset, followed by an unknown offset.
+  // The constant offset is first used to find the fields being indexed into.
+  auto prefixPO = baseRegisterPO;
+  if (offset != 0)
+  {
+    prefixPO = Set_->CreateDummyRegisterPointerObject();
+    Constraints_->AddConstraint(FieldOffsetConstraint(prefixPO, baseRegisterPO, offset, 0));
+  }
+  Constraints_->AddConstraint(FieldOffsetConstraint(outputRegisterPO, prefixPO, std::nullopt, 0));
 }
 
 void
@@ -844,21 +1198,24 @@ Andersen::AnalyzeMemcpy(const rvsdg::SimpleNode & node)
 {
   JLM_ASSERT(is<MemCpyOperation>(&node));
 
-  auto & dstAddressRegister = *node.input(0)->origin();
-  auto & srcAddressRegister = *node.input(1)->origin();
-  JLM_ASSERT(is<PointerType>(dstAddressRegister.type()));
-  JLM_ASSERT(is<PointerType>(srcAddressRegister.type()));
+  JLM_ASSERT(is<PointerType>(node.input(0)->origin()->type()));
+  JLM_ASSERT(is<PointerType>(node.input(1)->origin()->type()));
 
-  const auto dstAddressRegisterPO = Set_->GetRegisterPointerObject(dstAddressRegister);
-  const auto srcAddressRegisterPO = Set_->GetRegisterPointerObject(srcAddressRegister);
+  // Lengths that are not known, or negative, may access any field
+  std::optional<uint64_t> length;
+  if (const auto constantLength = TryGetConstantInteger(*node.input(2)->origin());
+      constantLength.has_value() && *constantLength >= 0)
+    length = *constantLength;
+  const auto dstAccessPO = CreateAccessPointerObject(*node.input(0), length);
+  const auto srcAccessPO = CreateAccessPointerObject(*node.input(1), length);
 
   // Create an intermediate PointerObject representing the moved values
   const auto dummyPO = Set_->CreateDummyRegisterPointerObject();
 
   // Add a "load" constraint from the source into the dummy register
-  Constraints_->AddConstraint(LoadConstraint(dummyPO, srcAddressRegisterPO));
+  Constraints_->AddConstraint(LoadConstraint(dummyPO, srcAccessPO));
   // Add a "store" constraint from the dummy register into the destination
-  Constraints_->AddConstraint(StoreConstraint(dstAddressRegisterPO, dummyPO));
+  Constraints_->AddConstraint(StoreConstraint(dstAccessPO, dummyPO));
 }
 
 void
@@ -1077,11 +1434,19 @@ Andersen::AnalyzeDelta(const delta::node & delta)
   // Create a global memory object representing the global variable
   const auto globalPO = Set_->CreateGlobalMemoryObject(delta, canPoint);
 
-  // If the initializer subregion result is a pointer, make the global point to what it points to
+  CreateFieldMemoryObjects(globalPO, delta.type());
+
+  // If the initializer subregion result is a pointer, make the global point to what it points to.
+  // The initializer is not split into fields, so every field that can point gets all pointees.
   if (canPoint)
   {
     const auto resultRegisterPO = Set_->GetRegisterPointerObject(resultRegister);
     Constraints_->AddConstraint(SupersetConstraint(globalPO, resultRegisterPO));
+    for (const auto fieldPO : Set_->GetFieldMemoryObjects(globalPO))
+    {
+      if (fieldPO != globalPO && Set_->CanPoint(fieldPO))
+        Constraints_->AddConstraint(SupersetConstraint(fieldPO, resultRegisterPO));
+    }
   }
 
   // Finally create a Register PointerObject for the delta's output, pointing to the memory object
@@ -1228,7 +1593,7 @@ Andersen::AnalyzeRegion(rvsdg::Region & region)
 
   // The use of the top-down traverser is vital, as it ensures all input origins
   // of pointer type are mapped to PointerObjects by the time a node is processed.
-  rvsdg::TopDownTraverser traverser(&region);
+  rvsdg::TopDownConstTraverser traverser(&region);
 
   // While visiting the node we have the responsibility of creating
   // PointerObjects for any of the node's outputs of pointer type
@@ -1290,6 +1655,50 @@ Andersen::AnalyzeRvsdg(const rvsdg::Graph & graph)
   }
 }
 
+void
+Andersen::CreateFieldMemoryObjects(PointerObjectIndex memoryObject, const rvsdg::Type & type)
+{
+  if (!FieldLayout_)
+    return;
+
+  auto fields = FieldLayout_->GetFields(type, Set_->CanPoint(memoryObject));
+  if (!fields.empty())
+    Set_->CreateFieldMemoryObjects(memoryObject, std::move(fields));
+}
+
+PointerObjectIndex
+Andersen::CreateAccessPointerObject(const rvsdg::input & address, const rvsdg::Type & accessedType)
+{
+  if (!FieldLayout_)
+    return Set_->GetRegisterPointerObject(*address.origin());
+
+  return CreateAccessPointerObject(address, FieldLayout_->GetStoreSize(accessedType));
+}
+
+PointerObjectIndex
+Andersen::CreateAccessPointerObject(
+    const rvsdg::input & address,
+    std::optional<uint64_t> accessSize)
+{
+  const auto addressRegisterPO = Set_->GetRegisterPointerObject(*address.origin());
+  if (!FieldLayout_)
+    return addressRegisterPO;
+
+  // Accesses through pointers to fields may also touch the following fields
+  const auto accessPO = Set_->CreateDummyRegisterPointerObject();
+  Set_->MapAccessToPointerObject(address, accessPO);
+  Constraints_->AddConstraint(FieldOffsetConstraint(
+      accessPO,
+      addressRegisterPO,
+      0,
+      accessSize.value_or(std::numeric_limits<uint64_t>::max())));
+  return accessPO;
+}
+
+Andersen::Andersen() = default;
+
+Andersen::~Andersen() noexcept = default;
+
 void
 Andersen::SetConfiguration(Configuration config)
 {
@@ -1302,14 +1711,69 @@ Andersen::GetConfiguration() const
   return Config_;
 }
 
+void
+Andersen::EnableAdaptiveConfiguration(bool enable) noexcept
+{
+  EnableAdaptiveConfiguration_ = enable;
+}
+
+bool
+Andersen::IsAdaptiveConfigurationEnabled() const noexcept
+{
+  return EnableAdaptiveConfiguration_;
+}
+
+void
+Andersen::EnableFieldSensitivity(bool enable) noexcept
+{
+  EnableFieldSensitivity_ = enable;
+}
+
+bool
+Andersen::IsFieldSensitivityEnabled() const noexcept
+{
+  return EnableFieldSensitivity_;
+}
+
+void
+Andersen::SetMaxFieldsPerObject(size_t maxFieldsPerObject) noexcept
+{
+  MaxFieldsPerObject_ = maxFieldsPerObject;
+}
+
+size_t
+Andersen::GetMaxFieldsPerObject() const noexcept
+{
+  return MaxFieldsPerObject_;
+}
+
 void
 Andersen::AnalyzeModule(const rvsdg::RvsdgModule & module, Statistics & statistics)
 {
   Set_ = std::make_unique<PointerObjectSet>();
   Constraints_ = std::make_unique<PointerObjectConstraintSet>(*Set_);
 
+  bool fieldSensitive = EnableFieldSensitivity_;
+  size_t maxFieldsPerObject = MaxFieldsPerObject_;
+  if (auto fieldSensitiveString = std::getenv(ENV_FIELD_SENSITIVE))
+  {
+    fieldSensitive = true;
+    if (auto envMaxFields = std::strtoull(fieldSensitiveString, nullptr, 10); envMaxFields > 1)
+      maxFieldsPerObject = envMaxFields;
+  }
+
   statistics.StartSetAndConstraintBuildingStatistics();
+
+  if (fieldSensitive)
+  {
+    const auto llvmModule = dynamic_cast<const RvsdgModule *>(&module);
+    const auto dataLayout = llvmModule ? llvmModule->DataLayout() : "";
+    FieldLayout_ = std::make_unique<FieldLayout>(dataLayout, maxFieldsPerObject);
+  }
+
   AnalyzeRvsdg(module.Rvsdg());
+  FieldLayout_.reset();
+
   statistics.StopSetAndConstraintBuildingStatistics(*Set_, *Constraints_);
 }
 
@@ -1321,6 +1785,9 @@ Andersen::SolveConstraints(
 {
   statistics.AddStatisticFromConfiguration(config);
 
+  constraints.GetPointerObjectSet().SetPointsToSetRepresentation(
+      config.GetPointsToSetRepresentation());
+
   if (config.IsOfflineVariableSubstitutionEnabled())
   {
     statistics.StartOfflineVariableSubstitution();
@@ -1355,6 +1822,12 @@ Andersen::SolveConstraints(
         config.IsPreferImplicitPointeesEnabled());
     statistics.StopConstraintSolvingWorklistStatistics(worklistStatistics);
   }
+  else if (config.GetSolver() == Configuration::Solver::WavePropagation)
+  {
+    statistics.StartConstraintSolvingWavePropagationStatistics();
+    auto wavePropagationStatistics = constraints.SolveUsingWavePropagation(config.GetNumThreads());
+    statistics.StopConstraintSolvingWavePropagationStatistics(wavePropagationStatistics);
+  }
   else
     JLM_UNREACHABLE("Unknown solver");
 }
@@ -1379,8 +1852,19 @@ Andersen::Analyze(
   const bool dumpGraphs = std::getenv(ENV_DUMP_SUBSET_GRAPH);
   util::GraphWriter writer;
 
+  const bool adaptiveConfig =
+      EnableAdaptiveConfiguration_ || std::getenv(ENV_ADAPTIVE_CONFIG) != nullptr;
+
   AnalyzeModule(module, *statistics);
 
+  // Extract features of the unsolved constraint set, for picking a configuration and training
+  std::optional<ConstraintSetFeatures> features;
+  if (adaptiveConfig || statisticsCollector.IsDemanded(*statistics))
+  {
+    features = ConstraintSetFeatures::Extract(*Constraints_);
+    statistics->AddStatisticsFromFeatures(*features);
+  }
+
   // If solving multiple times, make a copy of the original constraint set
   std::pair<std::unique_ptr<PointerObjectSet>, std::unique_ptr<PointerObjectConstraintSet>> copy;
   if (testAllConfigsIterations || doubleCheck)
@@ -1391,6 +1875,23 @@ Andersen::Analyze(
     Constraints_->DrawSubsetGraph(writer);
 
   auto config = Config_;
+  if (adaptiveConfig)
+  {
+    if (auto modelPath = std::getenv(ENV_CONFIG_MODEL))
+    {
+      std::ifstream modelFile(modelPath);
+      if (!modelFile.is_open())
+        throw util::error(std::string("Unable to open Andersen configuration model ") + modelPath);
+
+      std::stringstream modelText;
+      modelText << modelFile.rdbuf();
+      config = AndersenConfigurationModel::FromString(modelText.str()).Predict(*features);
+    }
+    else
+    {
+      config = AndersenConfigurationModel::GetBuiltinModel().Predict(*features);
+    }
+  }
   if (useExactConfig.has_value())
   {
     auto allConfigs = Configuration::GetAllConfigurations();
@@ -1515,6 +2016,22 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
     memoryNodes[pointerObjectIndex] = &node;
   }
 
+  // Memory objects that are split into fields get one node per field.
+  // The first field is represented by the memory object's own node.
+  for (PointerObjectIndex idx = 0; idx < set.NumPointerObjects(); idx++)
+  {
+    const auto & fields = set.GetFieldMemoryObjects(idx);
+    if (fields.empty() || fields.front() != idx)
+      continue;
+
+    JLM_ASSERT(memoryNodes[idx]);
+    for (size_t n = 1; n < fields.size(); n++)
+    {
+      auto & node = PointsToGraph::FieldNode::Create(*pointsToGraph, *memoryNodes[idx], n);
+      memoryNodes[fields[n]] = &node;
+    }
+  }
+
   // Helper function for attaching PointsToGraph nodes to their pointees, based on the
   // PointerObject's points-to set.
   auto applyPointsToSet = [&](PointsToGraph::Node & node, PointerObjectIndex index)
@@ -1548,6 +2065,25 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
     applyPointsToSet(node, registerIdx);
   }
 
+  // Accesses through pointers to fields may cover the following fields as well.
+  // These fields are recorded per access, and are not added to the targets of the address.
+  for (auto [address, accessIdx] : set.GetAccessMap())
+  {
+    const auto & addressPointees =
+        set.GetPointsToSet(set.GetRegisterPointerObject(*address->origin()));
+
+    util::HashSet<const PointsToGraph::MemoryNode *> accessedFieldNodes;
+    for (const auto targetIdx : set.GetPointsToSet(accessIdx).Items())
+    {
+      JLM_ASSERT(memoryNodes[targetIdx]);
+      if (!addressPointees.Contains(targetIdx))
+        accessedFieldNodes.Insert(memoryNodes[targetIdx]);
+    }
+
+    if (!accessedFieldNodes.IsEmpty())
+      pointsToGraph->AddAccessedFieldNodes(*address, std::move(accessedFieldNodes));
+  }
+
   // Now add all edges from memory node to memory node.
   // Also checks and informs the PointsToGraph which memory nodes are marked as escaping the module
   for (PointerObjectIndex idx = 0; idx < set.NumPointerObjects(); idx++)
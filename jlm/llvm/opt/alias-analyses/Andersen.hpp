@@ -19,11 +19,15 @@ namespace jlm::llvm::aa
 /**
  * class implementing Andersen's set constraint based pointer analysis, based on the Ph.D. thesis
  * Lars Ole Andersen - Program Analysis and Specialization for the C Programming Language
- * The analysis is inter-procedural, field-insensitive, context-insensitive,
- * flow-insensitive, and uses a static heap model.
+ * The analysis is inter-procedural, context-insensitive, flow-insensitive,
+ * and uses a static heap model. It is field-insensitive by default.
+ * When field sensitivity is enabled, allocas and global variables of aggregate type are split
+ * into one memory object per field, and constant offset GEPs select the fields they point to.
+ * Memory objects created by malloc are never split, as the type stored in them is unknown.
  */
 class Andersen final : public AliasAnalysis
 {
+  class FieldLayout;
   class Statistics;
 
 public:
@@ -53,6 +57,31 @@ public:
    */
   static inline const char * const ENV_DUMP_SUBSET_GRAPH = "JLM_ANDERSEN_DUMP_SUBSET_GRAPH";
 
+  /**
+   * Environment variable that enables adaptive configuration, regardless of the pass settings.
+   * @see EnableAdaptiveConfiguration
+   */
+  static inline const char * const ENV_ADAPTIVE_CONFIG = "JLM_ANDERSEN_ADAPTIVE_CONFIG";
+
+  /**
+   * Environment variable with the path of a model file, as written by jlm-andersen-train.
+   * When adaptive configuration is enabled, the model is used instead of the built-in model.
+   */
+  static inline const char * const ENV_CONFIG_MODEL = "JLM_ANDERSEN_CONFIG_MODEL";
+
+  /**
+   * Environment variable that enables field sensitivity, regardless of the pass settings.
+   * If set to a number larger than 1, it is also used as the maximum number of fields per object.
+   * @see EnableFieldSensitivity
+   */
+  static inline const char * const ENV_FIELD_SENSITIVE = "JLM_ANDERSEN_FIELD_SENSITIVE";
+
+  /**
+   * The default maximum number of fields a memory object can be split into.
+   * @see SetMaxFieldsPerObject
+   */
+  static constexpr size_t DefaultMaxFieldsPerObject = 32;
+
   /**
    * class for configuring the Andersen pass, such as what solver to use.
    */
@@ -65,7 +94,8 @@ public:
     enum class Solver
     {
       Naive,
-      Worklist
+      Worklist,
+      WavePropagation
     };
 
     /**
@@ -100,6 +130,23 @@ public:
       return WorklistSolverPolicy_;
     }
 
+    /**
+     * Sets the number of threads used to propagate points-to sets.
+     * Only applies to the wave propagation solver.
+     */
+    void
+    SetNumThreads(size_t numThreads) noexcept
+    {
+      JLM_ASSERT(numThreads >= 1);
+      NumThreads_ = numThreads;
+    }
+
+    [[nodiscard]] size_t
+    GetNumThreads() const noexcept
+    {
+      return NumThreads_;
+    }
+
     /**
      * Enables or disables the use of offline variable substitution to pre-process
      * the constraint set before applying the solving algorithm.
@@ -218,6 +265,24 @@ public:
       return EnablePreferImplicitPointees_;
     }
 
+    /**
+     * Sets how points-to sets are represented while solving.
+     * Applies to all solvers, and to the sets of new pointees used by difference propagation.
+     * With the shared representation, identical points-to sets are stored once, and unions are
+     * memoized.
+     */
+    void
+    SetPointsToSetRepresentation(PointsToSet::Representation representation) noexcept
+    {
+      PointsToSetRepresentation_ = representation;
+    }
+
+    [[nodiscard]] PointsToSet::Representation
+    GetPointsToSetRepresentation() const noexcept
+    {
+      return PointsToSetRepresentation_;
+    }
+
     [[nodiscard]] std::string
     ToString() const;
 
@@ -271,16 +336,18 @@ public:
     Solver Solver_ = Solver::Naive;
     PointerObjectConstraintSet::WorklistSolverPolicy WorklistSolverPolicy_ =
         PointerObjectConstraintSet::WorklistSolverPolicy::LeastRecentlyFired;
+    size_t NumThreads_ = 1;
     bool EnableOnlineCycleDetection_ = false;
     bool EnableHybridCycleDetection_ = false;
     bool EnableLazyCycleDetection_ = false;
     bool EnableDifferencePropagation_ = false;
     bool EnablePreferImplicitPointees_ = false;
+    PointsToSet::Representation PointsToSetRepresentation_ = PointsToSet::Representation::HashSet;
   };
 
-  ~Andersen() noexcept override = default;
+  ~Andersen() noexcept override;
 
-  Andersen() = default;
+  Andersen();
 
   Andersen(const Andersen &) = delete;
 
@@ -305,6 +372,45 @@ public:
   [[nodiscard]] const Configuration &
   GetConfiguration() const;
 
+  /**
+   * When enabled, the configuration is picked per module by the AndersenConfigurationModel,
+   * based on cheap features of the constraint set, instead of using the set configuration.
+   * ENV_USE_EXACT_CONFIG still takes precedence.
+   * @param enable if true, adaptive configuration is enabled
+   */
+  void
+  EnableAdaptiveConfiguration(bool enable) noexcept;
+
+  [[nodiscard]] bool
+  IsAdaptiveConfigurationEnabled() const noexcept;
+
+  /**
+   * When enabled, allocas and global variables of struct type are split into fields, based on
+   * the data layout of the module. GEPs with constant indices point to the field at their offset,
+   * while GEPs with other indices may point to any field of the objects pointed to by the base.
+   * Pointers into a field of array type are assumed to stay within the array.
+   * Memory objects created by malloc are never split.
+   * Loads, stores and memcpys that cover several fields access all of them, which is recorded
+   * per access in the PointsToGraph, without making the address point to these fields.
+   * @param enable if true, field sensitivity is enabled
+   */
+  void
+  EnableFieldSensitivity(bool enable) noexcept;
+
+  [[nodiscard]] bool
+  IsFieldSensitivityEnabled() const noexcept;
+
+  /**
+   * Memory objects with more fields than the given maximum are not split into fields.
+   * Only used when field sensitivity is enabled.
+   * @param maxFieldsPerObject the maximum number of fields per memory object
+   */
+  void
+  SetMaxFieldsPerObject(size_t maxFieldsPerObject) noexcept;
+
+  [[nodiscard]] size_t
+  GetMaxFieldsPerObject() const noexcept;
+
   /**
    * Performs Andersen's alias analysis on the rvsdg \p module,
    * producing a PointsToGraph describing what memory objects exists,
@@ -432,6 +538,35 @@ private:
   void
   AnalyzeRvsdg(const rvsdg::Graph & graph);
 
+  /**
+   * Creates the fields of the given memory object, if field sensitivity is enabled,
+   * and the type of the memory object has more than one field.
+   * @param memoryObject the memory object to split
+   * @param type the type of the value stored in the memory object
+   */
+  void
+  CreateFieldMemoryObjects(PointerObjectIndex memoryObject, const rvsdg::Type & type);
+
+  /**
+   * Creates the PointerObject used as the address in the constraints of a load, store or memcpy.
+   * If field sensitivity is enabled, this is a new PointerObject pointing to every field covered
+   * by the \p accessSize bytes following each pointee of the address. It is kept apart from the
+   * address' own PointerObject, so other uses of the address do not point to these fields, and is
+   * mapped to \p address in the PointerObjectSet. Otherwise, the address' PointerObject is used.
+   * @param address the address input of the load, store or memcpy
+   * @param accessSize the number of bytes accessed, or std::nullopt if unknown
+   * @return the PointerObject representing the memory accessed through \p address
+   */
+  [[nodiscard]] PointerObjectIndex
+  CreateAccessPointerObject(const rvsdg::input & address, std::optional<uint64_t> accessSize);
+
+  /**
+   * Creates the PointerObject representing the memory accessed as the given type.
+   * @see CreateAccessPointerObject
+   */
+  [[nodiscard]] PointerObjectIndex
+  CreateAccessPointerObject(const rvsdg::input & address, const rvsdg::Type & accessedType);
+
   /**
    * Traverses the given module, and initializes the members Set_ and Constraints_ with
    * PointerObjects and constraints corresponding to the module.
@@ -454,6 +589,12 @@ private:
       Statistics & statistics);
 
   Configuration Config_ = Configuration::DefaultConfiguration();
+  bool EnableAdaptiveConfiguration_ = false;
+  bool EnableFieldSensitivity_ = false;
+  size_t MaxFieldsPerObject_ = DefaultMaxFieldsPerObject;
+
+  // Only exists while analyzing a module with field sensitivity enabled
+  std::unique_ptr<FieldLayout> FieldLayout_;
 
   std::unique_ptr<PointerObjectSet> Set_;
   std::unique_ptr<PointerObjectConstraintSet> Constraints_;
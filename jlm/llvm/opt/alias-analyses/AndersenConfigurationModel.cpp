@@ -0,0 +1,503 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/AndersenConfigurationModel.hpp>
+#include <jlm/util/TarjanScc.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+namespace jlm::llvm::aa
+{
+
+/**
+ * The built-in model. It is a conservative starting point that only switches to sparse bit
+ * vectors for very large modules, and is meant to be replaced by a model trained with
+ * jlm-andersen-train.
+ */
+static const char * const BuiltinModel_ =
+    "split #PointerObjects 100000 1 2\n"
+    "leaf OVS_Solver=Worklist_Policy=LeastRecentlyFired_HybridCD_LazyCD_DP_PIP\n"
+    "leaf SBV_OVS_Solver=Worklist_Policy=LeastRecentlyFired_HybridCD_LazyCD_DP_PIP\n";
+
+const char *
+ConstraintSetFeatures::GetName(Feature feature)
+{
+  switch (feature)
+  {
+  case Feature::NumPointerObjects:
+    return "#PointerObjects";
+  case Feature::NumMemoryPointerObjects:
+    return "#MemoryPointerObjects";
+  case Feature::NumBaseConstraints:
+    return "#BaseConstraints";
+  case Feature::NumSupersetConstraints:
+    return "#SupersetConstraints";
+  case Feature::NumStoreConstraints:
+    return "#StoreConstraints";
+  case Feature::NumLoadConstraints:
+    return "#LoadConstraints";
+  case Feature::NumFunctionCallConstraints:
+    return "#FunctionCallConstraints";
+  case Feature::InitialLargestScc:
+    return "#InitialLargestScc";
+  case Feature::InitialSccNodes:
+    return "#InitialSccNodes";
+  case Feature::LoadStoreRatio:
+    return "LoadStoreRatio";
+  case Feature::EscapedFraction:
+    return "EscapedFraction";
+  default:
+    JLM_UNREACHABLE("Unknown feature");
+  }
+}
+
+ConstraintSetFeatures::Feature
+ConstraintSetFeatures::GetFeature(const std::string & name)
+{
+  for (size_t n = 0; n < static_cast<size_t>(Feature::COUNT); n++)
+  {
+    const auto feature = static_cast<Feature>(n);
+    if (name == GetName(feature))
+      return feature;
+  }
+
+  return Feature::COUNT;
+}
+
+bool
+ConstraintSetFeatures::IsAddedToStatistics(Feature feature)
+{
+  return feature == Feature::InitialLargestScc || feature == Feature::InitialSccNodes
+      || feature == Feature::LoadStoreRatio || feature == Feature::EscapedFraction;
+}
+
+ConstraintSetFeatures
+ConstraintSetFeatures::Extract(const PointerObjectConstraintSet & constraints)
+{
+  const auto & set = constraints.GetPointerObjectSet();
+  const auto numPointerObjects = set.NumPointerObjects();
+
+  // Count the constraints of each kind, and create the graph of superset constraints
+  size_t numSupersetConstraints = 0;
+  size_t numStoreConstraints = 0;
+  size_t numLoadConstraints = 0;
+  size_t numFunctionCallConstraints = 0;
+  std::vector<std::vector<PointerObjectIndex>> successors(numPointerObjects);
+  for (const auto & constraint : constraints.GetConstraints())
+  {
+    if (auto superset = std::get_if<SupersetConstraint>(&constraint))
+    {
+      const auto supersetRoot = set.GetUnificationRoot(superset->GetSuperset());
+      const auto subsetRoot = set.GetUnificationRoot(superset->GetSubset());
+      successors[subsetRoot].push_back(supersetRoot);
+      numSupersetConstraints++;
+    }
+
+    numStoreConstraints += std::holds_alternative<StoreConstraint>(constraint);
+    numLoadConstraints += std::holds_alternative<LoadConstraint>(constraint);
+    numFunctionCallConstraints += std::holds_alternative<FunctionCallConstraint>(constraint);
+  }
+
+  const auto GetSuccessors = [&](PointerObjectIndex node) -> auto &
+  {
+    return successors[node];
+  };
+
+  std::vector<PointerObjectIndex> sccIndex;
+  std::vector<PointerObjectIndex> topologicalOrder;
+  const auto numSccs = util::FindStronglyConnectedComponents<PointerObjectIndex>(
+      numPointerObjects,
+      GetSuccessors,
+      sccIndex,
+      topologicalOrder);
+
+  std::vector<size_t> sccSize(numSccs, 0);
+  for (const auto scc : sccIndex)
+    sccSize[scc]++;
+
+  size_t largestScc = 0;
+  size_t numSccNodes = 0;
+  for (const auto size : sccSize)
+  {
+    largestScc = std::max(largestScc, size);
+    if (size > 1)
+      numSccNodes += size;
+  }
+
+  size_t numMemoryObjects = 0;
+  size_t numEscapedMemoryObjects = 0;
+  for (PointerObjectIndex i = 0; i < numPointerObjects; i++)
+  {
+    if (set.IsPointerObjectRegister(i))
+      continue;
+
+    numMemoryObjects++;
+    numEscapedMemoryObjects += set.HasEscaped(i);
+  }
+
+  ConstraintSetFeatures features;
+  features.SetValue(Feature::NumPointerObjects, numPointerObjects);
+  features.SetValue(Feature::NumMemoryPointerObjects, set.NumMemoryPointerObjects());
+  features.SetValue(Feature::NumBaseConstraints, constraints.NumBaseConstraints());
+  features.SetValue(Feature::NumSupersetConstraints, numSupersetConstraints);
+  features.SetValue(Feature::NumStoreConstraints, numStoreConstraints);
+  features.SetValue(Feature::NumLoadConstraints, numLoadConstraints);
+  features.SetValue(Feature::NumFunctionCallConstraints, numFunctionCallConstraints);
+  features.SetValue(Feature::InitialLargestScc, largestScc);
+  features.SetValue(Feature::InitialSccNodes, numSccNodes);
+  features.SetValue(
+      Feature::LoadStoreRatio,
+      static_cast<double>(numLoadConstraints) / std::max<size_t>(numStoreConstraints, 1));
+  features.SetValue(
+      Feature::EscapedFraction,
+      static_cast<double>(numEscapedMemoryObjects) / std::max<size_t>(numMemoryObjects, 1));
+  return features;
+}
+
+AndersenConfigurationModel
+AndersenConfigurationModel::FromString(const std::string & text)
+{
+  AndersenConfigurationModel model;
+  model.Configurations_ = Andersen::Configuration::GetAllConfigurations();
+
+  std::unordered_map<std::string, size_t> configurationIndices;
+  for (size_t n = 0; n < model.Configurations_.size(); n++)
+    configurationIndices[model.Configurations_[n].ToString()] = n;
+
+  std::istringstream lines(text);
+  std::string line;
+  while (std::getline(lines, line))
+  {
+    std::istringstream tokens(line);
+    std::string kind;
+    if (!(tokens >> kind) || kind[0] == '#')
+      continue;
+
+    Node node{ ConstraintSetFeatures::Feature::COUNT, 0.0, 0, 0, 0 };
+    if (kind == "split")
+    {
+      std::string featureName;
+      if (!(tokens >> featureName >> node.Threshold >> node.Less >> node.GreaterOrEqual))
+        throw util::error("Malformed split in Andersen configuration model: " + line);
+
+      node.Feature = ConstraintSetFeatures::GetFeature(featureName);
+      if (node.Feature == ConstraintSetFeatures::Feature::COUNT)
+        throw util::error("Unknown feature in Andersen configuration model: " + featureName);
+
+      // Children come after their parent, which rules out cycles
+      const auto index = model.Nodes_.size();
+      if (node.Less <= index || node.GreaterOrEqual <= index)
+        throw util::error("Split refers to an earlier node in Andersen configuration model");
+    }
+    else if (kind == "leaf")
+    {
+      std::string configuration;
+      tokens >> configuration;
+      auto it = configurationIndices.find(configuration);
+      if (it == configurationIndices.end())
+        throw util::error("Unknown configuration in Andersen configuration model: " + line);
+
+      node.Configuration = it->second;
+    }
+    else
+    {
+      throw util::error("Unknown node kind in Andersen configuration model: " + kind);
+    }
+
+    model.Nodes_.push_back(node);
+  }
+
+  if (model.Nodes_.empty())
+    throw util::error("Andersen configuration model is empty");
+
+  for (const auto & node : model.Nodes_)
+  {
+    if (node.Feature != ConstraintSetFeatures::Feature::COUNT
+        && std::max(node.Less, node.GreaterOrEqual) >= model.Nodes_.size())
+      throw util::error("Split refers to a missing node in Andersen configuration model");
+  }
+
+  return model;
+}
+
+std::string
+AndersenConfigurationModel::ToString() const
+{
+  std::ostringstream text;
+  text << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (const auto & node : Nodes_)
+  {
+    if (node.Feature == ConstraintSetFeatures::Feature::COUNT)
+    {
+      text << "leaf " << Configurations_[node.Configuration].ToString() << std::endl;
+    }
+    else
+    {
+      text << "split " << ConstraintSetFeatures::GetName(node.Feature) << " " << node.Threshold
+           << " " << node.Less << " " << node.GreaterOrEqual << std::endl;
+    }
+  }
+
+  return text.str();
+}
+
+const AndersenConfigurationModel &
+AndersenConfigurationModel::GetBuiltinModel()
+{
+  static const auto model = FromString(BuiltinModel_);
+  return model;
+}
+
+const Andersen::Configuration &
+AndersenConfigurationModel::Predict(const ConstraintSetFeatures & features) const
+{
+  const Node * node = &Nodes_[0];
+  while (node->Feature != ConstraintSetFeatures::Feature::COUNT)
+  {
+    const auto next =
+        features.GetValue(node->Feature) < node->Threshold ? node->Less : node->GreaterOrEqual;
+    node = &Nodes_[next];
+  }
+
+  return Configurations_[node->Configuration];
+}
+
+std::vector<AndersenConfigurationModel::TrainingSample>
+AndersenConfigurationModel::ReadTrainingSamples(std::istream & statistics)
+{
+  static constexpr const char * configurationLabel = "Configuration";
+
+  // The timers that make up the solving time of a configuration
+  const auto IsSolvingTimer = [](const std::string & label)
+  {
+    return label == "OVSTimer[ns]" || label == "OfflineNormTimer[ns]"
+        || (label.rfind("ConstraintSolving", 0) == 0 && label.find("Timer[ns]") != label.npos);
+  };
+
+  std::vector<TrainingSample> samples;
+  std::vector<bool> hasAllFeatures;
+  std::string sourceFile;
+
+  std::string line;
+  while (std::getline(statistics, line))
+  {
+    std::istringstream tokens(line);
+    std::string statisticsName, file;
+    if (!(tokens >> statisticsName >> file) || statisticsName != "AndersenAnalysis")
+      continue;
+
+    std::unordered_map<std::string, std::string> measurements;
+    std::string token;
+    while (tokens >> token)
+    {
+      const auto separator = token.find(':');
+      if (separator != token.npos)
+        measurements[token.substr(0, separator)] = token.substr(separator + 1);
+    }
+
+    // The statistics of an analysis run measure the constraint set before solving
+    const auto numPointerObjectsLabel =
+        ConstraintSetFeatures::GetName(ConstraintSetFeatures::Feature::NumPointerObjects);
+    if (measurements.find(numPointerObjectsLabel) != measurements.end())
+    {
+      samples.emplace_back();
+      hasAllFeatures.push_back(true);
+      sourceFile = file;
+      for (size_t n = 0; n < static_cast<size_t>(ConstraintSetFeatures::Feature::COUNT); n++)
+      {
+        const auto feature = static_cast<ConstraintSetFeatures::Feature>(n);
+        auto it = measurements.find(ConstraintSetFeatures::GetName(feature));
+        if (it == measurements.end())
+          hasAllFeatures.back() = false;
+        else
+          samples.back().Features.SetValue(feature, std::stod(it->second));
+      }
+    }
+
+    auto configuration = measurements.find(configurationLabel);
+    if (samples.empty() || file != sourceFile || configuration == measurements.end())
+      continue;
+
+    double solvingTime = 0;
+    for (const auto & [label, value] : measurements)
+    {
+      if (IsSolvingTimer(label))
+        solvingTime += std::stod(value);
+    }
+
+    auto & solvingTimes = samples.back().SolvingTimes;
+    auto [it, inserted] = solvingTimes.emplace(configuration->second, solvingTime);
+    if (!inserted)
+      it->second = std::min(it->second, solvingTime);
+  }
+
+  std::vector<TrainingSample> result;
+  for (size_t n = 0; n < samples.size(); n++)
+  {
+    if (hasAllFeatures[n])
+      result.push_back(std::move(samples[n]));
+  }
+
+  return result;
+}
+
+AndersenConfigurationModel
+AndersenConfigurationModel::Train(
+    const std::vector<TrainingSample> & samples,
+    size_t maxDepth,
+    size_t minSamplesPerLeaf)
+{
+  JLM_ASSERT(!samples.empty());
+  minSamplesPerLeaf = std::max<size_t>(minSamplesPerLeaf, 1);
+
+  AndersenConfigurationModel model;
+  model.Configurations_ = Andersen::Configuration::GetAllConfigurations();
+
+  // Only configurations that were measured for all samples are candidates
+  std::vector<size_t> candidates;
+  for (size_t n = 0; n < model.Configurations_.size(); n++)
+  {
+    const auto configuration = model.Configurations_[n].ToString();
+    const bool isMeasured = std::all_of(
+        samples.begin(),
+        samples.end(),
+        [&](const TrainingSample & sample)
+        {
+          return sample.SolvingTimes.find(configuration) != sample.SolvingTimes.end();
+        });
+    if (isMeasured)
+      candidates.push_back(n);
+  }
+
+  if (candidates.empty())
+    throw util::error("No Andersen configuration was measured for all training samples");
+
+  // The slowdown of a configuration is its solving time relative to the fastest candidate
+  std::vector<std::vector<double>> slowdowns(samples.size());
+  for (size_t s = 0; s < samples.size(); s++)
+  {
+    std::vector<double> solvingTimes;
+    for (const auto candidate : candidates)
+    {
+      const auto configuration = model.Configurations_[candidate].ToString();
+      solvingTimes.push_back(samples[s].SolvingTimes.at(configuration));
+    }
+
+    const auto fastest = std::max(*std::min_element(solvingTimes.begin(), solvingTimes.end()), 1.0);
+    for (const auto solvingTime : solvingTimes)
+      slowdowns[s].push_back(solvingTime / fastest);
+  }
+
+  std::vector<size_t> sampleIndices(samples.size());
+  std::iota(sampleIndices.begin(), sampleIndices.end(), 0);
+  model.AddSubtree(samples, slowdowns, candidates, sampleIndices, maxDepth, minSamplesPerLeaf);
+  return model;
+}
+
+size_t
+AndersenConfigurationModel::AddSubtree(
+    const std::vector<TrainingSample> & samples,
+    const std::vector<std::vector<double>> & slowdowns,
+    const std::vector<size_t> & candidates,
+    const std::vector<size_t> & sampleIndices,
+    size_t maxDepth,
+    size_t minSamplesPerLeaf)
+{
+  const auto numCandidates = candidates.size();
+  const auto MinElement = [](const std::vector<double> & values)
+  {
+    return std::min_element(values.begin(), values.end());
+  };
+
+  // A leaf picks the candidate with the smallest sum of slowdowns
+  std::vector<double> totalSlowdowns(numCandidates, 0.0);
+  for (const auto s : sampleIndices)
+  {
+    for (size_t c = 0; c < numCandidates; c++)
+      totalSlowdowns[c] += slowdowns[s][c];
+  }
+  const auto bestLeaf = MinElement(totalSlowdowns);
+
+  // Find the split with the smallest sum of slowdowns in its two leaves
+  auto bestCost = *bestLeaf;
+  auto bestFeature = ConstraintSetFeatures::Feature::COUNT;
+  double bestThreshold = 0;
+  if (maxDepth > 0 && sampleIndices.size() >= 2 * minSamplesPerLeaf)
+  {
+    for (size_t f = 0; f < static_cast<size_t>(ConstraintSetFeatures::Feature::COUNT); f++)
+    {
+      const auto feature = static_cast<ConstraintSetFeatures::Feature>(f);
+      const auto GetValue = [&](size_t s)
+      {
+        return samples[s].Features.GetValue(feature);
+      };
+
+      auto sorted = sampleIndices;
+      std::sort(
+          sorted.begin(),
+          sorted.end(),
+          [&](size_t s1, size_t s2)
+          {
+            return GetValue(s1) < GetValue(s2);
+          });
+
+      std::vector<double> lessSlowdowns(numCandidates, 0.0);
+      std::vector<double> greaterOrEqualSlowdowns(numCandidates, 0.0);
+      for (size_t i = 0; i + 1 < sorted.size(); i++)
+      {
+        for (size_t c = 0; c < numCandidates; c++)
+          lessSlowdowns[c] += slowdowns[sorted[i]][c];
+
+        const auto numLess = i + 1;
+        if (numLess < minSamplesPerLeaf || sorted.size() - numLess < minSamplesPerLeaf
+            || GetValue(sorted[i]) == GetValue(sorted[i + 1]))
+          continue;
+
+        for (size_t c = 0; c < numCandidates; c++)
+          greaterOrEqualSlowdowns[c] = totalSlowdowns[c] - lessSlowdowns[c];
+
+        const auto cost = *MinElement(lessSlowdowns) + *MinElement(greaterOrEqualSlowdowns);
+        if (cost < bestCost * (1 - 1e-9))
+        {
+          bestCost = cost;
+          bestFeature = feature;
+          bestThreshold = (GetValue(sorted[i]) + GetValue(sorted[i + 1])) / 2;
+        }
+      }
+    }
+  }
+
+  const auto index = Nodes_.size();
+  if (bestFeature == ConstraintSetFeatures::Feature::COUNT)
+  {
+    const auto candidate = candidates[bestLeaf - totalSlowdowns.begin()];
+    Nodes_.push_back({ ConstraintSetFeatures::Feature::COUNT, 0.0, 0, 0, candidate });
+    return index;
+  }
+
+  std::vector<size_t> less, greaterOrEqual;
+  for (const auto s : sampleIndices)
+  {
+    if (samples[s].Features.GetValue(bestFeature) < bestThreshold)
+      less.push_back(s);
+    else
+      greaterOrEqual.push_back(s);
+  }
+
+  Nodes_.push_back({ bestFeature, bestThreshold, 0, 0, 0 });
+  const auto lessIndex =
+      AddSubtree(samples, slowdowns, candidates, less, maxDepth - 1, minSamplesPerLeaf);
+  const auto greaterOrEqualIndex =
+      AddSubtree(samples, slowdowns, candidates, greaterOrEqual, maxDepth - 1, minSamplesPerLeaf);
+  Nodes_[index].Less = lessIndex;
+  Nodes_[index].GreaterOrEqual = greaterOrEqualIndex;
+  return index;
+}
+
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_ANDERSENCONFIGURATIONMODEL_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_ANDERSENCONFIGURATIONMODEL_HPP
+
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::llvm::aa
+{
+
+/**
+ * Features of a constraint set that are cheap to extract before solving.
+ * They are used by the AndersenConfigurationModel to pick a solver configuration.
+ *
+ * The features are named after the measurements of the Andersen statistics,
+ * such that the model can be trained from the statistics output.
+ */
+class ConstraintSetFeatures final
+{
+public:
+  enum class Feature : size_t
+  {
+    NumPointerObjects,
+    NumMemoryPointerObjects,
+    NumBaseConstraints,
+    NumSupersetConstraints,
+    NumStoreConstraints,
+    NumLoadConstraints,
+    NumFunctionCallConstraints,
+    // The number of PointerObjects in the largest cycle of superset constraints
+    InitialLargestScc,
+    // The number of PointerObjects in cycles of superset constraints
+    InitialSccNodes,
+    // The number of load constraints per store constraint
+    LoadStoreRatio,
+    // The fraction of memory objects that have escaped before solving
+    EscapedFraction,
+
+    COUNT
+  };
+
+  /**
+   * @return the name of \p feature, which is also its label in the Andersen statistics.
+   */
+  [[nodiscard]] static const char *
+  GetName(Feature feature);
+
+  /**
+   * @return the feature with the given \p name, or Feature::COUNT if there is none.
+   */
+  [[nodiscard]] static Feature
+  GetFeature(const std::string & name);
+
+  /**
+   * @return true if \p feature is not measured by the Andersen statistics on its own.
+   */
+  [[nodiscard]] static bool
+  IsAddedToStatistics(Feature feature);
+
+  [[nodiscard]] double
+  GetValue(Feature feature) const noexcept
+  {
+    return Values_[static_cast<size_t>(feature)];
+  }
+
+  void
+  SetValue(Feature feature, double value) noexcept
+  {
+    Values_[static_cast<size_t>(feature)] = value;
+  }
+
+  /**
+   * Extracts the features of the unsolved constraint set \p constraints.
+   * The run time is linear in the number of PointerObjects and constraints.
+   */
+  [[nodiscard]] static ConstraintSetFeatures
+  Extract(const PointerObjectConstraintSet & constraints);
+
+private:
+  std::vector<double> Values_ = std::vector<double>(static_cast<size_t>(Feature::COUNT), 0.0);
+};
+
+/**
+ * A decision tree that picks an Andersen configuration from the ConstraintSetFeatures of a
+ * constraint set. Each inner node compares one feature against a threshold, and each leaf names
+ * a configuration from Andersen::Configuration::GetAllConfigurations().
+ *
+ * Models are stored in a line-based text format, where node 0 is the root:
+ *   split <feature> <threshold> <node if less> <node otherwise>
+ *   leaf <configuration>
+ * Empty lines and lines starting with '#' are ignored.
+ *
+ * Models are trained with the jlm-andersen-train tool, from the statistics of running Andersen
+ * with Andersen::ENV_TEST_ALL_CONFIGS on a set of modules. A trained model can be used instead of
+ * the built-in model through Andersen::ENV_CONFIG_MODEL.
+ */
+class AndersenConfigurationModel final
+{
+public:
+  /**
+   * The features and measured solving times of a single module, used for training.
+   */
+  struct TrainingSample
+  {
+    ConstraintSetFeatures Features;
+
+    // The solving time of each configuration, in nanoseconds, identified by its string
+    std::unordered_map<std::string, double> SolvingTimes;
+  };
+
+  /**
+   * Parses a model in the text format.
+   * @throws util::error if the model is malformed, or names unknown features or configurations.
+   */
+  [[nodiscard]] static AndersenConfigurationModel
+  FromString(const std::string & text);
+
+  /**
+   * @return the model in the text format.
+   */
+  [[nodiscard]] std::string
+  ToString() const;
+
+  /**
+   * @return the model that is built into jlm.
+   */
+  [[nodiscard]] static const AndersenConfigurationModel &
+  GetBuiltinModel();
+
+  /**
+   * @return the configuration the model picks for a constraint set with the given \p features.
+   */
+  [[nodiscard]] const Andersen::Configuration &
+  Predict(const ConstraintSetFeatures & features) const;
+
+  /**
+   * @return the number of nodes in the decision tree.
+   */
+  [[nodiscard]] size_t
+  NumNodes() const noexcept
+  {
+    return Nodes_.size();
+  }
+
+  /**
+   * Reads training samples from the statistics output of the Andersen analysis. The statistics
+   * line of each analysis run is followed by the lines of solving with other configurations.
+   * The solving time of a configuration includes the offline techniques, and is the minimum
+   * over all lines with that configuration.
+   * @param statistics the content of one or more statistics files
+   * @return one training sample per analysis run that has all features
+   */
+  [[nodiscard]] static std::vector<TrainingSample>
+  ReadTrainingSamples(std::istream & statistics);
+
+  /**
+   * Trains a decision tree that minimizes the sum of slowdowns of the picked configurations,
+   * compared to the fastest configuration of each sample.
+   * @param samples the training samples. Must not be empty.
+   * @param maxDepth the maximum depth of the decision tree
+   * @param minSamplesPerLeaf the minimum number of samples in each leaf
+   * @return the trained model
+   */
+  [[nodiscard]] static AndersenConfigurationModel
+  Train(const std::vector<TrainingSample> & samples, size_t maxDepth, size_t minSamplesPerLeaf);
+
+private:
+  struct Node
+  {
+    // The feature compared by a split, or Feature::COUNT for leaves
+    ConstraintSetFeatures::Feature Feature;
+    double Threshold;
+    size_t Less;
+    size_t GreaterOrEqual;
+    // The index of the configuration in Andersen::Configuration::GetAllConfigurations()
+    size_t Configuration;
+  };
+
+  AndersenConfigurationModel() = default;
+
+  /**
+   * Adds the subtree for the samples \p sampleIndices to the model.
+   * @param samples all training samples
+   * @param slowdowns the slowdown of each candidate configuration, for each sample
+   * @param candidates the indices of the candidate configurations in Configurations_
+   * @param sampleIndices the samples in the subtree
+   * @param maxDepth the maximum depth of the subtree
+   * @param minSamplesPerLeaf the minimum number of samples in each leaf
+   * @return the index of the root of the subtree
+   */
+  size_t
+  AddSubtree(
+      const std::vector<TrainingSample> & samples,
+      const std::vector<std::vector<double>> & slowdowns,
+      const std::vector<size_t> & candidates,
+      const std::vector<size_t> & sampleIndices,
+      size_t maxDepth,
+      size_t minSamplesPerLeaf);
+
+  std::vector<Node> Nodes_;
+  std::vector<Andersen::Configuration> Configurations_;
+};
+
+}
+
+#endif
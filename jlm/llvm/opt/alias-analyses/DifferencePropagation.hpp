@@ -27,7 +27,7 @@ public:
   void
   Initialize()
   {
-    NewPointees_.resize(Set_.NumPointerObjects());
+    NewPointees_.resize(Set_.NumPointerObjects(), Set_.CreateEmptyPointsToSet());
     NewPointeesTracked_.resize(Set_.NumPointerObjects(), false);
     PointsToExternalFlagSeen_.resize(Set_.NumPointerObjects(), false);
     PointeesEscapeFlagSeen_.resize(Set_.NumPointerObjects(), false);
@@ -101,7 +101,7 @@ public:
    * @param index the index of the PointerObject, must be a unification root.
    * @return a reference to either all new pointees, or all pointees of index.
    */
-  [[nodiscard]] const util::HashSet<PointerObjectIndex> &
+  [[nodiscard]] const PointsToSet &
   GetNewPointees(PointerObjectIndex index) const
   {
     JLM_ASSERT(IsInitialized());
@@ -220,7 +220,7 @@ private:
 
   // Tracks all new pointees added to a unification root i,
   // since ClearNewPointees(i) was last called.
-  std::vector<util::HashSet<PointerObjectIndex>> NewPointees_;
+  std::vector<PointsToSet> NewPointees_;
   // Becomes true for a unification root i when CleanNewPointees(i) is called for the first time.
   // Becomes false again when unification fully resets difference propagation
   std::vector<bool> NewPointeesTracked_;
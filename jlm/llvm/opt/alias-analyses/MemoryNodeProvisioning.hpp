@@ -44,6 +44,21 @@ public:
   [[nodiscard]] virtual jlm::util::HashSet<const PointsToGraph::MemoryNode *>
   GetOutputNodes(const jlm::rvsdg::output & output) const = 0;
 
+  /**
+   * @return the memory nodes accessed by the load, store or memcpy with the address input
+   * \p address. These are the nodes of the address' origin, and the fields that are covered by the
+   * width of the access.
+   *
+   * @see PointsToGraph::GetAccessedFieldNodes
+   */
+  [[nodiscard]] jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  GetAccessedNodes(const jlm::rvsdg::input & address) const
+  {
+    auto memoryNodes = GetOutputNodes(*address.origin());
+    memoryNodes.UnionWith(GetPointsToGraph().GetAccessedFieldNodes(address));
+    return memoryNodes;
+  }
+
   [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
   GetLambdaEntryNodes(const rvsdg::LambdaNode & lambdaNode) const
   {
@@ -71,7 +71,7 @@ public:
   bool
   Contains(const rvsdg::output & output) const noexcept
   {
-    return MemoryNodeMap_.find(&output) != MemoryNodeMap_.end();
+    return MemoryNodeMap_.Contains(output);
   }
 
   util::HashSet<const PointsToGraph::MemoryNode *>
@@ -80,7 +80,7 @@ public:
     JLM_ASSERT(is<PointerType>(output.type()));
 
     if (Contains(output))
-      return MemoryNodeMap_[&output];
+      return MemoryNodeMap_.Lookup(output);
 
     auto memoryNodes = MemoryNodeProvisioning_.GetOutputNodes(output);
 
@@ -88,9 +88,9 @@ public:
     if (output.nusers() <= 1)
       return memoryNodes;
 
-    MemoryNodeMap_[&output] = std::move(memoryNodes);
+    MemoryNodeMap_[output] = std::move(memoryNodes);
 
-    return MemoryNodeMap_[&output];
+    return MemoryNodeMap_.Lookup(output);
   }
 
   void
@@ -99,7 +99,7 @@ public:
     JLM_ASSERT(!Contains(oldAddress));
     JLM_ASSERT(!Contains(newAddress));
 
-    MemoryNodeMap_[&newAddress] = MemoryNodeProvisioning_.GetOutputNodes(oldAddress);
+    MemoryNodeMap_[newAddress] = MemoryNodeProvisioning_.GetOutputNodes(oldAddress);
   }
 
   static std::unique_ptr<MemoryNodeCache>
@@ -110,8 +110,7 @@ public:
 
 private:
   const MemoryNodeProvisioning & MemoryNodeProvisioning_;
-  std::unordered_map<const rvsdg::output *, util::HashSet<const PointsToGraph::MemoryNode *>>
-      MemoryNodeMap_;
+  rvsdg::DenseOutputMap<util::HashSet<const PointsToGraph::MemoryNode *>> MemoryNodeMap_;
 };
 
 /** \brief Hash map for mapping points-to graph memory nodes to RVSDG memory states.
@@ -318,6 +317,20 @@ public:
                                    : GetStates(*output.region(), memoryNodes);
   }
 
+  /**
+   * Gets the states of all memory nodes accessed by the load, store or memcpy with the address
+   * input \p address, including fields that are covered by the width of the access.
+   */
+  std::vector<StateMap::MemoryNodeStatePair *>
+  GetAccessedStates(const rvsdg::input & address)
+  {
+    auto memoryNodes = GetMemoryNodes(*address.origin());
+    memoryNodes.UnionWith(
+        MemoryNodeProvisioning_.GetPointsToGraph().GetAccessedFieldNodes(address));
+    return memoryNodes.Size() == 0 ? std::vector<StateMap::MemoryNodeStatePair *>()
+                                   : GetStates(*address.region(), memoryNodes);
+  }
+
   std::vector<StateMap::MemoryNodeStatePair *>
   GetStates(
       const rvsdg::Region & region,
@@ -585,20 +598,28 @@ MemoryStateEncoder::EncodeAlloca(const rvsdg::SimpleNode & allocaNode)
   JLM_ASSERT(is<alloca_op>(&allocaNode));
 
   auto & stateMap = Context_->GetRegionalizedStateMap();
-  auto & allocaMemoryNode =
-      Context_->GetMemoryNodeProvisioning().GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Context_->GetMemoryNodeProvisioning().GetPointsToGraph();
+  auto & allocaMemoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto & allocaNodeStateOutput = *allocaNode.output(1);
 
-  if (stateMap.HasState(*allocaNode.region(), allocaMemoryNode))
-  {
-    // The state for the alloca memory node should already exist in case of lifetime agnostic
-    // provisioning.
-    auto memoryNodeStatePair = stateMap.GetState(*allocaNode.region(), allocaMemoryNode);
-    memoryNodeStatePair->ReplaceState(allocaNodeStateOutput);
-  }
-  else
+  // If the alloca is split into fields, all fields are created by the alloca's state output
+  std::vector<const PointsToGraph::MemoryNode *> memoryNodes({ &allocaMemoryNode });
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(allocaMemoryNode))
+    memoryNodes.push_back(fieldNode);
+
+  for (auto memoryNode : memoryNodes)
   {
-    stateMap.InsertState(allocaMemoryNode, allocaNodeStateOutput);
+    if (stateMap.HasState(*allocaNode.region(), *memoryNode))
+    {
+      // The state for the alloca memory node should already exist in case of lifetime agnostic
+      // provisioning.
+      auto memoryNodeStatePair = stateMap.GetState(*allocaNode.region(), *memoryNode);
+      memoryNodeStatePair->ReplaceState(allocaNodeStateOutput);
+    }
+    else
+    {
+      stateMap.InsertState(*memoryNode, allocaNodeStateOutput);
+    }
   }
 }
 
@@ -627,8 +648,7 @@ MemoryStateEncoder::EncodeLoad(const LoadNode & loadNode)
 {
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto address = loadNode.GetAddressInput().origin();
-  auto memoryNodeStatePairs = stateMap.GetStates(*address);
+  auto memoryNodeStatePairs = stateMap.GetAccessedStates(loadNode.GetAddressInput());
   auto memoryStates = StateMap::MemoryNodeStatePair::States(memoryNodeStatePairs);
 
   auto & newLoadNode = ReplaceLoadNode(loadNode, memoryStates);
@@ -646,8 +666,7 @@ MemoryStateEncoder::EncodeStore(const StoreNode & storeNode)
 {
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto address = storeNode.GetAddressInput().origin();
-  auto memoryNodeStatePairs = stateMap.GetStates(*address);
+  auto memoryNodeStatePairs = stateMap.GetAccessedStates(storeNode.GetAddressInput());
   auto memoryStates = StateMap::MemoryNodeStatePair::States(memoryNodeStatePairs);
 
   auto & newStoreNode = ReplaceStoreNode(storeNode, memoryStates);
@@ -731,11 +750,8 @@ MemoryStateEncoder::EncodeMemcpy(const rvsdg::SimpleNode & memcpyNode)
   JLM_ASSERT(is<MemCpyOperation>(&memcpyNode));
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto destination = memcpyNode.input(0)->origin();
-  auto source = memcpyNode.input(1)->origin();
-
-  auto destMemoryNodeStatePairs = stateMap.GetStates(*destination);
-  auto srcMemoryNodeStatePairs = stateMap.GetStates(*source);
+  auto destMemoryNodeStatePairs = stateMap.GetAccessedStates(*memcpyNode.input(0));
+  auto srcMemoryNodeStatePairs = stateMap.GetAccessedStates(*memcpyNode.input(1));
 
   auto memoryStateOperands = StateMap::MemoryNodeStatePair::States(destMemoryNodeStatePairs);
   auto srcStates = StateMap::MemoryNodeStatePair::States(srcMemoryNodeStatePairs);
@@ -10,13 +10,309 @@
 #include <jlm/llvm/opt/alias-analyses/OnlineCycleDetection.hpp>
 #include <jlm/util/Worklist.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <limits>
+#include <mutex>
 #include <queue>
+#include <thread>
 #include <variant>
 
 namespace jlm::llvm::aa
 {
 
+SharedPointsToSetStore::SharedPointsToSetStore()
+{
+  [[maybe_unused]] auto emptySet = Intern(SetType());
+  JLM_ASSERT(emptySet == EmptySet);
+}
+
+SharedPointsToSetStore::SetIndex
+SharedPointsToSetStore::Intern(SetType set)
+{
+  const auto hash = set.Hash();
+  const auto [begin, end] = SetsByHash_.equal_range(hash);
+  for (auto it = begin; it != end; ++it)
+  {
+    if (Sets_[it->second] == set)
+      return it->second;
+  }
+
+  if (Sets_.size() > std::numeric_limits<SetIndex>::max())
+    throw util::error("Too many distinct points-to sets in the shared points-to set store");
+
+  const SetIndex index = Sets_.size();
+  NumSetBytes_ += set.NumBytes();
+  Sets_.push_back(std::move(set));
+  SetsByHash_.emplace(hash, index);
+  return index;
+}
+
+template<typename ComputeFunctor>
+SharedPointsToSetStore::SetIndex
+SharedPointsToSetStore::Memoize(
+    OperationCache & cache,
+    const OperationKey & key,
+    const ComputeFunctor & compute)
+{
+  if (const auto it = cache.find(key); it != cache.end())
+  {
+    NumCacheHits_++;
+    return it->second;
+  }
+
+  NumCacheMisses_++;
+  const auto result = compute();
+  cache[key] = result;
+  return result;
+}
+
+SharedPointsToSetStore::SetIndex
+SharedPointsToSetStore::Union(SetIndex index1, SetIndex index2)
+{
+  if (index1 == index2 || index2 == EmptySet)
+    return index1;
+  if (index1 == EmptySet)
+    return index2;
+
+  // Unions are commutative, so only cache them once
+  const OperationKey key = std::minmax(index1, index2);
+  const auto unite = [&]()
+  {
+    // Copy the larger set, and add the items of the smaller set to it
+    const auto & set1 = GetSet(key.first);
+    const auto & set2 = GetSet(key.second);
+    auto set = set1.Size() >= set2.Size() ? set1 : set2;
+    set.UnionWith(set1.Size() >= set2.Size() ? set2 : set1);
+    return Intern(std::move(set));
+  };
+  return Memoize(UnionCache_, key, unite);
+}
+
+SharedPointsToSetStore::SetIndex
+SharedPointsToSetStore::Difference(SetIndex index1, SetIndex index2)
+{
+  if (index1 == index2)
+    return EmptySet;
+  if (index1 == EmptySet || index2 == EmptySet)
+    return index1;
+
+  const auto subtract = [&]()
+  {
+    auto set = GetSet(index1);
+    set.DifferenceWith(GetSet(index2));
+    return Intern(std::move(set));
+  };
+  return Memoize(DifferenceCache_, { index1, index2 }, subtract);
+}
+
+size_t
+SharedPointsToSetStore::NumBytes() const noexcept
+{
+  // Each hash table entry is approximated as its value and a pointer to the next entry
+  const size_t cacheEntryBytes = sizeof(OperationCache::value_type) + sizeof(void *);
+  const size_t hashEntryBytes = sizeof(decltype(SetsByHash_)::value_type) + sizeof(void *);
+  const size_t numCacheEntries = UnionCache_.size() + DifferenceCache_.size();
+  return NumSetBytes_ + numCacheEntries * cacheEntryBytes + SetsByHash_.size() * hashEntryBytes;
+}
+
+PointsToSet::PointsToSet(Representation representation)
+{
+  JLM_ASSERT(representation != Representation::Shared);
+  if (representation == Representation::SparseBitVector)
+    Set_ = SparseBitVectorType();
+}
+
+void
+PointsToSet::SetRepresentation(Representation representation, SharedPointsToSetStore * store)
+{
+  JLM_ASSERT(representation != Representation::Shared || store);
+  if (representation == GetRepresentation())
+  {
+    auto sharedSet = std::get_if<SharedSet>(&Set_);
+    if (!sharedSet || &sharedSet->GetStore() == store)
+      return;
+  }
+
+  SparseBitVectorType items;
+  for (auto item : Items())
+    items.Insert(item);
+
+  if (representation == Representation::HashSet)
+  {
+    HashSetType hashSet;
+    for (auto item : items.Items())
+      hashSet.Insert(item);
+    Set_ = std::move(hashSet);
+  }
+  else if (representation == Representation::SparseBitVector)
+  {
+    Set_ = std::move(items);
+  }
+  else
+  {
+    Set_ = SharedSet(*store, store->Intern(std::move(items)));
+  }
+}
+
+bool
+PointsToSet::Insert(PointerObjectIndex item)
+{
+  if (auto hashSet = std::get_if<HashSetType>(&Set_))
+    return hashSet->Insert(item);
+  if (auto sparseBitVector = std::get_if<SparseBitVectorType>(&Set_))
+    return sparseBitVector->Insert(item);
+
+  // Inserting an item is not memoized, so avoid copying the set if it already contains the item
+  auto & sharedSet = std::get<SharedSet>(Set_);
+  if (sharedSet.GetItems().Contains(item))
+    return false;
+  return sharedSet.GetModifiableItems().Insert(item);
+}
+
+PointsToSet::SparseBitVectorType *
+PointsToSet::GetModifiableSparseBitVector()
+{
+  if (auto sharedSet = std::get_if<SharedSet>(&Set_))
+    return &sharedSet->GetModifiableItems();
+  return std::get_if<SparseBitVectorType>(&Set_);
+}
+
+bool
+PointsToSet::IsSharedInSameStore(const PointsToSet & other) const noexcept
+{
+  auto sharedSet = std::get_if<SharedSet>(&Set_);
+  auto otherSharedSet = std::get_if<SharedSet>(&other.Set_);
+  return sharedSet && otherSharedSet && &sharedSet->GetStore() == &otherSharedSet->GetStore();
+}
+
+bool
+PointsToSet::UnionWith(const PointsToSet & other, PointsToSet * newItems)
+{
+  // Shared sets are combined by a memoized union in their store
+  if (IsSharedInSameStore(other))
+  {
+    auto & sharedSet = std::get<SharedSet>(Set_);
+    auto & store = sharedSet.GetStore();
+    const auto oldIndex = sharedSet.GetIndex();
+    const auto index = store.Union(oldIndex, std::get<SharedSet>(other.Set_).GetIndex());
+    if (index == oldIndex)
+      return false;
+
+    if (newItems)
+    {
+      const auto difference = store.Difference(index, oldIndex);
+      if (newItems->IsSharedInSameStore(*this))
+      {
+        auto & newItemsSharedSet = std::get<SharedSet>(newItems->Set_);
+        newItemsSharedSet.SetIndex(store.Union(newItemsSharedSet.GetIndex(), difference));
+      }
+      else
+      {
+        for (auto item : store.GetSet(difference).Items())
+          newItems->Insert(item);
+      }
+    }
+
+    sharedSet.SetIndex(index);
+    return true;
+  }
+
+  // Sparse bit vectors and the items of shared sets are combined word by word.
+  // Shared sets are only added to the store again when they are used in a memoized operation.
+  if (GetRepresentation() != Representation::HashSet
+      && other.GetRepresentation() != Representation::HashSet)
+  {
+    // Avoid copying the items of a shared set out of the store if none are added
+    const auto & otherSparseBitVector = other.GetSparseBitVector();
+    if (GetRepresentation() == Representation::Shared
+        && otherSparseBitVector.IsSubsetOf(GetSparseBitVector()))
+      return false;
+
+    auto sparseBitVector = GetModifiableSparseBitVector();
+    if (!newItems)
+      return sparseBitVector->UnionWith(otherSparseBitVector);
+
+    if (auto newItemsSparseBitVector = newItems->GetModifiableSparseBitVector())
+      return sparseBitVector->UnionWith(otherSparseBitVector, newItemsSparseBitVector);
+  }
+
+  bool modified = false;
+  for (auto item : other.Items())
+  {
+    if (Insert(item))
+    {
+      modified = true;
+      if (newItems)
+        newItems->Insert(item);
+    }
+  }
+
+  return modified;
+}
+
+bool
+PointsToSet::UnionWithAndClear(PointsToSet & other)
+{
+  auto hashSet = std::get_if<HashSetType>(&Set_);
+  auto otherHashSet = std::get_if<HashSetType>(&other.Set_);
+  auto sparseBitVector = std::get_if<SparseBitVectorType>(&Set_);
+  auto otherSparseBitVector = std::get_if<SparseBitVectorType>(&other.Set_);
+
+  bool modified = false;
+  if (hashSet && otherHashSet)
+    modified = hashSet->UnionWithAndClear(*otherHashSet);
+  else if (sparseBitVector && otherSparseBitVector)
+    modified = sparseBitVector->UnionWithAndClear(*otherSparseBitVector);
+  else
+    modified = UnionWith(other);
+
+  other.Clear();
+  return modified;
+}
+
+bool
+PointsToSet::IsSubsetOf(const PointsToSet & other) const
+{
+  if (IsSharedInSameStore(other)
+      && std::get<SharedSet>(Set_).GetIndex() == std::get<SharedSet>(other.Set_).GetIndex())
+    return true;
+
+  if (GetRepresentation() != Representation::HashSet
+      && other.GetRepresentation() != Representation::HashSet)
+    return GetSparseBitVector().IsSubsetOf(other.GetSparseBitVector());
+
+  if (Size() > other.Size())
+    return false;
+
+  for (auto item : Items())
+  {
+    if (!other.Contains(item))
+      return false;
+  }
+
+  return true;
+}
+
+bool
+PointsToSet::operator==(const PointsToSet & other) const
+{
+  // Shared sets are hash-consed, so equal sets have the same index
+  if (IsSharedInSameStore(other))
+    return std::get<SharedSet>(Set_).GetIndex() == std::get<SharedSet>(other.Set_).GetIndex();
+
+  auto hashSet = std::get_if<HashSetType>(&Set_);
+  auto otherHashSet = std::get_if<HashSetType>(&other.Set_);
+  if (hashSet && otherHashSet)
+    return *hashSet == *otherHashSet;
+
+  if (!hashSet && !otherHashSet)
+    return GetSparseBitVector() == other.GetSparseBitVector();
+
+  return Size() == other.Size() && IsSubsetOf(other);
+}
+
 /**
  * Flag that enables unification logic.
  * When enabled, each points-to set lookup needs to perform a find operation.
@@ -36,7 +332,7 @@ PointerObjectSet::AddPointerObject(PointerObjectKind kind, bool canPoint)
     PointerObjectParents_.push_back(index);
     PointerObjectRank_.push_back(0);
   }
-  PointsToSets_.emplace_back(); // Add empty points-to set
+  PointsToSets_.push_back(CreateEmptyPointsToSet()); // Add empty points-to set
   return PointerObjects_.size() - 1;
 }
 
@@ -119,6 +415,16 @@ PointerObjectSet::CreateDummyRegisterPointerObject()
   return AddPointerObject(PointerObjectKind::Register, true);
 }
 
+void
+PointerObjectSet::MapAccessToPointerObject(
+    const rvsdg::input & address,
+    PointerObjectIndex pointerObject)
+{
+  JLM_ASSERT(AccessMap_.count(&address) == 0);
+  JLM_ASSERT(GetPointerObjectKind(pointerObject) == PointerObjectKind::Register);
+  AccessMap_[&address] = pointerObject;
+}
+
 PointerObjectIndex
 PointerObjectSet::CreateAllocaMemoryObject(const rvsdg::Node & allocaNode, bool canPoint)
 {
@@ -180,12 +486,187 @@ PointerObjectSet::CreateImportMemoryObject(const GraphImport & importNode)
   return importMemoryObject;
 }
 
+const std::vector<PointerObjectIndex> &
+PointerObjectSet::CreateFieldMemoryObjects(
+    PointerObjectIndex memoryObject,
+    std::vector<MemoryObjectField> fields)
+{
+  JLM_ASSERT(!IsPointerObjectRegister(memoryObject));
+  JLM_ASSERT(!IsFieldMemoryObject(memoryObject));
+  JLM_ASSERT(!fields.empty() && fields.front().Offset == 0);
+  JLM_ASSERT(!fields.front().CanPoint || CanPoint(memoryObject));
+
+  const auto splitIndex = SplitMemoryObjects_.size();
+  auto & split = SplitMemoryObjects_.emplace_back();
+  for (size_t n = 0; n < fields.size(); n++)
+  {
+    JLM_ASSERT(fields[n].Size > 0);
+    JLM_ASSERT(n == 0 || fields[n - 1].Offset + fields[n - 1].Size <= fields[n].Offset);
+
+    const auto kind = GetPointerObjectKind(memoryObject);
+    const auto field = n == 0 ? memoryObject : AddPointerObject(kind, fields[n].CanPoint);
+    split.FieldObjects.push_back(field);
+    FieldMap_[field] = { splitIndex, n };
+  }
+  split.Fields = std::move(fields);
+
+  // Fields of the same memory object always escape together
+  if (HasEscaped(memoryObject))
+  {
+    for (const auto field : split.FieldObjects)
+      MarkAsEscaped(field);
+  }
+
+  return split.FieldObjects;
+}
+
+size_t
+PointerObjectSet::NumFieldMemoryObjects() const noexcept
+{
+  return FieldMap_.size() - SplitMemoryObjects_.size();
+}
+
+bool
+PointerObjectSet::IsFieldMemoryObject(PointerObjectIndex index) const noexcept
+{
+  return FieldMap_.find(index) != FieldMap_.end();
+}
+
+const std::vector<PointerObjectIndex> &
+PointerObjectSet::GetFieldMemoryObjects(PointerObjectIndex index) const noexcept
+{
+  static const std::vector<PointerObjectIndex> noFields;
+
+  const auto it = FieldMap_.find(index);
+  if (it == FieldMap_.end())
+    return noFields;
+
+  return SplitMemoryObjects_[it->second.first].FieldObjects;
+}
+
+const MemoryObjectField &
+PointerObjectSet::GetMemoryObjectField(PointerObjectIndex index) const
+{
+  const auto it = FieldMap_.find(index);
+  JLM_ASSERT(it != FieldMap_.end());
+  const auto [splitIndex, fieldIndex] = it->second;
+  return SplitMemoryObjects_[splitIndex].Fields[fieldIndex];
+}
+
+void
+PointerObjectSet::GetFieldsAtOffset(
+    PointerObjectIndex pointee,
+    std::optional<int64_t> offset,
+    uint64_t accessSize,
+    std::vector<PointerObjectIndex> & targets) const
+{
+  const auto it = FieldMap_.find(pointee);
+  if (it == FieldMap_.end() || (offset == 0 && accessSize == 0))
+  {
+    targets.push_back(pointee);
+    return;
+  }
+
+  // Accesses are made after the offset has been applied
+  if (offset != 0 && accessSize != 0)
+  {
+    std::vector<PointerObjectIndex> offsetTargets;
+    GetFieldsAtOffset(pointee, offset, 0, offsetTargets);
+    for (const auto target : offsetTargets)
+      GetFieldsAtOffset(target, 0, accessSize, targets);
+    return;
+  }
+
+  const auto [splitIndex, fieldIndex] = it->second;
+  const auto & split = SplitMemoryObjects_[splitIndex];
+  const auto & field = split.Fields[fieldIndex];
+
+  if (accessSize != 0)
+  {
+    // Accesses through a pointer into an array are assumed to stay within the array
+    if (field.IsArray && accessSize <= field.Size)
+    {
+      targets.push_back(pointee);
+      return;
+    }
+
+    // Otherwise, the access starts at the first byte of the field, and may span several fields
+    const auto maxSize = std::numeric_limits<uint64_t>::max() - field.Offset;
+    const auto end = field.Offset + std::min(accessSize, maxSize);
+    for (size_t n = 0; n < split.Fields.size(); n++)
+    {
+      const auto & other = split.Fields[n];
+      if (other.Offset < end && field.Offset < other.Offset + other.Size)
+        targets.push_back(split.FieldObjects[n]);
+    }
+    return;
+  }
+
+  // Pointer arithmetic on a pointer into an array is assumed to stay within the array.
+  // A pointer to the first field can also be a pointer to the memory object as a whole.
+  if (field.IsArray)
+  {
+    targets.push_back(pointee);
+    if (fieldIndex != 0 || (offset.has_value() && *offset < 0))
+      return;
+  }
+
+  const auto AddAllFields = [&]()
+  {
+    targets.insert(targets.end(), split.FieldObjects.begin(), split.FieldObjects.end());
+  };
+
+  if (!offset.has_value())
+  {
+    AddAllFields();
+    return;
+  }
+
+  // The pointer points to the first byte of the field, so its new position is known
+  const auto position = field.Offset + static_cast<uint64_t>(*offset);
+  if (*offset < 0 ? position > field.Offset : position < field.Offset)
+  {
+    AddAllFields();
+    return;
+  }
+
+  // Find the last field starting at or before the position
+  const auto next = std::upper_bound(
+      split.Fields.begin(),
+      split.Fields.end(),
+      position,
+      [](uint64_t position, const MemoryObjectField & field)
+      {
+        return position < field.Offset;
+      });
+  if (next == split.Fields.begin())
+  {
+    AddAllFields();
+    return;
+  }
+  const auto targetIndex = std::distance(split.Fields.begin(), next) - 1;
+  const auto & target = split.Fields[targetIndex];
+
+  // Pointers to anywhere but the first byte of scalar fields may target any field
+  const auto isInsideTarget = position < target.Offset + target.Size;
+  if (isInsideTarget && (target.IsArray || target.Offset == position))
+    targets.push_back(split.FieldObjects[targetIndex]);
+  else
+    AddAllFields();
+}
+
 const std::unordered_map<const rvsdg::output *, PointerObjectIndex> &
 PointerObjectSet::GetRegisterMap() const noexcept
 {
   return RegisterMap_;
 }
 
+const std::unordered_map<const rvsdg::input *, PointerObjectIndex> &
+PointerObjectSet::GetAccessMap() const noexcept
+{
+  return AccessMap_;
+}
+
 const std::unordered_map<const rvsdg::Node *, PointerObjectIndex> &
 PointerObjectSet::GetAllocaMap() const noexcept
 {
@@ -258,6 +739,10 @@ PointerObjectSet::MarkAsEscaped(PointerObjectIndex index)
   MarkAsPointeesEscaping(index);
   MarkAsPointingToExternal(index);
 
+  // Fields of the same memory object always escape together
+  for (const auto field : GetFieldMemoryObjects(index))
+    MarkAsEscaped(field);
+
   return true;
 }
 
@@ -401,12 +886,44 @@ PointerObjectSet::UnifyPointerObjects(PointerObjectIndex object1, PointerObjectI
   return newRoot;
 }
 
-const util::HashSet<PointerObjectIndex> &
+const PointsToSet &
 PointerObjectSet::GetPointsToSet(PointerObjectIndex index) const
 {
   return PointsToSets_[GetUnificationRoot(index)];
 }
 
+PointsToSet::Representation
+PointerObjectSet::GetPointsToSetRepresentation() const noexcept
+{
+  return PointsToSetRepresentation_;
+}
+
+void
+PointerObjectSet::SetPointsToSetRepresentation(PointsToSet::Representation representation)
+{
+  if (representation == PointsToSet::Representation::Shared && !SharedPointsToSetStore_)
+    SharedPointsToSetStore_ = std::make_shared<SharedPointsToSetStore>();
+
+  PointsToSetRepresentation_ = representation;
+  for (auto & pointsToSet : PointsToSets_)
+    pointsToSet.SetRepresentation(representation, SharedPointsToSetStore_.get());
+}
+
+PointsToSet
+PointerObjectSet::CreateEmptyPointsToSet() const
+{
+  if (PointsToSetRepresentation_ == PointsToSet::Representation::Shared)
+    return PointsToSet(*SharedPointsToSetStore_);
+
+  return PointsToSet(PointsToSetRepresentation_);
+}
+
+const SharedPointsToSetStore *
+PointerObjectSet::GetSharedPointsToSetStore() const noexcept
+{
+  return SharedPointsToSetStore_.get();
+}
+
 // Makes pointee a member of P(pointer)
 bool
 PointerObjectSet::AddToPointsToSet(PointerObjectIndex pointer, PointerObjectIndex pointee)
@@ -423,12 +940,11 @@ PointerObjectSet::AddToPointsToSet(PointerObjectIndex pointer, PointerObjectInde
 }
 
 // Makes P(superset) a superset of P(subset)
-template<typename NewPointeeFunctor>
 bool
 PointerObjectSet::PropagateNewPointees(
     PointerObjectIndex superset,
     PointerObjectIndex subset,
-    NewPointeeFunctor & onNewPointee)
+    PointsToSet * newPointees)
 {
   auto supersetRoot = GetUnificationRoot(superset);
   auto subsetRoot = GetUnificationRoot(subset);
@@ -441,15 +957,7 @@ PointerObjectSet::PropagateNewPointees(
 
   NumSetInsertionAttempts_ += P_sub.Size();
 
-  bool modified = false;
-  for (PointerObjectIndex pointee : P_sub.Items())
-  {
-    if (P_super.Insert(pointee))
-    {
-      onNewPointee(pointee);
-      modified = true;
-    }
-  }
+  bool modified = P_super.UnionWith(P_sub, newPointees);
 
   // If the external node is in the subset, it must also be part of the superset
   if (IsPointingToExternal(subsetRoot))
@@ -461,24 +969,52 @@ PointerObjectSet::PropagateNewPointees(
 bool
 PointerObjectSet::MakePointsToSetSuperset(PointerObjectIndex superset, PointerObjectIndex subset)
 {
-  // NewPointee is a no-op
-  const auto & NewPointee = [](PointerObjectIndex)
-  {
-  };
-  return PropagateNewPointees(superset, subset, NewPointee);
+  return PropagateNewPointees(superset, subset, nullptr);
 }
 
 bool
 PointerObjectSet::MakePointsToSetSuperset(
     PointerObjectIndex superset,
     PointerObjectIndex subset,
-    util::HashSet<PointerObjectIndex> & newPointees)
+    PointsToSet & newPointees)
+{
+  return PropagateNewPointees(superset, subset, &newPointees);
+}
+
+bool
+PointerObjectSet::MakeUnificationRootPointsToSetSuperset(
+    PointerObjectIndex superset,
+    PointerObjectIndex subset,
+    size_t & numSetInsertionAttempts)
 {
-  const auto & NewPointee = [&](PointerObjectIndex pointee)
+  // Only read the parents, as path compression would write to them
+  JLM_ASSERT(PointerObjectParents_[superset] == superset);
+  JLM_ASSERT(PointerObjectParents_[subset] == subset);
+
+  if (superset == subset)
+    return false;
+
+  auto & P_super = PointsToSets_[superset];
+  auto & P_sub = PointsToSets_[subset];
+
+  numSetInsertionAttempts += P_sub.Size();
+
+  bool modified = P_super.UnionWith(P_sub);
+
+  // If the external node is in the subset, it must also be part of the superset
+  if (PointerObjects_[subset].PointsToExternal && !PointerObjects_[superset].PointsToExternal)
   {
-    newPointees.Insert(pointee);
-  };
-  return PropagateNewPointees(superset, subset, NewPointee);
+    PointerObjects_[superset].PointsToExternal = true;
+    modified = true;
+  }
+
+  return modified;
+}
+
+void
+PointerObjectSet::AddSetInsertionAttempts(size_t numSetInsertionAttempts) noexcept
+{
+  NumSetInsertionAttempts_ += numSetInsertionAttempts;
 }
 
 void
@@ -595,6 +1131,26 @@ LoadConstraint::ApplyDirectly(PointerObjectSet & set)
   return modified;
 }
 
+// Make P(result) a superset of the fields targeted by x + offset, for all x in P(base)
+bool
+FieldOffsetConstraint::ApplyDirectly(PointerObjectSet & set)
+{
+  // Find all targets first, as result and base may share points-to set
+  std::vector<PointerObjectIndex> targets;
+  for (PointerObjectIndex x : set.GetPointsToSet(Base_).Items())
+    set.GetFieldsAtOffset(x, Offset_, AccessSize_, targets);
+
+  bool modified = false;
+  for (const auto target : targets)
+    modified |= set.AddToPointsToSet(Result_, target);
+
+  // Fields of escaped memory objects have escaped as well, so they are all implicit pointees
+  if (set.IsPointingToExternal(Base_))
+    modified |= set.MarkAsPointingToExternal(Result_);
+
+  return modified;
+}
+
 /**
  * Handles informing the arguments and return values of the CallNode about
  * possibly being sent to and retrieved from unknown code.
@@ -832,7 +1388,9 @@ EscapeFlagConstraint::PropagateEscapedFlagsDirectly(PointerObjectSet & set)
       const auto unificationRoot = set.GetUnificationRoot(pointee);
       const bool prevHasPointeesEscaping = set.HasPointeesEscaping(unificationRoot);
 
-      modified |= set.MarkAsEscaped(pointee);
+      if (!set.MarkAsEscaped(pointee))
+        continue;
+      modified = true;
 
       // If the pointee's unification root previously didn't have the PointeesEscaping flag,
       // add it to the queue
@@ -841,6 +1399,13 @@ EscapeFlagConstraint::PropagateEscapedFlagsDirectly(PointerObjectSet & set)
         JLM_ASSERT(set.HasPointeesEscaping(unificationRoot));
         pointeeEscapers.push(unificationRoot);
       }
+
+      // Other fields of the same memory object have escaped as well
+      for (const auto field : set.GetFieldMemoryObjects(pointee))
+      {
+        if (field != pointee)
+          pointeeEscapers.push(set.GetUnificationRoot(field));
+      }
     }
   }
 
@@ -1182,6 +1747,19 @@ CreateSubsetGraphEdges(
         }
       }
     }
+    else if (auto * fieldConstraint = std::get_if<FieldOffsetConstraint>(&constraint))
+    {
+      auto & edge = graph.CreateDirectedEdge(
+          graph.GetNode(fieldConstraint->GetBase()),
+          graph.GetNode(fieldConstraint->GetResult()));
+      edge.SetStyle(util::Edge::Style::Dotted);
+
+      const auto offset = fieldConstraint->GetOffset();
+      auto label = offset ? util::strfmt("+", *offset) : std::string("+?");
+      if (fieldConstraint->GetAccessSize() != 0)
+        label += util::strfmt(" access ", fieldConstraint->GetAccessSize());
+      edge.SetLabel(std::move(label));
+    }
     else
     {
       JLM_UNREACHABLE("Unknown constraint type");
@@ -1305,6 +1883,11 @@ PointerObjectConstraintSet::CreateOvsSubsetGraph()
           isDirectNode[*resultPO] = false;
       }
     }
+    else if (auto * fieldConstraint = std::get_if<FieldOffsetConstraint>(&constraint))
+    {
+      // The fields pointed to by the result are only known online
+      isDirectNode[Set_.GetUnificationRoot(fieldConstraint->GetResult())] = false;
+    }
     else
       JLM_UNREACHABLE("Unknown constraint variant");
   }
@@ -1484,6 +2067,10 @@ PointerObjectConstraintSet::NormalizeConstraints()
   util::HashSet<std::pair<PointerObjectIndex, PointerObjectIndex>> addedStoreConstraints;
   util::HashSet<std::pair<PointerObjectIndex, PointerObjectIndex>> addedLoadConstraints;
   util::HashSet<std::pair<PointerObjectIndex, const CallNode *>> addedCallConstraints;
+  std::unordered_map<
+      PointerObjectIndex,
+      std::vector<std::tuple<PointerObjectIndex, std::optional<int64_t>, uint64_t>>>
+      addedFieldOffsetConstraints;
 
   for (auto constraint : Constraints_)
   {
@@ -1524,6 +2111,25 @@ PointerObjectConstraintSet::NormalizeConstraints()
       if (addedCallConstraints.Insert({ pointerRoot, &callNode }))
         newConstraints.emplace_back(FunctionCallConstraint(pointerRoot, callNode));
     }
+    else if (auto * fieldConstraint = std::get_if<FieldOffsetConstraint>(&constraint))
+    {
+      auto resultRoot = Set_.GetUnificationRoot(fieldConstraint->GetResult());
+      auto baseRoot = Set_.GetUnificationRoot(fieldConstraint->GetBase());
+      const auto offset = fieldConstraint->GetOffset();
+      const auto accessSize = fieldConstraint->GetAccessSize();
+
+      // Skip no-op constraints
+      if (resultRoot == baseRoot && offset == 0 && accessSize == 0)
+        continue;
+
+      auto & added = addedFieldOffsetConstraints[baseRoot];
+      const auto key = std::make_tuple(resultRoot, offset, accessSize);
+      if (std::find(added.begin(), added.end(), key) != added.end())
+        continue;
+
+      added.push_back(key);
+      newConstraints.emplace_back(FieldOffsetConstraint(resultRoot, baseRoot, offset, accessSize));
+    }
     else
       JLM_UNREACHABLE("Unknown Constraint variant");
   }
@@ -1565,6 +2171,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
   std::vector<util::HashSet<PointerObjectIndex>> storeConstraints(Set_.NumPointerObjects());
   std::vector<util::HashSet<PointerObjectIndex>> loadConstraints(Set_.NumPointerObjects());
   std::vector<util::HashSet<const jlm::llvm::CallNode *>> callConstraints(Set_.NumPointerObjects());
+  std::vector<std::vector<FieldOffsetConstraint>> fieldOffsetConstraints(Set_.NumPointerObjects());
 
   for (const auto & constraint : Constraints_)
   {
@@ -1599,6 +2206,12 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
 
       callConstraints[pointer].Insert(&callNode);
     }
+    else if (const auto * fieldConstraint = std::get_if<FieldOffsetConstraint>(&constraint))
+    {
+      auto base = Set_.GetUnificationRoot(fieldConstraint->GetBase());
+
+      fieldOffsetConstraints[base].push_back(*fieldConstraint);
+    }
   }
 
   DifferencePropagation differencePropagation(Set_);
@@ -1660,6 +2273,14 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
 
     callConstraints[root].UnionWithAndClear(callConstraints[nonRoot]);
 
+    auto & rootFieldOffsetConstraints = fieldOffsetConstraints[root];
+    auto & nonRootFieldOffsetConstraints = fieldOffsetConstraints[nonRoot];
+    rootFieldOffsetConstraints.insert(
+        rootFieldOffsetConstraints.end(),
+        nonRootFieldOffsetConstraints.begin(),
+        nonRootFieldOffsetConstraints.end());
+    nonRootFieldOffsetConstraints.clear();
+
     if constexpr (EnableDifferencePropagation)
       differencePropagation.OnPointerObjectsUnified(root, nonRoot);
 
@@ -1811,6 +2432,21 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     newSupersetEdges.Clear();
   };
 
+  // A temporary place to store fields targeted by field offset constraints, as the result may be
+  // the node currently being visited
+  std::vector<PointerObjectIndex> fieldTargets;
+  std::vector<std::pair<PointerObjectIndex, PointerObjectIndex>> newFieldPointees;
+  const auto FlushNewFieldPointees = [&]()
+  {
+    for (auto [pointer, field] : newFieldPointees)
+    {
+      pointer = Set_.GetUnificationRoot(pointer);
+      if (AddToPointsToSet(pointer, field))
+        worklist.PushWorkItem(pointer);
+    }
+    newFieldPointees.clear();
+  };
+
   // Ensure that all functions that have already escaped have informed their arguments and results
   // The worklist will only inform functions if their HasEscaped flag changes
   EscapedFunctionConstraint::PropagateEscapedFunctionsDirectly(Set_);
@@ -1937,6 +2573,13 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
           JLM_ASSERT(Set_.IsPointingToExternal(pointeeRoot));
           worklist.PushWorkItem(pointeeRoot);
         }
+
+        // Other fields of the same memory object have escaped as well
+        for (const auto field : Set_.GetFieldMemoryObjects(pointee))
+        {
+          if (field != pointee)
+            worklist.PushWorkItem(Set_.GetUnificationRoot(field));
+        }
       }
     }
 
@@ -2065,6 +2708,27 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
             MarkAsPointsToExternal);
     }
 
+    // Pointer arithmetic and accesses on the form result = n + offset
+    for (const auto & fieldConstraint : fieldOffsetConstraints[node])
+    {
+      // This loop ensures P(result) contains the targeted fields of every pointee of n
+      for (const auto pointee : newPointees.Items())
+      {
+        fieldTargets.clear();
+        Set_.GetFieldsAtOffset(
+            pointee,
+            fieldConstraint.GetOffset(),
+            fieldConstraint.GetAccessSize(),
+            fieldTargets);
+        for (const auto field : fieldTargets)
+          newFieldPointees.emplace_back(fieldConstraint.GetResult(), field);
+      }
+
+      // If P(n) contains "external", the result may also point to external
+      if (newPointsToExternal)
+        MarkAsPointsToExternal(fieldConstraint.GetResult());
+    }
+
     // No pointees have been added to P(node) while visiting node thus far in the handler.
     // All new flags have also been handled, or caused this node to be on the worklist again.
     if constexpr (EnableDifferencePropagation)
@@ -2076,6 +2740,10 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
         differencePropagation.MarkPointeesEscapeAsHandled(node);
     }
 
+    // Add the fields targeted by field offset constraints.
+    // This happens after clearing new pointees, as node may be the target of its own constraints.
+    FlushNewFieldPointees();
+
     // Add all new superset edges, which also propagates points-to sets immediately
     // and possibly performs unifications to eliminate cycles.
     // Any unified nodes, or nodes with updated points-to sets, are added to the worklist.
@@ -2289,31 +2957,239 @@ PointerObjectConstraintSet::WorklistSolverPolicyToString(WorklistSolverPolicy po
   }
 }
 
-size_t
-PointerObjectConstraintSet::SolveNaively()
+PointerObjectConstraintSet::WavePropagationStatistics
+PointerObjectConstraintSet::SolveUsingWavePropagation(size_t numThreads)
 {
-  size_t numIterations = 0;
+  JLM_ASSERT(numThreads >= 1);
 
-  // Keep applying constraints until no sets are modified
-  bool modified = true;
+  // The store of shared points-to sets can not be modified concurrently
+  if (Set_.GetPointsToSetRepresentation() == PointsToSet::Representation::Shared)
+    numThreads = 1;
+
+  WavePropagationStatistics statistics(numThreads);
+
+  // Topological levels are only split between threads if each thread gets this many nodes
+  constexpr size_t minNodesPerThread = 64;
 
+  const auto numPointerObjects = Set_.NumPointerObjects();
+  std::vector<std::vector<PointerObjectIndex>> successors(numPointerObjects);
+  std::vector<std::vector<PointerObjectIndex>> predecessors(numPointerObjects);
+  std::vector<PointerObjectIndex> sccIndex;
+  std::vector<PointerObjectIndex> topologicalOrder;
+  std::vector<size_t> sccLevel;
+  std::vector<std::vector<PointerObjectIndex>> levels;
+
+  const auto AddSupersetEdge = [&](PointerObjectIndex superset, PointerObjectIndex subset)
+  {
+    const auto supersetRoot = Set_.GetUnificationRoot(superset);
+    const auto subsetRoot = Set_.GetUnificationRoot(subset);
+    if (supersetRoot != subsetRoot)
+      successors[subsetRoot].push_back(supersetRoot);
+  };
+
+  const auto GetSuccessors = [&](PointerObjectIndex node) -> auto &
+  {
+    return successors[node];
+  };
+
+  bool modified = true;
   while (modified)
   {
-    numIterations++;
-    modified = false;
+    statistics.NumWaves++;
+
+    // Create the subset graph between unification roots, using the current points-to sets
+    for (auto & nodeSuccessors : successors)
+      nodeSuccessors.clear();
 
     for (auto & constraint : Constraints_)
     {
-      std::visit(
-          [&](auto & constraint)
+      if (auto superset = std::get_if<SupersetConstraint>(&constraint))
+      {
+        AddSupersetEdge(superset->GetSuperset(), superset->GetSubset());
+      }
+      else if (auto store = std::get_if<StoreConstraint>(&constraint))
+      {
+        for (const auto pointee : Set_.GetPointsToSet(store->GetPointer()).Items())
+          AddSupersetEdge(pointee, store->GetValue());
+      }
+      else if (auto load = std::get_if<LoadConstraint>(&constraint))
+      {
+        for (const auto pointee : Set_.GetPointsToSet(load->GetPointer()).Items())
+          AddSupersetEdge(load->GetValue(), pointee);
+      }
+      else if (auto call = std::get_if<FunctionCallConstraint>(&constraint))
+      {
+        for (const auto pointee : Set_.GetPointsToSet(call->GetPointer()).Items())
+        {
+          if (Set_.GetPointerObjectKind(pointee) == PointerObjectKind::FunctionMemoryObject)
+            HandleCallingLambdaFunction(Set_, call->GetCallNode(), pointee, AddSupersetEdge);
+        }
+      }
+    }
+
+    const auto numSccs = util::FindStronglyConnectedComponents<PointerObjectIndex>(
+        numPointerObjects,
+        GetSuccessors,
+        sccIndex,
+        topologicalOrder);
+
+    // Each SCC is placed in the topological level after the level of its last predecessor
+    sccLevel.assign(numSccs, 0);
+    size_t numLevels = 0;
+    for (const auto node : topologicalOrder)
+    {
+      const auto level = sccLevel[sccIndex[node]];
+      numLevels = std::max(numLevels, level + 1);
+      for (const auto successor : successors[node])
+      {
+        if (sccIndex[successor] == sccIndex[node])
+          continue;
+
+        auto & successorLevel = sccLevel[sccIndex[successor]];
+        successorLevel = std::max(successorLevel, level + 1);
+      }
+    }
+
+    // Unify the nodes of each cycle, which are neighbours in the topological order
+    for (size_t i = 0; i + 1 < topologicalOrder.size(); i++)
+    {
+      auto & nextNode = topologicalOrder[i + 1];
+      if (sccIndex[topologicalOrder[i]] == sccIndex[nextNode])
+      {
+        nextNode = Set_.UnifyPointerObjects(topologicalOrder[i], nextNode);
+        statistics.NumCycleUnifications++;
+      }
+    }
+
+    // Redirect the edges between SCCs to the unification roots, in the opposite direction
+    for (auto & nodePredecessors : predecessors)
+      nodePredecessors.clear();
+
+    for (PointerObjectIndex node = 0; node < numPointerObjects; node++)
+    {
+      for (const auto successor : successors[node])
+      {
+        if (sccIndex[successor] != sccIndex[node])
+          predecessors[Set_.GetUnificationRoot(successor)].push_back(
+              Set_.GetUnificationRoot(node));
+      }
+    }
+
+    levels.resize(numLevels);
+    for (auto & level : levels)
+      level.clear();
+
+    for (PointerObjectIndex node = 0; node < numPointerObjects; node++)
+    {
+      auto & nodePredecessors = predecessors[node];
+      if (nodePredecessors.empty())
+        continue;
+
+      std::sort(nodePredecessors.begin(), nodePredecessors.end());
+      nodePredecessors.erase(
+          std::unique(nodePredecessors.begin(), nodePredecessors.end()),
+          nodePredecessors.end());
+      levels[sccLevel[sccIndex[node]]].push_back(node);
+    }
+
+    // Propagate points-to sets through the levels in order.
+    // The nodes of a level only take pointees from nodes in earlier levels.
+    for (const auto & level : levels)
+    {
+      if (level.empty())
+        continue;
+
+      statistics.NumTopologicalLevels++;
+
+      std::atomic<size_t> nextNode(0);
+      std::mutex exceptionMutex;
+      std::exception_ptr exception;
+      auto visitNodes = [&](size_t & numSetInsertionAttempts)
+      {
+        try
+        {
+          for (size_t n = nextNode++; n < level.size(); n = nextNode++)
           {
-            modified |= constraint.ApplyDirectly(Set_);
-          },
-          constraint);
+            const auto node = level[n];
+            for (const auto predecessor : predecessors[node])
+              Set_.MakeUnificationRootPointsToSetSuperset(
+                  node,
+                  predecessor,
+                  numSetInsertionAttempts);
+          }
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> guard(exceptionMutex);
+          if (!exception)
+            exception = std::current_exception();
+        }
+      };
+
+      // The calling thread visits nodes as well
+      const auto numLevelThreads =
+          std::clamp<size_t>(level.size() / minNodesPerThread, 1, numThreads);
+      std::vector<size_t> numSetInsertionAttempts(numLevelThreads, 0);
+      std::vector<std::thread> threads;
+      for (size_t n = 1; n < numLevelThreads; n++)
+        threads.emplace_back(visitNodes, std::ref(numSetInsertionAttempts[n]));
+
+      visitNodes(numSetInsertionAttempts[0]);
+
+      for (auto & thread : threads)
+        thread.join();
+
+      if (exception)
+        std::rethrow_exception(exception);
+
+      for (const auto threadNumSetInsertionAttempts : numSetInsertionAttempts)
+        Set_.AddSetInsertionAttempts(threadNumSetInsertionAttempts);
+
+      if (numLevelThreads > 1)
+        statistics.NumParallelTopologicalLevels++;
     }
 
-    modified |= EscapeFlagConstraint::PropagateEscapedFlagsDirectly(Set_);
-    modified |= EscapedFunctionConstraint::PropagateEscapedFunctionsDirectly(Set_);
+    // Loads, stores, function calls and flags may have been affected by the new pointees.
+    // If applying all constraints once modifies nothing, the solution has converged.
+    modified = ApplyConstraintsDirectly();
+  }
+
+  return statistics;
+}
+
+bool
+PointerObjectConstraintSet::ApplyConstraintsDirectly()
+{
+  bool modified = false;
+
+  for (auto & constraint : Constraints_)
+  {
+    std::visit(
+        [&](auto & constraint)
+        {
+          modified |= constraint.ApplyDirectly(Set_);
+        },
+        constraint);
+  }
+
+  modified |= EscapeFlagConstraint::PropagateEscapedFlagsDirectly(Set_);
+  modified |= EscapedFunctionConstraint::PropagateEscapedFunctionsDirectly(Set_);
+
+  return modified;
+}
+
+size_t
+PointerObjectConstraintSet::SolveNaively()
+{
+  size_t numIterations = 0;
+
+  // Keep applying constraints until no sets are modified
+  bool modified = true;
+
+  while (modified)
+  {
+    numIterations++;
+    modified = ApplyConstraintsDirectly();
   }
 
   return numIterations;
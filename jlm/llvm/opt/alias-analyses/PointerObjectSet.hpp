@@ -15,8 +15,11 @@
 #include <jlm/util/GraphWriter.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/Math.hpp>
+#include <jlm/util/SparseBitVector.hpp>
 
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <variant>
@@ -43,6 +46,440 @@ enum class PointerObjectKind : uint8_t
 
 using PointerObjectIndex = uint32_t;
 
+/**
+ * Stores immutable, hash-consed points-to sets, where each distinct set is only stored once.
+ * Sets are identified by their index in the store, which makes comparing two sets O(1).
+ * Unions and differences are memoized, such that repeating an operation on the same operands is a
+ * single cache lookup.
+ *
+ * The store only grows, and sets are never freed until the store is destroyed.
+ */
+class SharedPointsToSetStore final
+{
+public:
+  using SetType = util::SparseBitVector<PointerObjectIndex>;
+  using SetIndex = uint32_t;
+
+  // The empty set is always present in the store
+  static constexpr SetIndex EmptySet = 0;
+
+  SharedPointsToSetStore();
+
+  SharedPointsToSetStore(const SharedPointsToSetStore & other) = delete;
+
+  SharedPointsToSetStore &
+  operator=(const SharedPointsToSetStore & other) = delete;
+
+  [[nodiscard]] const SetType &
+  GetSet(SetIndex index) const noexcept
+  {
+    JLM_ASSERT(index < Sets_.size());
+    return Sets_[index];
+  }
+
+  /**
+   * @return the index of the set containing the same items as \p set, adding it if needed.
+   * @throws util::error if the store would contain more sets than SetIndex can represent.
+   */
+  [[nodiscard]] SetIndex
+  Intern(SetType set);
+
+  /**
+   * @return the index of the union of the sets \p index1 and \p index2.
+   */
+  [[nodiscard]] SetIndex
+  Union(SetIndex index1, SetIndex index2);
+
+  /**
+   * @return the index of the set containing all items of the set \p index1,
+   * that are not in the set \p index2.
+   */
+  [[nodiscard]] SetIndex
+  Difference(SetIndex index1, SetIndex index2);
+
+  /**
+   * @return the number of distinct sets in the store, including the empty set.
+   */
+  [[nodiscard]] size_t
+  NumSets() const noexcept
+  {
+    return Sets_.size();
+  }
+
+  /**
+   * @return the number of memoized operations that were answered from the cache.
+   */
+  [[nodiscard]] size_t
+  NumCacheHits() const noexcept
+  {
+    return NumCacheHits_;
+  }
+
+  /**
+   * @return the number of memoized operations that had to be computed.
+   */
+  [[nodiscard]] size_t
+  NumCacheMisses() const noexcept
+  {
+    return NumCacheMisses_;
+  }
+
+  /**
+   * @return an estimate of the number of bytes used by the sets and operation caches.
+   */
+  [[nodiscard]] size_t
+  NumBytes() const noexcept;
+
+private:
+  using OperationKey = std::pair<SetIndex, SetIndex>;
+  using OperationCache = std::unordered_map<OperationKey, SetIndex, util::Hash<OperationKey>>;
+
+  /**
+   * Looks up \p key in \p cache, or computes and caches the result using \p compute.
+   */
+  template<typename ComputeFunctor>
+  SetIndex
+  Memoize(OperationCache & cache, const OperationKey & key, const ComputeFunctor & compute);
+
+  // All distinct sets. A deque keeps references to sets valid while new sets are added.
+  std::deque<SetType> Sets_;
+
+  // Maps the hash of each set to the indices of the sets with that hash
+  std::unordered_multimap<size_t, SetIndex> SetsByHash_;
+
+  // Caches for unordered (set, set) unions, and (set, set) differences
+  OperationCache UnionCache_;
+  OperationCache DifferenceCache_;
+
+  size_t NumCacheHits_ = 0;
+  size_t NumCacheMisses_ = 0;
+  size_t NumSetBytes_ = 0;
+};
+
+/**
+ * The set of pointees of a PointerObject. The pointees are either stored in a hash set, in a
+ * sparse bit vector, or as a shared set in a SharedPointsToSetStore. The sparse bit vector
+ * performs unions word-parallel, which is cheaper for large points-to sets with clustered indices.
+ * Shared sets are hash-consed, such that PointerObjects with identical points-to sets share a
+ * single copy, and repeated unions are cache lookups. Modifications of a shared set that are not
+ * memoized, such as inserting single items, are collected in a private copy of the set. The copy
+ * is only added to the store when the set is used in a memoized operation or compared, such that
+ * a sequence of modifications adds a single set to the store. The representation is chosen
+ * at runtime, such that all of them can be benchmarked side by side using the same solver
+ * configurations.
+ *
+ * Operations between two sets with different representations are performed item by item.
+ */
+class PointsToSet final
+{
+  using HashSetType = util::HashSet<PointerObjectIndex>;
+  using SparseBitVectorType = util::SparseBitVector<PointerObjectIndex>;
+
+  class SharedSet final
+  {
+  public:
+    SharedSet(SharedPointsToSetStore & store, SharedPointsToSetStore::SetIndex index)
+        : Store_(&store),
+          Index_(index)
+    {}
+
+    [[nodiscard]] SharedPointsToSetStore &
+    GetStore() const noexcept
+    {
+      return *Store_;
+    }
+
+    [[nodiscard]] const SparseBitVectorType &
+    GetItems() const noexcept
+    {
+      return ModifiedItems_ ? *ModifiedItems_ : Store_->GetSet(Index_);
+    }
+
+    /**
+     * @return the items of the set, copied out of the store if they are not already.
+     */
+    [[nodiscard]] SparseBitVectorType &
+    GetModifiableItems()
+    {
+      if (!ModifiedItems_)
+        ModifiedItems_ = Store_->GetSet(Index_);
+      return *ModifiedItems_;
+    }
+
+    /**
+     * @return the index of the items of the set in the store, adding any modified items first.
+     */
+    [[nodiscard]] SharedPointsToSetStore::SetIndex
+    GetIndex() const
+    {
+      if (ModifiedItems_)
+      {
+        Index_ = Store_->Intern(std::move(*ModifiedItems_));
+        ModifiedItems_.reset();
+      }
+      return Index_;
+    }
+
+    void
+    SetIndex(SharedPointsToSetStore::SetIndex index) noexcept
+    {
+      Index_ = index;
+      ModifiedItems_.reset();
+    }
+
+  private:
+    SharedPointsToSetStore * Store_;
+    // Adding the modified items to the store does not change the items of the set,
+    // so it is also done for const sets.
+    mutable SharedPointsToSetStore::SetIndex Index_;
+    // The items of the set, if they were modified since they were last added to the store
+    mutable std::optional<SparseBitVectorType> ModifiedItems_;
+  };
+
+public:
+  /**
+   * The representations of points-to sets, in the same order as the alternatives of Set_.
+   */
+  enum class Representation : uint8_t
+  {
+    HashSet,
+    SparseBitVector,
+    Shared
+  };
+
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PointerObjectIndex;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PointerObjectIndex *;
+    using reference = PointerObjectIndex;
+
+  private:
+    friend PointsToSet;
+
+    template<typename Iterator>
+    explicit ItemConstIterator(const Iterator & it)
+        : It_(it)
+    {}
+
+  public:
+    PointerObjectIndex
+    operator*() const
+    {
+      if (auto it = std::get_if<HashSetType::ItemConstIterator>(&It_))
+        return **it;
+
+      return *std::get<SparseBitVectorType::ItemConstIterator>(It_);
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      if (auto it = std::get_if<HashSetType::ItemConstIterator>(&It_))
+        ++*it;
+      else
+        ++std::get<SparseBitVectorType::ItemConstIterator>(It_);
+
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      return It_ == other.It_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    std::variant<HashSetType::ItemConstIterator, SparseBitVectorType::ItemConstIterator> It_;
+  };
+
+  PointsToSet() = default;
+
+  /**
+   * Creates an empty set with the given \p representation.
+   * @param representation the representation of the set, must not be Representation::Shared.
+   */
+  explicit PointsToSet(Representation representation);
+
+  /**
+   * Creates an empty shared set in the given \p store.
+   */
+  explicit PointsToSet(SharedPointsToSetStore & store)
+      : Set_(SharedSet(store, SharedPointsToSetStore::EmptySet))
+  {}
+
+  PointsToSet(std::initializer_list<PointerObjectIndex> initializerList)
+  {
+    for (auto item : initializerList)
+      Insert(item);
+  }
+
+  [[nodiscard]] Representation
+  GetRepresentation() const noexcept
+  {
+    return static_cast<Representation>(Set_.index());
+  }
+
+  /**
+   * Changes the representation of the set, keeping all its pointees.
+   * @param representation the new representation.
+   * @param store the store used for shared sets. Must be given if \p representation is shared.
+   */
+  void
+  SetRepresentation(Representation representation, SharedPointsToSetStore * store = nullptr);
+
+  [[nodiscard]] bool
+  Contains(PointerObjectIndex item) const noexcept
+  {
+    if (auto hashSet = std::get_if<HashSetType>(&Set_))
+      return hashSet->Contains(item);
+    return GetSparseBitVector().Contains(item);
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    if (auto hashSet = std::get_if<HashSetType>(&Set_))
+      return hashSet->Size();
+    return GetSparseBitVector().Size();
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Size() == 0;
+  }
+
+  void
+  Clear() noexcept
+  {
+    if (auto hashSet = std::get_if<HashSetType>(&Set_))
+      hashSet->Clear();
+    else if (auto sparseBitVector = std::get_if<SparseBitVectorType>(&Set_))
+      sparseBitVector->Clear();
+    else
+      std::get<SharedSet>(Set_).SetIndex(SharedPointsToSetStore::EmptySet);
+  }
+
+  /**
+   * Inserts \p item into the set.
+   * @return true if \p item was not already in the set
+   */
+  bool
+  Insert(PointerObjectIndex item);
+
+  [[nodiscard]] util::IteratorRange<ItemConstIterator>
+  Items() const noexcept
+  {
+    if (auto hashSet = std::get_if<HashSetType>(&Set_))
+    {
+      auto items = hashSet->Items();
+      return { ItemConstIterator(items.begin()), ItemConstIterator(items.end()) };
+    }
+
+    auto items = GetSparseBitVector().Items();
+    return { ItemConstIterator(items.begin()), ItemConstIterator(items.end()) };
+  }
+
+  /**
+   * Makes the set contain all items of itself and \p other.
+   * If \p newItems is not nullptr, all items that are added to the set are also added to it.
+   * @return true if any items were added to the set
+   */
+  bool
+  UnionWith(const PointsToSet & other, PointsToSet * newItems = nullptr);
+
+  /**
+   * Makes the set contain all items of itself and \p other, and makes \p other empty.
+   * @return true if any items were added to the set
+   */
+  bool
+  UnionWithAndClear(PointsToSet & other);
+
+  /**
+   * @return true if all items of the set are also in \p other
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const PointsToSet & other) const;
+
+  /**
+   * Compares the items of two sets, regardless of their representations.
+   */
+  bool
+  operator==(const PointsToSet & other) const;
+
+  bool
+  operator!=(const PointsToSet & other) const
+  {
+    return !operator==(other);
+  }
+
+private:
+  /**
+   * @return the sparse bit vector holding the items of a sparse bit vector or shared set.
+   */
+  [[nodiscard]] const SparseBitVectorType &
+  GetSparseBitVector() const noexcept
+  {
+    if (auto sharedSet = std::get_if<SharedSet>(&Set_))
+      return sharedSet->GetItems();
+    return std::get<SparseBitVectorType>(Set_);
+  }
+
+  /**
+   * @return the modifiable sparse bit vector holding the items of a sparse bit vector or shared
+   * set, or nullptr if the set is a hash set.
+   */
+  [[nodiscard]] SparseBitVectorType *
+  GetModifiableSparseBitVector();
+
+  /**
+   * @return true if both this and \p other are shared sets in the same store.
+   */
+  [[nodiscard]] bool
+  IsSharedInSameStore(const PointsToSet & other) const noexcept;
+
+  std::variant<HashSetType, SparseBitVectorType, SharedSet> Set_;
+};
+
+/**
+ * Describes one field of a memory object that is split into several PointerObjects,
+ * to make the analysis field-sensitive.
+ * Fields are identified by their byte offset from the start of the memory object.
+ */
+struct MemoryObjectField final
+{
+  // The offset of the first byte of the field, from the start of the memory object
+  uint64_t Offset;
+
+  // The number of bytes covered by the field, at least 1
+  uint64_t Size;
+
+  // If unset, the field is a scalar value, and pointers to it always point to its first byte.
+  // If set, the field is an array, and pointers to it may point anywhere inside the array.
+  // Pointer arithmetic on pointers into an array is assumed to stay within the array.
+  bool IsArray;
+
+  // If set, the PointerObject representing the field may point to other PointerObjects
+  bool CanPoint;
+};
+
 /**
  * A class containing a set of PointerObjects, and their points-to-sets,
  * as well as mappings from RVSDG nodes/outputs to the PointerObjects.
@@ -162,7 +599,14 @@ class PointerObjectSet final
   // For each PointerObject, a set of the other PointerObjects it points to
   // Only unification roots may have a non-empty set,
   // other PointerObjects refer to their root's set.
-  std::vector<util::HashSet<PointerObjectIndex>> PointsToSets_;
+  std::vector<PointsToSet> PointsToSets_;
+
+  // The representation used by all points-to sets
+  PointsToSet::Representation PointsToSetRepresentation_ = PointsToSet::Representation::HashSet;
+
+  // The store of shared points-to sets, if the shared representation has been used.
+  // Clones of this PointerObjectSet share the store, as it is never modified, only extended.
+  std::shared_ptr<SharedPointsToSetStore> SharedPointsToSetStore_;
 
   // Mapping from register to PointerObject
   // Unlike the other maps, several rvsdg::output* can share register PointerObject
@@ -178,6 +622,26 @@ class PointerObjectSet final
 
   std::unordered_map<const GraphImport *, PointerObjectIndex> ImportMap_;
 
+  // Mapping from the address input of loads, stores and memcpys to the PointerObject pointing to
+  // the memory they access, when it differs from the PointerObject of the address itself
+  std::unordered_map<const rvsdg::input *, PointerObjectIndex> AccessMap_;
+
+  /**
+   * A memory object that has been split into fields, each represented by its own PointerObject.
+   */
+  struct SplitMemoryObject final
+  {
+    std::vector<MemoryObjectField> Fields;
+
+    // The PointerObject representing each field. The first field is the memory object itself.
+    std::vector<PointerObjectIndex> FieldObjects;
+  };
+
+  std::vector<SplitMemoryObject> SplitMemoryObjects_;
+
+  // Mapping from the PointerObject of a field, to its split memory object and field index
+  std::unordered_map<PointerObjectIndex, std::pair<size_t, size_t>> FieldMap_;
+
   // How many items have been attempted added to explicit points-to sets
   size_t NumSetInsertionAttempts_ = 0;
 
@@ -192,15 +656,15 @@ class PointerObjectSet final
   AddPointerObject(PointerObjectKind kind, bool canPoint);
 
   /**
-   * Internal helper function for making P(superset) a superset of P(subset), with a callback.
+   * Internal helper function for making P(superset) a superset of P(subset).
+   * If \p newPointees is not nullptr, any new pointees of superset are also added to it.
    * @see MakePointsToSetSuperset
    */
-  template<typename NewPointeeFunctor>
   bool
   PropagateNewPointees(
       PointerObjectIndex superset,
       PointerObjectIndex subset,
-      NewPointeeFunctor & onNewPointee);
+      PointsToSet * newPointees);
 
 public:
   PointerObjectSet() = default;
@@ -273,6 +737,17 @@ public:
   [[nodiscard]] PointerObjectIndex
   CreateDummyRegisterPointerObject();
 
+  /**
+   * Associates the address input of a load, store or memcpy with a PointerObject of register kind
+   * that points to all memory accessed through it. Used when accesses cover more fields than the
+   * address itself points to, to keep the accessed fields out of the address' points-to set.
+   * @param address the address input of the memory access
+   * @param pointerObject the index of the PointerObject representing the accessed memory
+   * @see PointsToGraph::GetAccessedFieldNodes
+   */
+  void
+  MapAccessToPointerObject(const rvsdg::input & address, PointerObjectIndex pointerObject);
+
   [[nodiscard]] PointerObjectIndex
   CreateAllocaMemoryObject(const rvsdg::Node & allocaNode, bool canPoint);
 
@@ -310,9 +785,77 @@ public:
   [[nodiscard]] PointerObjectIndex
   CreateImportMemoryObject(const GraphImport & importNode);
 
+  /**
+   * Splits the given memory object into fields, making loads, stores and pointer arithmetic on
+   * the memory object field-sensitive. The memory object itself represents the first field,
+   * while each of the other fields gets a new PointerObject of the same kind.
+   * Memory objects can only be split once, and must be split before being used in constraints.
+   * If the memory object has already escaped, so do all its fields.
+   * @param memoryObject the index of the memory object being split
+   * @param fields the fields of the memory object, sorted by offset and not overlapping.
+   * The first field must be at offset 0. It is represented by the memory object itself,
+   * so it can only be marked as CanPoint if the memory object is.
+   * @return the indices of the PointerObjects representing each field, in order
+   * @see FieldOffsetConstraint
+   */
+  const std::vector<PointerObjectIndex> &
+  CreateFieldMemoryObjects(
+      PointerObjectIndex memoryObject,
+      std::vector<MemoryObjectField> fields);
+
+  /**
+   * @return the number of PointerObjects created to represent fields of memory objects,
+   * not counting the memory objects themselves.
+   */
+  [[nodiscard]] size_t
+  NumFieldMemoryObjects() const noexcept;
+
+  /**
+   * @return true if the PointerObject with the given \p index represents a field of a split
+   * memory object, including the first field, which is the memory object itself.
+   */
+  [[nodiscard]] bool
+  IsFieldMemoryObject(PointerObjectIndex index) const noexcept;
+
+  /**
+   * @return the PointerObjects of all fields of the memory object that \p index is a field of,
+   * with the memory object itself first. If \p index is not a field, the vector is empty.
+   */
+  [[nodiscard]] const std::vector<PointerObjectIndex> &
+  GetFieldMemoryObjects(PointerObjectIndex index) const noexcept;
+
+  /**
+   * @return the layout of the field represented by the PointerObject with the given \p index.
+   * The PointerObject must be a field memory object.
+   */
+  [[nodiscard]] const MemoryObjectField &
+  GetMemoryObjectField(PointerObjectIndex index) const;
+
+  /**
+   * Finds all fields that may be targeted by a pointer to \p pointee,
+   * after \p offset bytes have been added to the pointer.
+   * If \p accessSize is non-zero, all fields that overlap with the \p accessSize bytes starting at
+   * the resulting address are targeted. Otherwise, only fields the resulting address may point to.
+   * If \p pointee is not a field memory object, the pointee itself is the only target.
+   * A pointer to the first field may also be a pointer to the memory object as a whole.
+   * @param pointee the PointerObject being pointed to before the offset is applied
+   * @param offset the number of bytes added to the pointer, or nullopt if unknown
+   * @param accessSize the number of bytes accessed through the resulting pointer, or 0
+   * @param targets a vector that all targeted PointerObjects are appended to
+   */
+  void
+  GetFieldsAtOffset(
+      PointerObjectIndex pointee,
+      std::optional<int64_t> offset,
+      uint64_t accessSize,
+      std::vector<PointerObjectIndex> & targets) const;
+
   const std::unordered_map<const rvsdg::output *, PointerObjectIndex> &
   GetRegisterMap() const noexcept;
 
+  const std::unordered_map<const rvsdg::input *, PointerObjectIndex> &
+  GetAccessMap() const noexcept;
+
   const std::unordered_map<const rvsdg::Node *, PointerObjectIndex> &
   GetAllocaMap() const noexcept;
 
@@ -356,6 +899,7 @@ public:
    * Marks the PointerObject with the given \p index as having escaped the module.
    * Can only be called on non-register PointerObjects.
    * Implies both the PointeesEscaping flag, and the PointsToExternal flag.
+   * If the PointerObject is a field memory object, all fields of the same memory object escape.
    * @return true if the flag was changed by this operation, false otherwise
    */
   bool
@@ -455,9 +999,36 @@ public:
    * If index is part of a unification, the unification root's points-to set is returned.
    * @return the PointsToSet of the PointerObject.
    */
-  [[nodiscard]] const util::HashSet<PointerObjectIndex> &
+  [[nodiscard]] const PointsToSet &
   GetPointsToSet(PointerObjectIndex index) const;
 
+  /**
+   * @return the representation used by the points-to sets of all PointerObjects.
+   */
+  [[nodiscard]] PointsToSet::Representation
+  GetPointsToSetRepresentation() const noexcept;
+
+  /**
+   * Changes the representation of the points-to sets of all PointerObjects,
+   * including the points-to sets of PointerObjects created later.
+   * @param representation the new points-to set representation
+   */
+  void
+  SetPointsToSetRepresentation(PointsToSet::Representation representation);
+
+  /**
+   * @return an empty points-to set with the representation used by this PointerObjectSet.
+   */
+  [[nodiscard]] PointsToSet
+  CreateEmptyPointsToSet() const;
+
+  /**
+   * @return the store of shared points-to sets, or nullptr if the shared representation has
+   * never been used.
+   */
+  [[nodiscard]] const SharedPointsToSetStore *
+  GetSharedPointsToSetStore() const noexcept;
+
   /**
    * Adds \p pointee to P(\p pointer)
    * @param pointer the index of the PointerObject that shall point to \p pointee
@@ -490,7 +1061,31 @@ public:
   MakePointsToSetSuperset(
       PointerObjectIndex superset,
       PointerObjectIndex subset,
-      util::HashSet<PointerObjectIndex> & newPointees);
+      PointsToSet & newPointees);
+
+  /**
+   * A version of MakePointsToSetSuperset for unification roots, that only writes to P(\p superset)
+   * and the flags of \p superset. Several threads can use it concurrently, as long as no thread
+   * uses the superset of another thread, and the shared points-to set representation is not used.
+   * @param superset the unification root that shall point to everything subset points to
+   * @param subset the unification root whose pointees shall all be pointed to by superset as well
+   * @param numSetInsertionAttempts is increased by the number of attempted set insertions. They
+   * are not added to the count of this set, use AddSetInsertionAttempts() once threads are done.
+   *
+   * @return true if P(\p superset) or any flags were modified by this operation
+   */
+  bool
+  MakeUnificationRootPointsToSetSuperset(
+      PointerObjectIndex superset,
+      PointerObjectIndex subset,
+      size_t & numSetInsertionAttempts);
+
+  /**
+   * Adds set insertion attempts made by MakeUnificationRootPointsToSetSuperset().
+   * @param numSetInsertionAttempts the number of attempted set insertions
+   */
+  void
+  AddSetInsertionAttempts(size_t numSetInsertionAttempts) noexcept;
 
   /**
    * Removes all pointees from the PointerObject with the given \p index.
@@ -726,6 +1321,98 @@ public:
   ApplyDirectly(PointerObjectSet & set);
 };
 
+/**
+ * A constraint used to make memory objects split into fields, field-sensitive:
+ *   for all x in P(base), P(result) supseteq fields(x, offset, accessSize)
+ * Where fields(x, offset, accessSize) are the fields targeted by a pointer to x,
+ * after adding offset bytes to it, and accessing accessSize bytes through it.
+ * PointerObjects that are not fields are their own only target, regardless of offset.
+ * Corresponds to result = base + offset, when accessSize is 0.
+ * A non-zero accessSize is used on loads, stores and copies, with offset 0 and a separate result
+ * representing the memory accessed, so the base pointer itself does not point to extra fields.
+ * @see PointerObjectSet::GetFieldsAtOffset()
+ */
+class FieldOffsetConstraint final
+{
+  PointerObjectIndex Result_;
+  PointerObjectIndex Base_;
+  std::optional<int64_t> Offset_;
+  uint64_t AccessSize_;
+
+public:
+  FieldOffsetConstraint(
+      PointerObjectIndex result,
+      PointerObjectIndex base,
+      std::optional<int64_t> offset,
+      uint64_t accessSize)
+      : Result_(result),
+        Base_(base),
+        Offset_(offset),
+        AccessSize_(accessSize)
+  {}
+
+  /**
+   * @return the PointerObject that should point to the targeted fields
+   */
+  [[nodiscard]] PointerObjectIndex
+  GetResult() const noexcept
+  {
+    return Result_;
+  }
+
+  /**
+   * @param result the new PointerObject that should point to the targeted fields
+   */
+  void
+  SetResult(PointerObjectIndex result)
+  {
+    Result_ = result;
+  }
+
+  /**
+   * @return the PointerObject representing the pointer the offset is added to
+   */
+  [[nodiscard]] PointerObjectIndex
+  GetBase() const noexcept
+  {
+    return Base_;
+  }
+
+  /**
+   * @param base the new PointerObject representing the pointer the offset is added to
+   */
+  void
+  SetBase(PointerObjectIndex base)
+  {
+    Base_ = base;
+  }
+
+  /**
+   * @return the number of bytes added to the base pointer, or nullopt if it is not known
+   */
+  [[nodiscard]] std::optional<int64_t>
+  GetOffset() const noexcept
+  {
+    return Offset_;
+  }
+
+  /**
+   * @return the number of bytes accessed through the resulting pointer, or 0
+   */
+  [[nodiscard]] uint64_t
+  GetAccessSize() const noexcept
+  {
+    return AccessSize_;
+  }
+
+  /**
+   * Apply this constraint to \p set once.
+   * @return true if this operation modified any PointerObjects or points-to-sets
+   */
+  bool
+  ApplyDirectly(PointerObjectSet & set);
+};
+
 /**
  * A constraint making the given call site communicate with the functions it may call.
  *
@@ -842,8 +1529,12 @@ public:
 class PointerObjectConstraintSet final
 {
 public:
-  using ConstraintVariant =
-      std::variant<SupersetConstraint, StoreConstraint, LoadConstraint, FunctionCallConstraint>;
+  using ConstraintVariant = std::variant<
+      SupersetConstraint,
+      StoreConstraint,
+      LoadConstraint,
+      FunctionCallConstraint,
+      FieldOffsetConstraint>;
 
   enum class WorklistSolverPolicy
   {
@@ -954,6 +1645,42 @@ public:
     std::optional<size_t> NumPipExplicitPointeesRemoved;
   };
 
+  /**
+   * Struct holding statistics from solving the constraint set using wave propagation.
+   */
+  struct WavePropagationStatistics
+  {
+    explicit WavePropagationStatistics(size_t numThreads)
+        : NumThreads(numThreads)
+    {}
+
+    /**
+     * The number of threads used to propagate points-to sets.
+     */
+    size_t NumThreads;
+
+    /**
+     * The number of waves, i.e., the number of times points-to sets were propagated through
+     * the entire subset graph before the solution converged.
+     */
+    size_t NumWaves{};
+
+    /**
+     * The number of unifications made to eliminate cycles in the subset graph.
+     */
+    size_t NumCycleUnifications{};
+
+    /**
+     * The sum of the number of topological levels, for each wave.
+     */
+    size_t NumTopologicalLevels{};
+
+    /**
+     * The number of topological levels that had their nodes visited by several threads.
+     */
+    size_t NumParallelTopologicalLevels{};
+  };
+
   explicit PointerObjectConstraintSet(PointerObjectSet & set)
       : Set_(set),
         Constraints_(),
@@ -970,6 +1697,15 @@ public:
   PointerObjectConstraintSet &
   operator=(PointerObjectConstraintSet && other) = delete;
 
+  /**
+   * @return the PointerObjectSet the constraints are built upon
+   */
+  [[nodiscard]] PointerObjectSet &
+  GetPointerObjectSet() const noexcept
+  {
+    return Set_;
+  }
+
   /**
    * Some offline processing relies on knowing about all constraints that will ever be added.
    * After doing such processing, the constraint set is frozen, which prevents any new constraints
@@ -1103,6 +1839,23 @@ public:
       bool enableDifferencePropagation,
       bool enablePreferImplicitPropation);
 
+  /**
+   * Finds a least solution satisfying all constraints, using wave propagation, as described by
+   *   Pereira and Berlin, 2009: "Wave Propagation and Deep Propagation for Pointer Analysis"
+   * Each wave builds the subset graph from the superset constraints, and from the loads, stores
+   * and function calls with the current points-to sets. Cycles are unified, and points-to sets are
+   * propagated through the graph in topological order. The nodes of a topological level only
+   * take pointees from nodes in earlier levels, and are visited by several threads in parallel.
+   * After each wave, all constraints and flag inference rules are applied once, like the naive
+   * solver does. When this modifies no points-to sets or flags, the solution has converged.
+   *
+   * With the shared points-to set representation, only a single thread is used.
+   * @param numThreads the number of threads used to propagate points-to sets. At least 1.
+   * @return an instance of WavePropagationStatistics describing solver statistics
+   */
+  WavePropagationStatistics
+  SolveUsingWavePropagation(size_t numThreads);
+
   /**
    * Iterates over and applies constraints until all points-to-sets satisfy them.
    * Also applies inference rules on the escaped and pointing to external flags.
@@ -1139,6 +1892,14 @@ private:
   std::tuple<size_t, std::vector<util::HashSet<PointerObjectIndex>>, std::vector<bool>>
   CreateOvsSubsetGraph();
 
+  /**
+   * Applies every constraint once, as well as the inference rules on the escaped and
+   * pointing to external flags.
+   * @return true if any points-to sets or flags were modified
+   */
+  bool
+  ApplyConstraintsDirectly();
+
   /**
    * The worklist solver, with configuration passed at compile time as templates.
    * @param statistics the WorklistStatistics instance that will get information about this run.
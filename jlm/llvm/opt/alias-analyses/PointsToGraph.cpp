@@ -7,6 +7,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
 
+#include <functional>
 #include <typeindex>
 #include <unordered_map>
 
@@ -104,6 +105,44 @@ PointsToGraph::RegisterNodes() const
            RegisterNodeConstIterator(RegisterNodes_.end()) };
 }
 
+PointsToGraph::FieldNodeRange
+PointsToGraph::FieldNodes()
+{
+  return { FieldNodeIterator(FieldNodes_.begin()), FieldNodeIterator(FieldNodes_.end()) };
+}
+
+PointsToGraph::FieldNodeConstRange
+PointsToGraph::FieldNodes() const
+{
+  return { FieldNodeConstIterator(FieldNodes_.begin()), FieldNodeConstIterator(FieldNodes_.end()) };
+}
+
+const std::vector<const PointsToGraph::FieldNode *> &
+PointsToGraph::GetFieldNodes(const PointsToGraph::MemoryNode & memoryNode) const noexcept
+{
+  static const std::vector<const FieldNode *> noFieldNodes;
+  if (auto it = FieldNodeMap_.find(&memoryNode); it != FieldNodeMap_.end())
+    return it->second;
+  return noFieldNodes;
+}
+
+const util::HashSet<const PointsToGraph::MemoryNode *> &
+PointsToGraph::GetAccessedFieldNodes(const rvsdg::input & address) const noexcept
+{
+  static const util::HashSet<const MemoryNode *> noMemoryNodes;
+  if (auto it = AccessedFieldNodeMap_.find(&address); it != AccessedFieldNodeMap_.end())
+    return it->second;
+  return noMemoryNodes;
+}
+
+void
+PointsToGraph::AddAccessedFieldNodes(
+    const rvsdg::input & address,
+    util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes)
+{
+  AccessedFieldNodeMap_[&address].UnionWith(memoryNodes);
+}
+
 PointsToGraph::AllocaNode &
 PointsToGraph::AddAllocaNode(std::unique_ptr<PointsToGraph::AllocaNode> node)
 {
@@ -161,6 +200,19 @@ PointsToGraph::AddImportNode(std::unique_ptr<PointsToGraph::ImportNode> node)
   return *tmp;
 }
 
+PointsToGraph::FieldNode &
+PointsToGraph::AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node)
+{
+  auto tmp = node.get();
+  auto & fieldNodes = FieldNodeMap_[&node->GetParent()];
+  JLM_ASSERT(fieldNodes.size() + 1 == node->GetFieldIndex());
+  fieldNodes.push_back(tmp);
+
+  FieldNodes_.emplace_back(std::move(node));
+
+  return *tmp;
+}
+
 std::pair<size_t, size_t>
 PointsToGraph::NumEdges() const noexcept
 {
@@ -179,6 +231,7 @@ PointsToGraph::NumEdges() const noexcept
   countMemoryNodes(ImportNodes());
   countMemoryNodes(LambdaNodes());
   countMemoryNodes(MallocNodes());
+  countMemoryNodes(FieldNodes());
 
   numEdges += GetExternalMemoryNode().NumTargets();
 
@@ -199,11 +252,23 @@ PointsToGraph::IsSupergraphOf(const jlm::llvm::aa::PointsToGraph & subgraph) con
   // Given a memory node representing a memory object in an RVSDG module, this function finds
   // a memory node representing the same memory object in a different PointsToGraph.
   // If no corresponding memory node exists in the graph, nullptr is returned
-  auto GetCorrespondingMemoryNode =
-      [](const PointsToGraph::MemoryNode & node,
-         const PointsToGraph & graph) -> const PointsToGraph::MemoryNode *
+  std::function<const MemoryNode *(const MemoryNode &, const PointsToGraph &)>
+      GetCorrespondingMemoryNode =
+          [&GetCorrespondingMemoryNode](
+              const PointsToGraph::MemoryNode & node,
+              const PointsToGraph & graph) -> const PointsToGraph::MemoryNode *
   {
-    if (auto allocaNode = dynamic_cast<const AllocaNode *>(&node))
+    if (auto fieldNode = dynamic_cast<const FieldNode *>(&node))
+    {
+      // Field nodes correspond if they have the same index in corresponding memory nodes
+      auto parent = GetCorrespondingMemoryNode(fieldNode->GetParent(), graph);
+      if (parent == nullptr)
+        return nullptr;
+      auto & fieldNodes = graph.GetFieldNodes(*parent);
+      if (fieldNode->GetFieldIndex() <= fieldNodes.size())
+        return fieldNodes[fieldNode->GetFieldIndex() - 1];
+    }
+    else if (auto allocaNode = dynamic_cast<const AllocaNode *>(&node))
     {
       if (auto it = graph.AllocaNodes_.find(&allocaNode->GetAllocaNode());
           it != graph.AllocaNodes_.end())
@@ -315,6 +380,11 @@ PointsToGraph::IsSupergraphOf(const jlm::llvm::aa::PointsToGraph & subgraph) con
     if (!HasSuperOfMemoryNode(node))
       return false;
   }
+  for (auto & node : subgraph.FieldNodes())
+  {
+    if (!HasSuperOfMemoryNode(node))
+      return false;
+  }
 
   // For each register mapped to a RegisterNode in the subgraph, this graph must also have mapped
   // the same register to be a supergraph. The RegisterNode must point to a superset of what
@@ -354,6 +424,7 @@ PointsToGraph::ToDot(
           { typeid(ImportNode), "box" },
           { typeid(LambdaNode), "box" },
           { typeid(MallocNode), "box" },
+          { typeid(FieldNode), "box" },
           { typeid(RegisterNode), "oval" },
           { typeid(UnknownMemoryNode), "box" },
           { typeid(ExternalMemoryNode), "box" } });
@@ -439,6 +510,9 @@ PointsToGraph::ToDot(
   for (auto & mallocNode : pointsToGraph.MallocNodes())
     dot += printNodeAndEdges(mallocNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    dot += printNodeAndEdges(fieldNode);
+
   for (auto & registerNode : pointsToGraph.RegisterNodes())
     dot += printNodeAndEdges(registerNode);
 
@@ -589,6 +663,14 @@ PointsToGraph::ImportNode::DebugString() const
   return GetArgument().Name();
 }
 
+PointsToGraph::FieldNode::~FieldNode() noexcept = default;
+
+std::string
+PointsToGraph::FieldNode::DebugString() const
+{
+  return util::strfmt(GetParent().DebugString(), ":field", GetFieldIndex());
+}
+
 PointsToGraph::UnknownMemoryNode::~UnknownMemoryNode() noexcept = default;
 
 std::string
@@ -40,6 +40,7 @@ class PointsToGraph final
 public:
   class AllocaNode;
   class DeltaNode;
+  class FieldNode;
   class ImportNode;
   class LambdaNode;
   class MallocNode;
@@ -59,6 +60,7 @@ public:
   using MallocNodeMap = std::unordered_map<const rvsdg::Node *, std::unique_ptr<MallocNode>>;
   using RegisterNodeMap = std::unordered_map<const rvsdg::output *, PointsToGraph::RegisterNode *>;
   using RegisterNodeVector = std::vector<std::unique_ptr<PointsToGraph::RegisterNode>>;
+  using FieldNodeVector = std::vector<std::unique_ptr<PointsToGraph::FieldNode>>;
 
   template<class DataType, class IteratorType>
   struct IteratorToPointerFunctor
@@ -146,6 +148,27 @@ public:
   using RegisterNodeRange = util::IteratorRange<RegisterNodeIterator>;
   using RegisterNodeConstRange = util::IteratorRange<RegisterNodeConstIterator>;
 
+  template<class NodeType, class IteratorType>
+  struct VectorIteratorToPointerFunctor
+  {
+    NodeType *
+    operator()(const IteratorType & it) const
+    {
+      return it->get();
+    }
+  };
+
+  using FieldNodeIterator = NodeIterator<
+      FieldNode,
+      FieldNodeVector::iterator,
+      VectorIteratorToPointerFunctor<FieldNode, FieldNodeVector::iterator>>;
+  using FieldNodeConstIterator = NodeConstIterator<
+      FieldNode,
+      FieldNodeVector::const_iterator,
+      VectorIteratorToPointerFunctor<FieldNode, FieldNodeVector::const_iterator>>;
+  using FieldNodeRange = util::IteratorRange<FieldNodeIterator>;
+  using FieldNodeConstRange = util::IteratorRange<FieldNodeConstIterator>;
+
 private:
   PointsToGraph();
 
@@ -196,6 +219,12 @@ public:
   RegisterNodeConstRange
   RegisterNodes() const;
 
+  FieldNodeRange
+  FieldNodes();
+
+  FieldNodeConstRange
+  FieldNodes() const;
+
   size_t
   NumAllocaNodes() const noexcept
   {
@@ -232,6 +261,12 @@ public:
     return RegisterNodes_.size();
   }
 
+  [[nodiscard]] size_t
+  NumFieldNodes() const noexcept
+  {
+    return FieldNodes_.size();
+  }
+
   /**
    * @return the total number of registers that are represented by some RegisterNode
    */
@@ -245,7 +280,7 @@ public:
   NumMemoryNodes() const noexcept
   {
     return NumAllocaNodes() + NumDeltaNodes() + NumImportNodes() + NumLambdaNodes()
-         + NumMallocNodes() + 1; // External memory node
+         + NumMallocNodes() + NumFieldNodes() + 1; // External memory node
   }
 
   size_t
@@ -326,6 +361,42 @@ public:
     return *it->second;
   }
 
+  /**
+   * Returns the field nodes of a memory node that has been split into fields.
+   * The memory node itself represents the first field, and is not included.
+   *
+   * @param memoryNode the memory node whose fields are requested.
+   * @return the field nodes of \p memoryNode, ordered by field index, or an empty vector.
+   *
+   * @see PointsToGraph::FieldNode
+   */
+  [[nodiscard]] const std::vector<const PointsToGraph::FieldNode *> &
+  GetFieldNodes(const PointsToGraph::MemoryNode & memoryNode) const noexcept;
+
+  /**
+   * Returns the memory nodes accessed by a load, store or memcpy, besides the targets of the
+   * register node of its address. These are fields that follow the field pointed to by the
+   * address, and are covered by the width of the access.
+   *
+   * @param address the address input of the load, store or memcpy.
+   * @return the additionally accessed memory nodes, or an empty set.
+   *
+   * @see AddAccessedFieldNodes
+   */
+  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  GetAccessedFieldNodes(const rvsdg::input & address) const noexcept;
+
+  /**
+   * Records that the load, store or memcpy with the address input \p address also accesses
+   * \p memoryNodes, in addition to the targets of the register node of its address.
+   *
+   * @see GetAccessedFieldNodes
+   */
+  void
+  AddAccessedFieldNodes(
+      const rvsdg::input & address,
+      util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes);
+
   /**
    * Returns all memory nodes that are marked as escaped from the module.
    *
@@ -357,6 +428,9 @@ public:
   PointsToGraph::ImportNode &
   AddImportNode(std::unique_ptr<PointsToGraph::ImportNode> node);
 
+  PointsToGraph::FieldNode &
+  AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node);
+
   /**
    * Gets the total number of edges in the PointsToGraph.
    *
@@ -429,6 +503,12 @@ private:
   RegisterNodeMap RegisterNodeMap_;
   RegisterNodeVector RegisterNodes_;
 
+  FieldNodeVector FieldNodes_;
+  std::unordered_map<const PointsToGraph::MemoryNode *, std::vector<const FieldNode *>>
+      FieldNodeMap_;
+  std::unordered_map<const rvsdg::input *, util::HashSet<const PointsToGraph::MemoryNode *>>
+      AccessedFieldNodeMap_;
+
   std::unique_ptr<PointsToGraph::UnknownMemoryNode> UnknownMemoryNode_;
   std::unique_ptr<ExternalMemoryNode> ExternalMemoryNode_;
 };
@@ -789,6 +869,61 @@ private:
   const GraphImport * GraphImport_;
 };
 
+/** \brief PointsTo graph field node
+ *
+ * Represents one field of a memory object that has been split into fields by a field-sensitive
+ * analysis. The memory node of the memory object itself represents the first field,
+ * so field nodes are only created for the other fields.
+ */
+class PointsToGraph::FieldNode final : public PointsToGraph::MemoryNode
+{
+public:
+  ~FieldNode() noexcept override;
+
+private:
+  FieldNode(PointsToGraph & pointsToGraph, const MemoryNode & parent, size_t fieldIndex)
+      : MemoryNode(pointsToGraph),
+        Parent_(&parent),
+        FieldIndex_(fieldIndex)
+  {
+    JLM_ASSERT(fieldIndex > 0);
+  }
+
+public:
+  /**
+   * @return the memory node of the memory object this is a field of
+   */
+  const MemoryNode &
+  GetParent() const noexcept
+  {
+    return *Parent_;
+  }
+
+  /**
+   * @return the index of the field among all fields of the memory object, at least 1
+   */
+  size_t
+  GetFieldIndex() const noexcept
+  {
+    return FieldIndex_;
+  }
+
+  std::string
+  DebugString() const override;
+
+  static PointsToGraph::FieldNode &
+  Create(PointsToGraph & pointsToGraph, const MemoryNode & parent, size_t fieldIndex)
+  {
+    auto n = std::unique_ptr<PointsToGraph::FieldNode>(
+        new FieldNode(pointsToGraph, parent, fieldIndex));
+    return pointsToGraph.AddFieldNode(std::move(n));
+  }
+
+private:
+  const MemoryNode * Parent_;
+  size_t FieldIndex_;
+};
+
 /** \brief PointsTo graph unknown node
  *
  */
@@ -735,7 +735,7 @@ RegionAwareMemoryNodeProvider::AnnotateSimpleNode(const rvsdg::SimpleNode & simp
 void
 RegionAwareMemoryNodeProvider::AnnotateLoad(const LoadNode & loadNode)
 {
-  auto memoryNodes = Provisioning_->GetOutputNodes(*loadNode.GetAddressInput().origin());
+  auto memoryNodes = Provisioning_->GetAccessedNodes(loadNode.GetAddressInput());
   auto & regionSummary = Provisioning_->GetRegionSummary(*loadNode.region());
   regionSummary.AddMemoryNodes(memoryNodes);
 }
@@ -743,7 +743,7 @@ RegionAwareMemoryNodeProvider::AnnotateLoad(const LoadNode & loadNode)
 void
 RegionAwareMemoryNodeProvider::AnnotateStore(const StoreNode & storeNode)
 {
-  auto memoryNodes = Provisioning_->GetOutputNodes(*storeNode.GetAddressInput().origin());
+  auto memoryNodes = Provisioning_->GetAccessedNodes(storeNode.GetAddressInput());
   auto & regionSummary = Provisioning_->GetRegionSummary(*storeNode.region());
   regionSummary.AddMemoryNodes(memoryNodes);
 }
@@ -753,9 +753,14 @@ RegionAwareMemoryNodeProvider::AnnotateAlloca(const rvsdg::SimpleNode & allocaNo
 {
   JLM_ASSERT(is<alloca_op>(allocaNode.GetOperation()));
 
-  auto & memoryNode = Provisioning_->GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Provisioning_->GetPointsToGraph();
+  auto & memoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto & regionSummary = Provisioning_->GetRegionSummary(*allocaNode.region());
   regionSummary.AddMemoryNodes({ &memoryNode });
+
+  // If the alloca is split into fields, all fields are created by the alloca
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(memoryNode))
+    regionSummary.AddMemoryNodes({ fieldNode });
 }
 
 void
@@ -829,10 +834,10 @@ RegionAwareMemoryNodeProvider::AnnotateMemcpy(const rvsdg::SimpleNode & memcpyNo
 
   auto & regionSummary = Provisioning_->GetRegionSummary(*memcpyNode.region());
 
-  auto dstNodes = Provisioning_->GetOutputNodes(*memcpyNode.input(0)->origin());
+  auto dstNodes = Provisioning_->GetAccessedNodes(*memcpyNode.input(0));
   regionSummary.AddMemoryNodes(dstNodes);
 
-  auto srcNodes = Provisioning_->GetOutputNodes(*memcpyNode.input(1)->origin());
+  auto srcNodes = Provisioning_->GetAccessedNodes(*memcpyNode.input(1));
   regionSummary.AddMemoryNodes(srcNodes);
 }
 
@@ -859,7 +864,7 @@ RegionAwareMemoryNodeProvider::AnnotateStructuralNode(const rvsdg::StructuralNod
 void
 RegionAwareMemoryNodeProvider::Propagate(const rvsdg::RvsdgModule & rvsdgModule)
 {
-  rvsdg::TopDownTraverser traverser(&rvsdgModule.Rvsdg().GetRootRegion());
+  rvsdg::TopDownConstTraverser traverser(&rvsdgModule.Rvsdg().GetRootRegion());
   for (auto & node : traverser)
   {
     if (auto lambdaNode = dynamic_cast<const rvsdg::LambdaNode *>(node))
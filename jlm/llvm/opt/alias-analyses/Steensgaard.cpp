@@ -674,8 +674,8 @@ public:
   Location &
   GetOrInsertRegisterLocation(const rvsdg::output & output)
   {
-    if (auto it = LocationMap_.find(&output); it != LocationMap_.end())
-      return GetRootLocation(*it->second);
+    if (LocationMap_.Contains(output))
+      return GetRootLocation(*LocationMap_.Lookup(output));
 
     return InsertRegisterLocation(output, PointsToFlags::PointsToNone);
   }
@@ -737,9 +737,8 @@ public:
   RegisterLocation &
   GetRegisterLocation(const rvsdg::output & output)
   {
-    auto it = LocationMap_.find(&output);
-    JLM_ASSERT(it != LocationMap_.end());
-    return *it->second;
+    JLM_ASSERT(LocationMap_.Contains(output));
+    return *LocationMap_.Lookup(output);
   }
 
   /**
@@ -751,8 +750,7 @@ public:
   bool
   HasRegisterLocation(const rvsdg::output & output)
   {
-    auto it = LocationMap_.find(&output);
-    return it != LocationMap_.end();
+    return LocationMap_.Contains(output);
   }
 
   std::string
@@ -869,7 +867,7 @@ private:
     auto registerLocation = RegisterLocation::Create(output, pointsToFlags);
     auto registerLocationPointer = registerLocation.get();
 
-    LocationMap_[&output] = registerLocationPointer;
+    LocationMap_[output] = registerLocationPointer;
     DisjointLocationSet_.insert(registerLocationPointer);
     Locations_.push_back(std::move(registerLocation));
 
@@ -884,7 +882,7 @@ private:
 
   DisjointLocationSet DisjointLocationSet_;
   std::vector<std::unique_ptr<Location>> Locations_;
-  std::unordered_map<const jlm::rvsdg::output *, RegisterLocation *> LocationMap_;
+  rvsdg::DenseOutputMap<RegisterLocation *> LocationMap_;
 };
 
 /** \brief Collect statistics about Steensgaard alias analysis pass
@@ -1774,7 +1772,7 @@ Steensgaard::AnalyzeRegion(rvsdg::Region & region)
 
   using namespace jlm::rvsdg;
 
-  TopDownTraverser traverser(&region);
+  TopDownConstTraverser traverser(&region);
   for (auto & node : traverser)
   {
     if (auto simpleNode = dynamic_cast<const SimpleNode *>(node))
@@ -780,8 +780,13 @@ TopDownMemoryNodeEliminator::EliminateTopDownAlloca(const rvsdg::SimpleNode & no
   JLM_ASSERT(is<alloca_op>(&node));
 
   // We found an alloca node. Add the respective points-to graph memory node to the live nodes.
-  auto & allocaNode = Context_->GetPointsToGraph().GetAllocaNode(node);
+  auto & pointsToGraph = Context_->GetPointsToGraph();
+  auto & allocaNode = pointsToGraph.GetAllocaNode(node);
   Context_->AddLiveNodes(*node.region(), { &allocaNode });
+
+  // If the alloca is split into fields, the fields become live as well
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(allocaNode))
+    Context_->AddLiveNodes(*node.region(), { fieldNode });
 }
 
 void
@@ -912,7 +917,12 @@ TopDownMemoryNodeEliminator::InitializeLiveNodesOfTailLambda(
   {
     auto & escapedMemoryNodes = Context_->GetPointsToGraph().GetEscapedMemoryNodes();
 
-    return PointsToGraph::Node::Is<PointsToGraph::AllocaNode>(*memoryNode)
+    // Fields of allocas are treated like the alloca they belong to
+    auto allocaMemoryNode = memoryNode;
+    if (auto fieldNode = dynamic_cast<const PointsToGraph::FieldNode *>(memoryNode))
+      allocaMemoryNode = &fieldNode->GetParent();
+
+    return PointsToGraph::Node::Is<PointsToGraph::AllocaNode>(*allocaMemoryNode)
         && !escapedMemoryNodes.Contains(memoryNode);
   };
 
@@ -9,10 +9,13 @@
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
 #include <typeindex>
+#include <unordered_set>
 
 namespace jlm::llvm
 {
@@ -80,14 +83,14 @@ public:
 
     if (s2->size() < s1->size())
     {
-      s1 = outputs_[o2];
-      s2 = outputs_[o1];
+      s1 = outputs_[*o2];
+      s2 = outputs_[*o1];
     }
 
     for (auto & o : *s1)
     {
       s2->insert(o);
-      outputs_[o] = s2;
+      outputs_[*o] = s2;
     }
   }
 
@@ -106,11 +109,11 @@ public:
     if (o1 == o2)
       return true;
 
-    auto it = outputs_.find(o1);
-    if (it == outputs_.end())
+    if (!outputs_.Contains(*o1))
       return false;
 
-    return it->second->find(o2) != it->second->end();
+    auto set = outputs_.Lookup(*o1);
+    return set->find(o2) != set->end();
   }
 
   inline bool
@@ -122,19 +125,20 @@ public:
   congruence_set *
   set(jlm::rvsdg::output * output) noexcept
   {
-    if (outputs_.find(output) == outputs_.end())
+    auto & set = outputs_[*output];
+    if (set == nullptr)
     {
-      std::unique_ptr<congruence_set> set(new congruence_set({ output }));
-      outputs_[output] = set.get();
-      sets_.insert(std::move(set));
+      std::unique_ptr<congruence_set> newSet(new congruence_set({ output }));
+      set = newSet.get();
+      sets_.insert(std::move(newSet));
     }
 
-    return outputs_[output];
+    return set;
   }
 
 private:
   std::unordered_set<std::unique_ptr<congruence_set>> sets_;
-  std::unordered_map<const jlm::rvsdg::output *, congruence_set *> outputs_;
+  rvsdg::DenseOutputMap<congruence_set *> outputs_;
 };
 
 class vset
@@ -439,7 +443,7 @@ mark(const jlm::rvsdg::SimpleNode * node, cnectx & ctx)
 static void
 mark(rvsdg::Region * region, cnectx & ctx)
 {
-  for (const auto & node : rvsdg::TopDownTraverser(region))
+  for (const auto & node : rvsdg::TopDownConstTraverser(region))
   {
     if (auto simple = dynamic_cast<const jlm::rvsdg::SimpleNode *>(node))
       mark(simple, ctx);
@@ -448,6 +452,399 @@ mark(rvsdg::Region * region, cnectx & ctx)
   }
 }
 
+/* value numbering mark phase */
+
+/**
+ * Assigns value numbers to the outputs of a graph. Outputs of the same region with equal value
+ * numbers are congruent.
+ *
+ * Simple nodes are numbered by their operation and the value numbers of their operands. Region
+ * arguments that are connected to structural inputs are numbered by the value numbers of the
+ * inputs' origins, and gamma outputs by the value numbers of their results. Theta loop variables
+ * are numbered optimistically: loop variables with congruent inputs are assumed to be congruent,
+ * and this partition is refined until the numbering of the loop body confirms it. Classes that are
+ * not split keep their value numbers across refinements, and value numbers derived from split
+ * classes are discarded. A theta node whose inputs are numbered as before is not renumbered.
+ */
+class ValueNumbering final
+{
+  struct Key
+  {
+    const void * Scope;
+    const rvsdg::Operation * Operation;
+    std::vector<size_t> Operands;
+
+    bool
+    operator==(const Key & other) const noexcept
+    {
+      if (Scope != other.Scope || Operands != other.Operands)
+        return false;
+
+      if (Operation == nullptr || other.Operation == nullptr)
+        return Operation == other.Operation;
+
+      return *Operation == *other.Operation;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t
+    operator()(const Key & key) const noexcept
+    {
+      auto seed = util::CombineHashes(
+          std::hash<const void *>()(key.Scope),
+          key.Operation ? key.Operation->ComputeHash() : 0);
+      for (auto operand : key.Operands)
+        util::CombineHashesWithSeed(seed, operand);
+
+      return seed;
+    }
+  };
+
+public:
+  void
+  NumberGraph(const rvsdg::Graph & graph)
+  {
+    auto & rootRegion = graph.GetRootRegion();
+    for (size_t n = 0; n < rootRegion.narguments(); n++)
+      ValueNumbers_[*rootRegion.argument(n)] = CreateValueNumbers(1);
+
+    NumberNodes(rootRegion);
+  }
+
+  /**
+   * Marks all outputs of \p region and its subregions with equal value numbers as congruent.
+   */
+  void
+  MarkCongruentOutputs(const rvsdg::Region & region, cnectx & ctx) const
+  {
+    std::unordered_map<size_t, rvsdg::output *> leaders;
+    auto markOutput = [&](rvsdg::output & output)
+    {
+      auto [it, wasInserted] = leaders.emplace(ValueNumbers_.Lookup(output), &output);
+      if (!wasInserted)
+        ctx.mark(it->second, &output);
+    };
+
+    for (size_t n = 0; n < region.narguments(); n++)
+      markOutput(*region.argument(n));
+
+    for (auto node : rvsdg::TopDownConstTraverser(&region))
+    {
+      for (size_t n = 0; n < node->noutputs(); n++)
+        markOutput(*node->output(n));
+
+      if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(node))
+      {
+        if (is<delta::operation>(structuralNode))
+          continue;
+
+        for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+          MarkCongruentOutputs(*structuralNode->subregion(n), ctx);
+      }
+    }
+  }
+
+private:
+  void
+  NumberNodes(const rvsdg::Region & region)
+  {
+    for (auto node : rvsdg::TopDownConstTraverser(&region))
+    {
+      if (auto simpleNode = dynamic_cast<const rvsdg::SimpleNode *>(node))
+      {
+        NumberSimpleNode(*simpleNode);
+      }
+      else if (auto gammaNode = dynamic_cast<const rvsdg::GammaNode *>(node))
+      {
+        NumberGammaNode(*gammaNode);
+      }
+      else if (auto thetaNode = dynamic_cast<const rvsdg::ThetaNode *>(node))
+      {
+        NumberThetaNode(*thetaNode);
+      }
+      else if (is<rvsdg::LambdaOperation>(node) || is<phi::operation>(node))
+      {
+        auto & subregion = *static_cast<const rvsdg::StructuralNode *>(node)->subregion(0);
+        NumberArguments(subregion);
+        NumberNodes(subregion);
+        NumberOutputsUniquely(*node);
+      }
+      else
+      {
+        JLM_ASSERT(is<delta::operation>(node));
+        NumberOutputsUniquely(*node);
+      }
+    }
+  }
+
+  void
+  NumberSimpleNode(const rvsdg::SimpleNode & node)
+  {
+    std::vector<size_t> operands;
+    operands.reserve(node.ninputs());
+    for (size_t n = 0; n < node.ninputs(); n++)
+      operands.push_back(ValueNumbers_.Lookup(*node.input(n)->origin()));
+
+    Key key{ node.region(), &node.GetOperation(), std::move(operands) };
+    auto valueNumber = LookupOrCreate(std::move(key), node.noutputs());
+    for (size_t n = 0; n < node.noutputs(); n++)
+      ValueNumbers_[*node.output(n)] = valueNumber + n;
+  }
+
+  void
+  NumberGammaNode(const rvsdg::GammaNode & gammaNode)
+  {
+    for (size_t n = 0; n < gammaNode.nsubregions(); n++)
+    {
+      NumberArguments(*gammaNode.subregion(n));
+      NumberNodes(*gammaNode.subregion(n));
+    }
+
+    for (auto & exitVar : gammaNode.GetExitVars())
+    {
+      std::vector<size_t> operands;
+      for (auto result : exitVar.branchResult)
+        operands.push_back(ValueNumbers_.Lookup(*result->origin()));
+
+      Key key{ &gammaNode, nullptr, std::move(operands) };
+      ValueNumbers_[*exitVar.output] = LookupOrCreate(std::move(key), 1);
+    }
+  }
+
+  void
+  NumberThetaNode(const rvsdg::ThetaNode & thetaNode)
+  {
+    auto loopVars = thetaNode.GetLoopVars();
+
+    std::vector<size_t> inputValueNumbers;
+    for (auto & loopVar : loopVars)
+      inputValueNumbers.push_back(ValueNumbers_.Lookup(*loopVar.input->origin()));
+
+    // The numbering of the loop body only depends on the value numbers of the inputs. If they are
+    // unchanged since the last numbering of the theta node, then the body does not need to be
+    // renumbered. This avoids renumbering nested theta nodes in every iteration of an outer one.
+    if (auto it = ThetaNumberings_.find(&thetaNode);
+        it != ThetaNumberings_.end() && it->second.Inputs == inputValueNumbers)
+    {
+      for (size_t n = 0; n < loopVars.size(); n++)
+        ValueNumbers_[*loopVars[n].output] = it->second.Outputs[n];
+      return;
+    }
+
+    // Optimistically assume that all loop variables with congruent inputs are congruent
+    std::vector<size_t> partition;
+    size_t numClasses = 0;
+    {
+      std::unordered_map<size_t, size_t> classes;
+      for (auto inputValueNumber : inputValueNumbers)
+        partition.push_back(classes.emplace(inputValueNumber, classes.size()).first->second);
+      numClasses = classes.size();
+    }
+
+    std::vector<size_t> classValueNumbers(numClasses);
+    auto firstClassValueNumber = CreateDerivedValueNumbers(inputValueNumbers, numClasses);
+    for (size_t n = 0; n < numClasses; n++)
+      classValueNumbers[n] = firstClassValueNumber + n;
+
+    const auto logStart = Log_.size();
+    NumActiveThetaNodes_++;
+    while (true)
+    {
+      for (size_t n = 0; n < loopVars.size(); n++)
+        ValueNumbers_[*loopVars[n].pre] = classValueNumbers[partition[n]];
+
+      NumberNodes(*thetaNode.subregion());
+
+      // Split the classes whose loop variables do not compute congruent values in the loop body
+      std::unordered_map<std::pair<size_t, size_t>, size_t, util::Hash<std::pair<size_t, size_t>>>
+          refinedClasses;
+      std::vector<size_t> refinedPartition;
+      std::vector<size_t> numParts(numClasses, 0);
+      for (size_t n = 0; n < loopVars.size(); n++)
+      {
+        auto postValueNumber = ValueNumbers_.Lookup(*loopVars[n].post->origin());
+        auto key = std::make_pair(partition[n], postValueNumber);
+        auto [it, wasInserted] = refinedClasses.emplace(key, refinedClasses.size());
+        if (wasInserted)
+          numParts[partition[n]]++;
+        refinedPartition.push_back(it->second);
+      }
+
+      // Classes are only ever split, so the partition is stable if no class was split
+      if (refinedClasses.size() == numClasses)
+        break;
+
+      // Classes that were not split keep their value numbers, such that the value numbers derived
+      // from them stay valid in the next iteration. The value numbers of split classes are
+      // refuted, and so is everything that was derived from them.
+      std::unordered_set<size_t> refutedValueNumbers;
+      std::vector<size_t> refinedClassValueNumbers(refinedClasses.size());
+      std::vector<bool> isNumbered(refinedClasses.size(), false);
+      for (size_t n = 0; n < loopVars.size(); n++)
+      {
+        auto refinedClass = refinedPartition[n];
+        if (isNumbered[refinedClass])
+          continue;
+
+        isNumbered[refinedClass] = true;
+        if (numParts[partition[n]] == 1)
+        {
+          refinedClassValueNumbers[refinedClass] = classValueNumbers[partition[n]];
+        }
+        else
+        {
+          refutedValueNumbers.insert(classValueNumbers[partition[n]]);
+          refinedClassValueNumbers[refinedClass] =
+              CreateDerivedValueNumbers(inputValueNumbers, 1);
+        }
+      }
+      DiscardDerivedValueNumbers(refutedValueNumbers, logStart);
+
+      partition = std::move(refinedPartition);
+      classValueNumbers = std::move(refinedClassValueNumbers);
+      numClasses = classValueNumbers.size();
+    }
+    NumActiveThetaNodes_--;
+
+    auto firstOutputValueNumber = CreateDerivedValueNumbers(inputValueNumbers, numClasses);
+    std::vector<size_t> outputValueNumbers;
+    for (size_t n = 0; n < loopVars.size(); n++)
+    {
+      outputValueNumbers.push_back(firstOutputValueNumber + partition[n]);
+      ValueNumbers_[*loopVars[n].output] = outputValueNumbers.back();
+    }
+
+    ThetaNumberings_[&thetaNode] = { std::move(inputValueNumbers), std::move(outputValueNumbers) };
+
+    // Value numbers outside of theta nodes are never refuted
+    if (NumActiveThetaNodes_ == 0)
+      Log_.clear();
+  }
+
+  void
+  NumberArguments(const rvsdg::Region & region)
+  {
+    for (size_t n = 0; n < region.narguments(); n++)
+    {
+      auto argument = region.argument(n);
+      if (auto input = argument->input())
+      {
+        auto operand = ValueNumbers_.Lookup(*input->origin());
+        ValueNumbers_[*argument] = LookupOrCreate({ &region, nullptr, { operand } }, 1);
+      }
+      else
+      {
+        ValueNumbers_[*argument] = CreateValueNumbers(1);
+      }
+    }
+  }
+
+  void
+  NumberOutputsUniquely(const rvsdg::Node & node)
+  {
+    for (size_t n = 0; n < node.noutputs(); n++)
+      ValueNumbers_[*node.output(n)] = CreateValueNumbers(1);
+  }
+
+  size_t
+  LookupOrCreate(Key key, size_t numValueNumbers)
+  {
+    auto [it, wasInserted] = Table_.emplace(std::move(key), NextValueNumber_);
+    if (wasInserted)
+    {
+      NextValueNumber_ += numValueNumbers;
+      if (NumActiveThetaNodes_ != 0)
+        Log_.push_back({ &it->first, {}, it->second, numValueNumbers });
+    }
+
+    return it->second;
+  }
+
+  /**
+   * Creates \p numValueNumbers fresh value numbers that are only valid as long as none of
+   * \p operands is refuted.
+   */
+  size_t
+  CreateDerivedValueNumbers(const std::vector<size_t> & operands, size_t numValueNumbers)
+  {
+    auto valueNumber = CreateValueNumbers(numValueNumbers);
+    if (NumActiveThetaNodes_ != 0)
+      Log_.push_back({ nullptr, operands, valueNumber, numValueNumbers });
+
+    return valueNumber;
+  }
+
+  /**
+   * Removes the table entries and derived value numbers that were logged since \p logStart and
+   * transitively depend on one of \p refutedValueNumbers. The log is in creation order, so a
+   * single pass suffices.
+   */
+  void
+  DiscardDerivedValueNumbers(std::unordered_set<size_t> & refutedValueNumbers, size_t logStart)
+  {
+    auto isRefuted = [&](size_t valueNumber)
+    {
+      return refutedValueNumbers.find(valueNumber) != refutedValueNumbers.end();
+    };
+
+    size_t numKept = logStart;
+    for (size_t n = logStart; n < Log_.size(); n++)
+    {
+      auto & entry = Log_[n];
+      auto & operands = entry.TableKey ? entry.TableKey->Operands : entry.Operands;
+      if (std::none_of(operands.begin(), operands.end(), isRefuted))
+      {
+        if (numKept != n)
+          Log_[numKept] = std::move(entry);
+        numKept++;
+        continue;
+      }
+
+      for (size_t i = 0; i < entry.NumValueNumbers; i++)
+        refutedValueNumbers.insert(entry.ValueNumber + i);
+      if (entry.TableKey)
+        Table_.erase(Table_.find(*entry.TableKey));
+    }
+    Log_.erase(Log_.begin() + numKept, Log_.end());
+  }
+
+  size_t
+  CreateValueNumbers(size_t numValueNumbers)
+  {
+    auto valueNumber = NextValueNumber_;
+    NextValueNumber_ += numValueNumbers;
+    return valueNumber;
+  }
+
+  size_t NextValueNumber_ = 0;
+  rvsdg::DenseOutputMap<size_t> ValueNumbers_;
+  std::unordered_map<Key, size_t, KeyHash> Table_;
+
+  /**
+   * Value numbers created while numbering the body of a theta node, in creation order. Either a
+   * table entry, or fresh value numbers derived from \ref Operands.
+   */
+  struct LogEntry
+  {
+    const Key * TableKey;
+    std::vector<size_t> Operands;
+    size_t ValueNumber;
+    size_t NumValueNumbers;
+  };
+
+  struct ThetaNumbering
+  {
+    std::vector<size_t> Inputs;
+    std::vector<size_t> Outputs;
+  };
+
+  size_t NumActiveThetaNodes_ = 0;
+  std::vector<LogEntry> Log_;
+  std::unordered_map<const rvsdg::ThetaNode *, ThetaNumbering> ThetaNumberings_;
+};
+
 /* divert phase */
 
 static void
@@ -562,7 +959,9 @@ divert(rvsdg::Region * region, cnectx & ctx)
 }
 
 static void
-cne(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+cne(rvsdg::RvsdgModule & rvsdgModule,
+    cne::Mode mode,
+    util::StatisticsCollector & statisticsCollector)
 {
   auto & graph = rvsdgModule.Rvsdg();
 
@@ -570,7 +969,16 @@ cne(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsColl
   auto statistics = cnestat::Create(rvsdgModule.SourceFilePath().value());
 
   statistics->start_mark_stat(graph);
-  mark(&graph.GetRootRegion(), ctx);
+  if (mode == cne::Mode::ValueNumbering)
+  {
+    ValueNumbering valueNumbering;
+    valueNumbering.NumberGraph(graph);
+    valueNumbering.MarkCongruentOutputs(graph.GetRootRegion(), ctx);
+  }
+  else
+  {
+    mark(&graph.GetRootRegion(), ctx);
+  }
   statistics->end_mark_stat();
 
   statistics->start_divert_stat();
@@ -585,10 +993,14 @@ cne(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsColl
 cne::~cne()
 {}
 
+cne::cne(Mode mode)
+    : Mode_(mode)
+{}
+
 void
 cne::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
 {
-  llvm::cne(module, statisticsCollector);
+  llvm::cne(module, Mode_, statisticsCollector);
 }
 
 }
@@ -17,10 +17,41 @@ namespace jlm::llvm
 class cne final : public rvsdg::Transformation
 {
 public:
+  /**
+   * Determines how congruent outputs are discovered.
+   */
+  enum class Mode
+  {
+    /**
+     * Decides the congruence of output pairs by recursively comparing their definitions.
+     */
+    Pairwise,
+
+    /**
+     * Assigns value numbers to all outputs in a single top-down pass over each region. Simple
+     * nodes are numbered by hashing their operation with the value numbers of their operands.
+     * Theta loop variables are numbered optimistically and refined until a fixpoint is reached.
+     * Finds at least the congruences found by Pairwise in time that is near-linear in the size of
+     * the graph.
+     */
+    ValueNumbering
+  };
+
   virtual ~cne();
 
+  explicit cne(Mode mode = Mode::Pairwise);
+
+  [[nodiscard]] Mode
+  GetMode() const noexcept
+  {
+    return Mode_;
+  }
+
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+private:
+  Mode Mode_;
 };
 
 }
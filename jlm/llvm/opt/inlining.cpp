@@ -13,6 +13,8 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <optional>
+
 namespace jlm::llvm
 {
 
@@ -133,13 +135,21 @@ inlineCall(jlm::rvsdg::SimpleNode * call, const rvsdg::LambdaNode * lambda)
   for (size_t n = 0; n < ctxvars.size(); n++)
     smap.insert(ctxvars[n].inner, deps[n]);
 
-  lambda->subregion()->copy(call->region(), smap, false, false);
-
-  for (size_t n = 0; n < call->noutputs(); n++)
   {
-    auto output = lambda->subregion()->result(n)->origin();
-    JLM_ASSERT(smap.lookup(output));
-    call->output(n)->divert_users(smap.lookup(output));
+    // Defer the depth maintenance of the copied nodes and the diverted users until the body is
+    // fully inlined. The lambda body must not be batched as it is the source of the copy.
+    std::optional<rvsdg::BatchEdit> batchEdit;
+    if (call->region() != lambda->subregion())
+      batchEdit.emplace(*call->region());
+
+    lambda->subregion()->copy(call->region(), smap, false, false);
+
+    for (size_t n = 0; n < call->noutputs(); n++)
+    {
+      auto output = lambda->subregion()->result(n)->origin();
+      JLM_ASSERT(smap.lookup(output));
+      call->output(n)->divert_users(smap.lookup(output));
+    }
   }
   remove(call);
 }
@@ -323,4 +323,10 @@ tginversion::Run(rvsdg::RvsdgModule & module, jlm::util::StatisticsCollector & s
   invert(module, statisticsCollector);
 }
 
+void
+tginversion::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  invert(lambdaNode.subregion());
+}
+
 }
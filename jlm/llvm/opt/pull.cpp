@@ -327,4 +327,10 @@ pullin::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsC
   pull(module, statisticsCollector);
 }
 
+void
+pullin::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  pull(lambdaNode.subregion());
+}
+
 }
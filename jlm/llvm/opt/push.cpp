@@ -435,4 +435,10 @@ pushout::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statistics
   push(module, statisticsCollector);
 }
 
+void
+pushout::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  push(lambdaNode.subregion());
+}
+
 }
@@ -6,10 +6,17 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/opt/reduction.hpp>
 #include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/lambda.hpp>
 #include <jlm/rvsdg/NodeNormalization.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <deque>
+#include <functional>
+#include <unordered_set>
+
 namespace jlm::llvm
 {
 
@@ -26,21 +33,37 @@ NodeReduction::Statistics::End(const rvsdg::Graph & graph) noexcept
 {
   AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(&graph.GetRootRegion()));
   AddMeasurement(Label::NumRvsdgInputsAfter, rvsdg::ninputs(&graph.GetRootRegion()));
+
+  size_t numNodeVisits = 0;
+  for (const auto & [region, numVisits] : NumNodeVisits_)
+    numNodeVisits += numVisits;
+  AddMeasurement(NumNodeVisits, numNodeVisits);
+
+  for (const auto label :
+       { NumGammaReductions,
+         NumLoadReductions,
+         NumStoreReductions,
+         NumBinaryReductions,
+         NumCommonNodeReductions })
+  {
+    AddMeasurement(label, GetNumReductions(label));
+  }
+
   GetTimer(Label::Timer).stop();
 }
 
 bool
-NodeReduction::Statistics::AddIteration(const rvsdg::Region & region, size_t numIterations)
+NodeReduction::Statistics::AddNodeVisits(const rvsdg::Region & region, size_t numVisits)
 {
-  const auto it = NumIterations_.find(&region);
-  NumIterations_[&region] = numIterations;
-  return it != NumIterations_.end();
+  const auto it = NumNodeVisits_.find(&region);
+  NumNodeVisits_[&region] = numVisits;
+  return it != NumNodeVisits_.end();
 }
 
 std::optional<size_t>
-NodeReduction::Statistics::GetNumIterations(const rvsdg::Region & region) const noexcept
+NodeReduction::Statistics::GetNumNodeVisits(const rvsdg::Region & region) const noexcept
 {
-  if (const auto it = NumIterations_.find(&region); it != NumIterations_.end())
+  if (const auto it = NumNodeVisits_.find(&region); it != NumNodeVisits_.end())
   {
     return it->second;
   }
@@ -48,6 +71,137 @@ NodeReduction::Statistics::GetNumIterations(const rvsdg::Region & region) const
   return std::nullopt;
 }
 
+void
+NodeReduction::Statistics::AddReduction(const char * label)
+{
+  NumReductions_[label]++;
+}
+
+size_t
+NodeReduction::Statistics::GetNumReductions(const char * label) const noexcept
+{
+  if (const auto it = NumReductions_.find(label); it != NumReductions_.end())
+  {
+    return it->second;
+  }
+
+  return 0;
+}
+
+/**
+ * The worklist of the nodes in a single region that still need to be visited.
+ *
+ * All nodes of the region are initially added in top-down order. Afterwards, a node is added again
+ * when it is created or when the origin of one of its inputs changes. The producers of an origin
+ * that lost a user are added as well such that they can be removed if they became dead.
+ */
+class NodeReduction::Worklist final
+{
+public:
+  explicit Worklist(rvsdg::Region & region)
+      : Region_(region)
+  {
+    for (const auto node : rvsdg::TopDownTraverser(&region))
+      Push(*node);
+
+    using namespace std::placeholders;
+    Callbacks_.push_back(
+        rvsdg::on_node_create.connect(std::bind(&Worklist::OnNodeCreate, this, _1)));
+    Callbacks_.push_back(
+        rvsdg::on_node_destroy.connect(std::bind(&Worklist::OnNodeDestroy, this, _1)));
+    Callbacks_.push_back(
+        rvsdg::on_input_change.connect(std::bind(&Worklist::OnInputChange, this, _1, _2, _3)));
+  }
+
+  Worklist(const Worklist &) = delete;
+
+  Worklist &
+  operator=(const Worklist &) = delete;
+
+  /**
+   * @return The next node to visit, or nullptr if the worklist is empty.
+   */
+  rvsdg::Node *
+  Pop() noexcept
+  {
+    while (!Queue_.empty())
+    {
+      const auto node = Queue_.front();
+      Queue_.pop_front();
+
+      // Nodes that were removed in the meantime are no longer members
+      if (Members_.erase(node))
+        return node;
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * Marks the subregions of \p structuralNode as reduced.
+   *
+   * @return True, if the subregions were not marked as reduced before, otherwise false.
+   */
+  bool
+  MarkSubregionsReduced(const rvsdg::StructuralNode & structuralNode)
+  {
+    return ReducedStructuralNodes_.insert(&structuralNode).second;
+  }
+
+private:
+  void
+  Push(rvsdg::Node & node)
+  {
+    if (Members_.insert(&node).second)
+      Queue_.push_back(&node);
+  }
+
+  void
+  PushProducer(const rvsdg::output & output)
+  {
+    const auto node = rvsdg::TryGetOwnerNode<rvsdg::Node>(output);
+    if (node && node->region() == &Region_)
+      Push(*node);
+  }
+
+  void
+  OnNodeCreate(rvsdg::Node * node)
+  {
+    if (node->region() == &Region_)
+      Push(*node);
+  }
+
+  void
+  OnNodeDestroy(rvsdg::Node * node)
+  {
+    if (node->region() != &Region_)
+      return;
+
+    Members_.erase(node);
+    ReducedStructuralNodes_.erase(node);
+    for (size_t n = 0; n < node->ninputs(); n++)
+      PushProducer(*node->input(n)->origin());
+  }
+
+  void
+  OnInputChange(rvsdg::input * input, rvsdg::output * oldOrigin, rvsdg::output *)
+  {
+    if (const auto node = rvsdg::TryGetOwnerNode<rvsdg::Node>(*input);
+        node && node->region() == &Region_)
+    {
+      Push(*node);
+    }
+
+    PushProducer(*oldOrigin);
+  }
+
+  rvsdg::Region & Region_;
+  std::deque<rvsdg::Node *> Queue_;
+  std::unordered_set<const rvsdg::Node *> Members_;
+  std::unordered_set<const rvsdg::Node *> ReducedStructuralNodes_;
+  std::vector<util::callback> Callbacks_;
+};
+
 NodeReduction::~NodeReduction() noexcept = default;
 
 NodeReduction::NodeReduction() = default;
@@ -68,60 +222,93 @@ NodeReduction::Run(
   statisticsCollector.CollectDemandedStatistics(std::move(Statistics_));
 }
 
+void
+NodeReduction::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  // This method might be invoked concurrently. Keep the state in a separate transformation object.
+  NodeReduction nodeReduction;
+  nodeReduction.Statistics_ = Statistics::Create(util::filepath(""));
+  nodeReduction.ReduceNodesInRegion(*lambdaNode.subregion());
+}
+
+void
+NodeReduction::RunOutsideLambdas(
+    rvsdg::RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  SkipLambdaSubregions_ = true;
+  Run(rvsdgModule, statisticsCollector);
+  SkipLambdaSubregions_ = false;
+}
+
 void
 NodeReduction::ReduceNodesInRegion(rvsdg::Region & region)
 {
-  bool reductionPerformed;
-  size_t numIterations = 0;
-  do
+  // Identical nodes are found with the hash-consing table of the region
+  const auto enableHashConsing = region.GetHashConsingTable() == nullptr;
+  if (enableHashConsing)
+    region.EnableHashConsing();
+
+  Worklist worklist(region);
+
+  size_t numVisits = 0;
+  while (const auto node = worklist.Pop())
   {
-    numIterations++;
-    reductionPerformed = false;
+    numVisits++;
 
-    for (const auto node : rvsdg::TopDownTraverser(&region))
+    if (node->IsDead())
     {
-      if (const auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
-      {
-        reductionPerformed |= ReduceStructuralNode(*structuralNode);
-      }
-      else if (rvsdg::is<rvsdg::SimpleOperation>(node))
-      {
-        reductionPerformed |= ReduceSimpleNode(*node);
-      }
-      else
-      {
-        JLM_UNREACHABLE("Unhandled node type.");
-      }
+      // The worklist picks up the producers of the node's operands, which might become dead, too.
+      remove(node);
     }
-
-    if (reductionPerformed)
+    else if (const auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+    {
+      const auto reduceSubregions = worklist.MarkSubregionsReduced(*structuralNode);
+      (void)ReduceStructuralNode(*structuralNode, reduceSubregions);
+    }
+    else if (rvsdg::is<rvsdg::SimpleOperation>(node))
+    {
+      (void)ReduceSimpleNode(*node);
+    }
+    else
     {
-      // Let's remove all dead nodes in this region to avoid reductions on
-      // dead nodes in the next iteration.
-      region.prune(false);
+      JLM_UNREACHABLE("Unhandled node type.");
     }
-  } while (reductionPerformed);
+  }
+
+  Statistics_->AddNodeVisits(region, numVisits);
 
-  Statistics_->AddIteration(region, numIterations);
+  if (enableHashConsing)
+    region.DisableHashConsing();
 }
 
 bool
-NodeReduction::ReduceStructuralNode(rvsdg::StructuralNode & structuralNode)
+NodeReduction::ReduceStructuralNode(
+    rvsdg::StructuralNode & structuralNode,
+    const bool reduceSubregions)
 {
-  bool reductionPerformed = false;
-
   // Reduce structural nodes
-  if (is<rvsdg::GammaOperation>(&structuralNode))
+  if (is<rvsdg::GammaOperation>(&structuralNode) && ReduceGammaNode(structuralNode))
   {
-    reductionPerformed |= ReduceGammaNode(structuralNode);
-  }
+    Statistics_->AddReduction(Statistics::NumGammaReductions);
 
-  if (reductionPerformed)
-  {
     // We can not go through the subregions as the structural node might already have been removed.
     return true;
   }
 
+  // The subregions are independent of the operands of the structural node. It suffices to reduce
+  // them the first time the node is visited.
+  if (!reduceSubregions)
+  {
+    return false;
+  }
+
+  // The lambda subregions were already reduced by RunOnLambda()
+  if (SkipLambdaSubregions_ && is<rvsdg::LambdaOperation>(&structuralNode))
+  {
+    return false;
+  }
+
   // Reduce all nodes in the subregions
   for (size_t n = 0; n < structuralNode.nsubregions(); n++)
   {
@@ -146,26 +333,41 @@ NodeReduction::ReduceGammaNode(rvsdg::StructuralNode & gammaNode)
 bool
 NodeReduction::ReduceSimpleNode(rvsdg::Node & simpleNode)
 {
+  bool reductionPerformed = false;
+  const char * label = nullptr;
   if (is<LoadNonVolatileOperation>(&simpleNode))
   {
-    return ReduceLoadNode(simpleNode);
+    reductionPerformed = ReduceLoadNode(simpleNode);
+    label = Statistics::NumLoadReductions;
   }
-  if (is<StoreNonVolatileOperation>(&simpleNode))
+  else if (is<StoreNonVolatileOperation>(&simpleNode))
   {
-    return ReduceStoreNode(simpleNode);
+    reductionPerformed = ReduceStoreNode(simpleNode);
+    label = Statistics::NumStoreReductions;
   }
-  if (is<rvsdg::UnaryOperation>(&simpleNode))
+  else if (is<rvsdg::UnaryOperation>(&simpleNode))
   {
     // FIXME: handle the unary node
     // See github issue #304
-    return false;
   }
-  if (is<rvsdg::BinaryOperation>(&simpleNode))
+  else if (is<rvsdg::BinaryOperation>(&simpleNode))
   {
-    return ReduceBinaryNode(simpleNode);
+    reductionPerformed = ReduceBinaryNode(simpleNode);
+    label = Statistics::NumBinaryReductions;
   }
 
-  return false;
+  if (!reductionPerformed)
+  {
+    reductionPerformed = ReduceCommonNode(simpleNode);
+    label = Statistics::NumCommonNodeReductions;
+  }
+
+  if (reductionPerformed)
+  {
+    Statistics_->AddReduction(label);
+  }
+
+  return reductionPerformed;
 }
 
 bool
@@ -192,6 +394,22 @@ NodeReduction::ReduceBinaryNode(rvsdg::Node & simpleNode)
   return rvsdg::ReduceNode<rvsdg::BinaryOperation>(rvsdg::NormalizeBinaryOperation, simpleNode);
 }
 
+bool
+NodeReduction::ReduceCommonNode(rvsdg::Node & simpleNode)
+{
+  auto & region = *simpleNode.region();
+  if (!rvsdg::SimpleNodeTable::IsHashConsable(
+          *util::AssertedCast<const rvsdg::SimpleOperation>(&simpleNode.GetOperation())))
+    return false;
+
+  auto normalizeCommonNode =
+      [&](const rvsdg::SimpleOperation & operation, const std::vector<rvsdg::output *> & operands)
+  {
+    return rvsdg::NormalizeSimpleOperationCommonNodeElimination(region, operation, operands);
+  };
+  return rvsdg::ReduceNode<rvsdg::SimpleOperation>(normalizeCommonNode, simpleNode);
+}
+
 std::optional<std::vector<rvsdg::output *>>
 NodeReduction::NormalizeLoadNode(
     const LoadNonVolatileOperation & operation,
@@ -14,6 +14,7 @@
 namespace jlm::rvsdg
 {
 class Graph;
+class LambdaNode;
 class Node;
 class Region;
 class output;
@@ -28,8 +29,17 @@ class StoreNonVolatileOperation;
 
 /**
  * The node reduction transformation performs a series of peephole optimizations in the RVSDG. The
- * nodes in a region are visited top-down and reductions are performed until a fix-point is reached,
- * i.e., until no peephole optimization can be applied any longer to any node in a region.
+ * nodes of a region are initially put on a worklist in top-down order. Whenever a reduction
+ * changes the operands of a node or creates a new node, only the affected nodes are put back onto
+ * the worklist. Nodes that become dead are removed as soon as they are encountered. The
+ * transformation terminates once the worklists of all regions are empty, i.e., once no peephole
+ * optimization can be applied any longer to any node.
+ *
+ * Simple nodes with hash-consable operations that are identical to another node in the same region
+ * are replaced by that node. The hash-consing table of a region is enabled while its nodes are
+ * reduced, such that identical nodes are found in constant time.
+ *
+ * \see rvsdg::SimpleNodeTable
  */
 class NodeReduction final : public rvsdg::Transformation
 {
@@ -53,7 +63,38 @@ public:
   void
   Run(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::ReduceNodes;
+  }
+
+  [[nodiscard]] bool
+  HasPartOutsideLambdas() const noexcept override
+  {
+    return true;
+  }
+
+  /**
+   * Reduces all nodes outside of the lambda subregions, such as the nodes of delta subregions.
+   */
+  void
+  RunOutsideLambdas(
+      rvsdg::RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector) override;
+
 private:
+  class Worklist;
+
   void
   ReduceNodesInRegion(rvsdg::Region & region);
 
@@ -64,15 +105,16 @@ private:
    * the nodes in its subregions could be reduced.
    *
    * @param structuralNode The structural node that is supposed to be reduced.
+   * @param reduceSubregions Determines whether the nodes in the subregions are reduced as well.
    * @return True, if the structural node could be reduced, otherwise false.
    */
   [[nodiscard]] bool
-  ReduceStructuralNode(rvsdg::StructuralNode & structuralNode);
+  ReduceStructuralNode(rvsdg::StructuralNode & structuralNode, bool reduceSubregions);
 
   [[nodiscard]] static bool
   ReduceGammaNode(rvsdg::StructuralNode & gammaNode);
 
-  [[nodiscard]] static bool
+  [[nodiscard]] bool
   ReduceSimpleNode(rvsdg::Node & simpleNode);
 
   [[nodiscard]] static bool
@@ -84,6 +126,15 @@ private:
   [[nodiscard]] static bool
   ReduceBinaryNode(rvsdg::Node & simpleNode);
 
+  /**
+   * Replaces \p simpleNode with an identical node of the same region if the operation of
+   * \p simpleNode is hash-consable.
+   *
+   * @return True, if \p simpleNode was replaced, otherwise false.
+   */
+  [[nodiscard]] static bool
+  ReduceCommonNode(rvsdg::Node & simpleNode);
+
   static std::optional<std::vector<rvsdg::output *>>
   NormalizeLoadNode(
       const LoadNonVolatileOperation & operation,
@@ -95,6 +146,7 @@ private:
       const std::vector<rvsdg::output *> & operands);
 
   std::unique_ptr<Statistics> Statistics_;
+  bool SkipLambdaSubregions_ = false;
 };
 
 /**
@@ -103,6 +155,13 @@ private:
 class NodeReduction::Statistics final : public util::Statistics
 {
 public:
+  static constexpr const char * NumNodeVisits = "#NodeVisits";
+  static constexpr const char * NumGammaReductions = "#GammaReductions";
+  static constexpr const char * NumLoadReductions = "#LoadReductions";
+  static constexpr const char * NumStoreReductions = "#StoreReductions";
+  static constexpr const char * NumBinaryReductions = "#BinaryReductions";
+  static constexpr const char * NumCommonNodeReductions = "#CommonNodeReductions";
+
   ~Statistics() noexcept override = default;
 
   explicit Statistics(const util::filepath & sourceFile)
@@ -115,11 +174,27 @@ public:
   void
   End(const rvsdg::Graph & graph) noexcept;
 
+  /**
+   * Records that \p numVisits nodes were taken from the worklist of \p region.
+   *
+   * @return True, if visits were already recorded for \p region, otherwise false.
+   */
   bool
-  AddIteration(const rvsdg::Region & region, size_t numIterations);
+  AddNodeVisits(const rvsdg::Region & region, size_t numVisits);
 
   std::optional<size_t>
-  GetNumIterations(const rvsdg::Region & region) const noexcept;
+  GetNumNodeVisits(const rvsdg::Region & region) const noexcept;
+
+  /**
+   * Records the application of a reduction rule to a node of the operation kind \p label, which
+   * is one of NumGammaReductions, NumLoadReductions, NumStoreReductions, NumBinaryReductions, or
+   * NumCommonNodeReductions.
+   */
+  void
+  AddReduction(const char * label);
+
+  [[nodiscard]] size_t
+  GetNumReductions(const char * label) const noexcept;
 
   static std::unique_ptr<Statistics>
   Create(const util::filepath & sourceFile)
@@ -128,7 +203,8 @@ public:
   }
 
 private:
-  std::unordered_map<const rvsdg::Region *, size_t> NumIterations_;
+  std::unordered_map<const rvsdg::Region *, size_t> NumNodeVisits_;
+  std::unordered_map<std::string, size_t> NumReductions_;
 };
 
 }
@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/ScalarEvolution.hpp>
 #include <jlm/llvm/opt/unroll.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/traverser.hpp>
@@ -516,6 +517,84 @@ unroll(rvsdg::Region * region, size_t factor)
   return unrolled;
 }
 
+/*
+  Unroll the theta according to the size budget. The trip count is determined by the scalar
+  evolution analysis, and the unroll information only serves as fallback.
+  Returns true if the theta was fully unrolled, i.e., it was removed.
+*/
+static bool
+unroll_with_budget(rvsdg::ThetaNode * theta, size_t factor, size_t sizeBudget)
+{
+  ScalarEvolution scalarEvolution;
+  scalarEvolution.AnalyzeTheta(*theta);
+
+  auto ui = unrollinfo::create(theta);
+  auto niterations = ui ? ui->niterations() : nullptr;
+  auto tripCount = scalarEvolution.GetTripCount(*theta);
+  if (!tripCount && niterations && ui->nbits() <= 64)
+    tripCount = niterations->to_uint();
+
+  auto bodySize = std::max(rvsdg::nnodes(theta->subregion()), size_t(1));
+  if (tripCount && *tripCount != 0 && *tripCount <= sizeBudget / bodySize)
+  {
+    copy_body_and_unroll(theta, *tripCount);
+    remove(theta);
+    return true;
+  }
+
+  if (!ui)
+    return false;
+
+  factor = std::min(factor, sizeBudget / bodySize);
+  if (factor < 2)
+    return false;
+
+  /*
+    The loop is not fully unrolled by the unrolling below, as the number of iterations
+    is known to exceed the factor if it is known at all.
+  */
+  if (niterations)
+    unroll_known_theta(*ui, factor);
+  else
+    unroll_unknown_theta(*ui, factor);
+
+  return false;
+}
+
+/*
+  Unroll all innermost thetas in the region according to the size budget. A theta is
+  considered innermost if all of its inner thetas were fully unrolled.
+  Returns true if the region still contains thetas.
+*/
+static bool
+unroll_with_budget(rvsdg::Region * region, size_t factor, size_t sizeBudget)
+{
+  bool containsTheta = false;
+  for (auto & node : rvsdg::TopDownTraverser(region))
+  {
+    if (auto structnode = dynamic_cast<rvsdg::StructuralNode *>(node))
+    {
+      bool containsInnerTheta = false;
+      for (size_t n = 0; n < structnode->nsubregions(); n++)
+      {
+        if (unroll_with_budget(structnode->subregion(n), factor, sizeBudget))
+          containsInnerTheta = true;
+      }
+
+      if (auto theta = dynamic_cast<rvsdg::ThetaNode *>(node))
+      {
+        if (containsInnerTheta || !unroll_with_budget(theta, factor, sizeBudget))
+          containsTheta = true;
+      }
+      else if (containsInnerTheta)
+      {
+        containsTheta = true;
+      }
+    }
+  }
+  return containsTheta;
+}
+
 /* loopunroll class */
 
 loopunroll::~loopunroll()
@@ -524,17 +603,32 @@ loopunroll::~loopunroll()
 void
 loopunroll::Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
 {
-  if (factor_ < 2)
+  if (sizeBudget_ == 0 && factor_ < 2)
     return;
 
   auto & graph = module.Rvsdg();
   auto statistics = unrollstat::Create(module.SourceFilePath().value());
 
   statistics->start(module.Rvsdg());
-  unroll(&graph.GetRootRegion(), factor_);
+  if (sizeBudget_ == 0)
+    unroll(&graph.GetRootRegion(), factor_);
+  else
+    unroll_with_budget(&graph.GetRootRegion(), factor_, sizeBudget_);
   statistics->end(module.Rvsdg());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+void
+loopunroll::RunOnLambda(rvsdg::LambdaNode & lambdaNode) const
+{
+  if (sizeBudget_ == 0 && factor_ < 2)
+    return;
+
+  if (sizeBudget_ == 0)
+    unroll(lambdaNode.subregion(), factor_);
+  else
+    unroll_with_budget(lambdaNode.subregion(), factor_, sizeBudget_);
+}
+
 }
@@ -18,6 +18,17 @@ class RvsdgModule;
 
 /**
  * \brief Optimization that attempts to unroll loops (thetas).
+ *
+ * Without a size budget, all innermost loops are unrolled with a fixed factor. With a size
+ * budget, the unrolling is driven by the number of nodes in the loop bodies:
+ *
+ * 1. A loop with a constant trip count is fully unrolled if the trip count times the number of
+ * nodes in its body does not exceed the budget.
+ * 2. Any other loop is unrolled with the largest factor, at most the given factor, for which the
+ * factor times the number of nodes in its body does not exceed the budget.
+ *
+ * A loop whose inner loops were all fully unrolled is treated as innermost loop, i.e., outer loops
+ * are unrolled after their inner loops.
  */
 class loopunroll final : public rvsdg::Transformation
 {
@@ -25,9 +36,32 @@ public:
   virtual ~loopunroll();
 
   constexpr loopunroll(size_t factor)
-      : factor_(factor)
+      : factor_(factor),
+        sizeBudget_(0)
   {}
 
+  /**
+   * @param factor The maximum unroll factor of loops that are not fully unrolled.
+   * @param sizeBudget The maximum number of nodes in the body of an unrolled loop. If it is zero,
+   * all innermost loops are unrolled with \p factor.
+   */
+  constexpr loopunroll(size_t factor, size_t sizeBudget)
+      : factor_(factor),
+        sizeBudget_(sizeBudget)
+  {}
+
+  [[nodiscard]] size_t
+  factor() const noexcept
+  {
+    return factor_;
+  }
+
+  [[nodiscard]] size_t
+  sizeBudget() const noexcept
+  {
+    return sizeBudget_;
+  }
+
   /**
    * Given a module all inner most loops (thetas) are found and unrolled if possible.
    * All nodes in the module are traversed and if a theta is found and is the inner most theta
@@ -39,8 +73,24 @@ public:
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) const override;
+
+  [[nodiscard]] std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return util::Statistics::Id::LoopUnrolling;
+  }
+
 private:
   size_t factor_;
+  size_t sizeBudget_;
 };
 
 class unrollinfo final
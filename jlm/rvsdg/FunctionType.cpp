@@ -110,7 +110,8 @@ FunctionType::Create(
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> argumentTypes,
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> resultTypes)
 {
-  return std::make_shared<FunctionType>(std::move(argumentTypes), std::move(resultTypes));
+  return TypeTable::Intern(
+      std::make_shared<const FunctionType>(std::move(argumentTypes), std::move(resultTypes)));
 }
 
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/GraphAllocated.hpp>
+#include <jlm/util/SlabAllocator.hpp>
+
+#include <new>
+
+namespace jlm::rvsdg
+{
+
+namespace
+{
+
+/**
+ * Every block handed out by GraphAllocated is prefixed by this header. It records where the block
+ * came from, such that operator delete does not need to know the graph the object belonged to.
+ */
+struct alignas(std::max_align_t) BlockHeader
+{
+  util::SlabAllocator * Allocator;
+  std::size_t Size;
+};
+
+void *
+Allocate(util::SlabAllocator * allocator, std::size_t size)
+{
+  auto blockSize = sizeof(BlockHeader) + size;
+  auto block = allocator ? allocator->Allocate(blockSize) : ::operator new(blockSize);
+
+  auto header = new (block) BlockHeader{ allocator, blockSize };
+  return header + 1;
+}
+
+void
+Deallocate(void * ptr) noexcept
+{
+  if (ptr == nullptr)
+    return;
+
+  auto header = static_cast<BlockHeader *>(ptr) - 1;
+  if (auto allocator = header->Allocator)
+  {
+    allocator->Deallocate(header, header->Size);
+  }
+  else
+  {
+    ::operator delete(header);
+  }
+}
+
+}
+
+void *
+GraphAllocated::operator new(std::size_t size)
+{
+  return Allocate(nullptr, size);
+}
+
+void *
+GraphAllocated::operator new(std::size_t size, Region & region)
+{
+  return Allocate(&region.graph()->GetAllocator(), size);
+}
+
+void
+GraphAllocated::operator delete(void * ptr) noexcept
+{
+  Deallocate(ptr);
+}
+
+void
+GraphAllocated::operator delete(void * ptr, Region &) noexcept
+{
+  Deallocate(ptr);
+}
+
+}
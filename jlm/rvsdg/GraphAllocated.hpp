@@ -0,0 +1,54 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_GRAPHALLOCATED_HPP
+#define JLM_RVSDG_GRAPHALLOCATED_HPP
+
+#include <cstddef>
+
+namespace jlm::rvsdg
+{
+
+class Region;
+
+/**
+ * \brief Base class for objects that can be allocated from the slab allocator of a Graph.
+ *
+ * Nodes, inputs, and outputs derive from this class. Allocating them with the placement form
+ *
+ * \code
+ *   new (region) SimpleNode(region, ...);
+ * \endcode
+ *
+ * takes the memory from the slab allocator of the graph \p region belongs to. The memory is
+ * returned to the same allocator on deletion, and released in bulk when the graph is destroyed.
+ * The plain form of operator new keeps using the global allocator, such that both kinds of objects
+ * can be freely mixed and deleted through the same virtual destructor.
+ *
+ * \see Graph::GetAllocator()
+ */
+class GraphAllocated
+{
+public:
+  static void *
+  operator new(std::size_t size);
+
+  static void *
+  operator new(std::size_t size, Region & region);
+
+  static void
+  operator delete(void * ptr) noexcept;
+
+  /**
+   * Only invoked by the compiler if a constructor throws after the object was allocated with the
+   * placement form of operator new.
+   */
+  static void
+  operator delete(void * ptr, Region & region) noexcept;
+};
+
+}
+
+#endif // JLM_RVSDG_GRAPHALLOCATED_HPP
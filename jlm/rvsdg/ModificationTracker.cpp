@@ -0,0 +1,201 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/ModificationTracker.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/region.hpp>
+
+#include <functional>
+#include <variant>
+
+namespace jlm::rvsdg
+{
+
+ModificationTracker::~ModificationTracker() noexcept = default;
+
+ModificationTracker::ModificationTracker()
+    : Epoch_(0)
+{
+  using namespace std::placeholders;
+  Callbacks_.push_back(
+      on_node_create.connect(std::bind(&ModificationTracker::OnNodeCreate, this, _1)));
+  Callbacks_.push_back(
+      on_node_destroy.connect(std::bind(&ModificationTracker::OnNodeDestroy, this, _1)));
+  Callbacks_.push_back(
+      on_input_change.connect(std::bind(&ModificationTracker::OnInputChange, this, _1, _2, _3)));
+  Callbacks_.push_back(on_input_create.connect(
+      std::bind(&ModificationTracker::OnInputCreateOrDestroy, this, _1)));
+  Callbacks_.push_back(on_input_destroy.connect(
+      std::bind(&ModificationTracker::OnInputCreateOrDestroy, this, _1)));
+  Callbacks_.push_back(on_output_create.connect(
+      std::bind(&ModificationTracker::OnOutputCreateOrDestroy, this, _1)));
+  Callbacks_.push_back(on_output_destroy.connect(
+      std::bind(&ModificationTracker::OnOutputCreateOrDestroy, this, _1)));
+}
+
+uint64_t
+ModificationTracker::GetModificationEpoch(const LambdaNode & lambdaNode) const noexcept
+{
+  const auto it = ModificationEpochs_.find(&lambdaNode);
+  return it != ModificationEpochs_.end() ? it->second : 0;
+}
+
+void
+ModificationTracker::RecordModification(const LambdaNode & lambdaNode)
+{
+  RecordNetModification();
+  RecordModification(*lambdaNode.subregion());
+}
+
+void
+ModificationTracker::MarkClean(
+    const Transformation & transformation,
+    const LambdaNode & lambdaNode)
+{
+  CleanEpochs_[&transformation][&lambdaNode] = GetModificationEpoch(lambdaNode);
+}
+
+bool
+ModificationTracker::IsClean(const Transformation & transformation, const LambdaNode & lambdaNode)
+    const noexcept
+{
+  const auto transformationIt = CleanEpochs_.find(&transformation);
+  if (transformationIt == CleanEpochs_.end())
+    return false;
+
+  const auto & cleanEpochs = transformationIt->second;
+  const auto it = cleanEpochs.find(&lambdaNode);
+  return it != cleanEpochs.end() && it->second == GetModificationEpoch(lambdaNode);
+}
+
+void
+ModificationTracker::PushChangeSet()
+{
+  ChangeSets_.emplace_back();
+}
+
+bool
+ModificationTracker::PopChangeSet()
+{
+  JLM_ASSERT(!ChangeSets_.empty());
+  const auto hasModifications = ChangeSets_.back().HasModifications();
+  ChangeSets_.pop_back();
+  return hasModifications;
+}
+
+void
+ModificationTracker::RecordNetModification() noexcept
+{
+  for (auto & changeSet : ChangeSets_)
+    changeSet.HasOtherModifications = true;
+}
+
+void
+ModificationTracker::RecordPortModification(const Node * owner) noexcept
+{
+  // The ports of created nodes are part of their creation
+  for (auto & changeSet : ChangeSets_)
+  {
+    if (!changeSet.IsCreatedNode(owner))
+      changeSet.HasOtherModifications = true;
+  }
+}
+
+/**
+ * @return The node that owns \p port, or the structural node whose subregion owns \p port.
+ */
+template<class PortType>
+static const Node *
+GetOwnerNode(const PortType & port) noexcept
+{
+  const auto owner = port.GetOwner();
+  if (const auto node = std::get_if<Node *>(&owner))
+    return *node;
+
+  return std::get<Region *>(owner)->node();
+}
+
+void
+ModificationTracker::RecordModification(const Region & region)
+{
+  Epoch_++;
+
+  // The enclosing structural nodes are not cast to lambda nodes, as they might be in the middle of
+  // their destruction when the nodes of their subregions are destroyed.
+  for (auto node = region.node(); node != nullptr; node = node->region()->node())
+    ModificationEpochs_[node] = Epoch_;
+}
+
+void
+ModificationTracker::Forget(const Node & node)
+{
+  ModificationEpochs_.erase(&node);
+  for (auto & [transformation, cleanEpochs] : CleanEpochs_)
+    cleanEpochs.erase(&node);
+}
+
+void
+ModificationTracker::OnNodeCreate(Node * node)
+{
+  Forget(*node);
+  RecordModification(*node->region());
+
+  for (auto & changeSet : ChangeSets_)
+  {
+    // A new node can be created at the address of a destroyed node
+    changeSet.DestroyedCreatedNodes.erase(node);
+    changeSet.CreatedNodes.insert(node);
+  }
+}
+
+void
+ModificationTracker::OnNodeDestroy(Node * node)
+{
+  Forget(*node);
+  RecordModification(*node->region());
+
+  for (auto & changeSet : ChangeSets_)
+  {
+    if (changeSet.CreatedNodes.erase(node))
+      changeSet.DestroyedCreatedNodes.insert(node);
+    else
+      changeSet.HasOtherModifications = true;
+  }
+}
+
+void
+ModificationTracker::OnInputChange(input * input, output * oldOrigin, output * newOrigin)
+{
+  RecordModification(*input->region());
+
+  const auto owner = GetOwnerNode(*input);
+  for (auto & changeSet : ChangeSets_)
+  {
+    if (changeSet.IsCreatedNode(owner))
+      continue;
+
+    // Only the origin at the start of the change set is kept
+    const auto it = changeSet.DivertedInputs.emplace(input, oldOrigin).first;
+    if (it->second == newOrigin)
+      changeSet.DivertedInputs.erase(it);
+  }
+}
+
+void
+ModificationTracker::OnInputCreateOrDestroy(input * input)
+{
+  RecordModification(*input->region());
+  RecordPortModification(GetOwnerNode(*input));
+}
+
+void
+ModificationTracker::OnOutputCreateOrDestroy(output * output)
+{
+  RecordModification(*output->region());
+  RecordPortModification(GetOwnerNode(*output));
+}
+
+}
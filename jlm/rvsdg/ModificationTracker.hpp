@@ -0,0 +1,192 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_MODIFICATIONTRACKER_HPP
+#define JLM_RVSDG_MODIFICATIONTRACKER_HPP
+
+#include <jlm/util/callbacks.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class input;
+class LambdaNode;
+class Node;
+class output;
+class Region;
+class Transformation;
+
+/**
+ * Tracks the modifications of an RVSDG through the graph notifiers.
+ *
+ * The tracker maintains a global modification epoch that is incremented with every observed
+ * modification, and the epoch of the last modification of every lambda node's subregion. It
+ * further records for which lambda nodes a lambda-local transformation is known to be a no-op,
+ * i.e., lambda nodes to which the transformation was applied without modifying them and that were
+ * not modified since.
+ *
+ * In addition, the tracker can record the net modifications of the RVSDG in nested change sets.
+ * Nodes that are created and destroyed again, as well as inputs that are diverted back to their
+ * original origin, do not count as net modifications.
+ *
+ * \note The notifiers are thread-local. A tracker only observes the modifications performed by
+ * the thread that created it. Modifications performed by other threads need to be recorded
+ * explicitly with RecordModification().
+ *
+ * @see Transformation::IsLambdaLocal()
+ */
+class ModificationTracker final
+{
+public:
+  ~ModificationTracker() noexcept;
+
+  ModificationTracker();
+
+  ModificationTracker(const ModificationTracker &) = delete;
+
+  ModificationTracker &
+  operator=(const ModificationTracker &) = delete;
+
+  /**
+   * @return The current modification epoch. It is incremented with every modification.
+   */
+  [[nodiscard]] uint64_t
+  GetEpoch() const noexcept
+  {
+    return Epoch_;
+  }
+
+  /**
+   * @return The epoch of the last modification of the subregion of \p lambdaNode, or zero if no
+   * modification was observed.
+   */
+  [[nodiscard]] uint64_t
+  GetModificationEpoch(const LambdaNode & lambdaNode) const noexcept;
+
+  /**
+   * Records a modification of the subregion of \p lambdaNode.
+   */
+  void
+  RecordModification(const LambdaNode & lambdaNode);
+
+  /**
+   * Records that \p transformation was applied to \p lambdaNode without modifying it.
+   */
+  void
+  MarkClean(const Transformation & transformation, const LambdaNode & lambdaNode);
+
+  /**
+   * Determines whether \p lambdaNode is clean with respect to \p transformation, i.e., whether
+   * \p transformation was applied to \p lambdaNode without modifying it, and \p lambdaNode was not
+   * modified since.
+   */
+  [[nodiscard]] bool
+  IsClean(const Transformation & transformation, const LambdaNode & lambdaNode) const noexcept;
+
+  /**
+   * Starts recording the net modifications of the RVSDG in a new change set. Change sets can be
+   * nested, and every modification is recorded in all of them.
+   *
+   * @see PopChangeSet()
+   */
+  void
+  PushChangeSet();
+
+  /**
+   * Stops recording the net modifications in the most recently pushed change set.
+   *
+   * @return True if the RVSDG has net modifications since the corresponding PushChangeSet(),
+   * otherwise false.
+   */
+  bool
+  PopChangeSet();
+
+private:
+  /**
+   * The net modifications of the RVSDG since the start of a change set.
+   */
+  struct ChangeSet
+  {
+    [[nodiscard]] bool
+    HasModifications() const noexcept
+    {
+      return HasOtherModifications || !CreatedNodes.empty() || !DivertedInputs.empty();
+    }
+
+    /**
+     * @return True if \p node was created after the start of the change set. This also holds
+     * while the ports of a created node are destroyed, which happens after the node's destruction
+     * was announced.
+     */
+    [[nodiscard]] bool
+    IsCreatedNode(const Node * node) const noexcept
+    {
+      return CreatedNodes.find(node) != CreatedNodes.end()
+          || DestroyedCreatedNodes.find(node) != DestroyedCreatedNodes.end();
+    }
+
+    std::unordered_set<const Node *> CreatedNodes;
+    std::unordered_set<const Node *> DestroyedCreatedNodes;
+    // The origins of the diverted inputs of pre-existing nodes at the start of the change set
+    std::unordered_map<const input *, const output *> DivertedInputs;
+    bool HasOtherModifications = false;
+  };
+
+  /**
+   * Records a modification that does not cancel out in all change sets.
+   */
+  void
+  RecordNetModification() noexcept;
+
+  /**
+   * Records the creation or destruction of a port owned by \p owner in all change sets.
+   */
+  void
+  RecordPortModification(const Node * owner) noexcept;
+
+  /**
+   * Increments the epoch and records the modification for all lambda nodes enclosing \p region.
+   */
+  void
+  RecordModification(const Region & region);
+
+  /**
+   * Drops all information about \p node, as a new node can be created at the same address after
+   * \p node was destroyed.
+   */
+  void
+  Forget(const Node & node);
+
+  void
+  OnNodeCreate(Node * node);
+
+  void
+  OnNodeDestroy(Node * node);
+
+  void
+  OnInputChange(input * input, output *, output *);
+
+  void
+  OnInputCreateOrDestroy(input * input);
+
+  void
+  OnOutputCreateOrDestroy(output * output);
+
+  uint64_t Epoch_;
+  std::unordered_map<const Node *, uint64_t> ModificationEpochs_;
+  std::unordered_map<const Transformation *, std::unordered_map<const Node *, uint64_t>>
+      CleanEpochs_;
+  std::vector<ChangeSet> ChangeSets_;
+  std::vector<util::callback> Callbacks_;
+};
+
+}
+
+#endif // JLM_RVSDG_MODIFICATIONTRACKER_HPP
@@ -5,26 +5,64 @@
 
 #include "RvsdgModule.hpp"
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/ModificationTracker.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace jlm::rvsdg
 {
 
 Transformation::~Transformation() noexcept = default;
 
+void
+Transformation::RunOnLambda(LambdaNode &) const
+{
+  JLM_UNREACHABLE("Transformation is not lambda-local.");
+}
+
+void
+Transformation::RunOutsideLambdas(RvsdgModule &, util::StatisticsCollector &)
+{
+  JLM_UNREACHABLE("Transformation has no part outside of lambda nodes.");
+}
+
 class TransformationSequence::Statistics final : public util::Statistics
 {
+  static constexpr const char * NumFixpointIterations_ = "#FixpointIterations";
+  static constexpr const char * NumSkippedLambdaRuns_ = "#SkippedLambdaRuns";
+
 public:
   ~Statistics() noexcept override = default;
 
   explicit Statistics(const util::filepath & sourceFile)
-      : util::Statistics(Id::RvsdgOptimization, sourceFile)
+      : util::Statistics(Id::RvsdgOptimization, sourceFile),
+        FixpointIterations_(0),
+        SkippedLambdaRuns_(0)
   {}
 
+  void
+  AddFixpointIteration() noexcept
+  {
+    FixpointIterations_++;
+  }
+
+  void
+  AddSkippedLambdaRuns(size_t numSkippedLambdaRuns) noexcept
+  {
+    SkippedLambdaRuns_ += numSkippedLambdaRuns;
+  }
+
   void
   StartMeasuring(const Graph & graph) noexcept
   {
     AddMeasurement(Label::NumRvsdgNodesBefore, nnodes(&graph.GetRootRegion()));
+    AddMeasurement(Label::NumRvsdgAllocatedBytesBefore, graph.NumAllocatedBytes());
     AddTimer(Label::Timer).start();
   }
 
@@ -33,6 +71,9 @@ public:
   {
     GetTimer(Label::Timer).stop();
     AddMeasurement(Label::NumRvsdgNodesAfter, nnodes(&graph.GetRootRegion()));
+    AddMeasurement(Label::NumRvsdgAllocatedBytesAfter, graph.NumAllocatedBytes());
+    AddMeasurement(NumFixpointIterations_, FixpointIterations_);
+    AddMeasurement(NumSkippedLambdaRuns_, SkippedLambdaRuns_);
   }
 
   static std::unique_ptr<Statistics>
@@ -40,6 +81,10 @@ public:
   {
     return std::make_unique<Statistics>(sourceFile);
   }
+
+private:
+  size_t FixpointIterations_;
+  size_t SkippedLambdaRuns_;
 };
 
 TransformationSequence::~TransformationSequence() noexcept = default;
@@ -52,13 +97,251 @@ TransformationSequence::Run(
   auto statistics = Statistics::Create(rvsdgModule.SourceFilePath().value());
   statistics->StartMeasuring(rvsdgModule.Rvsdg());
 
-  for (const auto & optimization : Transformations_)
+  ModificationTracker tracker;
+  RunTransformations(rvsdgModule, statisticsCollector, Transformations_, tracker, *statistics);
+
+  statistics->EndMeasuring(rvsdgModule.Rvsdg());
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+/**
+ * Determines whether the statistics of \p transformation are demanded by \p statisticsCollector.
+ */
+static bool
+AreStatisticsDemanded(
+    const Transformation & transformation,
+    const util::StatisticsCollector & statisticsCollector)
+{
+  const auto statisticsId = transformation.GetStatisticsId();
+  return statisticsId.has_value() && statisticsCollector.GetSettings().IsDemanded(*statisticsId);
+}
+
+void
+TransformationSequence::RunTransformations(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector,
+    const std::vector<Transformation *> & transformations,
+    ModificationTracker & tracker,
+    Statistics & statistics) const
+{
+  // Skipping unchanged lambda nodes requires applying lambda-local transformations per lambda node.
+  // This does not change the resulting RVSDG, as the parts of the transformations outside of the
+  // lambda subregions are applied with RunOutsideLambdas().
+  const auto runPerLambda = NumThreads_ > 1 || SkipUnchangedLambdas_;
+
+  std::vector<Transformation *> lambdaLocalTransformations;
+  for (const auto & optimization : transformations)
   {
+    if (runPerLambda && optimization->IsLambdaLocal()
+        && !AreStatisticsDemanded(*optimization, statisticsCollector))
+    {
+      lambdaLocalTransformations.push_back(optimization);
+
+      // The subsequent transformations must observe the part outside of the lambda subregions
+      if (optimization->HasPartOutsideLambdas())
+      {
+        RunOnLambdas(
+            rvsdgModule,
+            statisticsCollector,
+            lambdaLocalTransformations,
+            tracker,
+            statistics);
+        lambdaLocalTransformations.clear();
+      }
+      continue;
+    }
+
+    if (!lambdaLocalTransformations.empty())
+    {
+      RunOnLambdas(
+          rvsdgModule,
+          statisticsCollector,
+          lambdaLocalTransformations,
+          tracker,
+          statistics);
+      lambdaLocalTransformations.clear();
+    }
+
+    if (const auto group = dynamic_cast<const RepeatUntilFixpoint *>(optimization))
+    {
+      for (size_t n = 0; n < group->GetMaxIterations(); n++)
+      {
+        statistics.AddFixpointIteration();
+        tracker.PushChangeSet();
+        RunTransformations(
+            rvsdgModule,
+            statisticsCollector,
+            group->GetTransformations(),
+            tracker,
+            statistics);
+        if (!tracker.PopChangeSet())
+          break;
+      }
+      continue;
+    }
+
     optimization->Run(rvsdgModule, statisticsCollector);
   }
 
-  statistics->EndMeasuring(rvsdgModule.Rvsdg());
-  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  if (!lambdaLocalTransformations.empty())
+  {
+    RunOnLambdas(rvsdgModule, statisticsCollector, lambdaLocalTransformations, tracker, statistics);
+  }
+}
+
+/**
+ * Collects all lambda nodes of \p region, including the ones nested in other structural nodes
+ * such as phi nodes. The subregions of lambda nodes are not searched.
+ */
+static void
+CollectLambdaNodes(Region & region, std::vector<LambdaNode *> & lambdaNodes)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto lambdaNode = dynamic_cast<LambdaNode *>(&node))
+    {
+      lambdaNodes.push_back(lambdaNode);
+    }
+    else if (auto structuralNode = dynamic_cast<StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectLambdaNodes(*structuralNode->subregion(n), lambdaNodes);
+    }
+  }
+}
+
+void
+TransformationSequence::RunOnLambdas(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector,
+    const std::vector<Transformation *> & transformations,
+    ModificationTracker & tracker,
+    Statistics & statistics) const
+{
+  std::vector<LambdaNode *> lambdaNodes;
+  CollectLambdaNodes(rvsdgModule.Rvsdg().GetRootRegion(), lambdaNodes);
+
+  // The tracker is only accessed by the calling thread. Determine the clean lambda nodes upfront,
+  // and record the modifications of the worker threads once they are done.
+  const auto numTransformations = transformations.size();
+  std::vector<bool> isClean(lambdaNodes.size() * numTransformations, false);
+  if (SkipUnchangedLambdas_)
+  {
+    for (size_t n = 0; n < lambdaNodes.size(); n++)
+    {
+      for (size_t t = 0; t < numTransformations; t++)
+        isClean[n * numTransformations + t] = tracker.IsClean(*transformations[t], *lambdaNodes[n]);
+    }
+  }
+
+  enum class Outcome : uint8_t
+  {
+    Skipped,
+    Unchanged,
+    Modified
+  };
+  std::vector<Outcome> outcomes(lambdaNodes.size() * numTransformations, Outcome::Skipped);
+
+  std::atomic<size_t> nextLambdaNode(0);
+  std::mutex exceptionMutex;
+  std::exception_ptr exception;
+  auto processLambdaNodes = [&]()
+  {
+    // The notifiers are thread-local. Each thread tracks the modifications it performs itself.
+    ModificationTracker threadTracker;
+    for (size_t n = nextLambdaNode++; n < lambdaNodes.size(); n = nextLambdaNode++)
+    {
+      try
+      {
+        bool isModified = false;
+        // The transformations that were applied without effect since the last modification
+        std::vector<const Transformation *> unchangedBy;
+        for (size_t t = 0; t < numTransformations; t++)
+        {
+          const auto index = n * numTransformations + t;
+          const auto & transformation = transformations[t];
+          if (SkipUnchangedLambdas_
+              && ((!isModified && isClean[index])
+                  || std::find(unchangedBy.begin(), unchangedBy.end(), transformation)
+                         != unchangedBy.end()))
+          {
+            continue;
+          }
+
+          threadTracker.PushChangeSet();
+          transformation->RunOnLambda(*lambdaNodes[n]);
+          if (threadTracker.PopChangeSet())
+          {
+            isModified = true;
+            unchangedBy.clear();
+            outcomes[index] = Outcome::Modified;
+          }
+          else
+          {
+            unchangedBy.push_back(transformation);
+            outcomes[index] = Outcome::Unchanged;
+          }
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> guard(exceptionMutex);
+        if (!exception)
+          exception = std::current_exception();
+      }
+    }
+  };
+
+  // The calling thread processes lambda nodes as well
+  std::vector<std::thread> threads;
+  auto numThreads = std::min(NumThreads_, lambdaNodes.size());
+  for (size_t n = 1; n < numThreads; n++)
+    threads.emplace_back(processLambdaNodes);
+
+  processLambdaNodes();
+
+  for (auto & thread : threads)
+    thread.join();
+
+  if (exception)
+    std::rethrow_exception(exception);
+
+  size_t numSkippedLambdaRuns = 0;
+  for (size_t n = 0; n < lambdaNodes.size(); n++)
+  {
+    for (size_t t = 0; t < numTransformations; t++)
+    {
+      switch (outcomes[n * numTransformations + t])
+      {
+      case Outcome::Skipped:
+        numSkippedLambdaRuns++;
+        break;
+      case Outcome::Unchanged:
+        tracker.MarkClean(*transformations[t], *lambdaNodes[n]);
+        break;
+      case Outcome::Modified:
+        tracker.RecordModification(*lambdaNodes[n]);
+        break;
+      }
+    }
+  }
+  statistics.AddSkippedLambdaRuns(numSkippedLambdaRuns);
+
+  // The modifications outside of the lambda subregions are performed by the calling thread, and
+  // are therefore observed by the tracker.
+  for (const auto & transformation : transformations)
+  {
+    if (transformation->HasPartOutsideLambdas())
+      transformation->RunOutsideLambdas(rvsdgModule, statisticsCollector);
+  }
+}
+
+RepeatUntilFixpoint::~RepeatUntilFixpoint() noexcept = default;
+
+void
+RepeatUntilFixpoint::Run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  TransformationSequence::CreateAndRun(rvsdgModule, statisticsCollector, { this });
 }
 
 }
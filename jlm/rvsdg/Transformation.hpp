@@ -8,9 +8,13 @@
 
 #include <jlm/util/Statistics.hpp>
 
+#include <optional>
+
 namespace jlm::rvsdg
 {
 
+class LambdaNode;
+class ModificationTracker;
 class RvsdgModule;
 
 /**
@@ -49,10 +53,110 @@ public:
     util::StatisticsCollector statisticsCollector;
     Run(module, statisticsCollector);
   }
+
+  /**
+   * A transformation is lambda-local if it only inspects and modifies the subregion of a lambda
+   * node. It must neither change the inputs and outputs of the lambda node, nor inspect any nodes
+   * outside of its subregion. Lambda-local transformations can therefore be applied to distinct
+   * lambda nodes of an RVSDG concurrently.
+   *
+   * @return True if the transformation is lambda-local, otherwise false.
+   *
+   * @see RunOnLambda()
+   */
+  [[nodiscard]] virtual bool
+  IsLambdaLocal() const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * \brief Perform RVSDG transformation on the subregion of a single lambda node.
+   *
+   * This method is only invoked for lambda-local transformations. It can be invoked concurrently
+   * for distinct lambda nodes, and is therefore not permitted to modify the state of the
+   * transformation object.
+   *
+   * @param lambdaNode The lambda node whose subregion the transformation is performed on.
+   *
+   * @see IsLambdaLocal()
+   * @see HasPartOutsideLambdas()
+   */
+  virtual void
+  RunOnLambda(LambdaNode & lambdaNode) const;
+
+  /**
+   * A lambda-local transformation can have a part that lies outside of the subregions of lambda
+   * nodes, such as removing lambda nodes that became dead. This part is applied with
+   * RunOutsideLambdas() after RunOnLambda() was applied to all lambda nodes.
+   *
+   * @return True if the transformation has a part outside of the lambda subregions, otherwise
+   * false.
+   *
+   * @see RunOutsideLambdas()
+   */
+  [[nodiscard]] virtual bool
+  HasPartOutsideLambdas() const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * \brief Perform the part of a lambda-local transformation that lies outside of the subregions
+   * of lambda nodes.
+   *
+   * This method is only invoked for lambda-local transformations with a part outside of the lambda
+   * subregions. It is invoked once after RunOnLambda() was applied to all lambda nodes of
+   * \p module, and both methods together must have the same effect as Run().
+   *
+   * @param module RVSDG module the transformation is performed on.
+   * @param statisticsCollector Statistics collector for collecting transformation statistics.
+   *
+   * @see HasPartOutsideLambdas()
+   */
+  virtual void
+  RunOutsideLambdas(RvsdgModule & module, util::StatisticsCollector & statisticsCollector);
+
+  /**
+   * Lambda-local transformations only collect their statistics when they are applied with Run().
+   *
+   * @return The Id of the statistics collected by the transformation, if any.
+   */
+  [[nodiscard]] virtual std::optional<util::Statistics::Id>
+  GetStatisticsId() const noexcept
+  {
+    return std::nullopt;
+  }
 };
 
 /**
  * Sequentially applies a list of RVSDG transformations.
+ *
+ * If the sequence is created with more than one thread, consecutive lambda-local transformations
+ * are applied to all lambda nodes of the RVSDG in parallel. Each lambda node is processed by a
+ * single thread, which applies the consecutive lambda-local transformations to it in order. All
+ * other transformations are applied to the entire RVSDG module one after the other.
+ *
+ * If the sequence is created with \p skipUnchangedLambdas, lambda-local transformations are
+ * applied per lambda node as well, but a lambda node is skipped if the transformation was already
+ * applied to it without any net effect and the lambda node was not modified since. The
+ * modifications are tracked with a ModificationTracker. Skipping does not change the resulting
+ * RVSDG, as the parts outside of the lambda subregions are applied in the same way as in parallel
+ * mode.
+ *
+ * Transformations of a RepeatUntilFixpoint group are applied repeatedly until an iteration no
+ * longer has net modifications of the RVSDG, i.e., until the nodes created by an iteration are
+ * removed again and the diverted inputs are diverted back to their original origins.
+ *
+ * A lambda-local transformation with a part outside of the lambda subregions ends the consecutive
+ * lambda-local transformations. Its part outside of the lambda subregions is applied once all
+ * lambda nodes are processed, such that the transformations are applied in the same order as in
+ * sequential mode. The resulting RVSDG is therefore independent of the number of threads.
+ *
+ * \note Lambda-local transformations only collect their statistics when applied with Run(). A
+ * lambda-local transformation whose statistics are demanded is therefore applied with Run().
+ *
+ * @see Transformation::IsLambdaLocal()
  */
 class TransformationSequence final : public Transformation
 {
@@ -61,8 +165,13 @@ class TransformationSequence final : public Transformation
 public:
   ~TransformationSequence() noexcept override;
 
-  explicit TransformationSequence(std::vector<Transformation *> transformations)
-      : Transformations_(std::move(transformations))
+  explicit TransformationSequence(
+      std::vector<Transformation *> transformations,
+      size_t numThreads = 1,
+      bool skipUnchangedLambdas = false)
+      : NumThreads_(numThreads),
+        SkipUnchangedLambdas_(skipUnchangedLambdas),
+        Transformations_(std::move(transformations))
   {}
 
   /**
@@ -80,18 +189,89 @@ public:
    * @param rvsdgModule RVSDG module the transformation is performed on.
    * @param statisticsCollector Statistics collector for collecting transformation statistics.
    * @param transformations The transformations that are sequentially applied to \p rvsdgModule.
+   * @param numThreads The number of threads used for applying lambda-local transformations.
+   * @param skipUnchangedLambdas Determines whether unchanged lambda nodes are skipped.
    */
   static void
   CreateAndRun(
       RvsdgModule & rvsdgModule,
       util::StatisticsCollector & statisticsCollector,
-      std::vector<Transformation *> transformations)
+      std::vector<Transformation *> transformations,
+      size_t numThreads = 1,
+      bool skipUnchangedLambdas = false)
   {
-    TransformationSequence sequentialApplication(std::move(transformations));
+    TransformationSequence sequentialApplication(
+        std::move(transformations),
+        numThreads,
+        skipUnchangedLambdas);
     sequentialApplication.Run(rvsdgModule, statisticsCollector);
   }
 
 private:
+  /**
+   * Applies \p transformations to \p rvsdgModule in order, and records their modifications in
+   * \p tracker.
+   */
+  void
+  RunTransformations(
+      RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector,
+      const std::vector<Transformation *> & transformations,
+      ModificationTracker & tracker,
+      Statistics & statistics) const;
+
+  /**
+   * Applies the lambda-local \p transformations to all lambda nodes of \p rvsdgModule using
+   * NumThreads_ threads, and afterwards applies their parts outside of the lambda subregions.
+   */
+  void
+  RunOnLambdas(
+      RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector,
+      const std::vector<Transformation *> & transformations,
+      ModificationTracker & tracker,
+      Statistics & statistics) const;
+
+  size_t NumThreads_;
+  bool SkipUnchangedLambdas_;
+  std::vector<Transformation *> Transformations_;
+};
+
+/**
+ * A group of RVSDG transformations that is applied repeatedly until the RVSDG reaches a fixpoint,
+ * i.e., until an application of all transformations in the group no longer modifies the RVSDG, or
+ * until a maximum number of iterations is reached.
+ *
+ * A group can be nested in a TransformationSequence, which shares its modification tracking with
+ * the group.
+ */
+class RepeatUntilFixpoint final : public Transformation
+{
+public:
+  ~RepeatUntilFixpoint() noexcept override;
+
+  RepeatUntilFixpoint(std::vector<Transformation *> transformations, size_t maxIterations)
+      : MaxIterations_(maxIterations),
+        Transformations_(std::move(transformations))
+  {}
+
+  [[nodiscard]] size_t
+  GetMaxIterations() const noexcept
+  {
+    return MaxIterations_;
+  }
+
+  [[nodiscard]] const std::vector<Transformation *> &
+  GetTransformations() const noexcept
+  {
+    return Transformations_;
+  }
+
+  void
+  Run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+private:
+  size_t MaxIterations_;
   std::vector<Transformation *> Transformations_;
 };
 
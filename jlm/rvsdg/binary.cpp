@@ -11,6 +11,7 @@
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Hash.hpp>
 
 #include <deque>
 
@@ -134,6 +135,15 @@ FlattenedBinaryOperation::operator==(const Operation & other) const noexcept
   return op && op->bin_operation() == bin_operation() && op->narguments() == narguments();
 }
 
+std::size_t
+FlattenedBinaryOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(FlattenedBinaryOperation).hash_code(),
+      bin_operation().ComputeHash(),
+      narguments());
+}
+
 std::string
 FlattenedBinaryOperation::debug_string() const
 {
@@ -203,14 +213,14 @@ FlattenedBinaryOperation::reduce(
 {
   JLM_ASSERT(operands.size() > 1);
 
-  static std::unordered_map<
+  static const std::unordered_map<
       FlattenedBinaryOperation::reduction,
       std::function<
           jlm::rvsdg::output *(const BinaryOperation &, const std::vector<jlm::rvsdg::output *> &)>>
       map({ { reduction::linear, reduce_linear }, { reduction::parallel, reduce_parallel } });
 
   JLM_ASSERT(map.find(reduction) != map.end());
-  return map[reduction](bin_operation(), operands);
+  return map.at(reduction)(bin_operation(), operands);
 }
 
 void
@@ -125,6 +125,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
@@ -24,6 +24,13 @@ MakeBitUnaryOperation<reduction, name>::operator==(const Operation & other) cons
   return op && op->type() == type();
 }
 
+template<typename reduction, const char * name>
+std::size_t
+MakeBitUnaryOperation<reduction, name>::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 template<typename reduction, const char * name>
 bitvalue_repr
 MakeBitUnaryOperation<reduction, name>::reduce_constant(const bitvalue_repr & arg) const
@@ -64,6 +71,13 @@ MakeBitBinaryOperation<reduction, name, opflags>::operator==(const Operation & o
   return op && op->type() == type();
 }
 
+template<typename reduction, const char * name, enum BinaryOperation::flags opflags>
+std::size_t
+MakeBitBinaryOperation<reduction, name, opflags>::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 template<typename reduction, const char * name, enum BinaryOperation::flags opflags>
 bitvalue_repr
 MakeBitBinaryOperation<reduction, name, opflags>::reduce_constants(
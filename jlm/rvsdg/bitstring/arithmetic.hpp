@@ -25,6 +25,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   bitvalue_repr
   reduce_constant(const bitvalue_repr & arg) const override;
 
@@ -57,6 +60,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   enum BinaryOperation::flags
   flags() const noexcept override;
 
@@ -24,6 +24,13 @@ MakeBitComparisonOperation<reduction, name, opflags>::operator==(
   return op && op->type() == type();
 }
 
+template<typename reduction, const char * name, enum BinaryOperation::flags opflags>
+std::size_t
+MakeBitComparisonOperation<reduction, name, opflags>::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 template<typename reduction, const char * name, enum BinaryOperation::flags opflags>
 compare_result
 MakeBitComparisonOperation<reduction, name, opflags>::reduce_constants(
@@ -26,6 +26,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   enum BinaryOperation::flags
   flags() const noexcept override;
 
@@ -53,6 +53,12 @@ bitconcat_op::operator==(const Operation & other) const noexcept
   return true;
 }
 
+std::size_t
+bitconcat_op::ComputeHash() const noexcept
+{
+  return ComputeSignatureHash();
+}
+
 binop_reduction_path_t
 bitconcat_op::can_reduce_operand_pair(
     const jlm::rvsdg::output * arg1,
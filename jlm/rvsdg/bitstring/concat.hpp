@@ -28,6 +28,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual binop_reduction_path_t
   can_reduce_operand_pair(const jlm::rvsdg::output * arg1, const jlm::rvsdg::output * arg2)
       const noexcept override;
@@ -8,6 +8,7 @@
 #include <jlm/rvsdg/bitstring/concat.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/bitstring/slice.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -22,6 +23,12 @@ bitslice_op::operator==(const Operation & other) const noexcept
   return op && op->low() == low() && op->high() == high() && op->argument(0) == argument(0);
 }
 
+std::size_t
+bitslice_op::ComputeHash() const noexcept
+{
+  return util::CombineHashes(ComputeSignatureHash(), low());
+}
+
 std::string
 bitslice_op::debug_string() const
 {
@@ -68,8 +75,7 @@ bitslice_op::reduce_operand(unop_reduction_path_t path, jlm::rvsdg::output * arg
   if (path == unop_reduction_constant)
   {
     auto op = static_cast<const bitconstant_op &>(node->GetOperation());
-    std::string s(&op.value()[0] + low(), high() - low());
-    return create_bitconstant(arg->region(), s.c_str());
+    return create_bitconstant(arg->region(), op.value().slice(low(), high()));
   }
 
   if (path == unop_reduction_distribute)
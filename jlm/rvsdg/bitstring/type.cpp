@@ -64,7 +64,7 @@ bittype::Create(std::size_t nbits)
   }
   else
   {
-    return std::make_shared<bittype>(nbits);
+    return TypeTable::Intern(std::make_shared<const bittype>(nbits));
   }
 }
 
@@ -11,77 +11,534 @@
 namespace jlm::rvsdg
 {
 
-uint64_t
-bitvalue_repr::to_uint() const
+/**
+ * Multiplies two 64-bit words.
+ *
+ * @return The low word of the product. The high word is stored in \p high.
+ */
+static uint64_t
+MultiplyWords(uint64_t a, uint64_t b, uint64_t & high) noexcept
 {
-  size_t limit = std::min(nbits(), size_t(64));
-  /* bits beyond 64 must be zero, else value is not representable as uint64_t */
-  for (size_t n = limit; n < nbits(); ++n)
+  const uint64_t mask = 0xFFFFFFFF;
+  uint64_t a0 = a & mask, a1 = a >> 32;
+  uint64_t b0 = b & mask, b1 = b >> 32;
+
+  uint64_t p00 = a0 * b0;
+  uint64_t p01 = a0 * b1;
+  uint64_t p10 = a1 * b0;
+  uint64_t p11 = a1 * b1;
+
+  uint64_t middle = (p00 >> 32) + (p01 & mask) + (p10 & mask);
+  high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+  return (middle << 32) | (p00 & mask);
+}
+
+bitvalue_repr::bitvalue_repr(size_t nbits, int64_t value)
+    : bitvalue_repr(Zero(nbits == 0 ? 1 : nbits))
+{
+  if (nbits == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
+    throw jlm::util::error("Value cannot be represented with the given number of bits.");
+
+  auto values = ValueWords();
+  values[0] = static_cast<uint64_t>(value);
+  for (size_t n = 1; n < NumWords(); n++)
+    values[n] = value < 0 ? ~uint64_t(0) : 0;
+
+  ClearUnusedBits();
+}
+
+bitvalue_repr::bitvalue_repr(const char * s)
+    : bitvalue_repr(Zero(strlen(s) == 0 ? 1 : strlen(s)))
+{
+  if (strlen(s) == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  for (size_t n = 0; n < nbits(); n++)
   {
-    if (data_[n] != '0')
-      throw std::range_error("Bit constant value exceeds uint64 range");
+    if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
+      throw jlm::util::error("Not a valid bit.");
+    SetBit(n, s[n]);
   }
+}
+
+bitvalue_repr
+bitvalue_repr::repeat(size_t nbits, char bit)
+{
+  if (nbits == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  if (bit != '0' && bit != '1' && bit != 'X' && bit != 'D')
+    throw jlm::util::error("Not a valid bit.");
 
-  uint64_t result = 0;
-  uint64_t pos_value = 1;
-  for (size_t n = 0; n < limit; ++n)
+  auto result = Zero(nbits);
+  uint64_t value = (bit == '1' || bit == 'D') ? ~uint64_t(0) : 0;
+  uint64_t unknown = (bit == 'X' || bit == 'D') ? ~uint64_t(0) : 0;
+  for (size_t n = 0; n < result.NumWords(); n++)
   {
-    switch (data_[n])
-    {
-    case '0':
-    {
-      break;
-    }
-    case '1':
-    {
-      result |= pos_value;
-      break;
-    }
-    default:
+    result.ValueWords()[n] = value;
+    result.UnknownWords()[n] = unknown;
+  }
+  result.ClearUnusedBits();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::Zero(size_t nbits)
+{
+  bitvalue_repr result;
+  result.NumBits_ = nbits;
+  if (nbits > 64)
+    result.Words_.assign(2 * result.NumWords(), 0);
+
+  return result;
+}
+
+void
+bitvalue_repr::SetBit(size_t n, char bit) noexcept
+{
+  JLM_ASSERT(n < nbits());
+  auto mask = uint64_t(1) << (n % 64);
+  auto & value = ValueWords()[n / 64];
+  auto & unknown = UnknownWords()[n / 64];
+
+  value = (bit == '1' || bit == 'D') ? value | mask : value & ~mask;
+  unknown = (bit == 'X' || bit == 'D') ? unknown | mask : unknown & ~mask;
+}
+
+uint64_t
+bitvalue_repr::ExtractWord(const uint64_t * words, size_t numWords, size_t offset) noexcept
+{
+  auto index = offset / 64;
+  auto shift = offset % 64;
+
+  uint64_t low = index < numWords ? words[index] >> shift : 0;
+  if (shift == 0)
+    return low;
+
+  uint64_t high = index + 1 < numWords ? words[index + 1] << (64 - shift) : 0;
+  return low | high;
+}
+
+void
+bitvalue_repr::InsertBits(size_t offset, const bitvalue_repr & other) noexcept
+{
+  JLM_ASSERT(offset + other.nbits() <= nbits());
+  auto shift = offset % 64;
+  for (size_t n = 0; n < other.NumWords(); n++)
+  {
+    auto index = offset / 64 + n;
+    ValueWords()[index] |= other.ValueWords()[n] << shift;
+    UnknownWords()[index] |= other.UnknownWords()[n] << shift;
+    if (shift != 0 && index + 1 < NumWords())
     {
-      throw std::range_error("Undetermined bit constant");
-    }
+      ValueWords()[index + 1] |= other.ValueWords()[n] >> (64 - shift);
+      UnknownWords()[index + 1] |= other.UnknownWords()[n] >> (64 - shift);
     }
-    pos_value = pos_value << 1;
   }
+}
+
+void
+bitvalue_repr::Append(const bitvalue_repr & other)
+{
+  auto result = Zero(nbits() + other.nbits());
+  result.InsertBits(0, *this);
+  result.InsertBits(nbits(), other);
+  *this = std::move(result);
+}
+
+bitvalue_repr
+bitvalue_repr::slice(size_t low, size_t high) const
+{
+  if (high <= low || high > nbits())
+  {
+    throw jlm::util::error("Slice is out of bound.");
+  }
+
+  auto result = Zero(high - low);
+  for (size_t n = 0; n < result.NumWords(); n++)
+  {
+    result.ValueWords()[n] = ExtractWord(ValueWords(), NumWords(), low + 64 * n);
+    result.UnknownWords()[n] = ExtractWord(UnknownWords(), NumWords(), low + 64 * n);
+  }
+  result.ClearUnusedBits();
+
   return result;
 }
 
+bitvalue_repr
+bitvalue_repr::FlipSign() const
+{
+  bitvalue_repr result(*this);
+  result.ValueWords()[(nbits() - 1) / 64] ^= uint64_t(1) << ((nbits() - 1) % 64);
+  return result;
+}
+
+int
+bitvalue_repr::CompareKnown(const bitvalue_repr & other) const noexcept
+{
+  JLM_ASSERT(is_known() && other.is_known() && nbits() == other.nbits());
+  for (size_t n = NumWords(); n > 0; n--)
+  {
+    auto a = ValueWords()[n - 1];
+    auto b = other.ValueWords()[n - 1];
+    if (a != b)
+      return a < b ? -1 : 1;
+  }
+
+  return 0;
+}
+
+uint64_t
+bitvalue_repr::to_uint() const
+{
+  /* bits beyond 64 must be zero, else value is not representable as uint64_t */
+  for (size_t n = 1; n < NumWords(); ++n)
+  {
+    if (ValueWords()[n] != 0 || UnknownWords()[n] != 0)
+      throw std::range_error("Bit constant value exceeds uint64 range");
+  }
+
+  if (UnknownWords()[0] != 0)
+    throw std::range_error("Undetermined bit constant");
+
+  return ValueWords()[0];
+}
+
 int64_t
 bitvalue_repr::to_int() const
 {
   /* all bits from 63 on must be identical, else value is not representable as int64_t */
-  char sign_bit = data_[nbits() - 1];
-  size_t limit = std::min(nbits(), size_t(63));
-  for (size_t n = limit; n < nbits(); ++n)
+  char sign_bit = sign();
+  for (size_t n = std::min(nbits(), size_t(63)); n < nbits(); ++n)
   {
-    if (data_[n] != sign_bit)
+    if ((*this)[n] != sign_bit)
       throw std::range_error("Bit constant value exceeds int64 range");
   }
 
-  int64_t result = 0;
-  uint64_t pos_value = 1;
-  for (size_t n = 0; n < 64; ++n)
+  if (UnknownWords()[0] != 0)
+    throw std::range_error("Undetermined bit constant");
+
+  auto value = ValueWords()[0];
+  if (nbits() < 64 && sign_bit == '1')
+    value |= ~TopWordMask();
+
+  return static_cast<int64_t>(value);
+}
+
+char
+bitvalue_repr::ult(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "ult");
+
+  if (is_known() && other.is_known())
+    return CompareKnown(other) < 0 ? '1' : '0';
+
+  char v = land(lnot((*this)[0]), other[0]);
+  for (size_t n = 1; n < nbits(); n++)
+    v = land(lor(lnot((*this)[n]), other[n]), lor(land(lnot((*this)[n]), other[n]), v));
+
+  return v;
+}
+
+char
+bitvalue_repr::slt(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "slt");
+
+  if (is_known() && other.is_known())
+    return FlipSign().CompareKnown(other.FlipSign()) < 0 ? '1' : '0';
+
+  bitvalue_repr t1(*this), t2(other);
+  t1.SetBit(t1.nbits() - 1, lnot(t1.sign()));
+  t2.SetBit(t2.nbits() - 1, lnot(t2.sign()));
+  return t1.ult(t2);
+}
+
+char
+bitvalue_repr::ule(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "ule");
+
+  if (is_known() && other.is_known())
+    return CompareKnown(other) <= 0 ? '1' : '0';
+
+  char v = '1';
+  for (size_t n = 0; n < nbits(); n++)
+    v = land(land(lor(lnot((*this)[n]), other[n]), lor(lnot((*this)[n]), v)), lor(v, other[n]));
+
+  return v;
+}
+
+char
+bitvalue_repr::sle(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "sle");
+
+  if (is_known() && other.is_known())
+    return FlipSign().CompareKnown(other.FlipSign()) <= 0 ? '1' : '0';
+
+  bitvalue_repr t1(*this), t2(other);
+  t1.SetBit(t1.nbits() - 1, lnot(t1.sign()));
+  t2.SetBit(t2.nbits() - 1, lnot(t2.sign()));
+  return t1.ule(t2);
+}
+
+char
+bitvalue_repr::ne(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "ne");
+
+  if (is_known() && other.is_known())
+    return CompareKnown(other) != 0 ? '1' : '0';
+
+  char v = '0';
+  for (size_t n = 0; n < nbits(); n++)
+    v = lor(v, lxor((*this)[n], other[n]));
+  return v;
+}
+
+bitvalue_repr
+bitvalue_repr::add(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "add");
+
+  if (is_known() && other.is_known())
   {
-    switch (n < nbits() ? data_[n] : sign_bit)
+    auto sum = Zero(nbits());
+    uint64_t c = 0;
+    for (size_t n = 0; n < NumWords(); n++)
     {
-    case '0':
+      auto a = ValueWords()[n];
+      auto s = a + other.ValueWords()[n];
+      auto s2 = s + c;
+      c = (s < a) | (s2 < s);
+      sum.ValueWords()[n] = s2;
+    }
+    sum.ClearUnusedBits();
+
+    return sum;
+  }
+
+  char c = '0';
+  bitvalue_repr sum = repeat(nbits(), 'X');
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    sum.SetBit(n, add((*this)[n], other[n], c));
+    c = carry((*this)[n], other[n], c);
+  }
+
+  return sum;
+}
+
+bitvalue_repr
+bitvalue_repr::land(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "land");
+
+  auto result = Zero(nbits());
+  for (size_t n = 0; n < NumWords(); n++)
+  {
+    auto va = ValueWords()[n], ua = UnknownWords()[n];
+    auto vb = other.ValueWords()[n], ub = other.UnknownWords()[n];
+
+    auto isZero = (~ua & ~va) | (~ub & ~vb);
+    auto isUndefined = ~isZero & ((ua & ~va) | (ub & ~vb));
+    auto isDefined = ~isZero & ~isUndefined & (ua | ub);
+    auto isOne = ~isZero & ~isUndefined & ~isDefined;
+
+    result.ValueWords()[n] = isOne | isDefined;
+    result.UnknownWords()[n] = isUndefined | isDefined;
+  }
+  result.ClearUnusedBits();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::lor(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "lor");
+
+  auto result = Zero(nbits());
+  for (size_t n = 0; n < NumWords(); n++)
+  {
+    auto va = ValueWords()[n], ua = UnknownWords()[n];
+    auto vb = other.ValueWords()[n], ub = other.UnknownWords()[n];
+
+    auto isOne = (~ua & va) | (~ub & vb);
+    auto isUndefined = ~isOne & ((ua & ~va) | (ub & ~vb));
+    auto isDefined = ~isOne & ~isUndefined & (ua | ub);
+
+    result.ValueWords()[n] = isOne | isDefined;
+    result.UnknownWords()[n] = isUndefined | isDefined;
+  }
+  result.ClearUnusedBits();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::lxor(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "lxor");
+
+  auto result = Zero(nbits());
+  for (size_t n = 0; n < NumWords(); n++)
+  {
+    auto va = ValueWords()[n], ua = UnknownWords()[n];
+    auto vb = other.ValueWords()[n], ub = other.UnknownWords()[n];
+
+    auto isUndefined = (ua & ~va) | (ub & ~vb);
+    auto isDefined = ~isUndefined & (ua | ub);
+    auto isOne = ~isUndefined & ~isDefined & (va ^ vb);
+
+    result.ValueWords()[n] = isOne | isDefined;
+    result.UnknownWords()[n] = isUndefined | isDefined;
+  }
+  result.ClearUnusedBits();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::neg() const
+{
+  if (is_known())
+  {
+    auto result = Zero(nbits());
+    uint64_t c = 1;
+    for (size_t n = 0; n < NumWords(); n++)
     {
-      break;
+      auto s = ~ValueWords()[n] + c;
+      c = c && s == 0;
+      result.ValueWords()[n] = s;
     }
-    case '1':
+    result.ClearUnusedBits();
+
+    return result;
+  }
+
+  char c = '1';
+  bitvalue_repr result = repeat(nbits(), 'X');
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    char tmp = lxor((*this)[n], '1');
+    result.SetBit(n, add(tmp, '0', c));
+    c = carry(tmp, '0', c);
+  }
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::sub(const bitvalue_repr & other) const
+{
+  return add(other.neg());
+}
+
+void
+bitvalue_repr::udiv(
+    const bitvalue_repr & divisor,
+    bitvalue_repr & quotient,
+    bitvalue_repr & remainder) const
+{
+  JLM_ASSERT(quotient == 0);
+  JLM_ASSERT(remainder == 0);
+
+  if (divisor.nbits() != nbits())
+    throw jlm::util::error(
+        jlm::util::strfmt("Unequal number of bits in udiv, ", divisor.nbits(), " != ", nbits()));
+
+  /*
+    FIXME: This should check whether divisor is zero, not whether nbits() is zero.
+  */
+  if (divisor.nbits() == 0)
+    throw jlm::util::error("Division by zero.");
+
+  if (nbits() <= 64 && is_known() && divisor.is_known())
+  {
+    auto dividendValue = ValueWords()[0];
+    auto divisorValue = divisor.ValueWords()[0];
+
+    // A zero divisor yields a quotient of all ones and the dividend as remainder, which is what
+    // the bit-serial long division computes.
+    quotient.ValueWords()[0] = divisorValue != 0 ? dividendValue / divisorValue : TopWordMask();
+    remainder.ValueWords()[0] = divisorValue != 0 ? dividendValue % divisorValue : dividendValue;
+    return;
+  }
+
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    remainder = remainder.shl(1);
+    remainder.SetBit(0, (*this)[nbits() - n - 1]);
+    if (remainder.uge(divisor) == '1')
     {
-      result |= pos_value;
-      break;
+      remainder = remainder.sub(divisor);
+      quotient.SetBit(nbits() - n - 1, '1');
     }
-    default:
+  }
+}
+
+void
+bitvalue_repr::mul(
+    const bitvalue_repr & factor1,
+    const bitvalue_repr & factor2,
+    bitvalue_repr & product)
+{
+  JLM_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
+
+  for (size_t i = 0; i < factor1.nbits(); i++)
+  {
+    char c = '0';
+    for (size_t j = 0; j < factor2.nbits(); j++)
     {
-      throw std::range_error("Undetermined bit constant");
+      char s = land(factor1[i], factor2[j]);
+      char nc = carry(s, product[i + j], c);
+      product.SetBit(i + j, add(s, product[i + j], c));
+      c = nc;
     }
+  }
+}
+
+bitvalue_repr
+bitvalue_repr::mul(const bitvalue_repr & other) const
+{
+  CheckNumBits(other, "mul");
+
+  if (is_known() && other.is_known())
+  {
+    // Schoolbook multiplication on words, truncated to the width of the factors
+    auto product = Zero(nbits());
+    auto numWords = NumWords();
+    for (size_t i = 0; i < numWords; i++)
+    {
+      uint64_t c = 0;
+      for (size_t j = 0; i + j < numWords; j++)
+      {
+        uint64_t high = 0;
+        auto low = MultiplyWords(ValueWords()[i], other.ValueWords()[j], high);
+
+        auto & word = product.ValueWords()[i + j];
+        auto sum = word + low;
+        high += sum < word;
+        auto sum2 = sum + c;
+        high += sum2 < sum;
+        word = sum2;
+        c = high;
+      }
     }
-    pos_value = pos_value << 1;
+    product.ClearUnusedBits();
+
+    return product;
   }
-  return result;
+
+  auto product = Zero(2 * nbits());
+  mul(*this, other, product);
+  return product.slice(0, nbits());
 }
 
 }
@@ -8,8 +8,10 @@
 #define JLM_RVSDG_BITSTRING_VALUE_REPRESENTATION_HPP
 
 #include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/strfmt.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <string>
@@ -25,56 +27,141 @@ namespace jlm::rvsdg
   - '1' : one
   - 'D' : defined, but unknown
   - 'X' : undefined and unknown
+
+ The bits are stored packed in two planes of 64-bit words. A bit is unknown
+ if it is set in the unknown plane. For known bits, the value plane holds the
+ value of the bit. For unknown bits, it distinguishes between 'D' (set) and
+ 'X' (cleared). Values with up to 64 bits are stored inline without any heap
+ allocation.
+
+ All operations work on entire words if the operands are fully known, and fall
+ back to a bit-serial evaluation of the four-valued logic otherwise.
 */
 
 class bitvalue_repr
 {
 public:
-  inline bitvalue_repr(size_t nbits, int64_t value)
+  bitvalue_repr(size_t nbits, int64_t value);
+
+  bitvalue_repr(const char * s);
+
+  bitvalue_repr(const bitvalue_repr & other) = default;
+
+  bitvalue_repr(bitvalue_repr && other) noexcept = default;
+
+  static bitvalue_repr
+  repeat(size_t nbits, char bit);
+
+private:
+  /**
+   * Creates a bit string of \p nbits known zero bits.
+   */
+  static bitvalue_repr
+  Zero(size_t nbits);
+
+  bitvalue_repr() noexcept
+      : NumBits_(0),
+        InlineWords_{ 0, 0 }
+  {}
+
+  [[nodiscard]] size_t
+  NumWords() const noexcept
   {
-    if (nbits == 0)
-      throw jlm::util::error("Number of bits is zero.");
+    return (NumBits_ + 63) / 64;
+  }
 
-    if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
-      throw jlm::util::error("Value cannot be represented with the given number of bits.");
+  [[nodiscard]] uint64_t *
+  ValueWords() noexcept
+  {
+    return NumBits_ <= 64 ? &InlineWords_[0] : Words_.data();
+  }
 
-    for (size_t n = 0; n < nbits; ++n)
-    {
-      data_.push_back('0' + (value & 1));
-      value = value >> 1;
-    }
+  [[nodiscard]] const uint64_t *
+  ValueWords() const noexcept
+  {
+    return NumBits_ <= 64 ? &InlineWords_[0] : Words_.data();
   }
 
-  inline bitvalue_repr(const char * s)
+  [[nodiscard]] uint64_t *
+  UnknownWords() noexcept
   {
-    if (strlen(s) == 0)
-      throw jlm::util::error("Number of bits is zero.");
+    return NumBits_ <= 64 ? &InlineWords_[1] : Words_.data() + NumWords();
+  }
 
-    for (size_t n = 0; n < strlen(s); n++)
-    {
-      if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
-        throw jlm::util::error("Not a valid bit.");
-      data_.push_back(s[n]);
-    }
+  [[nodiscard]] const uint64_t *
+  UnknownWords() const noexcept
+  {
+    return NumBits_ <= 64 ? &InlineWords_[1] : Words_.data() + NumWords();
   }
 
-  bitvalue_repr(const bitvalue_repr & other)
-      : data_(other.data_)
-  {}
+  /**
+   * @return A mask of the valid bits in the most significant word.
+   */
+  [[nodiscard]] uint64_t
+  TopWordMask() const noexcept
+  {
+    auto numTopBits = NumBits_ % 64;
+    return numTopBits == 0 ? ~uint64_t(0) : (uint64_t(1) << numTopBits) - 1;
+  }
 
-  bitvalue_repr(bitvalue_repr && other)
-      : data_(std::move(other.data_))
-  {}
+  /**
+   * Clears the bits beyond nbits() in the most significant word of both planes.
+   */
+  void
+  ClearUnusedBits() noexcept
+  {
+    ValueWords()[NumWords() - 1] &= TopWordMask();
+    UnknownWords()[NumWords() - 1] &= TopWordMask();
+  }
 
-  inline static bitvalue_repr
-  repeat(size_t nbits, char bit)
+  void
+  SetBit(size_t n, char bit) noexcept;
+
+  /**
+   * Places the bits of \p other at bit offset \p offset. The bits at these positions must be
+   * known zeros.
+   */
+  void
+  InsertBits(size_t offset, const bitvalue_repr & other) noexcept;
+
+  /**
+   * @return The bits [offset, offset + 64) of \p words, where bits beyond \p numWords words are
+   * zero.
+   */
+  static uint64_t
+  ExtractWord(const uint64_t * words, size_t numWords, size_t offset) noexcept;
+
+  /**
+   * @return The bits in the value plane with the sign bit flipped. This maps signed order to
+   * unsigned order.
+   */
+  [[nodiscard]] bitvalue_repr
+  FlipSign() const;
+
+  /**
+   * Compares two fully known bit strings of equal width as unsigned integers.
+   *
+   * @return A negative value, zero, or a positive value if this is less than, equal to, or
+   * greater than \p other.
+   */
+  [[nodiscard]] int
+  CompareKnown(const bitvalue_repr & other) const noexcept;
+
+  void
+  CheckNumBits(const bitvalue_repr & other, const char * operation) const
   {
-    return bitvalue_repr(std::string(nbits, bit).c_str());
+    if (nbits() != other.nbits())
+      throw jlm::util::error(jlm::util::strfmt(
+          "Unequal number of bits in ",
+          operation,
+          ", ",
+          nbits(),
+          " != ",
+          other.nbits()));
   }
 
-private:
-  inline char
-  lor(char a, char b) const noexcept
+  static inline char
+  lor(char a, char b) noexcept
   {
     switch (a)
     {
@@ -97,8 +184,8 @@ private:
     }
   }
 
-  inline char
-  lxor(char a, char b) const noexcept
+  static inline char
+  lxor(char a, char b) noexcept
   {
     switch (a)
     {
@@ -121,14 +208,14 @@ private:
     }
   }
 
-  inline char
-  lnot(char a) const noexcept
+  static inline char
+  lnot(char a) noexcept
   {
     return lxor('1', a);
   }
 
-  inline char
-  land(char a, char b) const noexcept
+  static inline char
+  land(char a, char b) noexcept
   {
     switch (a)
     {
@@ -151,103 +238,54 @@ private:
     }
   }
 
-  inline char
-  carry(char a, char b, char c) const noexcept
+  static inline char
+  carry(char a, char b, char c) noexcept
   {
     return lor(lor(land(a, b), land(a, c)), land(b, c));
   }
 
-  inline char
-  add(char a, char b, char c) const noexcept
+  static inline char
+  add(char a, char b, char c) noexcept
   {
     return lxor(lxor(a, b), c);
   }
 
-  inline void
-  udiv(const bitvalue_repr & divisor, bitvalue_repr & quotient, bitvalue_repr & remainder) const
-  {
-    JLM_ASSERT(quotient == 0);
-    JLM_ASSERT(remainder == 0);
-
-    if (divisor.nbits() != nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in udiv, ", divisor.nbits(), " != ", nbits()));
-
-    /*
-      FIXME: This should check whether divisor is zero, not whether nbits() is zero.
-    */
-    if (divisor.nbits() == 0)
-      throw jlm::util::error("Division by zero.");
-
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      remainder = remainder.shl(1);
-      remainder[0] = data_[nbits() - n - 1];
-      if (remainder.uge(divisor) == '1')
-      {
-        remainder = remainder.sub(divisor);
-        quotient[nbits() - n - 1] = '1';
-      }
-    }
-  }
+  void
+  udiv(const bitvalue_repr & divisor, bitvalue_repr & quotient, bitvalue_repr & remainder) const;
 
-  inline void
-  mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product) const
-  {
-    JLM_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
-
-    for (size_t i = 0; i < factor1.nbits(); i++)
-    {
-      char c = '0';
-      for (size_t j = 0; j < factor2.nbits(); j++)
-      {
-        char s = land(factor1[i], factor2[j]);
-        char nc = carry(s, product[i + j], c);
-        product[i + j] = add(s, product[i + j], c);
-        c = nc;
-      }
-    }
-  }
+  static void
+  mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product);
 
 public:
   /*
     FIXME: add <, <=, >, >= operator for uint64_t and int64_t
   */
-  inline bitvalue_repr &
-  operator=(const bitvalue_repr & other)
-  {
-    data_ = other.data_;
-    return *this;
-  }
-
   bitvalue_repr &
-  operator=(bitvalue_repr && other)
-  {
-    if (this == &other)
-      return *this;
+  operator=(const bitvalue_repr & other) = default;
 
-    data_ = std::move(other.data_);
-    return *this;
-  }
+  bitvalue_repr &
+  operator=(bitvalue_repr && other) noexcept = default;
 
-  inline char &
-  operator[](size_t n)
+  inline char
+  operator[](size_t n) const noexcept
   {
     JLM_ASSERT(n < nbits());
-    return data_[n];
-  }
+    auto value = (ValueWords()[n / 64] >> (n % 64)) & 1;
+    auto unknown = (UnknownWords()[n / 64] >> (n % 64)) & 1;
+    if (unknown)
+      return value ? 'D' : 'X';
 
-  inline const char &
-  operator[](size_t n) const
-  {
-    JLM_ASSERT(n < nbits());
-    return data_[n];
+    return value ? '1' : '0';
   }
 
   inline bool
   operator==(const bitvalue_repr & other) const noexcept
   {
-    return data_ == other.data_;
+    if (nbits() != other.nbits())
+      return false;
+
+    return std::equal(ValueWords(), ValueWords() + NumWords(), other.ValueWords())
+        && std::equal(UnknownWords(), UnknownWords() + NumWords(), other.UnknownWords());
   }
 
   inline bool
@@ -256,6 +294,21 @@ public:
     return !(*this == other);
   }
 
+  /**
+   * Computes a hash value for the bit string.
+   *
+   * @return A hash value.
+   */
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept
+  {
+    std::size_t seed = std::hash<size_t>()(NumBits_);
+    for (size_t n = 0; n < NumWords(); n++)
+      util::CombineHashesWithSeed(seed, ValueWords()[n], UnknownWords()[n]);
+
+    return seed;
+  }
+
   inline bool
   operator==(int64_t value) const
   {
@@ -276,7 +329,7 @@ public:
 
     for (size_t n = 0; n < other.size(); n++)
     {
-      if (data_[n] != other[n])
+      if ((*this)[n] != other[n])
         return false;
     }
 
@@ -292,15 +345,15 @@ public:
   inline char
   sign() const noexcept
   {
-    return data_[nbits() - 1];
+    return (*this)[nbits() - 1];
   }
 
   inline bool
   is_defined() const noexcept
   {
-    for (auto bit : data_)
+    for (size_t n = 0; n < NumWords(); n++)
     {
-      if (bit == 'X')
+      if (UnknownWords()[n] & ~ValueWords()[n])
         return false;
     }
 
@@ -310,9 +363,9 @@ public:
   inline bool
   is_known() const noexcept
   {
-    for (auto bit : data_)
+    for (size_t n = 0; n < NumWords(); n++)
     {
-      if (bit == 'X' || bit == 'D')
+      if (UnknownWords()[n] != 0)
         return false;
     }
 
@@ -329,20 +382,12 @@ public:
   concat(const bitvalue_repr & other) const
   {
     bitvalue_repr result(*this);
-    result.data_.insert(result.data_.end(), other.data_.begin(), other.data_.end());
+    result.Append(other);
     return result;
   }
 
-  inline bitvalue_repr
-  slice(size_t low, size_t high) const
-  {
-    if (high <= low || high > nbits())
-    {
-      throw jlm::util::error("Slice is out of bound.");
-    }
-
-    return bitvalue_repr(std::string(&data_[low], high - low).c_str());
-  }
+  bitvalue_repr
+  slice(size_t low, size_t high) const;
 
   inline bitvalue_repr
   zext(size_t nbits) const
@@ -350,7 +395,7 @@ public:
     if (nbits == 0)
       return *this;
 
-    return concat(bitvalue_repr(nbits, 0));
+    return concat(bitvalue_repr::Zero(nbits));
   }
 
   inline bitvalue_repr
@@ -365,13 +410,17 @@ public:
   inline size_t
   nbits() const noexcept
   {
-    return data_.size();
+    return NumBits_;
   }
 
   inline std::string
   str() const
   {
-    return std::string(data_.begin(), data_.end());
+    std::string s(nbits(), '0');
+    for (size_t n = 0; n < nbits(); n++)
+      s[n] = (*this)[n];
+
+    return s;
   }
 
   uint64_t
@@ -380,64 +429,20 @@ public:
   int64_t
   to_int() const;
 
-  inline char
-  ult(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in ult, ", nbits(), " != ", other.nbits()));
+  char
+  ult(const bitvalue_repr & other) const;
 
-    char v = land(lnot(data_[0]), other[0]);
-    for (size_t n = 1; n < nbits(); n++)
-      v = land(lor(lnot(data_[n]), other[n]), lor(land(lnot(data_[n]), other[n]), v));
+  char
+  slt(const bitvalue_repr & other) const;
 
-    return v;
-  }
+  char
+  ule(const bitvalue_repr & other) const;
 
-  inline char
-  slt(const bitvalue_repr & other) const
-  {
-    bitvalue_repr t1(*this), t2(other);
-    t1[t1.nbits() - 1] = lnot(t1.sign());
-    t2[t2.nbits() - 1] = lnot(t2.sign());
-    return t1.ult(t2);
-  }
-
-  inline char
-  ule(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in ule, ", nbits(), " != ", other.nbits()));
-
-    char v = '1';
-    for (size_t n = 0; n < nbits(); n++)
-      v = land(land(lor(lnot(data_[n]), other[n]), lor(lnot(data_[n]), v)), lor(v, other[n]));
-
-    return v;
-  }
+  char
+  sle(const bitvalue_repr & other) const;
 
-  inline char
-  sle(const bitvalue_repr & other) const
-  {
-    bitvalue_repr t1(*this), t2(other);
-    t1[t1.nbits() - 1] = lnot(t1.sign());
-    t2[t2.nbits() - 1] = lnot(t2.sign());
-    return t1.ule(t2);
-  }
-
-  inline char
-  ne(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in ne, ", nbits(), " != ", other.nbits()));
-
-    char v = '0';
-    for (size_t n = 0; n < nbits(); n++)
-      v = lor(v, lxor(data_[n], other[n]));
-    return v;
-  }
+  char
+  ne(const bitvalue_repr & other) const;
 
   inline char
   eq(const bitvalue_repr & other) const
@@ -469,65 +474,17 @@ public:
     return lnot(ule(other));
   }
 
-  inline bitvalue_repr
-  add(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in add, ", nbits(), " != ", other.nbits()));
-
-    char c = '0';
-    bitvalue_repr sum = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      sum[n] = add(data_[n], other[n], c);
-      c = carry(data_[n], other[n], c);
-    }
-
-    return sum;
-  }
-
-  inline bitvalue_repr
-  land(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in land, ", nbits(), " != ", other.nbits()));
-
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = land(data_[n], other[n]);
-
-    return result;
-  }
-
-  inline bitvalue_repr
-  lor(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in lor, ", nbits(), " != ", other.nbits()));
-
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lor(data_[n], other[n]);
+  bitvalue_repr
+  add(const bitvalue_repr & other) const;
 
-    return result;
-  }
+  bitvalue_repr
+  land(const bitvalue_repr & other) const;
 
-  inline bitvalue_repr
-  lxor(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in lxor, ", nbits(), " != ", other.nbits()));
+  bitvalue_repr
+  lor(const bitvalue_repr & other) const;
 
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lxor(data_[n], other[n]);
-
-    return result;
-  }
+  bitvalue_repr
+  lxor(const bitvalue_repr & other) const;
 
   inline bitvalue_repr
   lnot() const
@@ -535,26 +492,11 @@ public:
     return lxor(repeat(nbits(), '1'));
   }
 
-  inline bitvalue_repr
-  neg() const
-  {
-    char c = '1';
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      char tmp = lxor(data_[n], '1');
-      result[n] = add(tmp, '0', c);
-      c = carry(tmp, '0', c);
-    }
-
-    return result;
-  }
+  bitvalue_repr
+  neg() const;
 
-  inline bitvalue_repr
-  sub(const bitvalue_repr & other) const
-  {
-    return add(other.neg());
-  }
+  bitvalue_repr
+  sub(const bitvalue_repr & other) const;
 
   inline bitvalue_repr
   shr(size_t shift) const
@@ -562,8 +504,7 @@ public:
     if (shift >= nbits())
       return repeat(nbits(), '0');
 
-    bitvalue_repr result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.zext(shift);
+    return slice(shift, nbits()).zext(shift);
   }
 
   inline bitvalue_repr
@@ -572,8 +513,7 @@ public:
     if (shift >= nbits())
       return repeat(nbits(), sign());
 
-    bitvalue_repr result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.sext(shift);
+    return slice(shift, nbits()).sext(shift);
   }
 
   inline bitvalue_repr
@@ -582,14 +522,17 @@ public:
     if (shift >= nbits())
       return repeat(nbits(), '0');
 
-    return repeat(shift, '0').concat(slice(0, nbits() - shift));
+    if (shift == 0)
+      return *this;
+
+    return Zero(shift).concat(slice(0, nbits() - shift));
   }
 
   inline bitvalue_repr
   udiv(const bitvalue_repr & other) const
   {
-    bitvalue_repr quotient(nbits(), 0);
-    bitvalue_repr remainder(nbits(), 0);
+    auto quotient = Zero(nbits());
+    auto remainder = Zero(nbits());
     udiv(other, quotient, remainder);
     return quotient;
   }
@@ -597,8 +540,8 @@ public:
   inline bitvalue_repr
   umod(const bitvalue_repr & other) const
   {
-    bitvalue_repr quotient(nbits(), 0);
-    bitvalue_repr remainder(nbits(), 0);
+    auto quotient = Zero(nbits());
+    auto remainder = Zero(nbits());
     udiv(other, quotient, remainder);
     return remainder;
   }
@@ -614,12 +557,10 @@ public:
     if (divisor.is_negative())
       divisor = divisor.neg();
 
-    bitvalue_repr quotient(nbits(), 0), remainder(nbits(), 0);
+    auto quotient = Zero(nbits());
+    auto remainder = Zero(nbits());
     dividend.udiv(divisor, quotient, remainder);
 
-    if (is_negative())
-      remainder = remainder.neg();
-
     if (is_negative() ^ other.is_negative())
       quotient = quotient.neg();
 
@@ -637,67 +578,43 @@ public:
     if (divisor.is_negative())
       divisor = divisor.neg();
 
-    bitvalue_repr quotient(nbits(), 0), remainder(nbits(), 0);
+    auto quotient = Zero(nbits());
+    auto remainder = Zero(nbits());
     dividend.udiv(divisor, quotient, remainder);
 
     if (is_negative())
       remainder = remainder.neg();
 
-    if (is_negative() ^ other.is_negative())
-      quotient = quotient.neg();
-
     return remainder;
   }
 
-  inline bitvalue_repr
-  mul(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in mul, ", nbits(), " != ", other.nbits()));
-
-    bitvalue_repr product(2 * nbits(), 0);
-    mul(*this, other, product);
-    return product.slice(0, nbits());
-  }
+  bitvalue_repr
+  mul(const bitvalue_repr & other) const;
 
   inline bitvalue_repr
   umulh(const bitvalue_repr & other) const
   {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in umulh, ", nbits(), " != ", other.nbits()));
-
-    bitvalue_repr product(4 * nbits(), 0);
-    bitvalue_repr factor1 = this->zext(nbits());
-    bitvalue_repr factor2 = other.zext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+    CheckNumBits(other, "umulh");
+    return zext(nbits()).mul(other.zext(nbits())).slice(nbits(), 2 * nbits());
   }
 
   inline bitvalue_repr
   smulh(const bitvalue_repr & other) const
   {
-    if (nbits() != other.nbits())
-      throw jlm::util::error(
-          jlm::util::strfmt("Unequal number of bits in smulh, ", nbits(), " != ", other.nbits()));
-
-    bitvalue_repr product(4 * nbits(), 0);
-    bitvalue_repr factor1 = this->sext(nbits());
-    bitvalue_repr factor2 = other.sext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+    CheckNumBits(other, "smulh");
+    return sext(nbits()).mul(other.sext(nbits())).slice(nbits(), 2 * nbits());
   }
 
   void
-  Append(const bitvalue_repr & other)
-  {
-    data_.insert(data_.end(), other.data_.begin(), other.data_.end());
-  }
+  Append(const bitvalue_repr & other);
 
 private:
   /* [lsb ... msb] */
-  std::vector<char> data_;
+  size_t NumBits_;
+  /* The value and unknown plane of bit strings with up to 64 bits */
+  uint64_t InlineWords_[2];
+  /* The value plane followed by the unknown plane of bit strings with more than 64 bits */
+  std::vector<uint64_t> Words_;
 };
 
 }
@@ -68,7 +68,7 @@ ControlType::Create(std::size_t nalternatives)
   }
   else
   {
-    return std::make_shared<ControlType>(nalternatives);
+    return TypeTable::Intern(std::make_shared<const ControlType>(nalternatives));
   }
 }
 
@@ -105,6 +105,22 @@ match_op::operator==(const Operation & other) const noexcept
       && op->nbits() == nbits() && op->nalternatives() == nalternatives();
 }
 
+std::size_t
+match_op::ComputeHash() const noexcept
+{
+  // The mapping is unordered, so its entries are combined independent of their order.
+  std::size_t mappingHash = 0;
+  for (auto & [value, alternative] : mapping_)
+    mappingHash += util::CombineHashes(value, alternative);
+
+  return util::CombineHashes(
+      typeid(match_op).hash_code(),
+      nbits(),
+      nalternatives(),
+      default_alternative_,
+      mappingHash);
+}
+
 unop_reduction_path_t
 match_op::can_reduce_operand(const jlm::rvsdg::output * arg) const noexcept
 {
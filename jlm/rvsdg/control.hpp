@@ -11,6 +11,7 @@
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/nullary.hpp>
 #include <jlm/rvsdg/unary.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/strfmt.hpp>
 
 #include <unordered_map>
@@ -83,6 +84,17 @@ public:
     return !(*this == other);
   }
 
+  /**
+   * Computes a hash value for the control value.
+   *
+   * @return A hash value.
+   */
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept
+  {
+    return util::CombineHashes(alternative_, nalternatives_);
+  }
+
   inline size_t
   alternative() const noexcept
   {
@@ -154,6 +166,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   virtual unop_reduction_path_t
   can_reduce_operand(const jlm::rvsdg::output * arg) const noexcept override;
 
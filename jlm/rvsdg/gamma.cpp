@@ -7,6 +7,7 @@
 #include <jlm/rvsdg/control.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/substitution.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -209,6 +210,12 @@ GammaOperation::operator==(const Operation & other) const noexcept
   return op && op->nalternatives_ == nalternatives_;
 }
 
+std::size_t
+GammaOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(GammaOperation).hash_code(), nalternatives_);
+}
+
 /* gamma node */
 
 GammaNode::~GammaNode() noexcept = default;
@@ -218,7 +225,7 @@ GammaNode::GammaNode(rvsdg::output * predicate, size_t nalternatives)
       Operation_(nalternatives)
 {
   add_input(std::unique_ptr<node_input>(
-      new StructuralInput(this, predicate, ControlType::Create(nalternatives))));
+      new (*region()) StructuralInput(this, predicate, ControlType::Create(nalternatives))));
 }
 
 [[nodiscard]] const GammaOperation &
@@ -230,7 +237,7 @@ GammaNode::GetOperation() const noexcept
 GammaNode::EntryVar
 GammaNode::AddEntryVar(rvsdg::output * origin)
 {
-  auto gammaInput = new StructuralInput(this, origin, origin->Type());
+  auto gammaInput = new (*region()) StructuralInput(this, origin, origin->Type());
   add_input(std::unique_ptr<node_input>(gammaInput));
 
   EntryVar ev;
@@ -291,8 +298,8 @@ GammaNode::AddExitVar(std::vector<jlm::rvsdg::output *> values)
     throw jlm::util::error("Incorrect number of values.");
 
   const auto & type = values[0]->Type();
-  auto output =
-      static_cast<StructuralOutput *>(add_output(std::make_unique<StructuralOutput>(this, type)));
+  auto output = static_cast<StructuralOutput *>(
+      add_output(std::unique_ptr<node_output>(new (*region()) StructuralOutput(this, type))));
 
   std::vector<rvsdg::input *> branchResults;
   for (size_t n = 0; n < nsubregions(); n++)
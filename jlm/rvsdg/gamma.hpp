@@ -43,6 +43,9 @@ public:
   virtual bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
 private:
   size_t nalternatives_;
 };
@@ -94,7 +97,7 @@ public:
   static GammaNode *
   create(jlm::rvsdg::output * predicate, size_t nalternatives)
   {
-    return new GammaNode(predicate, nalternatives);
+    return new (*predicate->region()) GammaNode(predicate, nalternatives);
   }
 
   inline rvsdg::input *
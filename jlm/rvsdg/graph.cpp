@@ -38,6 +38,11 @@ GraphExport::debug_string() const
 Graph::~Graph()
 {
   JLM_ASSERT(!has_active_trackers(this));
+
+  // All nodes and ports are about to be destroyed. Their memory is released in bulk together with
+  // the slabs of the allocator, such that there is no need to recycle individual blocks.
+  Allocator_.BeginTeardown();
+  RootRegion_.reset();
 }
 
 Graph::Graph()
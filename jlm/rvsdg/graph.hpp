@@ -9,6 +9,7 @@
 
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/region.hpp>
+#include <jlm/util/SlabAllocator.hpp>
 
 namespace jlm::rvsdg
 {
@@ -105,7 +106,73 @@ public:
   static std::vector<Node *>
   ExtractTailNodes(const Graph & rvsdg);
 
+  /**
+   * @return The slab allocator from which the nodes, inputs, and outputs of the graph are
+   * allocated.
+   *
+   * @see GraphAllocated
+   */
+  [[nodiscard]] util::SlabAllocator &
+  GetAllocator() noexcept
+  {
+    return Allocator_;
+  }
+
+  /**
+   * @return The number of bytes currently occupied by nodes, inputs, and outputs allocated from
+   * the graph's slab allocator.
+   */
+  [[nodiscard]] size_t
+  NumAllocatedBytes() const noexcept
+  {
+    return Allocator_.NumBytesInUse();
+  }
+
+  /**
+   * @return An upper bound on the identifiers of all nodes in the graph.
+   *
+   * @see Node::GetId()
+   */
+  [[nodiscard]] size_t
+  NumNodeIds() const noexcept
+  {
+    return NodeIds_.NumIds();
+  }
+
+  /**
+   * @return An upper bound on the identifiers of all outputs in the graph.
+   *
+   * @see output::GetId()
+   */
+  [[nodiscard]] size_t
+  NumOutputIds() const noexcept
+  {
+    return OutputIds_.NumIds();
+  }
+
+  /**
+   * @return The dense identifier allocator for the nodes of the graph.
+   */
+  [[nodiscard]] util::DenseIdAllocator &
+  GetNodeIdAllocator() noexcept
+  {
+    return NodeIds_;
+  }
+
+  /**
+   * @return The dense identifier allocator for the outputs of the graph.
+   */
+  [[nodiscard]] util::DenseIdAllocator &
+  GetOutputIdAllocator() noexcept
+  {
+    return OutputIds_;
+  }
+
 private:
+  // Must be declared before RootRegion_ as they need to outlive all nodes of the graph.
+  util::SlabAllocator Allocator_;
+  util::DenseIdAllocator NodeIds_;
+  util::DenseIdAllocator OutputIds_;
   std::unique_ptr<Region> RootRegion_;
 };
 
@@ -5,6 +5,7 @@
  */
 
 #include <jlm/rvsdg/lambda.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -28,6 +29,12 @@ LambdaOperation::operator==(const Operation & other) const noexcept
   return op && op->type() == type();
 }
 
+std::size_t
+LambdaOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(typeid(LambdaOperation).hash_code(), type().ComputeHash());
+}
+
 std::unique_ptr<rvsdg::Operation>
 LambdaOperation::copy() const
 {
@@ -122,7 +129,7 @@ LambdaNode::AddContextVar(jlm::rvsdg::output & origin)
 LambdaNode *
 LambdaNode::Create(rvsdg::Region & parent, std::unique_ptr<LambdaOperation> operation)
 {
-  return new LambdaNode(parent, std::move(operation));
+  return new (parent) LambdaNode(parent, std::move(operation));
 }
 
 rvsdg::output *
@@ -152,7 +159,8 @@ LambdaNode::finalize(const std::vector<jlm::rvsdg::output *> & results)
   for (const auto & origin : results)
     rvsdg::RegionResult::Create(*origin->region(), *origin, nullptr, origin->Type());
 
-  return append_output(std::make_unique<rvsdg::StructuralOutput>(this, GetOperation().Type()));
+  return append_output(std::unique_ptr<rvsdg::StructuralOutput>(
+      new (*region()) rvsdg::StructuralOutput(this, GetOperation().Type())));
 }
 
 rvsdg::output *
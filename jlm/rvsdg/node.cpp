@@ -4,6 +4,7 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/region.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
@@ -64,6 +65,13 @@ input::divert_to(jlm::rvsdg::output * new_origin)
   if (is<node_input>(*this))
     static_cast<node_input *>(this)->node()->recompute_depth();
 
+  // Keep the node findable with its new operands
+  if (auto table = region()->GetHashConsingTable())
+  {
+    if (auto simpleNode = dynamic_cast<SimpleNode *>(input::GetNode(*this)))
+      table->Update(*simpleNode);
+  }
+
   on_input_change(this, old_origin, new_origin);
 }
 
@@ -79,14 +87,34 @@ input::GetNode(const rvsdg::input & input) noexcept
 output::~output() noexcept
 {
   JLM_ASSERT(nusers() == 0);
+  region_->graph()->GetOutputIdAllocator().Release(Id_);
 }
 
 output::output(rvsdg::Region * region, std::shared_ptr<const rvsdg::Type> type)
     : index_(0),
+      Id_(region->graph()->GetOutputIdAllocator().Allocate()),
       region_(region),
-      Type_(std::move(type))
+      Type_(std::move(type)),
+      nusers_(0)
 {}
 
+void
+output::divert_users(jlm::rvsdg::output * new_origin)
+{
+  if (this == new_origin)
+    return;
+
+  if (nusers() == 1)
+  {
+    users_.first()->divert_to(new_origin);
+    return;
+  }
+
+  BatchEdit batchEdit(*region());
+  while (!users_.empty())
+    users_.first()->divert_to(new_origin);
+}
+
 std::string
 output::debug_string() const
 {
@@ -103,9 +131,11 @@ output::GetNode(const rvsdg::output & output) noexcept
 void
 output::remove_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) != users_.end());
+  JLM_ASSERT(user->origin() == this);
+  JLM_ASSERT(nusers_ != 0);
 
   users_.erase(user);
+  nusers_--;
 
   if (auto node = output::GetNode(*this))
   {
@@ -120,7 +150,7 @@ output::remove_user(jlm::rvsdg::input * user)
 void
 output::add_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) == users_.end());
+  JLM_ASSERT(user->origin() == this);
 
   if (auto node = output::GetNode(*this))
   {
@@ -130,7 +160,8 @@ output::add_user(jlm::rvsdg::input * user)
       JLM_ASSERT(wasRemoved);
     }
   }
-  users_.insert(user);
+  users_.push_back(user);
+  nusers_++;
 }
 
 node_input::node_input(
@@ -164,6 +195,7 @@ node_output::GetOwner() const noexcept
 
 Node::Node(Region * region)
     : depth_(0),
+      Id_(region->graph()->GetNodeIdAllocator().Allocate()),
       graph_(region->graph()),
       region_(region)
 {
@@ -190,6 +222,8 @@ Node::~Node()
 
   wasRemoved = region()->RemoveNode(*this);
   JLM_ASSERT(wasRemoved);
+
+  graph_->GetNodeIdAllocator().Release(Id_);
 }
 
 node_input *
@@ -199,7 +233,7 @@ Node::add_input(std::unique_ptr<node_input> input)
 
   if (ninputs() == 0)
   {
-    JLM_ASSERT(depth() == 0);
+    JLM_ASSERT(depth() == 0 || region()->IsBatchEditing());
     const auto wasRemoved = region()->RemoveTopNode(*this);
     JLM_ASSERT(wasRemoved);
   }
@@ -229,7 +263,7 @@ Node::RemoveInput(size_t index)
   inputs_.pop_back();
 
   /* recompute depth */
-  if (producer)
+  if (producer && !region()->IsBatchEditing())
   {
     auto pdepth = producer->depth();
     JLM_ASSERT(pdepth < depth());
@@ -241,7 +275,7 @@ Node::RemoveInput(size_t index)
   /* add to region's top nodes */
   if (ninputs() == 0)
   {
-    JLM_ASSERT(depth() == 0);
+    JLM_ASSERT(depth() == 0 || region()->IsBatchEditing());
     const auto wasAdded = region()->AddTopNode(*this);
     JLM_ASSERT(wasAdded);
   }
@@ -267,20 +301,18 @@ Node::recompute_depth() noexcept
     FIXME: This function is inefficient, as it can visit the
     node's successors multiple times. Optimally, we would like
     to visit the node's successors in top down order to ensure
-    that each node is only visited once.
+    that each node is only visited once. Bulk rewrites should
+    therefore use a BatchEdit, which recomputes all stale depths
+    in a single top down pass.
   */
-  size_t new_depth = 0;
-  for (size_t n = 0; n < ninputs(); n++)
+  if (region()->IsBatchEditing())
   {
-    auto producer = output::GetNode(*input(n)->origin());
-    new_depth = std::max(new_depth, producer ? producer->depth() + 1 : 0);
-  }
-  if (new_depth == depth())
+    region()->MarkDepthStale(*this);
     return;
+  }
 
-  size_t old_depth = depth();
-  depth_ = new_depth;
-  on_node_depth_change(this, old_depth);
+  if (!UpdateDepth())
+    return;
 
   for (size_t n = 0; n < noutputs(); n++)
   {
@@ -295,6 +327,32 @@ Node::recompute_depth() noexcept
   }
 }
 
+size_t
+Node::ComputeDepth() const noexcept
+{
+  size_t depth = 0;
+  for (size_t n = 0; n < ninputs(); n++)
+  {
+    auto producer = output::GetNode(*input(n)->origin());
+    depth = std::max(depth, producer ? producer->depth() + 1 : 0);
+  }
+
+  return depth;
+}
+
+bool
+Node::UpdateDepth() noexcept
+{
+  const auto new_depth = ComputeDepth();
+  if (new_depth == depth())
+    return false;
+
+  size_t old_depth = depth();
+  depth_ = new_depth;
+  on_node_depth_change(this, old_depth);
+  return true;
+}
+
 Node *
 Node::copy(rvsdg::Region * region, const std::vector<jlm::rvsdg::output *> & operands) const
 {
@@ -7,8 +7,10 @@
 #ifndef JLM_RVSDG_NODE_HPP
 #define JLM_RVSDG_NODE_HPP
 
+#include <jlm/rvsdg/GraphAllocated.hpp>
 #include <jlm/rvsdg/operation.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/DenseIdMap.hpp>
 #include <jlm/util/intrusive-list.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -29,7 +31,7 @@ class SubstitutionMap;
 
 /* inputs */
 
-class input
+class input : public GraphAllocated
 {
   friend class Node;
   friend class rvsdg::Region;
@@ -266,6 +268,11 @@ private:
   jlm::rvsdg::output * origin_;
   rvsdg::Region * region_;
   std::shared_ptr<const rvsdg::Type> Type_;
+
+  util::intrusive_list_anchor<input> user_list_anchor_;
+
+public:
+  typedef util::intrusive_list_accessor<input, &input::user_list_anchor_> user_list_accessor;
 };
 
 template<class T>
@@ -281,15 +288,69 @@ is(const jlm::rvsdg::input & input) noexcept
 
 /* outputs */
 
-class output
+class output : public GraphAllocated
 {
   friend input;
   friend class Node;
   friend class rvsdg::Region;
 
-  typedef std::unordered_set<jlm::rvsdg::input *>::const_iterator user_iterator;
+  typedef util::intrusive_list<input, input::user_list_accessor> user_list;
 
 public:
+  /**
+   * Iterates the users of an output in the order they were added. Dereferencing the iterator
+   * yields the user input.
+   */
+  class user_iterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = jlm::rvsdg::input *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = jlm::rvsdg::input * const *;
+    using reference = jlm::rvsdg::input * const &;
+
+    constexpr explicit user_iterator(jlm::rvsdg::input * user) noexcept
+        : user_(user)
+    {}
+
+    reference
+    operator*() const noexcept
+    {
+      return user_;
+    }
+
+    user_iterator &
+    operator++() noexcept
+    {
+      user_ = input::user_list_accessor().get_next(user_);
+      return *this;
+    }
+
+    user_iterator
+    operator++(int) noexcept
+    {
+      user_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const user_iterator & other) const noexcept
+    {
+      return user_ == other.user_;
+    }
+
+    bool
+    operator!=(const user_iterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    jlm::rvsdg::input * user_;
+  };
+
   virtual ~output() noexcept;
 
   output(rvsdg::Region * region, std::shared_ptr<const rvsdg::Type> type);
@@ -313,7 +374,7 @@ public:
   inline size_t
   nusers() const noexcept
   {
-    return users_.size();
+    return nusers_;
   }
 
   /**
@@ -331,26 +392,25 @@ public:
     return nusers() == 0;
   }
 
-  inline void
-  divert_users(jlm::rvsdg::output * new_origin)
-  {
-    if (this == new_origin)
-      return;
-
-    while (users_.size())
-      (*users_.begin())->divert_to(new_origin);
-  }
+  /**
+   * Diverts all users of the output to \p new_origin. The depths of the users' nodes are updated
+   * in a single batch.
+   *
+   * \see BatchEdit
+   */
+  void
+  divert_users(jlm::rvsdg::output * new_origin);
 
   inline user_iterator
   begin() const noexcept
   {
-    return users_.begin();
+    return user_iterator(users_.first());
   }
 
   inline user_iterator
   end() const noexcept
   {
-    return users_.end();
+    return user_iterator(nullptr);
   }
 
   [[nodiscard]] const rvsdg::Type &
@@ -371,6 +431,30 @@ public:
     return region_;
   }
 
+  /**
+   * @return The dense identifier of the output. Identifiers are unique among all live outputs of
+   * a graph and are recycled once an output is destroyed.
+   *
+   * @see Graph::NumOutputIds()
+   * @see DenseOutputMap
+   */
+  [[nodiscard]] size_t
+  GetId() const noexcept
+  {
+    return Id_.Index;
+  }
+
+  /**
+   * @return The dense identifier of the output together with its generation.
+   *
+   * @see GetId()
+   */
+  [[nodiscard]] const util::DenseId &
+  GetDenseId() const noexcept
+  {
+    return Id_;
+  }
+
   virtual std::string
   debug_string() const;
 
@@ -556,9 +640,11 @@ private:
   add_user(jlm::rvsdg::input * user);
 
   size_t index_;
+  util::DenseId Id_;
   rvsdg::Region * region_;
   std::shared_ptr<const rvsdg::Type> Type_;
-  std::unordered_set<jlm::rvsdg::input *> users_;
+  size_t nusers_;
+  user_list users_;
 };
 
 template<class T>
@@ -621,8 +707,10 @@ private:
 
 /* node class */
 
-class Node
+class Node : public GraphAllocated
 {
+  friend class rvsdg::Region;
+
 public:
   virtual ~Node();
 
@@ -696,7 +784,14 @@ public:
     return outputs_[index].get();
   }
 
-  inline void
+  /**
+   * Recomputes the depth of the node from the depths of its predecessors and propagates a changed
+   * depth to the node's successors. If the node's region is in a batch edit, then the node is only
+   * marked as stale and its depth is recomputed at the end of the batch edit.
+   *
+   * \see BatchEdit
+   */
+  void
   recompute_depth() noexcept;
 
   /**
@@ -824,6 +919,30 @@ public:
     return region_;
   }
 
+  /**
+   * @return The dense identifier of the node. Identifiers are unique among all live nodes of a
+   * graph and are recycled once a node is destroyed.
+   *
+   * @see Graph::NumNodeIds()
+   * @see DenseNodeMap
+   */
+  [[nodiscard]] size_t
+  GetId() const noexcept
+  {
+    return Id_.Index;
+  }
+
+  /**
+   * @return The dense identifier of the node together with its generation.
+   *
+   * @see GetId()
+   */
+  [[nodiscard]] const util::DenseId &
+  GetDenseId() const noexcept
+  {
+    return Id_;
+  }
+
   virtual Node *
   copy(rvsdg::Region * region, const std::vector<jlm::rvsdg::output *> & operands) const;
 
@@ -853,6 +972,21 @@ public:
   }
 
 private:
+  /**
+   * @return The depth of the node according to the current depths of its predecessors.
+   */
+  [[nodiscard]] size_t
+  ComputeDepth() const noexcept;
+
+  /**
+   * Computes the depth of the node from the depths of its predecessors without propagating it to
+   * the node's successors. Emits on_node_depth_change if the depth changed.
+   *
+   * @return True if the depth of the node changed, otherwise false.
+   */
+  bool
+  UpdateDepth() noexcept;
+
   util::intrusive_list_anchor<Node> region_node_list_anchor_;
 
   util::intrusive_list_anchor<Node> region_top_node_list_anchor_;
@@ -871,6 +1005,7 @@ public:
 
 private:
   size_t depth_;
+  util::DenseId Id_;
   Graph * graph_;
   rvsdg::Region * region_;
   std::vector<std::unique_ptr<node_input>> inputs_;
@@ -1075,6 +1210,35 @@ is(const Node * node) noexcept
 Node *
 producer(const jlm::rvsdg::output * output) noexcept;
 
+/**
+ * Returns the dense identifier of a node or an output.
+ */
+struct DenseIdOf final
+{
+  template<class T>
+  const util::DenseId &
+  operator()(const T & value) const noexcept
+  {
+    return value.GetDenseId();
+  }
+};
+
+/**
+ * Flat side table that associates the nodes of a graph with values of type \p T.
+ *
+ * @see Node::GetId()
+ */
+template<class T>
+using DenseNodeMap = util::DenseIdMap<Node, T, DenseIdOf>;
+
+/**
+ * Flat side table that associates the outputs of a graph with values of type \p T.
+ *
+ * @see output::GetId()
+ */
+template<class T>
+using DenseOutputMap = util::DenseIdMap<output, T, DenseIdOf>;
+
 }
 
 #endif
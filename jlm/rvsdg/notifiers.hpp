@@ -16,24 +16,30 @@ class Node;
 class output;
 class Region;
 
-extern jlm::util::notifier<rvsdg::Region *> on_region_create;
-extern jlm::util::notifier<rvsdg::Region *> on_region_destroy;
+/*
+ * The notifiers are thread-local: a callback is only invoked for changes performed by the thread
+ * that connected it. This permits independent regions of a graph, e.g., the subregions of distinct
+ * lambda nodes, to be transformed concurrently by different threads.
+ */
+
+extern thread_local jlm::util::notifier<rvsdg::Region *> on_region_create;
+extern thread_local jlm::util::notifier<rvsdg::Region *> on_region_destroy;
 
-extern util::notifier<Node *> on_node_create;
-extern util::notifier<Node *> on_node_destroy;
-extern util::notifier<Node *, size_t> on_node_depth_change;
+extern thread_local util::notifier<Node *> on_node_create;
+extern thread_local util::notifier<Node *> on_node_destroy;
+extern thread_local util::notifier<Node *, size_t> on_node_depth_change;
 
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
-extern jlm::util::notifier<
+extern thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
+extern thread_local jlm::util::notifier<
     jlm::rvsdg::input *,
     jlm::rvsdg::output *, /* old */
     jlm::rvsdg::output *  /* new */
     >
     on_input_change;
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
+extern thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
 
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
+extern thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
+extern thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
 
 }
 
@@ -9,6 +9,9 @@
 
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/util/Hash.hpp>
+
+#include <typeinfo>
 
 namespace jlm::rvsdg
 {
@@ -74,6 +77,12 @@ public:
     return op && op->value_ == value_;
   }
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override
+  {
+    return util::CombineHashes(typeid(domain_const_op).hash_code(), value_.ComputeHash());
+  }
+
   virtual std::string
   debug_string() const override
   {
@@ -5,12 +5,21 @@
  */
 
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/util/Hash.hpp>
+
+#include <typeinfo>
 
 namespace jlm::rvsdg
 {
 
 Operation::~Operation() noexcept = default;
 
+std::size_t
+Operation::ComputeHash() const noexcept
+{
+  return typeid(*this).hash_code();
+}
+
 SimpleOperation::~SimpleOperation() noexcept = default;
 
 size_t
@@ -39,6 +48,18 @@ SimpleOperation::result(size_t index) const noexcept
   return results_[index];
 }
 
+std::size_t
+SimpleOperation::ComputeSignatureHash() const noexcept
+{
+  auto seed = typeid(*this).hash_code();
+  for (auto & operand : operands_)
+    util::CombineHashesWithSeed(seed, operand->ComputeHash());
+  for (auto & result : results_)
+    util::CombineHashesWithSeed(seed, result->ComputeHash());
+
+  return seed;
+}
+
 bool
 StructuralOperation::operator==(const Operation & other) const noexcept
 {
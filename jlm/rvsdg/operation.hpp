@@ -35,6 +35,19 @@ public:
   [[nodiscard]] virtual std::unique_ptr<Operation>
   copy() const = 0;
 
+  /**
+   * Computes a hash value for the operation. Operations that compare equal must return the same
+   * hash value.
+   *
+   * The default implementation only hashes the dynamic type of the operation. Operations that are
+   * further characterized by attributes, such as types or constant values, should override this
+   * method and combine the attributes that are compared by operator==().
+   *
+   * @return A hash value.
+   */
+  [[nodiscard]] virtual std::size_t
+  ComputeHash() const noexcept;
+
   inline bool
   operator!=(const Operation & other) const noexcept
   {
@@ -77,6 +90,17 @@ public:
   [[nodiscard]] const std::shared_ptr<const rvsdg::Type> &
   result(size_t index) const noexcept;
 
+protected:
+  /**
+   * Combines the hash of the dynamic type of the operation with the hashes of all its operand and
+   * result types. This is a suitable implementation of ComputeHash() for all operations that are
+   * fully characterized by their type signature.
+   *
+   * @return A hash value.
+   */
+  [[nodiscard]] std::size_t
+  ComputeSignatureHash() const noexcept;
+
 private:
   std::vector<std::shared_ptr<const rvsdg::Type>> operands_;
   std::vector<std::shared_ptr<const rvsdg::Type>> results_;
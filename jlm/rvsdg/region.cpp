@@ -6,11 +6,16 @@
 
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/AnnotationMap.hpp>
 
+#include <functional>
+#include <queue>
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
@@ -67,7 +72,7 @@ RegionArgument::Create(
     StructuralInput * input,
     std::shared_ptr<const rvsdg::Type> type)
 {
-  auto argument = new RegionArgument(&region, input, std::move(type));
+  auto argument = new (region) RegionArgument(&region, input, std::move(type));
   region.append_argument(argument);
   return *argument;
 }
@@ -128,7 +133,7 @@ RegionResult::Create(
     std::shared_ptr<const rvsdg::Type> type)
 {
   JLM_ASSERT(origin.region() == &region);
-  auto result = new RegionResult(&region, &origin, output, std::move(type));
+  auto result = new (region) RegionResult(&region, &origin, output, std::move(type));
   region.append_result(result);
   return *result;
 }
@@ -152,7 +157,8 @@ Region::~Region() noexcept
 Region::Region(Region *, Graph * graph)
     : index_(0),
       graph_(graph),
-      node_(nullptr)
+      node_(nullptr),
+      NumBatchEdits_(0)
 {
   on_region_create(this);
 }
@@ -160,7 +166,8 @@ Region::Region(Region *, Graph * graph)
 Region::Region(rvsdg::StructuralNode * node, size_t index)
     : index_(index),
       graph_(node->graph()),
-      node_(node)
+      node_(node),
+      NumBatchEdits_(0)
 {
   on_region_create(this);
 }
@@ -297,14 +304,90 @@ Region::RemoveTopNode(Node & node)
 bool
 Region::RemoveNode(Node & node)
 {
+  if (HashConsingTable_)
+    HashConsingTable_->Remove(node);
+
+  StaleDepthNodes_.erase(&node);
+
   auto numNodes = nnodes();
   Nodes_.erase(&node);
   return numNodes != nnodes();
 }
 
+void
+Region::EndBatchEdit()
+{
+  JLM_ASSERT(NumBatchEdits_ != 0);
+  if (--NumBatchEdits_ != 0)
+    return;
+
+  UpdateStaleDepths();
+}
+
+void
+Region::UpdateStaleDepths()
+{
+  if (StaleDepthNodes_.empty())
+    return;
+
+  // The nodes are visited in the order of their recomputed depths, such that the predecessors of a
+  // node are usually updated before the node itself. Only the successors of nodes whose depth
+  // changed are visited, and the propagation stops at nodes whose depth is unchanged.
+  using WorkItem = std::pair<size_t, Node *>;
+  std::priority_queue<WorkItem, std::vector<WorkItem>, std::greater<WorkItem>> worklist;
+  for (auto node : StaleDepthNodes_)
+    worklist.emplace(node->ComputeDepth(), node);
+  StaleDepthNodes_.clear();
+
+  while (!worklist.empty())
+  {
+    const auto [depth, node] = worklist.top();
+    worklist.pop();
+
+    // The depth of a predecessor changed after the node was added to the worklist. The node was
+    // then added again with its new depth.
+    if (depth != node->ComputeDepth())
+      continue;
+
+    if (!node->UpdateDepth())
+      continue;
+
+    for (size_t n = 0; n < node->noutputs(); n++)
+    {
+      for (auto user : *node->output(n))
+      {
+        if (auto successor = input::GetNode(*user))
+          worklist.emplace(successor->ComputeDepth(), successor);
+      }
+    }
+  }
+}
+
+void
+Region::EnableHashConsing()
+{
+  if (HashConsingTable_)
+    return;
+
+  HashConsingTable_ = std::make_unique<SimpleNodeTable>();
+  for (auto & node : Nodes())
+  {
+    if (auto simpleNode = dynamic_cast<SimpleNode *>(&node))
+      HashConsingTable_->Insert(*simpleNode);
+  }
+}
+
+void
+Region::DisableHashConsing() noexcept
+{
+  HashConsingTable_.reset();
+}
+
 void
 Region::copy(Region * target, SubstitutionMap & smap, bool copy_arguments, bool copy_results) const
 {
+  // The depths of the nodes are used for ordering them and must be up to date
+  JLM_ASSERT(!IsBatchEditing());
   smap.insert(this, target);
 
   // order nodes top-down
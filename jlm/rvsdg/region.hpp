@@ -22,6 +22,7 @@ namespace jlm::rvsdg
 
 class Node;
 class SimpleNode;
+class SimpleNodeTable;
 class SimpleOperation;
 class StructuralInput;
 class StructuralNode;
@@ -630,6 +631,46 @@ public:
   void
   prune(bool recursive);
 
+  /**
+   * Enables hash-consing of simple nodes in the region. While enabled, SimpleNode::Create() returns
+   * an already existing node with an identical operation and identical operands instead of
+   * creating a new one. Only nodes with hash-consable operations are considered. All such simple
+   * nodes already present in the region are added to the hash-consing table.
+   *
+   * Hash-consing is disabled by default. It is not applied to subregions of the region. The node
+   * reduction transformation enables it while it reduces the nodes of a region.
+   *
+   * \see SimpleNodeTable
+   */
+  void
+  EnableHashConsing();
+
+  /**
+   * Disables hash-consing of simple nodes in the region and discards the hash-consing table.
+   */
+  void
+  DisableHashConsing() noexcept;
+
+  /**
+   * @return The hash-consing table of the region if hash-consing is enabled, otherwise nullptr.
+   */
+  [[nodiscard]] SimpleNodeTable *
+  GetHashConsingTable() const noexcept
+  {
+    return HashConsingTable_.get();
+  }
+
+  /**
+   * @return True if the region is in a batch edit, otherwise false.
+   *
+   * \see BatchEdit
+   */
+  [[nodiscard]] bool
+  IsBatchEditing() const noexcept
+  {
+    return NumBatchEdits_ != 0;
+  }
+
   /**
    * Checks if an operation is contained within the given \p region. If \p checkSubregions is true,
    * then the subregions of all contained structural nodes are recursively checked as well.
@@ -705,6 +746,36 @@ public:
   ToTree(const rvsdg::Region & region) noexcept;
 
 private:
+  friend class BatchEdit;
+  friend class Node;
+
+  void
+  BeginBatchEdit() noexcept
+  {
+    NumBatchEdits_++;
+  }
+
+  void
+  EndBatchEdit();
+
+  /**
+   * Marks the depth of \p node as stale. The depth is recomputed at the end of the current batch
+   * edit.
+   */
+  void
+  MarkDepthStale(Node & node)
+  {
+    JLM_ASSERT(IsBatchEditing());
+    StaleDepthNodes_.insert(&node);
+  }
+
+  /**
+   * Recomputes the depths of all stale nodes. The nodes are processed with a worklist ordered by
+   * depth, and only the successors of nodes whose depth actually changed are revisited.
+   */
+  void
+  UpdateStaleDepths();
+
   static void
   ToTree(
       const rvsdg::Region & region,
@@ -736,6 +807,48 @@ private:
   region_bottom_node_list BottomNodes_;
   region_top_node_list TopNodes_;
   region_nodes_list Nodes_;
+  std::unique_ptr<SimpleNodeTable> HashConsingTable_;
+  size_t NumBatchEdits_;
+  std::unordered_set<Node *> StaleDepthNodes_;
+};
+
+/**
+ * \brief Defers the depth maintenance of a region's nodes.
+ *
+ * Diverting an input or adding an input to a node eagerly recomputes the node's depth and
+ * propagates the change to all its successors, which can revisit the same nodes many times in bulk
+ * rewrites. While a BatchEdit is alive, these updates are suspended and the affected nodes are only
+ * recorded. The depths of all affected nodes are recomputed in a single top down pass when the last
+ * BatchEdit of the region is destroyed. Batch edits can be nested.
+ *
+ * Node depths are stale during a batch edit. Code that relies on them, such as Region::copy() with
+ * the region as source or the traversers, must not be used on the region until the batch edit
+ * ends. The depths of nodes in other regions, including the subregions of the region, are not
+ * affected.
+ *
+ * \see Node::depth()
+ */
+class BatchEdit final
+{
+public:
+  explicit BatchEdit(Region & region) noexcept
+      : Region_(&region)
+  {
+    Region_->BeginBatchEdit();
+  }
+
+  ~BatchEdit() noexcept
+  {
+    Region_->EndBatchEdit();
+  }
+
+  BatchEdit(const BatchEdit &) = delete;
+
+  BatchEdit &
+  operator=(const BatchEdit &) = delete;
+
+private:
+  Region * Region_;
 };
 
 static inline void
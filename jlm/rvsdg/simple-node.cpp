@@ -7,6 +7,7 @@
 #include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -54,12 +55,13 @@ SimpleNode::SimpleNode(
 
   for (size_t n = 0; n < SimpleNode::GetOperation().narguments(); n++)
   {
-    add_input(
-        std::make_unique<SimpleInput>(this, operands[n], SimpleNode::GetOperation().argument(n)));
+    add_input(std::unique_ptr<node_input>(
+        new (region) SimpleInput(this, operands[n], SimpleNode::GetOperation().argument(n))));
   }
 
   for (size_t n = 0; n < SimpleNode::GetOperation().nresults(); n++)
-    add_output(std::make_unique<SimpleOutput>(this, SimpleNode::GetOperation().result(n)));
+    add_output(std::unique_ptr<node_output>(
+        new (region) SimpleOutput(this, SimpleNode::GetOperation().result(n))));
 
   on_node_create(this);
 }
@@ -70,6 +72,49 @@ SimpleNode::GetOperation() const noexcept
   return *Operation_;
 }
 
+SimpleNode &
+SimpleNode::Create(
+    Region & region,
+    const SimpleOperation & op,
+    const std::vector<rvsdg::output *> & operands)
+{
+  auto table = region.GetHashConsingTable();
+  if (table && SimpleNodeTable::IsHashConsable(op))
+  {
+    if (auto node = table->Lookup(op, operands))
+      return *node;
+  }
+
+  std::unique_ptr<SimpleOperation> newOp(util::AssertedCast<SimpleOperation>(op.copy().release()));
+  auto node = new (region) SimpleNode(region, std::move(newOp), operands);
+
+  if (auto table = region.GetHashConsingTable())
+    table->Insert(*node);
+
+  return *node;
+}
+
+SimpleNode &
+SimpleNode::Create(
+    Region & region,
+    std::unique_ptr<SimpleOperation> operation,
+    const std::vector<rvsdg::output *> & operands)
+{
+  auto table = region.GetHashConsingTable();
+  if (table && SimpleNodeTable::IsHashConsable(*operation))
+  {
+    if (auto node = table->Lookup(*operation, operands))
+      return *node;
+  }
+
+  auto node = new (region) SimpleNode(region, std::move(operation), operands);
+
+  if (auto table = region.GetHashConsingTable())
+    table->Insert(*node);
+
+  return *node;
+}
+
 Node *
 SimpleNode::copy(rvsdg::Region * region, const std::vector<jlm::rvsdg::output *> & operands) const
 {
@@ -107,12 +152,112 @@ SimpleNode::copy(rvsdg::Region * region, SubstitutionMap & smap) const
   return node;
 }
 
+SimpleNode *
+SimpleNodeTable::Lookup(
+    const SimpleOperation & operation,
+    const std::vector<rvsdg::output *> & operands) const noexcept
+{
+  auto [begin, end] = Nodes_.equal_range(ComputeHash(operation, operands));
+  for (auto it = begin; it != end; it++)
+  {
+    auto node = it->second;
+    auto & nodeOperation = node->GetOperation();
+    if (&nodeOperation != &operation && nodeOperation == operation
+        && operands == rvsdg::operands(node))
+    {
+      return node;
+    }
+  }
+
+  return nullptr;
+}
+
+void
+SimpleNodeTable::Insert(SimpleNode & node)
+{
+  if (!IsHashConsable(node.GetOperation()))
+    return;
+
+  auto hash = ComputeHash(node.GetOperation(), rvsdg::operands(&node));
+  if (Hashes_.emplace(&node, hash).second)
+    Nodes_.emplace(hash, &node);
+}
+
+void
+SimpleNodeTable::Update(SimpleNode & node)
+{
+  if (Hashes_.find(&node) == Hashes_.end())
+    return;
+
+  Remove(node);
+  Insert(node);
+}
+
+void
+SimpleNodeTable::Remove(const Node & node) noexcept
+{
+  auto hashIt = Hashes_.find(&node);
+  if (hashIt == Hashes_.end())
+    return;
+
+  auto [begin, end] = Nodes_.equal_range(hashIt->second);
+  for (auto it = begin; it != end; it++)
+  {
+    if (it->second == &node)
+    {
+      Nodes_.erase(it);
+      break;
+    }
+  }
+  Hashes_.erase(hashIt);
+}
+
+bool
+SimpleNodeTable::IsHashConsable(const SimpleOperation & operation) noexcept
+{
+  for (size_t n = 0; n < operation.narguments(); n++)
+  {
+    if (is<StateType>(operation.argument(n)))
+      return false;
+  }
+
+  for (size_t n = 0; n < operation.nresults(); n++)
+  {
+    if (is<StateType>(operation.result(n)))
+      return false;
+  }
+
+  return true;
+}
+
+std::size_t
+SimpleNodeTable::ComputeHash(
+    const SimpleOperation & operation,
+    const std::vector<rvsdg::output *> & operands) noexcept
+{
+  auto seed = operation.ComputeHash();
+  for (auto operand : operands)
+    util::CombineHashesWithSeed(seed, std::hash<const rvsdg::output *>()(operand));
+
+  return seed;
+}
+
 std::optional<std::vector<rvsdg::output *>>
 NormalizeSimpleOperationCommonNodeElimination(
     Region & region,
     const SimpleOperation & operation,
     const std::vector<rvsdg::output *> & operands)
 {
+  // Only nodes with hash-consable operations are in the table
+  auto table = region.GetHashConsingTable();
+  if (table && SimpleNodeTable::IsHashConsable(operation))
+  {
+    if (auto node = table->Lookup(operation, operands))
+      return outputs(node);
+
+    return std::nullopt;
+  }
+
   auto isCongruent = [&](const Node & node)
   {
     auto & nodeOperation = node.GetOperation();
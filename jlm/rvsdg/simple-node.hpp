@@ -10,6 +10,7 @@
 #include <jlm/rvsdg/node.hpp>
 
 #include <optional>
+#include <unordered_map>
 
 namespace jlm::rvsdg
 {
@@ -45,22 +46,29 @@ public:
   Node *
   copy(rvsdg::Region * region, SubstitutionMap & smap) const override;
 
+  /**
+   * Creates a simple node with operation \p op and operands \p operands in \p region.
+   *
+   * If hash-consing is enabled for \p region, \p op is hash-consable, and the region already
+   * contains a node with an identical operation and identical operands, then no new node is
+   * created and the existing node is returned instead.
+   *
+   * \see Region::EnableHashConsing()
+   */
   static SimpleNode &
-  Create(Region & region, const SimpleOperation & op, const std::vector<rvsdg::output *> & operands)
-  {
-    std::unique_ptr<SimpleOperation> newOp(
-        util::AssertedCast<SimpleOperation>(op.copy().release()));
-    return *(new SimpleNode(region, std::move(newOp), operands));
-  }
+  Create(
+      Region & region,
+      const SimpleOperation & op,
+      const std::vector<rvsdg::output *> & operands);
 
+  /**
+   * \copydoc Create(Region&, const SimpleOperation&, const std::vector<rvsdg::output*>&)
+   */
   static SimpleNode &
   Create(
       Region & region,
       std::unique_ptr<SimpleOperation> operation,
-      const std::vector<rvsdg::output *> & operands)
-  {
-    return *new SimpleNode(region, std::move(operation), operands);
-  }
+      const std::vector<rvsdg::output *> & operands);
 
 private:
   std::unique_ptr<SimpleOperation> Operation_;
@@ -118,6 +126,79 @@ public:
   }
 };
 
+/**
+ * \brief Hash-consing table for the simple nodes of a region.
+ *
+ * The table maps the operation and operands of simple nodes to the nodes, such that an identical
+ * node can be found in constant time. Only nodes with hash-consable operations are inserted, i.e.,
+ * operations without state operands or results. Such operations have no side effects, and two
+ * nodes with identical operands compute identical values. In contrast, two allocas with the same
+ * size, or two loads from the same address, must not be merged by the table.
+ *
+ * Nodes are keyed by their current operands. Diverting an input of a node in the table re-keys
+ * the node.
+ *
+ * \see Region::EnableHashConsing()
+ */
+class SimpleNodeTable final
+{
+public:
+  /**
+   * Looks up a node with an operation equal to \p operation and the operands \p operands. Nodes
+   * whose operation is \p operation itself are never returned.
+   *
+   * @param operation The operation of the node.
+   * @param operands The operands of the node.
+   * @return The node if it exists, otherwise nullptr.
+   */
+  [[nodiscard]] SimpleNode *
+  Lookup(const SimpleOperation & operation, const std::vector<rvsdg::output *> & operands)
+      const noexcept;
+
+  /**
+   * Inserts \p node into the table if its operation is hash-consable.
+   */
+  void
+  Insert(SimpleNode & node);
+
+  /**
+   * Re-keys \p node with its current operands if it is in the table.
+   */
+  void
+  Update(SimpleNode & node);
+
+  /**
+   * Removes \p node from the table if it was inserted before.
+   */
+  void
+  Remove(const Node & node) noexcept;
+
+  /**
+   * @return The number of nodes in the table.
+   */
+  [[nodiscard]] size_t
+  NumNodes() const noexcept
+  {
+    return Hashes_.size();
+  }
+
+  /**
+   * @return True if nodes with \p operation can be hash-consed, i.e., if the operation has no
+   * state operands or results.
+   */
+  [[nodiscard]] static bool
+  IsHashConsable(const SimpleOperation & operation) noexcept;
+
+private:
+  [[nodiscard]] static std::size_t
+  ComputeHash(
+      const SimpleOperation & operation,
+      const std::vector<rvsdg::output *> & operands) noexcept;
+
+  std::unordered_multimap<std::size_t, SimpleNode *> Nodes_;
+  std::unordered_map<const Node *, std::size_t> Hashes_;
+};
+
 inline SimpleInput *
 SimpleNode::input(size_t index) const noexcept
 {
@@ -83,7 +83,8 @@ public:
       jlm::rvsdg::output * origin,
       std::shared_ptr<const jlm::rvsdg::Type> type)
   {
-    auto input = std::make_unique<StructuralInput>(node, origin, std::move(type));
+    auto input = std::unique_ptr<StructuralInput>(
+        new (*node->region()) StructuralInput(node, origin, std::move(type)));
     return node->append_input(std::move(input));
   }
 
@@ -113,7 +114,8 @@ public:
   static StructuralOutput *
   create(StructuralNode * node, std::shared_ptr<const jlm::rvsdg::Type> type)
   {
-    auto output = std::make_unique<StructuralOutput>(node, std::move(type));
+    auto output = std::unique_ptr<StructuralOutput>(
+        new (*node->region()) StructuralOutput(node, std::move(type)));
     return node->append_output(std::move(output));
   }
 
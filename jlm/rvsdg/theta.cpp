@@ -48,8 +48,10 @@ ThetaNode::ThetaNode(rvsdg::Region & parent)
 ThetaNode::LoopVar
 ThetaNode::AddLoopVar(rvsdg::output * origin)
 {
-  Node::add_input(std::make_unique<StructuralInput>(this, origin, origin->Type()));
-  Node::add_output(std::make_unique<StructuralOutput>(this, origin->Type()));
+  Node::add_input(
+      std::unique_ptr<node_input>(new (*region()) StructuralInput(this, origin, origin->Type())));
+  Node::add_output(
+      std::unique_ptr<node_output>(new (*region()) StructuralOutput(this, origin->Type())));
 
   auto input = ThetaNode::input(ninputs() - 1);
   auto output = ThetaNode::output(noutputs() - 1);
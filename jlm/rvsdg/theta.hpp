@@ -72,7 +72,7 @@ public:
   static ThetaNode *
   create(rvsdg::Region * parent)
   {
-    return new ThetaNode(*parent);
+    return new (*parent) ThetaNode(*parent);
   }
 
   [[nodiscard]] rvsdg::Region *
@@ -8,6 +8,8 @@
 #include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/tracker.hpp>
 
+#include <unordered_map>
+
 using namespace std::placeholders;
 
 namespace
@@ -18,7 +20,8 @@ typedef std::unordered_set<const jlm::rvsdg::Graph *> tracker_set;
 tracker_set *
 active_trackers()
 {
-  static std::unique_ptr<tracker_set> trackers;
+  // Trackers are bound to the thread-local notifiers and are therefore tracked per thread as well.
+  static thread_local std::unique_ptr<tracker_set> trackers;
   if (!trackers)
     trackers.reset(new tracker_set());
 
@@ -166,7 +169,8 @@ tracker::~tracker() noexcept
 
 tracker::tracker(Graph * graph, size_t nstates)
     : graph_(graph),
-      states_(nstates)
+      states_(nstates),
+      nodestates_(graph->NumNodeIds())
 {
   for (size_t n = 0; n < states_.size(); n++)
     states_[n] = std::make_unique<tracker_depth_state>();
@@ -181,6 +185,10 @@ tracker::tracker(Graph * graph, size_t nstates)
 void
 tracker::node_depth_change(Node * node, size_t old_depth)
 {
+  // The notifiers are global. Ignore the nodes of other graphs.
+  if (node->graph() != graph_)
+    return;
+
   auto nstate = nodestate(node);
   if (nstate->state() < states_.size())
   {
@@ -192,11 +200,15 @@ tracker::node_depth_change(Node * node, size_t old_depth)
 void
 tracker::node_destroy(Node * node)
 {
+  // The notifiers are global. Ignore the nodes of other graphs.
+  if (node->graph() != graph_)
+    return;
+
   auto nstate = nodestate(node);
   if (nstate->state() < states_.size())
     states_[nstate->state()]->remove(nstate, node->depth());
 
-  nodestates_.erase(node);
+  nodestates_.Remove(*node);
 }
 
 ssize_t
@@ -253,12 +265,13 @@ tracker::peek_bottom(size_t state) const
 jlm::rvsdg::tracker_nodestate *
 tracker::nodestate(Node * node)
 {
-  auto it = nodestates_.find(node);
-  if (it != nodestates_.end())
-    return it->second.get();
+  JLM_ASSERT(node->graph() == graph_);
+
+  auto & nodestate = nodestates_[*node];
+  if (nodestate == nullptr)
+    nodestate = std::make_unique<jlm::rvsdg::tracker_nodestate>(node);
 
-  nodestates_[node] = std::make_unique<jlm::rvsdg::tracker_nodestate>(node);
-  return nodestates_[node].get();
+  return nodestate.get();
 }
 
 }
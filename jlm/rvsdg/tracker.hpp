@@ -7,10 +7,9 @@
 #ifndef JLM_RVSDG_TRACKER_HPP
 #define JLM_RVSDG_TRACKER_HPP
 
+#include <jlm/rvsdg/node.hpp>
 #include <jlm/util/callbacks.hpp>
 
-#include <unordered_map>
-
 namespace jlm::rvsdg
 {
 
@@ -74,7 +73,7 @@ private:
 
   jlm::util::callback depth_callback_, destroy_callback_;
 
-  std::unordered_map<Node *, std::unique_ptr<tracker_nodestate>> nodestates_;
+  DenseNodeMap<std::unique_ptr<tracker_nodestate>> nodestates_;
 };
 
 class tracker_nodestate
@@ -8,6 +8,8 @@
 #include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <algorithm>
+
 using namespace std::placeholders;
 
 /* top down traverser */
@@ -204,4 +206,41 @@ BottomUpTraverser::input_change(input * in, output * old_origin, output *)
   tracker_.set_nodestate(node, traversal_nodestate::frontier);
 }
 
+/* read-only traversers */
+
+/**
+ * Sorts the nodes of \p region by their depth using a counting sort. Nodes of equal depth retain
+ * their order in the region's node list.
+ */
+static std::vector<const Node *>
+SortNodesByDepth(const Region & region)
+{
+  size_t maxDepth = 0;
+  for (auto & node : region.Nodes())
+    maxDepth = std::max(maxDepth, node.depth());
+
+  std::vector<size_t> offsets(maxDepth + 2, 0);
+  for (auto & node : region.Nodes())
+    offsets[node.depth() + 1]++;
+
+  for (size_t n = 1; n < offsets.size(); n++)
+    offsets[n] += offsets[n - 1];
+
+  std::vector<const Node *> nodes(offsets.back());
+  for (auto & node : region.Nodes())
+    nodes[offsets[node.depth()]++] = &node;
+
+  return nodes;
+}
+
+TopDownConstTraverser::TopDownConstTraverser(const Region * region)
+    : region_(region),
+      Nodes_(SortNodesByDepth(*region))
+{}
+
+BottomUpConstTraverser::BottomUpConstTraverser(const Region * region)
+    : region_(region),
+      Nodes_(SortNodesByDepth(*region))
+{}
+
 }
@@ -226,6 +226,92 @@ private:
   traversal_nodestate new_node_state_;
 };
 
+/** \brief Read-only TopDown Traverser
+ *
+ * The read-only topdown traverser visits a region's nodes in the same order as the
+ * TopDownTraverser, i.e., from the nodes with the lowest depth to the nodes with the highest depth.
+ * In contrast to the TopDownTraverser, it does not register for any notifications and does not
+ * track the state of individual nodes. Instead, the constructor sorts the nodes of the region by
+ * their depth in a single linear pass, and the traversal iterates the resulting sequence.
+ *
+ * The region must not be mutated while it is traversed. Use the TopDownTraverser for traversals
+ * that create, remove, or rewire nodes.
+ *
+ * @see TopDownTraverser
+ * @see Node::depth()
+ */
+class TopDownConstTraverser final
+{
+public:
+  explicit TopDownConstTraverser(const Region * region);
+
+  [[nodiscard]] const rvsdg::Region *
+  region() const noexcept
+  {
+    return region_;
+  }
+
+  typedef std::vector<const Node *>::const_iterator iterator;
+  typedef const Node * value_type;
+
+  [[nodiscard]] iterator
+  begin() const noexcept
+  {
+    return Nodes_.begin();
+  }
+
+  [[nodiscard]] iterator
+  end() const noexcept
+  {
+    return Nodes_.end();
+  }
+
+private:
+  const rvsdg::Region * region_;
+  std::vector<const Node *> Nodes_;
+};
+
+/** \brief Read-only BottomUp Traverser
+ *
+ * The read-only bottomup traverser visits a region's nodes from the nodes with the highest depth to
+ * the nodes with the lowest depth, i.e., every node is visited after all of its successors. Just
+ * like the TopDownConstTraverser, it computes the traversal order in a single linear pass and the
+ * region must not be mutated while it is traversed.
+ *
+ * @see BottomUpTraverser
+ * @see TopDownConstTraverser
+ */
+class BottomUpConstTraverser final
+{
+public:
+  explicit BottomUpConstTraverser(const Region * region);
+
+  [[nodiscard]] const rvsdg::Region *
+  region() const noexcept
+  {
+    return region_;
+  }
+
+  typedef std::vector<const Node *>::const_reverse_iterator iterator;
+  typedef const Node * value_type;
+
+  [[nodiscard]] iterator
+  begin() const noexcept
+  {
+    return Nodes_.rbegin();
+  }
+
+  [[nodiscard]] iterator
+  end() const noexcept
+  {
+    return Nodes_.rend();
+  }
+
+private:
+  const rvsdg::Region * region_;
+  std::vector<const Node *> Nodes_;
+};
+
 /* traversal tracker implementation */
 
 TraversalTracker::TraversalTracker(Graph * graph)
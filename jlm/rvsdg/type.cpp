@@ -6,6 +6,9 @@
 
 #include <jlm/rvsdg/type.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
@@ -15,4 +18,106 @@ ValueType::~ValueType() noexcept = default;
 
 StateType::~StateType() noexcept = default;
 
+namespace
+{
+
+struct InternedType
+{
+  // Owns the type. Only the table holds this reference, so the type, and the storage of a
+  // make_shared allocation, are released as soon as the entry is erased.
+  std::shared_ptr<const Type> Owner;
+  // The handle given out to users of the type. Its deleter erases this entry.
+  std::weak_ptr<const Type> Handle;
+};
+
+struct InternedTypes
+{
+  std::mutex Mutex;
+  std::unordered_multimap<std::size_t, InternedType> Types;
+};
+
+InternedTypes &
+GetInternedTypes()
+{
+  // Never destroyed, as interned types can outlive other static objects
+  static auto internedTypes = new InternedTypes;
+  return *internedTypes;
+}
+
+/**
+ * Erases the table entry of an interned type once its last handle is released.
+ */
+class InternedTypeReleaser final
+{
+public:
+  explicit InternedTypeReleaser(std::size_t hash) noexcept
+      : Hash_(hash)
+  {}
+
+  void
+  operator()(const Type * type) const
+  {
+    auto & internedTypes = GetInternedTypes();
+
+    // The type is destroyed after the lock is released, as destroying it can release other
+    // interned types, such as the element type of an array type.
+    std::shared_ptr<const Type> owner;
+    {
+      std::lock_guard<std::mutex> guard(internedTypes.Mutex);
+      auto [it, end] = internedTypes.Types.equal_range(Hash_);
+      for (; it != end; it++)
+      {
+        if (it->second.Owner.get() == type)
+        {
+          owner = std::move(it->second.Owner);
+          internedTypes.Types.erase(it);
+          break;
+        }
+      }
+    }
+  }
+
+private:
+  std::size_t Hash_;
+};
+
+}
+
+std::shared_ptr<const Type>
+TypeTable::InternType(std::shared_ptr<const Type> type)
+{
+  auto & internedTypes = GetInternedTypes();
+  const auto hash = type->ComputeHash();
+
+  std::lock_guard<std::mutex> guard(internedTypes.Mutex);
+  auto [it, end] = internedTypes.Types.equal_range(hash);
+  for (; it != end; it++)
+  {
+    if (*it->second.Owner != *type)
+      continue;
+
+    // An expired handle belongs to an entry that is about to be erased by its releaser. Handles
+    // are never released while the lock is held, as that would run the releaser.
+    if (auto internedType = it->second.Handle.lock())
+      return internedType;
+  }
+
+  std::shared_ptr<const Type> handle(type.get(), InternedTypeReleaser(hash));
+  internedTypes.Types.emplace(hash, InternedType{ std::move(type), handle });
+  return handle;
+}
+
+std::size_t
+TypeTable::NumTypes()
+{
+  auto & internedTypes = GetInternedTypes();
+
+  std::lock_guard<std::mutex> guard(internedTypes.Mutex);
+  std::size_t numTypes = 0;
+  for (auto & [hash, internedType] : internedTypes.Types)
+    numTypes += !internedType.Handle.expired();
+
+  return numTypes;
+}
+
 }
@@ -29,7 +29,8 @@ public:
   inline bool
   operator!=(const jlm::rvsdg::Type & other) const noexcept
   {
-    return !(*this == other);
+    // Interned types are unique, so identical instances short-circuit the virtual comparison.
+    return this != &other && !(*this == other);
   }
 
   virtual std::string
@@ -66,6 +67,47 @@ protected:
   {}
 };
 
+/**
+ * Global table of interned types.
+ *
+ * The table maps every type to a canonical instance such that structurally equal types, i.e.,
+ * types that compare equal with Type::operator==, are represented by the same object. Type
+ * equality of interned types therefore reduces to a pointer comparison. An interned type is
+ * released, and its entry erased from the table, as soon as the last reference to it outside of
+ * the table is dropped. All member functions are thread-safe.
+ */
+class TypeTable final
+{
+public:
+  /**
+   * Interns \p type.
+   *
+   * @param type The type that is interned.
+   * @return The canonical instance of all types equal to \p type. This is \p type itself if no
+   * equal type is currently interned.
+   */
+  template<class T>
+  static std::shared_ptr<const T>
+  Intern(std::shared_ptr<const T> type)
+  {
+    static_assert(
+        std::is_base_of<jlm::rvsdg::Type, T>::value,
+        "Template parameter T must be derived from jlm::rvsdg::Type.");
+
+    return std::static_pointer_cast<const T>(InternType(std::move(type)));
+  }
+
+  /**
+   * @return The number of types that are currently interned.
+   */
+  [[nodiscard]] static std::size_t
+  NumTypes();
+
+private:
+  static std::shared_ptr<const Type>
+  InternType(std::shared_ptr<const Type> type);
+};
+
 template<class T>
 static inline bool
 is(const jlm::rvsdg::Type & type) noexcept
@@ -9,6 +9,7 @@
 #include <jlm/llvm/frontend/InterProceduralGraphConversion.hpp>
 #include <jlm/llvm/frontend/LlvmModuleConversion.hpp>
 #include <jlm/llvm/ir/ipgraph-module.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
@@ -18,14 +19,19 @@
 #include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
 #include <jlm/llvm/opt/alias-analyses/TopDownMemoryNodeEliminator.hpp>
 #include <jlm/llvm/opt/cne.hpp>
+#include <jlm/llvm/opt/CostModelInliner.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
 #include <jlm/llvm/opt/inlining.hpp>
 #include <jlm/llvm/opt/InvariantValueRedirection.hpp>
 #include <jlm/llvm/opt/inversion.hpp>
+#include <jlm/llvm/opt/LoopInvariantCodeMotion.hpp>
 #include <jlm/llvm/opt/pull.hpp>
 #include <jlm/llvm/opt/push.hpp>
 #include <jlm/llvm/opt/reduction.hpp>
 #include <jlm/llvm/opt/RvsdgTreePrinter.hpp>
+#include <jlm/llvm/opt/ScalarPromotion.hpp>
+#include <jlm/llvm/opt/SlpVectorizer.hpp>
+#include <jlm/llvm/opt/StrengthReduction.hpp>
 #include <jlm/llvm/opt/unroll.hpp>
 #include <jlm/rvsdg/view.hpp>
 #include <jlm/tooling/Command.hpp>
@@ -330,11 +336,37 @@ JlmOptCommand::ToString() const
       "-s " + CommandLineOptions_.GetStatisticsCollectorSettings().GetOutputDirectory().to_str()
       + " ";
 
+  auto numThreads = CommandLineOptions_.GetNumThreads();
+  std::string numThreadsArgument =
+      numThreads > 1 ? util::strfmt("--num-threads=", numThreads, " ") : "";
+  std::string skipUnchangedLambdasArgument =
+      CommandLineOptions_.SkipUnchangedLambdas() ? "--skip-unchanged-lambdas " : "";
+  auto maxFixpointIterations = CommandLineOptions_.GetMaxFixpointIterations();
+  std::string maxFixpointIterationsArgument =
+      maxFixpointIterations > 1
+          ? util::strfmt("--max-fixpoint-iterations=", maxFixpointIterations, " ")
+          : "";
+  auto unrollFactor = CommandLineOptions_.GetUnrollFactor();
+  std::string unrollFactorArgument =
+      unrollFactor != 4 ? util::strfmt("--unroll-factor=", unrollFactor, " ") : "";
+  auto unrollBudget = CommandLineOptions_.GetUnrollBudget();
+  std::string unrollBudgetArgument =
+      unrollBudget != 0 ? util::strfmt("--unroll-budget=", unrollBudget, " ") : "";
+  auto slpVectorWidth = CommandLineOptions_.GetSlpVectorWidth();
+  std::string slpVectorWidthArgument =
+      slpVectorWidth != 128 ? util::strfmt("--slp-vector-width=", slpVectorWidth, " ") : "";
+
   return util::strfmt(
       ProgramName_,
       " ",
       outputFormatArgument,
       optimizationArguments,
+      numThreadsArgument,
+      skipUnchangedLambdasArgument,
+      maxFixpointIterationsArgument,
+      unrollFactorArgument,
+      unrollBudgetArgument,
+      slpVectorWidthArgument,
       statisticsDirArgument,
       statisticsArguments,
       outputFileArgument,
@@ -352,10 +384,19 @@ JlmOptCommand::Run() const
       CommandLineOptions_.GetInputFormat(),
       statisticsCollector);
 
+  auto transformations = GetTransformations();
+  rvsdg::RepeatUntilFixpoint fixpointGroup(
+      transformations,
+      CommandLineOptions_.GetMaxFixpointIterations());
+  if (CommandLineOptions_.GetMaxFixpointIterations() > 1)
+    transformations = { &fixpointGroup };
+
   rvsdg::TransformationSequence::CreateAndRun(
       *rvsdgModule,
       statisticsCollector,
-      GetTransformations());
+      transformations,
+      CommandLineOptions_.GetNumThreads(),
+      CommandLineOptions_.SkipUnchangedLambdas());
 
   PrintRvsdgModule(
       *rvsdgModule,
@@ -405,14 +446,22 @@ JlmOptCommand::CreateTransformation(
     return std::make_unique<llvm::aa::AliasAnalysisStateEncoder<Steensgaard, RegionAwareMnp>>();
   case JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination:
     return std::make_unique<llvm::cne>();
+  case JlmOptCommandLineOptions::OptimizationId::CommonNodeEliminationValueNumbering:
+    return std::make_unique<llvm::cne>(llvm::cne::Mode::ValueNumbering);
   case JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination:
     return std::make_unique<llvm::DeadNodeElimination>();
   case JlmOptCommandLineOptions::OptimizationId::FunctionInlining:
     return std::make_unique<llvm::fctinline>();
+  case JlmOptCommandLineOptions::OptimizationId::FunctionInliningCostModel:
+    return std::make_unique<llvm::CostModelInliner>();
   case JlmOptCommandLineOptions::OptimizationId::InvariantValueRedirection:
     return std::make_unique<llvm::InvariantValueRedirection>();
+  case JlmOptCommandLineOptions::OptimizationId::LoopInvariantCodeMotion:
+    return std::make_unique<llvm::LoopInvariantCodeMotion>();
   case JlmOptCommandLineOptions::OptimizationId::LoopUnrolling:
-    return std::make_unique<llvm::loopunroll>(4);
+    return std::make_unique<llvm::loopunroll>(
+        CommandLineOptions_.GetUnrollFactor(),
+        CommandLineOptions_.GetUnrollBudget());
   case JlmOptCommandLineOptions::OptimizationId::NodePullIn:
     return std::make_unique<llvm::pullin>();
   case JlmOptCommandLineOptions::OptimizationId::NodePushOut:
@@ -422,6 +471,12 @@ JlmOptCommand::CreateTransformation(
   case JlmOptCommandLineOptions::OptimizationId::RvsdgTreePrinter:
     return std::make_unique<llvm::RvsdgTreePrinter>(
         CommandLineOptions_.GetRvsdgTreePrinterConfiguration());
+  case JlmOptCommandLineOptions::OptimizationId::ScalarPromotion:
+    return std::make_unique<llvm::ScalarPromotion>();
+  case JlmOptCommandLineOptions::OptimizationId::SlpVectorizer:
+    return std::make_unique<llvm::SlpVectorizer>(CommandLineOptions_.GetSlpVectorWidth());
+  case JlmOptCommandLineOptions::OptimizationId::StrengthReduction:
+    return std::make_unique<llvm::StrengthReduction>();
   case JlmOptCommandLineOptions::OptimizationId::ThetaGammaInversion:
     return std::make_unique<llvm::tginversion>();
   default:
@@ -483,6 +538,10 @@ JlmOptCommand::ParseInputFile(
   {
     return ParseMlirIrFile(inputFile, statisticsCollector);
   }
+  else if (inputFormat == tooling::JlmOptCommandLineOptions::InputFormat::RvsdgBinary)
+  {
+    return llvm::ReadRvsdgBinary(inputFile);
+  }
   else
   {
     JLM_UNREACHABLE("Unhandled input format.");
@@ -609,6 +668,26 @@ JlmOptCommand::PrintAsDot(
   }
 }
 
+void
+JlmOptCommand::PrintAsRvsdgBinary(
+    const llvm::RvsdgModule & rvsdgModule,
+    const util::filepath & outputFile,
+    util::StatisticsCollector &)
+{
+  if (outputFile == "")
+  {
+    llvm::WriteRvsdgBinary(rvsdgModule, std::cout);
+    std::cout.flush();
+  }
+  else
+  {
+    std::ofstream fs;
+    fs.open(outputFile.to_str(), std::ios::binary);
+    llvm::WriteRvsdgBinary(rvsdgModule, fs);
+    fs.close();
+  }
+}
+
 void
 JlmOptCommand::PrintRvsdgModule(
     llvm::RvsdgModule & rvsdgModule,
@@ -640,6 +719,10 @@ JlmOptCommand::PrintRvsdgModule(
   {
     PrintAsDot(rvsdgModule, outputFile, statisticsCollector);
   }
+  else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::RvsdgBinary)
+  {
+    PrintAsRvsdgBinary(rvsdgModule, outputFile, statisticsCollector);
+  }
   else
   {
     JLM_UNREACHABLE("Unhandled output format.");
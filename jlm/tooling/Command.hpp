@@ -421,6 +421,12 @@ private:
       const util::filepath & outputFile,
       util::StatisticsCollector & statisticsCollector);
 
+  static void
+  PrintAsRvsdgBinary(
+      const llvm::RvsdgModule & rvsdgModule,
+      const util::filepath & outputFile,
+      util::StatisticsCollector & statisticsCollector);
+
   [[nodiscard]] std::vector<rvsdg::Transformation *>
   GetTransformations() const;
 
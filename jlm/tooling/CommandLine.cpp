@@ -97,6 +97,12 @@ JlmOptCommandLineOptions::Reset() noexcept
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = util::StatisticsCollectorSettings();
   OptimizationIds_.clear();
+  NumThreads_ = 1;
+  SkipUnchangedLambdas_ = false;
+  MaxFixpointIterations_ = 1;
+  UnrollFactor_ = 4;
+  UnrollBudget_ = 0;
+  SlpVectorWidth_ = 128;
 }
 
 JlmOptCommandLineOptions::OptimizationId
@@ -116,15 +122,24 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToOptimizationId(
           OptimizationId::AASteensgaardRegionAware },
         { OptimizationCommandLineArgument::CommonNodeElimination_,
           OptimizationId::CommonNodeElimination },
+        { OptimizationCommandLineArgument::CommonNodeEliminationValueNumbering_,
+          OptimizationId::CommonNodeEliminationValueNumbering },
         { OptimizationCommandLineArgument::DeadNodeElimination_,
           OptimizationId::DeadNodeElimination },
         { OptimizationCommandLineArgument::FunctionInlining_, OptimizationId::FunctionInlining },
+        { OptimizationCommandLineArgument::FunctionInliningCostModel_,
+          OptimizationId::FunctionInliningCostModel },
         { OptimizationCommandLineArgument::InvariantValueRedirection_,
           OptimizationId::InvariantValueRedirection },
+        { OptimizationCommandLineArgument::LoopInvariantCodeMotion_,
+          OptimizationId::LoopInvariantCodeMotion },
         { OptimizationCommandLineArgument::NodePushOut_, OptimizationId::NodePushOut },
         { OptimizationCommandLineArgument::NodePullIn_, OptimizationId::NodePullIn },
         { OptimizationCommandLineArgument::NodeReduction_, OptimizationId::NodeReduction },
         { OptimizationCommandLineArgument::RvsdgTreePrinter_, OptimizationId::RvsdgTreePrinter },
+        { OptimizationCommandLineArgument::ScalarPromotion_, OptimizationId::ScalarPromotion },
+        { OptimizationCommandLineArgument::SlpVectorizer_, OptimizationId::SlpVectorizer },
+        { OptimizationCommandLineArgument::StrengthReduction_, OptimizationId::StrengthReduction },
         { OptimizationCommandLineArgument::ThetaGammaInversion_,
           OptimizationId::ThetaGammaInversion },
         { OptimizationCommandLineArgument::LoopUnrolling_, OptimizationId::LoopUnrolling } });
@@ -151,16 +166,25 @@ JlmOptCommandLineOptions::ToCommandLineArgument(OptimizationId optimizationId)
           OptimizationCommandLineArgument::AaSteensgaardRegionAware_ },
         { OptimizationId::CommonNodeElimination,
           OptimizationCommandLineArgument::CommonNodeElimination_ },
+        { OptimizationId::CommonNodeEliminationValueNumbering,
+          OptimizationCommandLineArgument::CommonNodeEliminationValueNumbering_ },
         { OptimizationId::DeadNodeElimination,
           OptimizationCommandLineArgument::DeadNodeElimination_ },
         { OptimizationId::FunctionInlining, OptimizationCommandLineArgument::FunctionInlining_ },
+        { OptimizationId::FunctionInliningCostModel,
+          OptimizationCommandLineArgument::FunctionInliningCostModel_ },
         { OptimizationId::InvariantValueRedirection,
           OptimizationCommandLineArgument::InvariantValueRedirection_ },
+        { OptimizationId::LoopInvariantCodeMotion,
+          OptimizationCommandLineArgument::LoopInvariantCodeMotion_ },
         { OptimizationId::LoopUnrolling, OptimizationCommandLineArgument::LoopUnrolling_ },
         { OptimizationId::NodePullIn, OptimizationCommandLineArgument::NodePullIn_ },
         { OptimizationId::NodePushOut, OptimizationCommandLineArgument::NodePushOut_ },
         { OptimizationId::NodeReduction, OptimizationCommandLineArgument::NodeReduction_ },
         { OptimizationId::RvsdgTreePrinter, OptimizationCommandLineArgument::RvsdgTreePrinter_ },
+        { OptimizationId::ScalarPromotion, OptimizationCommandLineArgument::ScalarPromotion_ },
+        { OptimizationId::SlpVectorizer, OptimizationCommandLineArgument::SlpVectorizer_ },
+        { OptimizationId::StrengthReduction, OptimizationCommandLineArgument::StrengthReduction_ },
         { OptimizationId::ThetaGammaInversion,
           OptimizationCommandLineArgument::ThetaGammaInversion_ } });
 
@@ -201,7 +225,9 @@ const char *
 JlmOptCommandLineOptions::ToCommandLineArgument(InputFormat inputFormat)
 {
   static std::unordered_map<InputFormat, const char *> map(
-      { { InputFormat::Llvm, "llvm" }, { InputFormat::Mlir, "mlir" } });
+      { { InputFormat::Llvm, "llvm" },
+        { InputFormat::Mlir, "mlir" },
+        { InputFormat::RvsdgBinary, "rvsdg-binary" } });
 
   if (map.find(inputFormat) != map.end())
     return map[inputFormat];
@@ -232,6 +258,7 @@ JlmOptCommandLineOptions::GetStatisticsIdCommandLineArguments()
     { util::Statistics::Id::FunctionInlining, "print-iln-stat" },
     { util::Statistics::Id::InvariantValueRedirection, "printInvariantValueRedirection" },
     { util::Statistics::Id::JlmToRvsdgConversion, "print-jlm-rvsdg-conversion" },
+    { util::Statistics::Id::LoopInvariantCodeMotion, "print-licm-stat" },
     { util::Statistics::Id::LoopUnrolling, "print-unroll-stat" },
     { util::Statistics::Id::MemoryStateEncoder, "print-basicencoder-encoding" },
     { util::Statistics::Id::PullNodes, "print-pull-stat" },
@@ -242,7 +269,10 @@ JlmOptCommandLineOptions::GetStatisticsIdCommandLineArguments()
     { util::Statistics::Id::RvsdgDestruction, "print-rvsdg-destruction" },
     { util::Statistics::Id::RvsdgOptimization, "print-rvsdg-optimization" },
     { util::Statistics::Id::RvsdgTreePrinter, "print-rvsdg-tree" },
+    { util::Statistics::Id::ScalarPromotion, "print-sp-stat" },
+    { util::Statistics::Id::SlpVectorizer, "print-slp-stat" },
     { util::Statistics::Id::SteensgaardAnalysis, "print-steensgaard-analysis" },
+    { util::Statistics::Id::StrengthReduction, "print-sr-stat" },
     { util::Statistics::Id::ThetaGammaInversion, "print-ivt-stat" },
     { util::Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" }
   };
@@ -259,7 +289,8 @@ JlmOptCommandLineOptions::GetOutputFormatCommandLineArguments()
   static std::unordered_map<OutputFormat, std::string_view> mapping = {
     { OutputFormat::Ascii, "ascii" }, { OutputFormat::Dot, "dot" },
     { OutputFormat::Llvm, "llvm" },   { OutputFormat::Mlir, "mlir" },
-    { OutputFormat::Tree, "tree" },   { OutputFormat::Xml, "xml" }
+    { OutputFormat::Tree, "tree" },   { OutputFormat::Xml, "xml" },
+    { OutputFormat::RvsdgBinary, "rvsdg-binary" }
   };
 
   auto firstIndex = static_cast<size_t>(OutputFormat::FirstEnumValue);
@@ -513,6 +544,9 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
           CreateStatisticsOption(
               util::Statistics::Id::JlmToRvsdgConversion,
               "Collect Jlm to RVSDG conversion pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopInvariantCodeMotion,
+              "Collect loop-invariant code motion pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::LoopUnrolling,
               "Collect loop unrolling pass statistics."),
@@ -540,9 +574,18 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
           CreateStatisticsOption(
               util::Statistics::Id::RvsdgTreePrinter,
               "Collect RVSDG tree printer pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::ScalarPromotion,
+              "Collect scalar promotion pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::SlpVectorizer,
+              "Collect SLP vectorizer pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::SteensgaardAnalysis,
               "Collect Steensgaard alias analysis pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::StrengthReduction,
+              "Collect strength reduction pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::ThetaGammaInversion,
               "Collect theta-gamma inversion pass statistics.")),
@@ -736,6 +779,9 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateStatisticsOption(
               util::Statistics::Id::JlmToRvsdgConversion,
               "Write Jlm to RVSDG conversion statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopInvariantCodeMotion,
+              "Write loop-invariant code motion statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::LoopUnrolling,
               "Write loop unrolling statistics to file."),
@@ -763,17 +809,28 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateStatisticsOption(
               util::Statistics::Id::RvsdgTreePrinter,
               "Write RVSDG tree printer pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::ScalarPromotion,
+              "Write scalar promotion statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::SlpVectorizer,
+              "Write SLP vectorizer statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::SteensgaardAnalysis,
               "Write Steensgaard analysis statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::StrengthReduction,
+              "Write strength reduction statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::ThetaGammaInversion,
               "Write theta-gamma inversion statistics to file.")),
       cl::desc("Write statistics"));
 
-#ifdef ENABLE_MLIR
   auto llvmInputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
+  auto rvsdgBinaryInputFormat = JlmOptCommandLineOptions::InputFormat::RvsdgBinary;
+#ifdef ENABLE_MLIR
   auto mlirInputFormat = JlmOptCommandLineOptions::InputFormat::Mlir;
+#endif
 
   cl::opt<JlmOptCommandLineOptions::InputFormat> inputFormat(
       "input-format",
@@ -783,14 +840,17 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               llvmInputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(llvmInputFormat),
               "Input LLVM IR [default]"),
+#ifdef ENABLE_MLIR
           ::clEnumValN(
               mlirInputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(mlirInputFormat),
-              "Input MLIR")),
-      cl::init(llvmInputFormat));
-#else
-  auto inputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
+              "Input MLIR"),
 #endif
+          ::clEnumValN(
+              rvsdgBinaryInputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgBinaryInputFormat),
+              "Input binary RVSDG")),
+      cl::init(llvmInputFormat));
 
   cl::opt<JlmOptCommandLineOptions::OutputFormat> outputFormat(
       "output-format",
@@ -807,7 +867,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateOutputFormatOption(
               JlmOptCommandLineOptions::OutputFormat::Tree,
               "Output Rvsdg Tree"),
-          CreateOutputFormatOption(JlmOptCommandLineOptions::OutputFormat::Xml, "Output XML")),
+          CreateOutputFormatOption(JlmOptCommandLineOptions::OutputFormat::Xml, "Output XML"),
+          CreateOutputFormatOption(
+              JlmOptCommandLineOptions::OutputFormat::RvsdgBinary,
+              "Output binary RVSDG")),
       cl::init(JlmOptCommandLineOptions::OutputFormat::Llvm));
 
   auto aAAndersenAgnostic = JlmOptCommandLineOptions::OptimizationId::AAAndersenAgnostic;
@@ -818,14 +881,23 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
   auto aASteensgaardRegionAware =
       JlmOptCommandLineOptions::OptimizationId::AASteensgaardRegionAware;
   auto commonNodeElimination = JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination;
+  auto commonNodeEliminationValueNumbering =
+      JlmOptCommandLineOptions::OptimizationId::CommonNodeEliminationValueNumbering;
   auto deadNodeElimination = JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination;
   auto functionInlining = JlmOptCommandLineOptions::OptimizationId::FunctionInlining;
+  auto functionInliningCostModel =
+      JlmOptCommandLineOptions::OptimizationId::FunctionInliningCostModel;
   auto invariantValueRedirection =
       JlmOptCommandLineOptions::OptimizationId::InvariantValueRedirection;
+  auto loopInvariantCodeMotion =
+      JlmOptCommandLineOptions::OptimizationId::LoopInvariantCodeMotion;
   auto nodePushOut = JlmOptCommandLineOptions::OptimizationId::NodePushOut;
   auto nodePullIn = JlmOptCommandLineOptions::OptimizationId::NodePullIn;
   auto nodeReduction = JlmOptCommandLineOptions::OptimizationId::NodeReduction;
   auto rvsdgTreePrinter = JlmOptCommandLineOptions::OptimizationId::RvsdgTreePrinter;
+  auto scalarPromotion = JlmOptCommandLineOptions::OptimizationId::ScalarPromotion;
+  auto slpVectorizer = JlmOptCommandLineOptions::OptimizationId::SlpVectorizer;
+  auto strengthReduction = JlmOptCommandLineOptions::OptimizationId::StrengthReduction;
   auto thetaGammaInversion = JlmOptCommandLineOptions::OptimizationId::ThetaGammaInversion;
   auto loopUnrolling = JlmOptCommandLineOptions::OptimizationId::LoopUnrolling;
 
@@ -855,6 +927,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               commonNodeElimination,
               JlmOptCommandLineOptions::ToCommandLineArgument(commonNodeElimination),
               "Common Node Elimination"),
+          ::clEnumValN(
+              commonNodeEliminationValueNumbering,
+              JlmOptCommandLineOptions::ToCommandLineArgument(commonNodeEliminationValueNumbering),
+              "Common Node Elimination with global value numbering"),
           ::clEnumValN(
               deadNodeElimination,
               JlmOptCommandLineOptions::ToCommandLineArgument(deadNodeElimination),
@@ -863,10 +939,18 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               functionInlining,
               JlmOptCommandLineOptions::ToCommandLineArgument(functionInlining),
               "Function Inlining"),
+          ::clEnumValN(
+              functionInliningCostModel,
+              JlmOptCommandLineOptions::ToCommandLineArgument(functionInliningCostModel),
+              "Cost model driven bottom-up Function Inlining"),
           ::clEnumValN(
               invariantValueRedirection,
               JlmOptCommandLineOptions::ToCommandLineArgument(invariantValueRedirection),
               "Invariant Value Redirection"),
+          ::clEnumValN(
+              loopInvariantCodeMotion,
+              JlmOptCommandLineOptions::ToCommandLineArgument(loopInvariantCodeMotion),
+              "Loop-Invariant Code Motion"),
           ::clEnumValN(
               nodePushOut,
               JlmOptCommandLineOptions::ToCommandLineArgument(nodePushOut),
@@ -883,6 +967,18 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               rvsdgTreePrinter,
               JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgTreePrinter),
               "Rvsdg Tree Printer"),
+          ::clEnumValN(
+              scalarPromotion,
+              JlmOptCommandLineOptions::ToCommandLineArgument(scalarPromotion),
+              "Scalar Promotion of loop-carried memory locations"),
+          ::clEnumValN(
+              slpVectorizer,
+              JlmOptCommandLineOptions::ToCommandLineArgument(slpVectorizer),
+              "Superword-Level Parallelism Vectorizer"),
+          ::clEnumValN(
+              strengthReduction,
+              JlmOptCommandLineOptions::ToCommandLineArgument(strengthReduction),
+              "Strength Reduction"),
           ::clEnumValN(
               thetaGammaInversion,
               JlmOptCommandLineOptions::ToCommandLineArgument(thetaGammaInversion),
@@ -906,6 +1002,45 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       cl::CommaSeparated,
       cl::desc("Comma separated list of RVSDG tree printer annotations"));
 
+  cl::opt<size_t> numThreads(
+      "num-threads",
+      cl::init(1),
+      cl::desc("Apply lambda-local optimizations with <n> threads. Default is 1."),
+      cl::value_desc("n"));
+
+  cl::opt<bool> skipUnchangedLambdas(
+      "skip-unchanged-lambdas",
+      cl::init(false),
+      cl::desc("Skip lambda-local optimizations for functions that did not change since the "
+               "optimization was last applied to them without effect."));
+
+  cl::opt<size_t> maxFixpointIterations(
+      "max-fixpoint-iterations",
+      cl::init(1),
+      cl::desc("Repeat the optimizations until the RVSDG no longer changes, but at most <n> "
+               "times. Default is 1."),
+      cl::value_desc("n"));
+
+  cl::opt<size_t> unrollFactor(
+      "unroll-factor",
+      cl::init(4),
+      cl::desc("Unroll loops with a factor of at most <n>. Default is 4."),
+      cl::value_desc("n"));
+
+  cl::opt<size_t> unrollBudget(
+      "unroll-budget",
+      cl::init(0),
+      cl::desc("Fully unroll loops with constant trip counts and pick the unroll factor of other "
+               "loops such that unrolled loop bodies have at most <n> nodes. If 0, all innermost "
+               "loops are unrolled with the unroll factor. Default is 0."),
+      cl::value_desc("n"));
+
+  cl::opt<size_t> slpVectorWidth(
+      "slp-vector-width",
+      cl::init(128),
+      cl::desc("Vectorize isomorphic scalar operations with vectors of <n> bits. Default is 128."),
+      cl::value_desc("n"));
+
   cl::ParseCommandLineOptions(argc, argv);
 
   jlm::util::filepath statisticsDirectoryFilePath(statisticDirectory);
@@ -931,7 +1066,13 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       outputFormat,
       std::move(statisticsCollectorSettings),
       std::move(treePrinterConfiguration),
-      std::move(optimizationIds));
+      std::move(optimizationIds),
+      numThreads,
+      skipUnchangedLambdas,
+      maxFixpointIterations,
+      unrollFactor,
+      unrollBudget,
+      slpVectorWidth);
 
   return *CommandLineOptions_;
 }
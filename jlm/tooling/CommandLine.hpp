@@ -45,6 +45,7 @@ public:
   {
     Llvm,
     Mlir,
+    RvsdgBinary,
   };
 
   enum class OutputFormat
@@ -57,6 +58,7 @@ public:
     Mlir,
     Tree,
     Xml,
+    RvsdgBinary,
 
     LastEnumValue // must always be the last enum value, used for iteration
   };
@@ -71,14 +73,20 @@ public:
     AASteensgaardAgnostic,
     AASteensgaardRegionAware,
     CommonNodeElimination,
+    CommonNodeEliminationValueNumbering,
     DeadNodeElimination,
     FunctionInlining,
+    FunctionInliningCostModel,
     InvariantValueRedirection,
+    LoopInvariantCodeMotion,
     LoopUnrolling,
     NodePullIn,
     NodePushOut,
     NodeReduction,
     RvsdgTreePrinter,
+    ScalarPromotion,
+    SlpVectorizer,
+    StrengthReduction,
     ThetaGammaInversion,
 
     LastEnumValue // must always be the last enum value, used for iteration
@@ -91,14 +99,26 @@ public:
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
       llvm::RvsdgTreePrinter::Configuration rvsdgTreePrinterConfiguration,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numThreads = 1,
+      bool skipUnchangedLambdas = false,
+      size_t maxFixpointIterations = 1,
+      size_t unrollFactor = 4,
+      size_t unrollBudget = 0,
+      size_t slpVectorWidth = 128)
       : InputFile_(std::move(inputFile)),
         InputFormat_(inputFormat),
         OutputFile_(std::move(outputFile)),
         OutputFormat_(outputFormat),
         StatisticsCollectorSettings_(std::move(statisticsCollectorSettings)),
         OptimizationIds_(std::move(optimizations)),
-        RvsdgTreePrinterConfiguration_(std::move(rvsdgTreePrinterConfiguration))
+        RvsdgTreePrinterConfiguration_(std::move(rvsdgTreePrinterConfiguration)),
+        NumThreads_(numThreads),
+        SkipUnchangedLambdas_(skipUnchangedLambdas),
+        MaxFixpointIterations_(maxFixpointIterations),
+        UnrollFactor_(unrollFactor),
+        UnrollBudget_(unrollBudget),
+        SlpVectorWidth_(slpVectorWidth)
   {}
 
   void
@@ -146,6 +166,75 @@ public:
     return RvsdgTreePrinterConfiguration_;
   }
 
+  /**
+   * @return The number of threads used for applying lambda-local optimizations.
+   *
+   * @see rvsdg::TransformationSequence
+   */
+  [[nodiscard]] size_t
+  GetNumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
+  /**
+   * @return True if lambda-local optimizations skip the lambda nodes that were not modified since
+   * the optimization was last applied to them without effect.
+   *
+   * @see rvsdg::TransformationSequence
+   */
+  [[nodiscard]] bool
+  SkipUnchangedLambdas() const noexcept
+  {
+    return SkipUnchangedLambdas_;
+  }
+
+  /**
+   * @return The maximum number of times the optimizations are applied until the RVSDG no longer
+   * changes.
+   *
+   * @see rvsdg::RepeatUntilFixpoint
+   */
+  [[nodiscard]] size_t
+  GetMaxFixpointIterations() const noexcept
+  {
+    return MaxFixpointIterations_;
+  }
+
+  /**
+   * @return The (maximum) factor with which loops are unrolled.
+   *
+   * @see llvm::loopunroll
+   */
+  [[nodiscard]] size_t
+  GetUnrollFactor() const noexcept
+  {
+    return UnrollFactor_;
+  }
+
+  /**
+   * @return The maximum number of nodes in the body of an unrolled loop. If it is zero, all
+   * innermost loops are unrolled with GetUnrollFactor().
+   *
+   * @see llvm::loopunroll
+   */
+  [[nodiscard]] size_t
+  GetUnrollBudget() const noexcept
+  {
+    return UnrollBudget_;
+  }
+
+  /**
+   * @return The width of the target's vector registers in bits.
+   *
+   * @see llvm::SlpVectorizer
+   */
+  [[nodiscard]] size_t
+  GetSlpVectorWidth() const noexcept
+  {
+    return SlpVectorWidth_;
+  }
+
   static OptimizationId
   FromCommandLineArgumentToOptimizationId(const std::string & commandLineArgument);
 
@@ -172,7 +261,13 @@ public:
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
       llvm::RvsdgTreePrinter::Configuration rvsdgTreePrinterConfiguration,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numThreads = 1,
+      bool skipUnchangedLambdas = false,
+      size_t maxFixpointIterations = 1,
+      size_t unrollFactor = 4,
+      size_t unrollBudget = 0,
+      size_t slpVectorWidth = 128)
   {
     return std::make_unique<JlmOptCommandLineOptions>(
         std::move(inputFile),
@@ -181,7 +276,13 @@ public:
         outputFormat,
         std::move(statisticsCollectorSettings),
         std::move(rvsdgTreePrinterConfiguration),
-        std::move(optimizations));
+        std::move(optimizations),
+        numThreads,
+        skipUnchangedLambdas,
+        maxFixpointIterations,
+        unrollFactor,
+        unrollBudget,
+        slpVectorWidth);
   }
 
 private:
@@ -192,6 +293,12 @@ private:
   util::StatisticsCollectorSettings StatisticsCollectorSettings_;
   std::vector<OptimizationId> OptimizationIds_;
   llvm::RvsdgTreePrinter::Configuration RvsdgTreePrinterConfiguration_;
+  size_t NumThreads_;
+  bool SkipUnchangedLambdas_;
+  size_t MaxFixpointIterations_;
+  size_t UnrollFactor_;
+  size_t UnrollBudget_;
+  size_t SlpVectorWidth_;
 
   struct OptimizationCommandLineArgument
   {
@@ -201,15 +308,22 @@ private:
     inline static const char * AaSteensgaardAgnostic_ = "AASteensgaardAgnostic";
     inline static const char * AaSteensgaardRegionAware_ = "AASteensgaardRegionAware";
     inline static const char * CommonNodeElimination_ = "CommonNodeElimination";
+    inline static const char * CommonNodeEliminationValueNumbering_ =
+        "CommonNodeEliminationValueNumbering";
     inline static const char * DeadNodeElimination_ = "DeadNodeElimination";
     inline static const char * FunctionInlining_ = "FunctionInlining";
+    inline static const char * FunctionInliningCostModel_ = "FunctionInliningCostModel";
     inline static const char * InvariantValueRedirection_ = "InvariantValueRedirection";
+    inline static const char * LoopInvariantCodeMotion_ = "LoopInvariantCodeMotion";
     inline static const char * NodePullIn_ = "NodePullIn";
     inline static const char * NodePushOut_ = "NodePushOut";
     inline static const char * ThetaGammaInversion_ = "ThetaGammaInversion";
     inline static const char * LoopUnrolling_ = "LoopUnrolling";
     inline static const char * NodeReduction_ = "NodeReduction";
     inline static const char * RvsdgTreePrinter_ = "RvsdgTreePrinter";
+    inline static const char * ScalarPromotion_ = "ScalarPromotion";
+    inline static const char * SlpVectorizer_ = "SlpVectorizer";
+    inline static const char * StrengthReduction_ = "StrengthReduction";
   };
 
   static const util::BijectiveMap<util::Statistics::Id, std::string_view> &
@@ -0,0 +1,333 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_DENSEIDMAP_HPP
+#define JLM_UTIL_DENSEIDMAP_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * A dense identifier. The index is dense and recycled, while the generation distinguishes the
+ * successive owners of an index.
+ */
+struct DenseId final
+{
+  size_t Index;
+  size_t Generation;
+};
+
+/**
+ * Allocates dense integer identifiers with indices from the range [0, NumIds()). Released indices
+ * are recycled by subsequent allocations, which keeps the range compact such that indices can be
+ * used for flat arrays. The generation of an index is incremented every time it is released, such
+ * that no two identifiers handed out by an allocator are identical.
+ *
+ * Allocate() and Release() are thread-safe.
+ */
+class DenseIdAllocator final
+{
+public:
+  /**
+   * @return A currently unused identifier.
+   */
+  [[nodiscard]] DenseId
+  Allocate()
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+    if (!FreeIds_.empty())
+    {
+      auto index = FreeIds_.back();
+      FreeIds_.pop_back();
+      return { index, Generations_[index] };
+    }
+
+    Generations_.push_back(0);
+    return { Generations_.size() - 1, 0 };
+  }
+
+  /**
+   * Releases identifier \p id such that its index can be handed out again.
+   */
+  void
+  Release(const DenseId & id)
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+    JLM_ASSERT(id.Index < NumIds());
+    JLM_ASSERT(id.Generation == Generations_[id.Index]);
+    Generations_[id.Index]++;
+    FreeIds_.push_back(id.Index);
+  }
+
+  /**
+   * @return An upper bound on the indices of all identifiers handed out so far.
+   */
+  [[nodiscard]] size_t
+  NumIds() const noexcept
+  {
+    return Generations_.size();
+  }
+
+  /**
+   * @return The number of identifiers that are currently in use.
+   */
+  [[nodiscard]] size_t
+  NumUsedIds() const noexcept
+  {
+    return NumIds() - FreeIds_.size();
+  }
+
+private:
+  // The current generation of every index handed out so far
+  std::vector<size_t> Generations_;
+  std::vector<size_t> FreeIds_;
+  std::mutex Mutex_;
+};
+
+/**
+ * Map from objects with dense identifiers to values of type \p V. The map is backed by a flat
+ * array that is indexed with the identifier of a key, which makes lookups, insertions, and removals
+ * a single indexed memory access.
+ *
+ * The identifier of a key is obtained by invoking \p IdOf on it. Slots are tagged with the
+ * generation of the identifier of their key. An entry of a destroyed key is therefore never
+ * reported for a key that reuses its index, even if the new key lives at the same address. The
+ * iterators of the map must not be used after a key in the map was destroyed, though.
+ *
+ * @tparam K The key type.
+ * @tparam V The value type. It must be default constructible.
+ * @tparam IdOf Function object that returns the DenseId of a key.
+ */
+template<class K, class V, class IdOf>
+class DenseIdMap final
+{
+  using Slot = std::pair<const K *, V>;
+
+public:
+  class ConstIterator final
+  {
+    friend DenseIdMap;
+
+    ConstIterator(const std::vector<Slot> & slots, size_t index)
+        : Slots_(&slots),
+          Index_(index)
+    {
+      SkipEmpty();
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Slot;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Slot *;
+    using reference = const Slot &;
+
+    reference
+    operator*() const
+    {
+      return (*Slots_)[Index_];
+    }
+
+    pointer
+    operator->() const
+    {
+      return &operator*();
+    }
+
+    ConstIterator &
+    operator++()
+    {
+      Index_++;
+      SkipEmpty();
+      return *this;
+    }
+
+    ConstIterator
+    operator++(int)
+    {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ConstIterator & other) const noexcept
+    {
+      return Slots_ == other.Slots_ && Index_ == other.Index_;
+    }
+
+    bool
+    operator!=(const ConstIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    void
+    SkipEmpty()
+    {
+      while (Index_ < Slots_->size() && (*Slots_)[Index_].first == nullptr)
+        Index_++;
+    }
+
+    const std::vector<Slot> * Slots_;
+    size_t Index_;
+  };
+
+  DenseIdMap() = default;
+
+  /**
+   * Creates an empty map with space for all keys with identifiers smaller than \p numIds.
+   */
+  explicit DenseIdMap(size_t numIds)
+  {
+    Slots_.resize(numIds);
+    Generations_.resize(numIds);
+  }
+
+  [[nodiscard]] bool
+  Contains(const K & key) const noexcept
+  {
+    const DenseId id = IdOf()(key);
+    return id.Index < Slots_.size() && Slots_[id.Index].first == &key
+        && Generations_[id.Index] == id.Generation;
+  }
+
+  /**
+   * Inserts \p value for \p key if \p key is not yet in the map.
+   *
+   * @return True if the value was inserted, otherwise false.
+   */
+  bool
+  Insert(const K & key, V value)
+  {
+    if (Contains(key))
+      return false;
+
+    auto & slot = GetSlot(key);
+
+    slot.first = &key;
+    slot.second = std::move(value);
+    Size_++;
+    return true;
+  }
+
+  /**
+   * @return The value of \p key. A default constructed value is inserted if \p key is not yet in
+   * the map.
+   */
+  V &
+  operator[](const K & key)
+  {
+    if (Contains(key))
+      return Slots_[IdOf()(key).Index].second;
+
+    auto & slot = GetSlot(key);
+    slot.first = &key;
+    slot.second = V();
+    Size_++;
+    return slot.second;
+  }
+
+  /**
+   * @return The value of \p key, which must be in the map.
+   */
+  [[nodiscard]] const V &
+  Lookup(const K & key) const
+  {
+    JLM_ASSERT(Contains(key));
+    return Slots_[IdOf()(key).Index].second;
+  }
+
+  /**
+   * Removes \p key from the map.
+   *
+   * @return True if \p key was in the map, otherwise false.
+   */
+  bool
+  Remove(const K & key)
+  {
+    if (!Contains(key))
+      return false;
+
+    auto & slot = Slots_[IdOf()(key).Index];
+    slot.first = nullptr;
+    slot.second = V();
+    Size_--;
+    return true;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Slots_.clear();
+    Generations_.clear();
+    Size_ = 0;
+  }
+
+  [[nodiscard]] ConstIterator
+  begin() const
+  {
+    return ConstIterator(Slots_, 0);
+  }
+
+  [[nodiscard]] ConstIterator
+  end() const
+  {
+    return ConstIterator(Slots_, Slots_.size());
+  }
+
+private:
+  /**
+   * @return The empty slot for \p key, which must not be in the map.
+   */
+  Slot &
+  GetSlot(const K & key)
+  {
+    const DenseId id = IdOf()(key);
+    if (id.Index >= Slots_.size())
+    {
+      const auto numSlots = std::max(id.Index + 1, 2 * Slots_.size());
+      Slots_.resize(numSlots);
+      Generations_.resize(numSlots);
+    }
+
+    auto & slot = Slots_[id.Index];
+    if (slot.first != nullptr)
+    {
+      // The slot belongs to a destroyed key whose index was recycled.
+      slot.first = nullptr;
+      slot.second = V();
+      Size_--;
+    }
+
+    Generations_[id.Index] = id.Generation;
+    return slot;
+  }
+
+  size_t Size_ = 0;
+  std::vector<Slot> Slots_;
+  // The generation of the identifier of the key in each slot
+  std::vector<size_t> Generations_;
+};
+
+}
+
+#endif
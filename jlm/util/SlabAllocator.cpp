@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/SlabAllocator.hpp>
+
+#include <algorithm>
+#include <new>
+
+namespace jlm::util
+{
+
+SlabAllocator::~SlabAllocator() noexcept
+{
+  JLM_ASSERT(NumLargeBytesInUse_ == 0);
+}
+
+SlabAllocator::SlabAllocator() noexcept
+    : IsTearingDown_(false),
+      NumBytesInUse_(0),
+      NumLargeBytesInUse_(0),
+      SlabCursor_(nullptr),
+      SlabEnd_(nullptr),
+      FreeLists_({})
+{}
+
+void *
+SlabAllocator::Allocate(size_t size)
+{
+  std::lock_guard<std::mutex> guard(Mutex_);
+  JLM_ASSERT(!IsTearingDown_);
+
+  if (size == 0)
+    size = 1;
+
+  auto roundedSize = RoundUp(size);
+  if (roundedSize > MaxSmallSize)
+  {
+    auto ptr = ::operator new(roundedSize);
+    NumLargeBytesInUse_ += roundedSize;
+    NumBytesInUse_ += roundedSize;
+    return ptr;
+  }
+
+  NumBytesInUse_ += roundedSize;
+
+  auto & freeList = FreeLists_[GetSizeClass(roundedSize)];
+  if (freeList)
+  {
+    auto block = freeList;
+    freeList = block->Next;
+    return block;
+  }
+
+  return AllocateFromSlab(roundedSize);
+}
+
+void
+SlabAllocator::Deallocate(void * ptr, size_t size) noexcept
+{
+  if (ptr == nullptr)
+    return;
+
+  if (size == 0)
+    size = 1;
+
+  std::lock_guard<std::mutex> guard(Mutex_);
+  auto roundedSize = RoundUp(size);
+  JLM_ASSERT(NumBytesInUse_ >= roundedSize);
+  NumBytesInUse_ -= roundedSize;
+
+  if (roundedSize > MaxSmallSize)
+  {
+    NumLargeBytesInUse_ -= roundedSize;
+    ::operator delete(ptr);
+    return;
+  }
+
+  // The memory of all slabs is reclaimed at once when the allocator is destroyed.
+  if (IsTearingDown_)
+    return;
+
+  auto & freeList = FreeLists_[GetSizeClass(roundedSize)];
+  auto block = static_cast<FreeBlock *>(ptr);
+  block->Next = freeList;
+  freeList = block;
+}
+
+void *
+SlabAllocator::AllocateFromSlab(size_t roundedSize)
+{
+  if (static_cast<size_t>(SlabEnd_ - SlabCursor_) < roundedSize)
+  {
+    // Hand out the remainder of the current slab to the free lists, so that it is not wasted.
+    while (SlabCursor_ != SlabEnd_)
+    {
+      auto remainder = std::min(static_cast<size_t>(SlabEnd_ - SlabCursor_), MaxSmallSize);
+      auto block = reinterpret_cast<FreeBlock *>(SlabCursor_);
+      auto & freeList = FreeLists_[GetSizeClass(remainder)];
+      block->Next = freeList;
+      freeList = block;
+      SlabCursor_ += remainder;
+    }
+
+    Slabs_.emplace_back(new std::byte[SlabSize]);
+    SlabCursor_ = Slabs_.back().get();
+    SlabEnd_ = SlabCursor_ + SlabSize;
+  }
+
+  auto ptr = SlabCursor_;
+  SlabCursor_ += roundedSize;
+  return ptr;
+}
+
+}
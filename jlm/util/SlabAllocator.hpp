@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SLABALLOCATOR_HPP
+#define JLM_UTIL_SLABALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * \brief Size-class slab allocator for many small, similarly sized objects.
+ *
+ * Small requests are rounded up to a multiple of \ref Granularity and bump-allocated from large
+ * slabs. Freed blocks are kept in one free list per size class and are recycled by subsequent
+ * allocations of the same size class. Requests larger than \ref MaxSmallSize bypass the slabs and
+ * are forwarded to the global allocator.
+ *
+ * Slabs are only returned to the system when the allocator itself is destroyed. This allows an
+ * owner to tear down all objects at once: after BeginTeardown() is invoked, deallocations of small
+ * blocks only update the accounting and no longer touch the free lists.
+ *
+ * Allocate() and Deallocate() are thread-safe, such that objects can be created and destroyed
+ * concurrently. The remaining methods must not be invoked concurrently with them.
+ */
+class SlabAllocator final
+{
+  struct FreeBlock
+  {
+    FreeBlock * Next;
+  };
+
+public:
+  /**
+   * All returned blocks are aligned to this many bytes, and all small sizes are rounded up to a
+   * multiple of it.
+   */
+  static constexpr size_t Granularity = alignof(std::max_align_t);
+
+  /**
+   * The largest request size served from slabs.
+   */
+  static constexpr size_t MaxSmallSize = 512;
+
+  /**
+   * The size of a single slab in bytes.
+   */
+  static constexpr size_t SlabSize = 64 * 1024;
+
+  ~SlabAllocator() noexcept;
+
+  SlabAllocator() noexcept;
+
+  SlabAllocator(const SlabAllocator &) = delete;
+
+  SlabAllocator(SlabAllocator &&) = delete;
+
+  SlabAllocator &
+  operator=(const SlabAllocator &) = delete;
+
+  SlabAllocator &
+  operator=(SlabAllocator &&) = delete;
+
+  /**
+   * Allocates a block of at least \p size bytes.
+   *
+   * @param size The number of requested bytes.
+   * @return A pointer to the allocated block, aligned to \ref Granularity.
+   */
+  [[nodiscard]] void *
+  Allocate(size_t size);
+
+  /**
+   * Releases a block previously returned by Allocate().
+   *
+   * @param ptr The block to release.
+   * @param size The size that was passed to Allocate() when the block was allocated.
+   */
+  void
+  Deallocate(void * ptr, size_t size) noexcept;
+
+  /**
+   * Indicates that all remaining blocks are about to be released, and that no more allocations
+   * follow. Small blocks released afterwards are not recycled anymore, as their memory is reclaimed
+   * in bulk when the allocator is destroyed.
+   */
+  void
+  BeginTeardown() noexcept
+  {
+    IsTearingDown_ = true;
+  }
+
+  /**
+   * @return The number of bytes currently handed out to clients, including padding to the size
+   * class.
+   */
+  [[nodiscard]] size_t
+  NumBytesInUse() const noexcept
+  {
+    return NumBytesInUse_;
+  }
+
+  /**
+   * @return The number of bytes currently reserved from the system, i.e., the size of all slabs
+   * plus the size of all live large blocks.
+   */
+  [[nodiscard]] size_t
+  NumBytesReserved() const noexcept
+  {
+    return Slabs_.size() * SlabSize + NumLargeBytesInUse_;
+  }
+
+  /**
+   * @return The number of slabs allocated so far.
+   */
+  [[nodiscard]] size_t
+  NumSlabs() const noexcept
+  {
+    return Slabs_.size();
+  }
+
+private:
+  static constexpr size_t NumSizeClasses = MaxSmallSize / Granularity;
+
+  static constexpr size_t
+  RoundUp(size_t size) noexcept
+  {
+    return (size + Granularity - 1) & ~(Granularity - 1);
+  }
+
+  static constexpr size_t
+  GetSizeClass(size_t roundedSize) noexcept
+  {
+    return roundedSize / Granularity - 1;
+  }
+
+  void *
+  AllocateFromSlab(size_t roundedSize);
+
+  bool IsTearingDown_;
+  size_t NumBytesInUse_;
+  size_t NumLargeBytesInUse_;
+  std::byte * SlabCursor_;
+  std::byte * SlabEnd_;
+  std::array<FreeBlock *, NumSizeClasses> FreeLists_;
+  std::vector<std::unique_ptr<std::byte[]>> Slabs_;
+  std::mutex Mutex_;
+};
+
+}
+
+#endif // JLM_UTIL_SLABALLOCATOR_HPP
@@ -0,0 +1,651 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SPARSEBITVECTOR_HPP
+#define JLM_UTIL_SPARSEBITVECTOR_HPP
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
+#include <jlm/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Represents a set of unsigned integers as a sorted list of fixed-size bit chunks. Only chunks
+ * that contain at least one item are stored. Set operations between two sparse bit vectors walk
+ * both chunk lists in lockstep and operate on whole 64-bit words, which makes them considerably
+ * cheaper than item-by-item hashing for dense clusters of items.
+ *
+ * @tparam ItemType The type of the items in the set. Must be an unsigned integer type.
+ * @tparam NumChunkBits The number of bits per chunk. Must be a multiple of 64.
+ */
+template<typename ItemType, size_t NumChunkBits = 128>
+class SparseBitVector final
+{
+  static_assert(std::is_unsigned_v<ItemType>, "SparseBitVector requires unsigned items");
+  static_assert(NumChunkBits % 64 == 0, "Chunks must consist of whole 64-bit words");
+
+  using Word = uint64_t;
+  static constexpr size_t NumWordBits = 64;
+  static constexpr size_t NumChunkWords = NumChunkBits / NumWordBits;
+
+  struct Chunk
+  {
+    size_t Index;
+    std::array<Word, NumChunkWords> Words;
+
+    [[nodiscard]] bool
+    IsEmpty() const noexcept
+    {
+      for (auto word : Words)
+      {
+        if (word != 0)
+          return false;
+      }
+
+      return true;
+    }
+  };
+
+public:
+  /**
+   * Iterates over the items in ascending order. The iterator remembers the current item rather
+   * than a position in the chunk list, such that it stays valid if items are added to the set
+   * while iterating. Items that are added after the current item are visited, items that are
+   * added before it are not.
+   */
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ItemType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ItemType *;
+    using reference = ItemType;
+
+  private:
+    friend SparseBitVector;
+
+    // The chunk position of end iterators, which compare equal to any iterator past the last chunk
+    static constexpr size_t EndPosition = std::numeric_limits<size_t>::max();
+
+    ItemConstIterator(const std::vector<Chunk> & chunks, size_t position)
+        : Chunks_(&chunks),
+          Position_(position)
+    {
+      if (!IsAtEnd())
+        SeekFrom(0);
+    }
+
+  public:
+    ItemType
+    operator*() const
+    {
+      JLM_ASSERT(!IsAtEnd());
+      return static_cast<ItemType>(Item_);
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      JLM_ASSERT(!IsAtEnd());
+      if (Item_ == std::numeric_limits<ItemType>::max())
+        Position_ = EndPosition;
+      else
+        SeekFrom(Item_ + 1);
+
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      if (IsAtEnd() || other.IsAtEnd())
+        return IsAtEnd() && other.IsAtEnd();
+
+      return Chunks_ == other.Chunks_ && Item_ == other.Item_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    [[nodiscard]] bool
+    IsAtEnd() const noexcept
+    {
+      return Position_ == EndPosition;
+    }
+
+    /**
+     * Moves the iterator to the smallest item in the set that is at least \p item, or to the end.
+     * The chunk position is only a hint, as chunks can be inserted in front of it while iterating.
+     */
+    void
+    SeekFrom(size_t item)
+    {
+      const auto & chunks = *Chunks_;
+      const auto chunkIndex = item / NumChunkBits;
+      if (Position_ >= chunks.size() || chunks[Position_].Index != chunkIndex)
+      {
+        auto it = std::lower_bound(
+            chunks.begin(),
+            chunks.end(),
+            chunkIndex,
+            [](const Chunk & chunk, size_t index)
+            {
+              return chunk.Index < index;
+            });
+        Position_ = it - chunks.begin();
+      }
+
+      for (; Position_ < chunks.size(); Position_++)
+      {
+        const auto & chunk = chunks[Position_];
+        const auto firstBit = chunk.Index == chunkIndex ? item % NumChunkBits : 0;
+        for (auto wordIndex = firstBit / NumWordBits; wordIndex < NumChunkWords; wordIndex++)
+        {
+          auto word = chunk.Words[wordIndex];
+          if (wordIndex == firstBit / NumWordBits)
+            word &= ~Word(0) << (firstBit % NumWordBits);
+
+          if (word != 0)
+          {
+            auto bit = static_cast<size_t>(__builtin_ctzll(word));
+            Item_ = chunk.Index * NumChunkBits + wordIndex * NumWordBits + bit;
+            return;
+          }
+        }
+      }
+
+      Position_ = EndPosition;
+    }
+
+    const std::vector<Chunk> * Chunks_;
+    size_t Position_;
+    size_t Item_ = 0;
+  };
+
+  ~SparseBitVector() noexcept = default;
+
+  SparseBitVector() = default;
+
+  SparseBitVector(std::initializer_list<ItemType> initializerList)
+  {
+    for (auto item : initializerList)
+      Insert(item);
+  }
+
+  SparseBitVector(const SparseBitVector & other) = default;
+
+  SparseBitVector(SparseBitVector && other) noexcept
+      : Chunks_(std::move(other.Chunks_)),
+        Size_(other.Size_)
+  {
+    other.Clear();
+  }
+
+  SparseBitVector &
+  operator=(const SparseBitVector & other) = default;
+
+  SparseBitVector &
+  operator=(SparseBitVector && other) noexcept
+  {
+    Chunks_ = std::move(other.Chunks_);
+    Size_ = other.Size_;
+    other.Clear();
+    return *this;
+  }
+
+  /**
+   * Removes all items from the set.
+   */
+  void
+  Clear() noexcept
+  {
+    Chunks_.clear();
+    Size_ = 0;
+  }
+
+  /**
+   * @return True if the set contains \p item, otherwise false.
+   */
+  [[nodiscard]] bool
+  Contains(ItemType item) const noexcept
+  {
+    auto chunk = FindChunk(item / NumChunkBits);
+    if (chunk == Chunks_.end() || chunk->Index != item / NumChunkBits)
+      return false;
+
+    return (chunk->Words[WordIndex(item)] & BitMask(item)) != 0;
+  }
+
+  /**
+   * @return The number of items in the set.
+   */
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  /**
+   * @return True if the set is empty, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Size_ == 0;
+  }
+
+  /**
+   * @return The number of chunks used to represent the set.
+   */
+  [[nodiscard]] size_t
+  NumChunks() const noexcept
+  {
+    return Chunks_.size();
+  }
+
+  /**
+   * @return The number of bytes used by the set, including its chunks.
+   */
+  [[nodiscard]] size_t
+  NumBytes() const noexcept
+  {
+    return sizeof(*this) + Chunks_.capacity() * sizeof(Chunk);
+  }
+
+  /**
+   * @return A hash value of the items in the set. Equal sets have equal hash values.
+   */
+  [[nodiscard]] size_t
+  Hash() const noexcept
+  {
+    size_t seed = 0;
+    for (auto & chunk : Chunks_)
+    {
+      CombineHashesWithSeed(seed, std::hash<size_t>()(chunk.Index));
+      for (auto word : chunk.Words)
+        CombineHashesWithSeed(seed, std::hash<Word>()(word));
+    }
+
+    return seed;
+  }
+
+  /**
+   * Inserts \p item into the set.
+   *
+   * @return True if \p item was added to the set, false if it was already present.
+   */
+  bool
+  Insert(ItemType item)
+  {
+    auto index = item / NumChunkBits;
+    auto chunk = FindChunk(index);
+    if (chunk == Chunks_.end() || chunk->Index != index)
+      chunk = Chunks_.insert(chunk, Chunk{ index, {} });
+
+    auto & word = chunk->Words[WordIndex(item)];
+    if (word & BitMask(item))
+      return false;
+
+    word |= BitMask(item);
+    Size_++;
+    return true;
+  }
+
+  /**
+   * Removes \p item from the set.
+   *
+   * @return True if \p item was removed, false if it was not present.
+   */
+  bool
+  Remove(ItemType item)
+  {
+    auto chunk = FindChunk(item / NumChunkBits);
+    if (chunk == Chunks_.end() || chunk->Index != item / NumChunkBits)
+      return false;
+
+    auto & word = chunk->Words[WordIndex(item)];
+    if (!(word & BitMask(item)))
+      return false;
+
+    word &= ~BitMask(item);
+    Size_--;
+    if (chunk->IsEmpty())
+      Chunks_.erase(chunk);
+
+    return true;
+  }
+
+  /**
+   * @return An iterator range over the items of the set in ascending order.
+   */
+  [[nodiscard]] IteratorRange<ItemConstIterator>
+  Items() const noexcept
+  {
+    return { ItemConstIterator(Chunks_, 0),
+             ItemConstIterator(Chunks_, ItemConstIterator::EndPosition) };
+  }
+
+  /**
+   * Makes the set contain all items of itself and \p other.
+   *
+   * @return True if items were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other)
+  {
+    return UnionWith(other, nullptr);
+  }
+
+  /**
+   * Makes the set contain all items of itself and \p other. All items that are added to the set
+   * are also added to \p newItems.
+   *
+   * @return True if items were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other, SparseBitVector * newItems)
+  {
+    if (&other == this || other.IsEmpty())
+      return false;
+
+    // Collect the added items chunk by chunk, which keeps them sorted
+    SparseBitVector addedItems;
+    auto sizeBefore = Size_;
+    bool needsMerge = false;
+
+    auto it = Chunks_.begin();
+    for (auto & otherChunk : other.Chunks_)
+    {
+      while (it != Chunks_.end() && it->Index < otherChunk.Index)
+        ++it;
+
+      if (it == Chunks_.end() || it->Index != otherChunk.Index)
+      {
+        // Missing chunks are merged in a single pass after all existing chunks are updated
+        needsMerge = true;
+        Size_ += CountBits(otherChunk.Words);
+        if (newItems)
+          addedItems.AppendChunk(otherChunk.Index, otherChunk.Words);
+        continue;
+      }
+
+      std::array<Word, NumChunkWords> added{};
+      for (size_t n = 0; n < NumChunkWords; n++)
+      {
+        added[n] = otherChunk.Words[n] & ~it->Words[n];
+        it->Words[n] |= added[n];
+      }
+
+      auto numAdded = CountBits(added);
+      Size_ += numAdded;
+      if (newItems && numAdded != 0)
+        addedItems.AppendChunk(otherChunk.Index, added);
+    }
+
+    if (needsMerge)
+      MergeMissingChunks(other);
+
+    if (newItems)
+      newItems->UnionWith(addedItems);
+
+    return Size_ != sizeBefore;
+  }
+
+  /**
+   * Makes the set contain all items of itself and \p other, and makes \p other empty.
+   *
+   * @return True if items were added to the set, otherwise false.
+   */
+  bool
+  UnionWithAndClear(SparseBitVector & other)
+  {
+    if (Size() < other.Size())
+      std::swap(*this, other);
+
+    auto result = UnionWith(other);
+    other.Clear();
+    return result;
+  }
+
+  /**
+   * Removes all items from the set that are present in \p other.
+   */
+  void
+  DifferenceWith(const SparseBitVector & other)
+  {
+    if (&other == this)
+    {
+      Clear();
+      return;
+    }
+
+    auto otherIt = other.Chunks_.begin();
+    for (auto & chunk : Chunks_)
+    {
+      while (otherIt != other.Chunks_.end() && otherIt->Index < chunk.Index)
+        ++otherIt;
+
+      if (otherIt == other.Chunks_.end())
+        break;
+
+      if (otherIt->Index != chunk.Index)
+        continue;
+
+      for (size_t n = 0; n < NumChunkWords; n++)
+      {
+        Size_ -= __builtin_popcountll(chunk.Words[n] & otherIt->Words[n]);
+        chunk.Words[n] &= ~otherIt->Words[n];
+      }
+    }
+
+    RemoveEmptyChunks();
+  }
+
+  /**
+   * Removes all items from the set that are not present in \p other.
+   */
+  void
+  IntersectWith(const SparseBitVector & other)
+  {
+    auto otherIt = other.Chunks_.begin();
+    for (auto & chunk : Chunks_)
+    {
+      while (otherIt != other.Chunks_.end() && otherIt->Index < chunk.Index)
+        ++otherIt;
+
+      auto hasOtherChunk = otherIt != other.Chunks_.end() && otherIt->Index == chunk.Index;
+      for (size_t n = 0; n < NumChunkWords; n++)
+      {
+        auto kept = hasOtherChunk ? chunk.Words[n] & otherIt->Words[n] : 0;
+        Size_ -= __builtin_popcountll(chunk.Words[n] & ~kept);
+        chunk.Words[n] = kept;
+      }
+    }
+
+    RemoveEmptyChunks();
+  }
+
+  /**
+   * @return True if all items of the set are also present in \p other, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const SparseBitVector & other) const noexcept
+  {
+    if (Size() > other.Size())
+      return false;
+
+    auto otherIt = other.Chunks_.begin();
+    for (auto & chunk : Chunks_)
+    {
+      while (otherIt != other.Chunks_.end() && otherIt->Index < chunk.Index)
+        ++otherIt;
+
+      if (otherIt == other.Chunks_.end() || otherIt->Index != chunk.Index)
+        return false;
+
+      for (size_t n = 0; n < NumChunkWords; n++)
+      {
+        if (chunk.Words[n] & ~otherIt->Words[n])
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool
+  operator==(const SparseBitVector & other) const noexcept
+  {
+    if (Size_ != other.Size_ || Chunks_.size() != other.Chunks_.size())
+      return false;
+
+    for (size_t n = 0; n < Chunks_.size(); n++)
+    {
+      if (Chunks_[n].Index != other.Chunks_[n].Index || Chunks_[n].Words != other.Chunks_[n].Words)
+        return false;
+    }
+
+    return true;
+  }
+
+  bool
+  operator!=(const SparseBitVector & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  static size_t
+  WordIndex(ItemType item) noexcept
+  {
+    return (item % NumChunkBits) / NumWordBits;
+  }
+
+  static Word
+  BitMask(ItemType item) noexcept
+  {
+    return Word(1) << (item % NumWordBits);
+  }
+
+  static size_t
+  CountBits(const std::array<Word, NumChunkWords> & words) noexcept
+  {
+    size_t numBits = 0;
+    for (auto word : words)
+      numBits += __builtin_popcountll(word);
+
+    return numBits;
+  }
+
+  typename std::vector<Chunk>::const_iterator
+  FindChunk(size_t index) const noexcept
+  {
+    return std::lower_bound(
+        Chunks_.begin(),
+        Chunks_.end(),
+        index,
+        [](const Chunk & chunk, size_t index)
+        {
+          return chunk.Index < index;
+        });
+  }
+
+  typename std::vector<Chunk>::iterator
+  FindChunk(size_t index) noexcept
+  {
+    return std::lower_bound(
+        Chunks_.begin(),
+        Chunks_.end(),
+        index,
+        [](const Chunk & chunk, size_t index)
+        {
+          return chunk.Index < index;
+        });
+  }
+
+  /**
+   * Appends a chunk with the given \p index and \p words. The chunk must be placed
+   * after all other chunks.
+   */
+  void
+  AppendChunk(size_t index, const std::array<Word, NumChunkWords> & words)
+  {
+    JLM_ASSERT(Chunks_.empty() || Chunks_.back().Index < index);
+    Chunks_.push_back(Chunk{ index, words });
+    Size_ += CountBits(words);
+  }
+
+  /**
+   * Inserts copies of all chunks of \p other whose indices are not present in the set.
+   */
+  void
+  MergeMissingChunks(const SparseBitVector & other)
+  {
+    std::vector<Chunk> chunks;
+    chunks.reserve(Chunks_.size() + other.Chunks_.size());
+
+    auto it = Chunks_.begin();
+    auto otherIt = other.Chunks_.begin();
+    while (it != Chunks_.end() || otherIt != other.Chunks_.end())
+    {
+      if (otherIt == other.Chunks_.end() || (it != Chunks_.end() && it->Index < otherIt->Index))
+      {
+        chunks.push_back(*it++);
+      }
+      else if (it == Chunks_.end() || otherIt->Index < it->Index)
+      {
+        chunks.push_back(*otherIt++);
+      }
+      else
+      {
+        chunks.push_back(*it++);
+        ++otherIt;
+      }
+    }
+
+    Chunks_ = std::move(chunks);
+  }
+
+  void
+  RemoveEmptyChunks()
+  {
+    auto isEmpty = [](const Chunk & chunk)
+    {
+      return chunk.IsEmpty();
+    };
+    Chunks_.erase(std::remove_if(Chunks_.begin(), Chunks_.end(), isEmpty), Chunks_.end());
+  }
+
+  std::vector<Chunk> Chunks_;
+  size_t Size_ = 0;
+};
+
+}
+
+#endif // JLM_UTIL_SPARSEBITVECTOR_HPP
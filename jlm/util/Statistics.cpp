@@ -28,6 +28,7 @@ GetStatisticsIdNames()
     { Statistics::Id::DeadNodeElimination, "DeadNodeElimination" },
     { Statistics::Id::FunctionInlining, "ILN" },
     { Statistics::Id::JlmToRvsdgConversion, "ControlFlowGraphToLambda" },
+    { Statistics::Id::LoopInvariantCodeMotion, "LICM" },
     { Statistics::Id::LoopUnrolling, "UNROLL" },
     { Statistics::Id::InvariantValueRedirection, "InvariantValueRedirection" },
     { Statistics::Id::MemoryStateEncoder, "MemoryStateEncoder" },
@@ -39,7 +40,10 @@ GetStatisticsIdNames()
     { Statistics::Id::RvsdgDestruction, "RVSDGDESTRUCTION" },
     { Statistics::Id::RvsdgOptimization, "RVSDGOPTIMIZATION" },
     { Statistics::Id::RvsdgTreePrinter, "RvsdgTreePrinter" },
+    { Statistics::Id::ScalarPromotion, "SP" },
+    { Statistics::Id::SlpVectorizer, "SLP" },
     { Statistics::Id::SteensgaardAnalysis, "SteensgaardAnalysis" },
+    { Statistics::Id::StrengthReduction, "SR" },
     { Statistics::Id::ThetaGammaInversion, "IVT" },
     { Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" }
   };
@@ -45,6 +45,7 @@ public:
     FunctionInlining,
     InvariantValueRedirection,
     JlmToRvsdgConversion,
+    LoopInvariantCodeMotion,
     LoopUnrolling,
     MemoryStateEncoder,
     PullNodes,
@@ -55,7 +56,10 @@ public:
     RvsdgDestruction,
     RvsdgOptimization,
     RvsdgTreePrinter,
+    ScalarPromotion,
+    SlpVectorizer,
     SteensgaardAnalysis,
+    StrengthReduction,
     ThetaGammaInversion,
     TopDownMemoryNodeEliminator,
 
@@ -213,12 +217,17 @@ protected:
     static inline const char * NumRvsdgInputsBefore = "#RvsdgInputsBefore";
     static inline const char * NumRvsdgInputsAfter = "#RvsdgInputsAfter";
 
+    static inline const char * NumRvsdgAllocatedBytes = "#RvsdgAllocatedBytes";
+    static inline const char * NumRvsdgAllocatedBytesBefore = "#RvsdgAllocatedBytesBefore";
+    static inline const char * NumRvsdgAllocatedBytesAfter = "#RvsdgAllocatedBytesAfter";
+
     inline static const char * NumPointsToGraphNodes = "#PointsToGraphNodes";
     inline static const char * NumPointsToGraphAllocaNodes = "#PointsToGraphAllocaNodes";
     inline static const char * NumPointsToGraphDeltaNodes = "#PointsToGraphDeltaNodes";
     inline static const char * NumPointsToGraphImportNodes = "#PointsToGraphImportNodes";
     inline static const char * NumPointsToGraphLambdaNodes = "#PointsToGraphLambdaNodes";
     inline static const char * NumPointsToGraphMallocNodes = "#PointsToGraphMallocNodes";
+    inline static const char * NumPointsToGraphFieldNodes = "#PointsToGraphFieldNodes";
     inline static const char * NumPointsToGraphMemoryNodes = "#PointsToGraphMemoryNodes";
     inline static const char * NumPointsToGraphRegisterNodes = "#PointsToGraphRegisterNodes";
     inline static const char * NumPointsToGraphEscapedNodes = "#PointsToGraphEscapedNodes";
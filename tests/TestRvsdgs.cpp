@@ -4102,4 +4102,62 @@ VariadicFunctionTest2::SetupRvsdg()
   return rvsdgModule;
 }
 
+std::unique_ptr<jlm::llvm::RvsdgModule>
+StructFieldsTest::SetupRvsdg()
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto pointerType = PointerType::Create();
+  auto intType = rvsdg::bittype::Create(32);
+  auto & structDeclaration = rvsdgModule->AddStructTypeDeclaration(
+      StructType::Declaration::Create({ pointerType, intType, pointerType }));
+  auto structType = StructType::Create(false, structDeclaration);
+
+  auto functionType = rvsdg::FunctionType::Create(
+      { IOStateType::Create(), MemoryStateType::Create() },
+      { IOStateType::Create(), MemoryStateType::Create() });
+
+  auto lambda = rvsdg::LambdaNode::Create(
+      rvsdg.GetRootRegion(),
+      llvm::LlvmLambdaOperation::Create(functionType, "f", linkage::external_linkage));
+  auto iOStateArgument = lambda->GetFunctionArguments()[0];
+  auto memoryStateArgument = lambda->GetFunctionArguments()[1];
+
+  auto zero = rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+  auto one = rvsdg::create_bitconstant(lambda->subregion(), 32, 1);
+  auto two = rvsdg::create_bitconstant(lambda->subregion(), 32, 2);
+
+  auto allocaA = alloca_op::create(intType, one, 4);
+  auto allocaB = alloca_op::create(intType, one, 4);
+  auto allocaS = alloca_op::create(structType, one, 8);
+  auto mergedMemoryState = MemoryStateMergeOperation::Create(
+      std::vector<rvsdg::output *>{ allocaA[1], allocaB[1], allocaS[1], memoryStateArgument });
+
+  auto storeX = StoreNonVolatileNode::Create(allocaS[0], allocaA[0], { mergedMemoryState }, 8);
+
+  auto gepZ = GetElementPtrOperation::Create(allocaS[0], { zero, two }, structType, pointerType);
+  auto storeZ = StoreNonVolatileNode::Create(gepZ, allocaB[0], { storeX[0] }, 8);
+  auto loadZ = LoadNonVolatileNode::Create(gepZ, { storeZ[0] }, pointerType, 8);
+  auto loadS = LoadNonVolatileNode::Create(allocaS[0], { loadZ[1] }, structType, 8);
+
+  auto lambdaOutput = lambda->finalize({ iOStateArgument, loadS[1] });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  /*
+   * Assign nodes
+   */
+  this->Lambda_ = lambda;
+  this->AllocaA_ = rvsdg::output::GetNode(*allocaA[0]);
+  this->AllocaB_ = rvsdg::output::GetNode(*allocaB[0]);
+  this->AllocaS_ = rvsdg::output::GetNode(*allocaS[0]);
+  this->GepZ_ = rvsdg::output::GetNode(*gepZ);
+  this->LoadedPointer_ = loadZ[0];
+  this->StructLoad_ = rvsdg::output::GetNode(*loadS[0]);
+
+  return rvsdgModule;
+}
+
 }
@@ -2537,4 +2537,106 @@ private:
   rvsdg::Node * AllocaNode_ = {};
 };
 
+/** \brief RVSDG module with a struct containing two pointer fields.
+ *
+ * The class sets up an RVSDG module corresponding to the code:
+ *
+ * \code{.c}
+ *   struct S
+ *   {
+ *     int * x;
+ *     int y;
+ *     int * z;
+ *   };
+ *
+ *   void
+ *   f()
+ *   {
+ *     int a, b;
+ *     struct S s;
+ *     s.x = &a;
+ *     s.z = &b;
+ *     int * p = s.z;
+ *   }
+ * \endcode
+ *
+ * It uses a single memory state to sequentialize the respective memory operations.
+ * The field s.x is accessed through the address of s, without a GEP.
+ */
+class StructFieldsTest final : public RvsdgTest
+{
+public:
+  [[nodiscard]] const jlm::rvsdg::LambdaNode &
+  GetLambda() const noexcept
+  {
+    JLM_ASSERT(Lambda_ != nullptr);
+    return *Lambda_;
+  }
+
+  [[nodiscard]] const rvsdg::Node &
+  GetAllocaA() const noexcept
+  {
+    JLM_ASSERT(AllocaA_ != nullptr);
+    return *AllocaA_;
+  }
+
+  [[nodiscard]] const rvsdg::Node &
+  GetAllocaB() const noexcept
+  {
+    JLM_ASSERT(AllocaB_ != nullptr);
+    return *AllocaB_;
+  }
+
+  [[nodiscard]] const rvsdg::Node &
+  GetAllocaS() const noexcept
+  {
+    JLM_ASSERT(AllocaS_ != nullptr);
+    return *AllocaS_;
+  }
+
+  /**
+   * @return the GEP computing the address of s.z
+   */
+  [[nodiscard]] const rvsdg::Node &
+  GetGepZ() const noexcept
+  {
+    JLM_ASSERT(GepZ_ != nullptr);
+    return *GepZ_;
+  }
+
+  /**
+   * @return the output of the load of s.z
+   */
+  [[nodiscard]] const rvsdg::output &
+  GetLoadedPointer() const noexcept
+  {
+    JLM_ASSERT(LoadedPointer_ != nullptr);
+    return *LoadedPointer_;
+  }
+
+  /**
+   * @return the load of the whole struct s
+   */
+  [[nodiscard]] const rvsdg::Node &
+  GetStructLoad() const noexcept
+  {
+    JLM_ASSERT(StructLoad_ != nullptr);
+    return *StructLoad_;
+  }
+
+private:
+  std::unique_ptr<jlm::llvm::RvsdgModule>
+  SetupRvsdg() override;
+
+  jlm::rvsdg::LambdaNode * Lambda_ = {};
+
+  rvsdg::Node * AllocaA_ = {};
+  rvsdg::Node * AllocaB_ = {};
+  rvsdg::Node * AllocaS_ = {};
+  rvsdg::Node * GepZ_ = {};
+
+  rvsdg::output * LoadedPointer_ = {};
+  rvsdg::Node * StructLoad_ = {};
+};
+
 }
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+#include <cassert>
+#include <fstream>
+#include <sstream>
+
+/**
+ * Creates a module that covers all structural node kinds, loads, stores, calls, and bit
+ * constants that are wider than 64 bits or contain undefined bits.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateTestModule()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto rvsdgModule =
+      jlm::llvm::RvsdgModule::Create(jlm::util::filepath("test.c"), "x86_64", "e-m:e");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto bit32Type = bittype::Create(32);
+  auto pointerType = PointerType::Create();
+  auto ioStateType = IOStateType::Create();
+  auto memoryStateType = MemoryStateType::Create();
+  auto functionType = FunctionType::Create(
+      { bit32Type, ioStateType, memoryStateType },
+      { bit32Type, ioStateType, memoryStateType });
+
+  auto & global = jlm::llvm::GraphImport::Create(
+      graph,
+      bit32Type,
+      pointerType,
+      "g",
+      linkage::external_linkage);
+
+  // Delta with a constant initializer
+  auto delta = delta::node::Create(
+      &graph.GetRootRegion(),
+      bittype::Create(64),
+      "d",
+      linkage::internal_linkage,
+      ".data",
+      true);
+  auto deltaOutput = delta->finalize(create_bitconstant(delta->subregion(), 64, 42));
+
+  // Lambda with a load, a store, a gamma, and a theta
+  attributeset attributes;
+  attributes.InsertEnumAttribute(enum_attribute(attribute::kind::NoUnwind));
+  attributes.InsertIntAttribute(int_attribute(attribute::kind::Alignment, 8));
+  attributes.InsertStringAttribute(string_attribute("key", "value"));
+  auto lambda = LambdaNode::Create(
+      graph.GetRootRegion(),
+      LlvmLambdaOperation::Create(functionType, "f", linkage::external_linkage, attributes));
+  auto globalCtxVar = lambda->AddContextVar(global).inner;
+  auto arguments = lambda->GetFunctionArguments();
+
+  auto loadResults = LoadNonVolatileNode::Create(globalCtxVar, { arguments[2] }, bit32Type, 4);
+  auto sum =
+      SimpleNode::Create(*lambda->subregion(), bitadd_op(32), { loadResults[0], arguments[0] })
+          .output(0);
+
+  auto predicate = match(32, { { 0, 0 } }, 1, 2, arguments[0]);
+  auto gamma = GammaNode::create(predicate, 2);
+  auto sumEntryVar = gamma->AddEntryVar(sum);
+  auto seven = create_bitconstant(gamma->subregion(1), 32, 7);
+  auto gammaExitVar = gamma->AddExitVar({ sumEntryVar.branchArgument[0], seven });
+
+  auto theta = ThetaNode::create(lambda->subregion());
+  auto loopVar = theta->AddLoopVar(gammaExitVar.output);
+  auto one = create_bitconstant(theta->subregion(), 32, 1);
+  loopVar.post->divert_to(
+      SimpleNode::Create(*theta->subregion(), bitadd_op(32), { loopVar.pre, one }).output(0));
+
+  auto storeResults =
+      StoreNonVolatileNode::Create(globalCtxVar, loopVar.output, { loadResults[1] }, 4);
+
+  // Constants that do not fit into a single 64 bit chunk or that are not fully known
+  auto wideValue = bitvalue_repr(64, -1).concat(bitvalue_repr(64, 5));
+  create_bitconstant(lambda->subregion(), wideValue);
+  create_bitconstant(lambda->subregion(), bitvalue_repr("01X0D"));
+
+  auto lambdaOutput = lambda->finalize({ loopVar.output, arguments[1], storeResults[0] });
+
+  // Phi with a recursive function
+  phi::builder phiBuilder;
+  phiBuilder.begin(&graph.GetRootRegion());
+  auto recursionVar = phiBuilder.add_recvar(functionType);
+  auto ctxVar = phiBuilder.add_ctxvar(lambdaOutput);
+
+  auto recursiveLambda = LambdaNode::Create(
+      *phiBuilder.subregion(),
+      LlvmLambdaOperation::Create(functionType, "r", linkage::external_linkage));
+  auto selfCtxVar = recursiveLambda->AddContextVar(*recursionVar->argument()).inner;
+  auto fCtxVar = recursiveLambda->AddContextVar(*ctxVar).inner;
+  auto recursiveArguments = recursiveLambda->GetFunctionArguments();
+  auto fPointer = CreateOpNode<FunctionToPointerOperation>({ fCtxVar }, functionType).output(0);
+  auto fFunction = CreateOpNode<PointerToFunctionOperation>({ fPointer }, functionType).output(0);
+  auto callResults = CallNode::Create(
+      selfCtxVar,
+      functionType,
+      { recursiveArguments[0], recursiveArguments[1], recursiveArguments[2] });
+  auto fResults = CallNode::Create(
+      fFunction,
+      functionType,
+      { callResults[0], callResults[1], callResults[2] });
+  auto recursiveLambdaOutput = recursiveLambda->finalize(fResults);
+  recursionVar->set_rvorigin(recursiveLambdaOutput);
+  auto phiNode = phiBuilder.end();
+
+  jlm::llvm::GraphExport::Create(*lambdaOutput, "f");
+  jlm::llvm::GraphExport::Create(*deltaOutput, "d");
+  jlm::llvm::GraphExport::Create(*phiNode->output(0), "r");
+
+  return rvsdgModule;
+}
+
+static std::string
+WriteToString(const jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  std::ostringstream stream;
+  jlm::llvm::WriteRvsdgBinary(rvsdgModule, stream);
+  return stream.str();
+}
+
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+ReadFromString(const std::string & encoding)
+{
+  return jlm::llvm::ReadRvsdgBinary(
+      reinterpret_cast<const uint8_t *>(encoding.data()),
+      encoding.size());
+}
+
+static int
+RoundTrip()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto rvsdgModule = CreateTestModule();
+  auto encoding = WriteToString(*rvsdgModule);
+
+  // Act
+  auto decodedModule = ReadFromString(encoding);
+
+  // Assert
+  assert(WriteToString(*decodedModule) == encoding);
+  assert(decodedModule->SourceFileName() == rvsdgModule->SourceFileName());
+  assert(decodedModule->TargetTriple() == "x86_64");
+  assert(decodedModule->DataLayout() == "e-m:e");
+
+  auto & rootRegion = decodedModule->Rvsdg().GetRootRegion();
+  assert(rootRegion.narguments() == 1);
+  assert(rootRegion.nresults() == 3);
+  assert(rootRegion.nnodes() == 3);
+
+  auto & global = *jlm::util::AssertedCast<GraphImport>(rootRegion.argument(0));
+  assert(global.Name() == "g");
+  assert(global.Linkage() == linkage::external_linkage);
+
+  auto & lambdaExport = *jlm::util::AssertedCast<jlm::rvsdg::GraphExport>(rootRegion.result(0));
+  assert(lambdaExport.Name() == "f");
+  auto & lambda = jlm::rvsdg::AssertGetOwnerNode<jlm::rvsdg::LambdaNode>(*lambdaExport.origin());
+  auto & operation = *jlm::util::AssertedCast<const LlvmLambdaOperation>(&lambda.GetOperation());
+  assert(operation.name() == "f");
+  auto & originalLambda = jlm::rvsdg::AssertGetOwnerNode<jlm::rvsdg::LambdaNode>(
+      *rvsdgModule->Rvsdg().GetRootRegion().result(0)->origin());
+  auto & originalOperation =
+      *jlm::util::AssertedCast<const LlvmLambdaOperation>(&originalLambda.GetOperation());
+  assert(operation.attributes() == originalOperation.attributes());
+  assert(lambda.subregion()->nnodes() == 8);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/RvsdgBinaryFormatTests-RoundTrip", RoundTrip)
+
+static int
+FileRoundTrip()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  auto rvsdgModule = CreateTestModule();
+  auto encoding = WriteToString(*rvsdgModule);
+
+  auto file = filepath::CreateUniqueFileName(filepath::TempDirectoryPath(), "rvsdg-", ".bin");
+  std::ofstream stream(file.to_str(), std::ios::binary);
+  jlm::llvm::WriteRvsdgBinary(*rvsdgModule, stream);
+  stream.close();
+
+  // Act
+  auto decodedModule = jlm::llvm::ReadRvsdgBinary(file);
+  std::filesystem::remove(file.to_str());
+
+  // Assert
+  assert(WriteToString(*decodedModule) == encoding);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/RvsdgBinaryFormatTests-FileRoundTrip", FileRoundTrip)
+
+static int
+MalformedInput()
+{
+  auto expectError = [](const std::string & encoding)
+  {
+    try
+    {
+      ReadFromString(encoding);
+      assert(false);
+    }
+    catch (const jlm::util::error &)
+    {}
+  };
+
+  auto encoding = WriteToString(*CreateTestModule());
+
+  // Wrong magic
+  auto wrongMagic = encoding;
+  wrongMagic[0] = 'X';
+  expectError(wrongMagic);
+
+  // Wrong version
+  auto wrongVersion = encoding;
+  wrongVersion[8] = static_cast<char>(jlm::llvm::RvsdgBinaryFormatVersion + 1);
+  expectError(wrongVersion);
+
+  // Truncated encoding
+  expectError(encoding.substr(0, encoding.size() / 2));
+
+  // Trailing bytes
+  expectError(encoding + '\0');
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/RvsdgBinaryFormatTests-MalformedInput", MalformedInput)
@@ -9,6 +9,8 @@
 #include <tests/test-types.hpp>
 
 #include <jlm/llvm/ir/types.hpp>
+#include <jlm/rvsdg/bitstring/type.hpp>
+#include <jlm/rvsdg/FunctionType.hpp>
 
 #include <cassert>
 
@@ -73,3 +75,46 @@ TestIsOrContains()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes-TestIsOrContains", TestIsOrContains);
+
+static int
+TestTypeInterning()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Structurally equal types are the same instance
+  auto bitType1 = bittype::Create(100);
+  auto bitType2 = bittype::Create(100);
+  assert(bitType1 == bitType2);
+  assert(bittype::Create(101) != bitType1);
+
+  auto arrayType1 = ArrayType::Create(bittype::Create(32), 10);
+  auto arrayType2 = ArrayType::Create(bittype::Create(32), 10);
+  auto arrayType3 = ArrayType::Create(bittype::Create(32), 11);
+  assert(arrayType1 == arrayType2);
+  assert(arrayType1 != arrayType3);
+
+  auto functionType1 = FunctionType::Create({ arrayType1 }, { PointerType::Create() });
+  auto functionType2 = FunctionType::Create({ arrayType2 }, { PointerType::Create() });
+  assert(functionType1 == functionType2);
+
+  // Types are released once they are no longer referenced
+  auto numTypes = TypeTable::NumTypes();
+  functionType1.reset();
+  functionType2.reset();
+  assert(TypeTable::NumTypes() == numTypes - 1);
+
+  auto functionType3 = FunctionType::Create({ arrayType3 }, { PointerType::Create() });
+  assert(TypeTable::NumTypes() == numTypes);
+  assert(*functionType3 != *FunctionType::Create({ arrayType1 }, { PointerType::Create() }));
+
+  // Releasing a type releases the types it holds, without a later lookup of the same hash
+  auto arrayType4 = ArrayType::Create(bittype::Create(1000), 1000);
+  assert(TypeTable::NumTypes() == numTypes + 2);
+  arrayType4.reset();
+  assert(TypeTable::NumTypes() == numTypes);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes-TestTypeInterning", TestTypeInterning);
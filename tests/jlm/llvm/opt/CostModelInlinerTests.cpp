@@ -0,0 +1,281 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/CostModelInliner.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static std::shared_ptr<const jlm::rvsdg::FunctionType>
+GetFunctionType()
+{
+  using namespace jlm::llvm;
+
+  auto valueType = jlm::tests::valuetype::Create();
+  return jlm::rvsdg::FunctionType::Create(
+      { valueType, IOStateType::Create(), MemoryStateType::Create() },
+      { valueType, IOStateType::Create(), MemoryStateType::Create() });
+}
+
+/**
+ * Creates a function with \p numOperations operations on its value argument, followed by a call
+ * to each of the \p callees.
+ */
+static jlm::rvsdg::output *
+CreateFunction(
+    jlm::rvsdg::Region & region,
+    const std::string & name,
+    size_t numOperations,
+    const std::vector<jlm::rvsdg::output *> & callees,
+    const jlm::llvm::attributeset & attributes = {})
+{
+  using namespace jlm::llvm;
+
+  auto functionType = GetFunctionType();
+  auto lambda = jlm::rvsdg::LambdaNode::Create(
+      region,
+      LlvmLambdaOperation::Create(functionType, name, linkage::external_linkage, attributes));
+
+  auto arguments = lambda->GetFunctionArguments();
+  std::vector<jlm::rvsdg::output *> values({ arguments[0], arguments[1], arguments[2] });
+  for (size_t n = 0; n < numOperations; n++)
+  {
+    values[0] = jlm::tests::test_op::create(
+                    lambda->subregion(),
+                    { values[0] },
+                    { jlm::tests::valuetype::Create() })
+                    ->output(0);
+  }
+
+  for (auto callee : callees)
+  {
+    auto calleeArgument = lambda->AddContextVar(*callee).inner;
+    values = CallNode::Create(calleeArgument, functionType, values);
+  }
+
+  return lambda->finalize(values);
+}
+
+static jlm::llvm::attributeset
+CreateAttributes(jlm::llvm::attribute::kind kind)
+{
+  jlm::llvm::attributeset attributes;
+  attributes.InsertEnumAttribute(jlm::llvm::enum_attribute(kind));
+  return attributes;
+}
+
+static const jlm::llvm::CostModelInliner::Statistics &
+RunInliner(
+    jlm::llvm::RvsdgModule & rvsdgModule,
+    const jlm::llvm::CostModelInliner::Configuration & configuration,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  jlm::llvm::CostModelInliner inliner(configuration);
+  inliner.Run(rvsdgModule, statisticsCollector);
+
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  return dynamic_cast<const jlm::llvm::CostModelInliner::Statistics &>(statistics);
+}
+
+static size_t
+NumCallNodes(const jlm::rvsdg::output & lambdaOutput)
+{
+  auto & lambda = jlm::rvsdg::AssertGetOwnerNode<jlm::rvsdg::LambdaNode>(lambdaOutput);
+
+  size_t numCallNodes = 0;
+  for (auto & node : lambda.subregion()->Nodes())
+  {
+    if (jlm::rvsdg::is<jlm::llvm::CallOperation>(&node))
+      numCallNodes++;
+  }
+
+  return numCallNodes;
+}
+
+static int
+Decisions()
+{
+  using namespace jlm::llvm;
+  using Decision = CostModelInliner::Decision;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+
+  auto small = CreateFunction(rootRegion, "small", 1, {});
+  auto large = CreateFunction(rootRegion, "large", 3, {});
+  auto noInline =
+      CreateFunction(rootRegion, "noInline", 1, {}, CreateAttributes(attribute::kind::NoInline));
+  auto alwaysInline = CreateFunction(
+      rootRegion,
+      "alwaysInline",
+      3,
+      {},
+      CreateAttributes(attribute::kind::AlwaysInline));
+  auto singleCall = CreateFunction(rootRegion, "singleCall", 3, {});
+  auto f = CreateFunction(
+      rootRegion,
+      "f",
+      1,
+      { small, small, large, large, noInline, alwaysInline, singleCall });
+
+  for (auto output : { small, large, noInline, alwaysInline, f })
+    GraphExport::Create(*output, "");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::FunctionInlining }));
+
+  // Act
+  auto & statistics =
+      RunInliner(rvsdgModule, CostModelInliner::Configuration(2, 1000, 1000), statisticsCollector);
+
+  // Assert
+  assert(statistics.GetCallSiteDecisions().size() == 7);
+  assert(statistics.GetNumCallSites(Decision::InlinedWithinBudget) == 2);
+  assert(statistics.GetNumCallSites(Decision::RejectedTooLarge) == 2);
+  assert(statistics.GetNumCallSites(Decision::RejectedNoInline) == 1);
+  assert(statistics.GetNumCallSites(Decision::InlinedAlwaysInline) == 1);
+  assert(statistics.GetNumCallSites(Decision::InlinedSingleCall) == 1);
+
+  // Only the calls to large and noInline are left
+  assert(NumCallNodes(*f) == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/CostModelInlinerTests-Decisions", Decisions)
+
+static int
+BottomUp()
+{
+  using namespace jlm::llvm;
+  using Decision = CostModelInliner::Decision;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+
+  // The callers are created before their callees in order to ensure that the inliner does not
+  // rely on the order of the lambda nodes in the root region.
+  auto leaf = CreateFunction(rootRegion, "leaf", 1, {});
+  auto middle = CreateFunction(rootRegion, "middle", 0, { leaf });
+  auto f = CreateFunction(rootRegion, "f", 0, { middle });
+  auto g = CreateFunction(rootRegion, "g", 0, { middle });
+
+  for (auto output : { leaf, middle, f, g })
+    GraphExport::Create(*output, "");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::FunctionInlining }));
+
+  // Act
+  auto & statistics =
+      RunInliner(rvsdgModule, CostModelInliner::Configuration(1, 1000, 1000), statisticsCollector);
+
+  // Assert
+  // The leaf is inlined into middle first, such that middle itself is small enough to be inlined
+  // into f and g.
+  auto & decisions = statistics.GetCallSiteDecisions();
+  assert(decisions.size() == 3);
+  assert(decisions[0].caller == "middle" && decisions[0].callee == "leaf");
+  assert(statistics.GetNumCallSites(Decision::InlinedWithinBudget) == 3);
+  assert(NumCallNodes(*middle) == 0);
+  assert(NumCallNodes(*f) == 0);
+  assert(NumCallNodes(*g) == 0);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/CostModelInlinerTests-BottomUp", BottomUp)
+
+static int
+GrowthBudgets()
+{
+  using namespace jlm::llvm;
+  using Decision = CostModelInliner::Decision;
+
+  auto test = [](const CostModelInliner::Configuration & configuration, Decision expectedDecision)
+  {
+    // Arrange
+    RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+    auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+
+    auto small = CreateFunction(rootRegion, "small", 1, {});
+    auto f = CreateFunction(rootRegion, "f", 0, { small, small, small });
+    GraphExport::Create(*small, "small");
+    GraphExport::Create(*f, "f");
+
+    jlm::util::StatisticsCollector statisticsCollector(
+        jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::FunctionInlining }));
+
+    // Act
+    auto & statistics = RunInliner(rvsdgModule, configuration, statisticsCollector);
+
+    // Assert
+    // The budget is the inline threshold, i.e., only two calls fit into it.
+    assert(statistics.GetNumCallSites(Decision::InlinedWithinBudget) == 2);
+    assert(statistics.GetNumCallSites(expectedDecision) == 1);
+    assert(NumCallNodes(*f) == 1);
+  };
+
+  test(CostModelInliner::Configuration(2, 0, 1000), Decision::RejectedCallerBudget);
+  test(CostModelInliner::Configuration(2, 1000, 0), Decision::RejectedModuleBudget);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/CostModelInlinerTests-GrowthBudgets", GrowthBudgets)
+
+static int
+Recursion()
+{
+  using namespace jlm::llvm;
+  using Decision = CostModelInliner::Decision;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+
+  phi::builder phiBuilder;
+  phiBuilder.begin(&rootRegion);
+  auto recursionVariable = phiBuilder.add_recvar(GetFunctionType());
+  auto r = CreateFunction(*phiBuilder.subregion(), "r", 1, { recursionVariable->argument() });
+  recursionVariable->set_rvorigin(r);
+  auto phiNode = phiBuilder.end();
+
+  auto f = CreateFunction(rootRegion, "f", 0, { phiNode->output(0) });
+  GraphExport::Create(*phiNode->output(0), "r");
+  GraphExport::Create(*f, "f");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::FunctionInlining }));
+
+  // Act
+  auto & statistics =
+      RunInliner(rvsdgModule, CostModelInliner::Configuration(100, 1000, 1000), statisticsCollector);
+
+  // Assert
+  // The recursive call in r is never inlined. The call in f can not be inlined, as the
+  // recursion variable of r can not be routed out of the phi node.
+  assert(statistics.GetNumCallSites(Decision::RejectedRecursive) == 1);
+  assert(statistics.GetNumCallSites(Decision::RejectedUnsupported) == 1);
+  assert(NumCallNodes(*r) == 1);
+  assert(NumCallNodes(*f) == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/CostModelInlinerTests-Recursion", Recursion)
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/LoopInvariantCodeMotion.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunLoopInvariantCodeMotion(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::llvm::LoopInvariantCodeMotion loopInvariantCodeMotion;
+  loopInvariantCodeMotion.Run(rvsdgModule, statisticsCollector);
+
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+}
+
+static size_t
+NumLoadNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numLoadNodes = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (jlm::rvsdg::is<jlm::llvm::LoadNonVolatileOperation>(&node))
+      numLoadNodes++;
+  }
+
+  return numLoadNodes;
+}
+
+static int
+HoistInvariantLoads()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, jlm::rvsdg::ControlType::Create(2), "c");
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto x = &jlm::tests::GraphImport::Create(graph, valueType, "x");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+
+  auto theta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  auto lvc = theta->AddLoopVar(c);
+  auto lva = theta->AddLoopVar(a);
+  auto lvx = theta->AddLoopVar(x);
+  auto lvs = theta->AddLoopVar(s);
+
+  // The memory state is only threaded through the loads, i.e., it is read-only in the loop.
+  auto load1 = LoadNonVolatileNode::Create(lva.pre, { lvs.pre }, valueType, 4);
+  auto load2 = LoadNonVolatileNode::Create(lva.pre, { load1[1] }, valueType, 4);
+  auto sum = jlm::tests::create_testop(theta->subregion(), { load1[0], load2[0] }, { valueType });
+  auto value = jlm::tests::create_testop(theta->subregion(), { lvx.pre, sum[0] }, { valueType });
+
+  lvx.post->divert_to(value[0]);
+  lvs.post->divert_to(load2[1]);
+  theta->set_predicate(lvc.pre);
+
+  auto & xExport = GraphExport::Create(*lvx.output, "x");
+  auto & sExport = GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunLoopInvariantCodeMotion(rvsdgModule);
+
+  // Assert
+  // Both loads and their sum are hoisted, only the variant computation stays in the loop.
+  assert(theta->subregion()->nnodes() == 1);
+  assert(NumLoadNodes(graph.GetRootRegion()) == 2);
+  assert(jlm::rvsdg::ThetaLoopVarIsInvariant(lvs));
+
+  // The hoisted loads are sequenced before the theta node
+  auto hoistedLoad = jlm::rvsdg::output::GetNode(*lvs.input->origin());
+  assert(jlm::rvsdg::is<LoadNonVolatileOperation>(hoistedLoad));
+  assert(jlm::rvsdg::output::GetNode(*sExport.origin()) == theta);
+  assert(jlm::rvsdg::output::GetNode(*xExport.origin()) == theta);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopInvariantCodeMotionTests-HoistInvariantLoads",
+    HoistInvariantLoads)
+
+static int
+KeepLoadsWithModifiedMemoryState()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, jlm::rvsdg::ControlType::Create(2), "c");
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto b = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "b");
+  auto x = &jlm::tests::GraphImport::Create(graph, valueType, "x");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+
+  auto theta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  auto lvc = theta->AddLoopVar(c);
+  auto lva = theta->AddLoopVar(a);
+  auto lvb = theta->AddLoopVar(b);
+  auto lvx = theta->AddLoopVar(x);
+  auto lvs = theta->AddLoopVar(s);
+
+  // The store modifies the memory state the load consumes in the next iteration
+  auto load = LoadNonVolatileNode::Create(lva.pre, { lvs.pre }, valueType, 4);
+  auto value = jlm::tests::create_testop(theta->subregion(), { lvx.pre, load[0] }, { valueType });
+  auto store = StoreNonVolatileNode::Create(lvb.pre, value[0], { load[1] }, 4);
+
+  lvx.post->divert_to(value[0]);
+  lvs.post->divert_to(store[0]);
+  theta->set_predicate(lvc.pre);
+
+  GraphExport::Create(*lvx.output, "x");
+  GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunLoopInvariantCodeMotion(rvsdgModule);
+
+  // Assert
+  assert(theta->subregion()->nnodes() == 3);
+  assert(NumLoadNodes(*theta->subregion()) == 1);
+  assert(NumLoadNodes(graph.GetRootRegion()) == 0);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopInvariantCodeMotionTests-KeepLoadsWithModifiedMemoryState",
+    KeepLoadsWithModifiedMemoryState)
+
+static int
+HoistThroughNestedThetas()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+  auto stateType = jlm::tests::statetype::Create();
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, jlm::rvsdg::ControlType::Create(2), "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, valueType, "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+  auto s = &jlm::tests::GraphImport::Create(graph, stateType, "s");
+
+  auto outerTheta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  auto outerLvc = outerTheta->AddLoopVar(c);
+  auto outerLvx = outerTheta->AddLoopVar(x);
+  auto outerLvy = outerTheta->AddLoopVar(y);
+  auto outerLvs = outerTheta->AddLoopVar(s);
+
+  auto innerTheta = jlm::rvsdg::ThetaNode::create(outerTheta->subregion());
+  auto innerLvc = innerTheta->AddLoopVar(outerLvc.pre);
+  auto innerLvx = innerTheta->AddLoopVar(outerLvx.pre);
+  auto innerLvy = innerTheta->AddLoopVar(outerLvy.pre);
+  auto innerLvs = innerTheta->AddLoopVar(outerLvs.pre);
+
+  // n1 and n2 only depend on values that are invariant in both loops. n3 depends on the variant
+  // y, and the state-typed n4 has side-effects.
+  auto innerRegion = innerTheta->subregion();
+  auto n1 = jlm::tests::create_testop(innerRegion, {}, { valueType });
+  auto n2 = jlm::tests::create_testop(innerRegion, { n1[0], innerLvx.pre }, { valueType });
+  auto n3 = jlm::tests::create_testop(innerRegion, { n2[0], innerLvy.pre }, { valueType });
+  auto n4 = jlm::tests::create_testop(innerRegion, { n2[0], innerLvs.pre }, { stateType });
+
+  innerLvy.post->divert_to(n3[0]);
+  innerLvs.post->divert_to(n4[0]);
+  innerTheta->set_predicate(innerLvc.pre);
+
+  outerLvy.post->divert_to(innerLvy.output);
+  outerLvs.post->divert_to(innerLvs.output);
+  outerTheta->set_predicate(outerLvc.pre);
+
+  GraphExport::Create(*outerLvy.output, "y");
+  GraphExport::Create(*outerLvs.output, "s");
+
+  // Act
+  RunLoopInvariantCodeMotion(rvsdgModule);
+
+  // Assert
+  assert(innerTheta->subregion()->nnodes() == 2);
+  assert(outerTheta->subregion()->nnodes() == 1);
+  assert(graph.GetRootRegion().nnodes() == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopInvariantCodeMotionTests-HoistThroughNestedThetas",
+    HoistThroughNestedThetas)
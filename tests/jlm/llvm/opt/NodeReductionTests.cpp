@@ -60,11 +60,22 @@ MultipleReductionsPerRegion()
   auto constantOperation = dynamic_cast<const bitconstant_op *>(&constantNode->GetOperation());
   assert(constantOperation->value().to_uint() == 8);
 
-  // We expect that the node reductions transformation iterated over the root region 2 times.
   auto & statistics = *statisticsCollector.CollectedStatistics().begin();
   auto & nodeReductionStatistics = dynamic_cast<const NodeReduction::Statistics &>(statistics);
-  auto numIterations = nodeReductionStatistics.GetNumIterations(graph.GetRootRegion()).value();
-  assert(numIterations == 2);
+  assert(
+      nodeReductionStatistics.GetNumReductions(NodeReduction::Statistics::NumLoadReductions) == 1);
+  assert(
+      nodeReductionStatistics.GetNumReductions(NodeReduction::Statistics::NumBinaryReductions)
+      == 1);
+  assert(
+      nodeReductionStatistics.GetNumReductions(NodeReduction::Statistics::NumStoreReductions)
+      == 0);
+
+  // We expect that the six initial nodes and the folded constant are visited once. The store and
+  // both operand constants of the add are revisited once they lost their users, while the alloca
+  // is revisited once after the load and once after the store was removed.
+  auto numNodeVisits = nodeReductionStatistics.GetNumNodeVisits(graph.GetRootRegion()).value();
+  assert(numNodeVisits == 12);
 
   return 0;
 }
@@ -72,3 +83,56 @@ MultipleReductionsPerRegion()
 JLM_UNIT_TEST_REGISTER(
     "jlm/llvm/opt/NodeReductionTests-MultipleReductionsPerRegion",
     MultipleReductionsPerRegion)
+
+static int
+CommonNodeReduction()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  const auto bitType = bittype::Create(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto & x = jlm::tests::GraphImport::Create(graph, bitType, "x");
+  auto & y = jlm::tests::GraphImport::Create(graph, bitType, "y");
+
+  auto sum1 = bitadd_op::create(32, &x, &y);
+  auto sum2 = bitadd_op::create(32, &x, &y);
+  auto & sumExport1 = jlm::tests::GraphExport::Create(*sum1, "sum1");
+  auto & sumExport2 = jlm::tests::GraphExport::Create(*sum2, "sum2");
+
+  // Allocas with identical operands create distinct memory locations
+  auto allocaResults1 = alloca_op::create(bitType, &x, 4);
+  auto allocaResults2 = alloca_op::create(bitType, &x, 4);
+  jlm::tests::GraphExport::Create(*allocaResults1[0], "a1");
+  jlm::tests::GraphExport::Create(*allocaResults2[0], "a2");
+
+  view(graph, stdout);
+
+  // Act
+  NodeReduction nodeReduction;
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::ReduceNodes }));
+  nodeReduction.Run(rvsdgModule, statisticsCollector);
+
+  view(graph, stdout);
+
+  // Assert
+  // Only the two add nodes are merged
+  assert(graph.GetRootRegion().nnodes() == 3);
+  assert(sumExport1.origin() == sumExport2.origin());
+  assert(graph.GetRootRegion().GetHashConsingTable() == nullptr);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  auto & nodeReductionStatistics = dynamic_cast<const NodeReduction::Statistics &>(statistics);
+  assert(
+      nodeReductionStatistics.GetNumReductions(NodeReduction::Statistics::NumCommonNodeReductions)
+      == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/NodeReductionTests-CommonNodeReduction", CommonNodeReduction)
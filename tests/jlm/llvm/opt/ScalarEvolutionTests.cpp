@@ -0,0 +1,178 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/ScalarEvolution.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/comparison.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+#include <cassert>
+
+/**
+ * Creates a theta node with the induction variable {init, aop, step} whose updated value is
+ * compared against end with cop in order to determine whether the loop is repeated.
+ */
+static jlm::rvsdg::ThetaNode &
+CreateCountingTheta(
+    const jlm::rvsdg::bitcompare_op & cop,
+    const jlm::rvsdg::bitbinary_op & aop,
+    jlm::rvsdg::output & init,
+    jlm::rvsdg::output & step,
+    jlm::rvsdg::output & end)
+{
+  using namespace jlm::rvsdg;
+
+  auto theta = ThetaNode::create(init.region());
+  auto subregion = theta->subregion();
+  auto idv = theta->AddLoopVar(&init);
+  auto lvs = theta->AddLoopVar(&step);
+  auto lve = theta->AddLoopVar(&end);
+
+  auto arm = SimpleNode::Create(*subregion, aop, { idv.pre, lvs.pre }).output(0);
+  auto cmp = SimpleNode::Create(*subregion, cop, { arm, lve.pre }).output(0);
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv.post->divert_to(arm);
+  theta->set_predicate(match);
+
+  return *theta;
+}
+
+static std::optional<size_t>
+GetTripCount(const jlm::rvsdg::ThetaNode & thetaNode)
+{
+  jlm::llvm::ScalarEvolution scalarEvolution;
+  scalarEvolution.AnalyzeTheta(thetaNode);
+  return scalarEvolution.GetTripCount(thetaNode);
+}
+
+static int
+ChainRecurrences()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  bitadd_op add(32);
+  bitsub_op sub(32);
+  bitmul_op mul(32);
+
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, bt32, "x");
+  auto zero = create_bitconstant(&rootRegion, 32, 0);
+
+  auto theta = ThetaNode::create(&rootRegion);
+  auto subregion = theta->subregion();
+  auto lvc = theta->AddLoopVar(c);
+  auto lvx = theta->AddLoopVar(x);
+  auto lvi = theta->AddLoopVar(zero);
+  auto lvj = theta->AddLoopVar(zero);
+  auto lvk = theta->AddLoopVar(zero);
+  auto lvl = theta->AddLoopVar(zero);
+  auto lvm = theta->AddLoopVar(zero);
+  auto lvn = theta->AddLoopVar(zero);
+
+  // i = {0, +, 1}, j = {0, -, x}, k = {0, +, i}, l = {0, +, k}
+  auto one = create_bitconstant(subregion, 32, 1);
+  auto i = SimpleNode::Create(*subregion, add, { lvi.pre, one }).output(0);
+  auto j = SimpleNode::Create(*subregion, sub, { lvj.pre, lvx.pre }).output(0);
+  auto k = SimpleNode::Create(*subregion, add, { lvi.pre, lvk.pre }).output(0);
+  auto l = SimpleNode::Create(*subregion, add, { lvl.pre, lvk.pre }).output(0);
+  // m = x - m and n = n * 1 are no recurrences
+  auto m = SimpleNode::Create(*subregion, sub, { lvx.pre, lvm.pre }).output(0);
+  auto n = SimpleNode::Create(*subregion, mul, { lvn.pre, one }).output(0);
+
+  lvi.post->divert_to(i);
+  lvj.post->divert_to(j);
+  lvk.post->divert_to(k);
+  lvl.post->divert_to(l);
+  lvm.post->divert_to(m);
+  lvn.post->divert_to(n);
+  theta->set_predicate(lvc.pre);
+
+  // Act
+  ScalarEvolution scalarEvolution;
+  scalarEvolution.AnalyzeRegion(rootRegion);
+
+  // Assert
+  auto crI = scalarEvolution.GetChainRecurrence(*lvi.pre);
+  assert(crI && crI->IsAffine() && !crI->IsSubtractive());
+  assert(&crI->GetStart() == zero && &crI->GetStep() == one);
+  assert(crI->GetDegree() == 1 && crI->NumBits() == 32);
+
+  auto crJ = scalarEvolution.GetChainRecurrence(*lvj.pre);
+  assert(crJ && crJ->IsAffine() && crJ->IsSubtractive());
+  assert(&crJ->GetStep() == lvx.pre);
+
+  auto crK = scalarEvolution.GetChainRecurrence(*lvk.pre);
+  assert(crK && !crK->IsAffine());
+  assert(crK->GetStepRecurrence() == crI && crK->GetDegree() == 2);
+
+  auto crL = scalarEvolution.GetChainRecurrence(*lvl.pre);
+  assert(crL && crL->GetStepRecurrence() == crK && crL->GetDegree() == 3);
+
+  assert(scalarEvolution.GetChainRecurrence(*lvm.pre) == nullptr);
+  assert(scalarEvolution.GetChainRecurrence(*lvn.pre) == nullptr);
+  assert(scalarEvolution.GetChainRecurrence(*lvx.pre) == nullptr);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/ScalarEvolutionTests-ChainRecurrences", ChainRecurrences)
+
+static int
+TripCounts()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  bitult_op ult(32);
+  bitule_op ule(32);
+  bitsgt_op sgt(32);
+  bitne_op ne(32);
+  bitadd_op add(32);
+  bitsub_op sub(32);
+
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  auto x = &jlm::tests::GraphImport::Create(graph, bt32, "x");
+
+  auto zero = create_bitconstant(&rootRegion, 32, 0);
+  auto one = create_bitconstant(&rootRegion, 32, 1);
+  auto three = create_bitconstant(&rootRegion, 32, 3);
+  auto ten = create_bitconstant(&rootRegion, 32, 10);
+  auto twelve = create_bitconstant(&rootRegion, 32, 12);
+  auto hundred = create_bitconstant(&rootRegion, 32, 100);
+  auto max = create_bitconstant(&rootRegion, 32, 0xFFFFFFFF);
+
+  // Act & Assert
+  assert(GetTripCount(CreateCountingTheta(ult, add, *zero, *one, *hundred)) == 100);
+  assert(GetTripCount(CreateCountingTheta(ule, add, *zero, *one, *hundred)) == 101);
+  assert(GetTripCount(CreateCountingTheta(ult, add, *zero, *three, *hundred)) == 34);
+  assert(GetTripCount(CreateCountingTheta(sgt, sub, *hundred, *one, *zero)) == 100);
+  assert(GetTripCount(CreateCountingTheta(ne, add, *zero, *three, *twelve)) == 4);
+  assert(GetTripCount(CreateCountingTheta(ult, add, *hundred, *one, *ten)) == 1);
+
+  // The induction variable skips the end value and wraps around
+  assert(!GetTripCount(CreateCountingTheta(ne, add, *zero, *three, *ten)));
+  // The induction variable wraps around before the loop exits
+  assert(!GetTripCount(CreateCountingTheta(ule, add, *zero, *one, *max)));
+  // The end value is unknown
+  assert(!GetTripCount(CreateCountingTheta(ult, add, *zero, *one, *x)));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/ScalarEvolutionTests-TripCounts", TripCounts)
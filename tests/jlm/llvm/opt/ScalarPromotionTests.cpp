@@ -0,0 +1,157 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/ScalarPromotion.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunScalarPromotion(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::llvm::ScalarPromotion scalarPromotion;
+  scalarPromotion.Run(rvsdgModule, statisticsCollector);
+
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+}
+
+template<class OPERATION>
+static size_t
+NumNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numNodes = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (jlm::rvsdg::is<OPERATION>(&node))
+      numNodes++;
+  }
+
+  return numNodes;
+}
+
+static int
+PromoteAccumulator()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  bitadd_op add(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "c");
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto x = &jlm::tests::GraphImport::Create(graph, bt32, "x");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+
+  auto theta = ThetaNode::create(&rootRegion);
+  auto subregion = theta->subregion();
+  auto lvc = theta->AddLoopVar(c);
+  auto lva = theta->AddLoopVar(a);
+  auto lvx = theta->AddLoopVar(x);
+  auto lvs = theta->AddLoopVar(s);
+
+  // *a = *a + x
+  auto load = LoadNonVolatileNode::Create(lva.pre, { lvs.pre }, bt32, 4);
+  auto sum = SimpleNode::Create(*subregion, add, { load[0], lvx.pre }).output(0);
+  auto store = StoreNonVolatileNode::Create(lva.pre, sum, { load[1] }, 4);
+
+  lvs.post->divert_to(store[0]);
+  theta->set_predicate(lvc.pre);
+
+  auto & sExport = jlm::llvm::GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunScalarPromotion(rvsdgModule);
+
+  // Assert
+  // The location is loaded in front of the loop and stored after it
+  assert(NumNodes<LoadNonVolatileOperation>(*subregion) == 0);
+  assert(NumNodes<StoreNonVolatileOperation>(*subregion) == 0);
+  assert(ThetaLoopVarIsInvariant(lvs));
+
+  auto loadNode = TryGetOwnerNode<LoadNonVolatileNode>(*lvs.input->origin());
+  assert(loadNode && loadNode->input(0)->origin() == a && loadNode->input(1)->origin() == s);
+
+  auto storeNode = TryGetOwnerNode<StoreNonVolatileNode>(*sExport.origin());
+  assert(storeNode && storeNode->input(0)->origin() == a);
+  assert(storeNode->input(2)->origin() == lvs.output);
+
+  // The sum is carried by a new loop variable that starts with the loaded value
+  assert(TryGetOwnerNode<ThetaNode>(*storeNode->input(1)->origin()) == theta);
+  auto valueLoopVar = theta->MapOutputLoopVar(*storeNode->input(1)->origin());
+  assert(valueLoopVar.input->origin() == &loadNode->GetLoadedValueOutput());
+  assert(is<bitadd_op>(TryGetOwnerNode<SimpleNode>(*valueLoopVar.post->origin())));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/ScalarPromotionTests-PromoteAccumulator", PromoteAccumulator)
+
+static int
+KeepAliasedLocations()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  auto memoryStateType = MemoryStateType::Create();
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "c");
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto s = &jlm::tests::GraphImport::Create(graph, memoryStateType, "s");
+
+  auto theta = ThetaNode::create(&graph.GetRootRegion());
+  auto subregion = theta->subregion();
+  auto lvc = theta->AddLoopVar(c);
+  auto lva = theta->AddLoopVar(a);
+  auto lvs = theta->AddLoopVar(s);
+
+  // The location is also accessed by another node on the same memory state
+  auto load = LoadNonVolatileNode::Create(lva.pre, { lvs.pre }, bt32, 4);
+  auto other = jlm::tests::create_testop(subregion, { load[1] }, { memoryStateType });
+  auto store = StoreNonVolatileNode::Create(lva.pre, load[0], { other[0] }, 4);
+
+  lvs.post->divert_to(store[0]);
+  theta->set_predicate(lvc.pre);
+
+  jlm::llvm::GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunScalarPromotion(rvsdgModule);
+
+  // Assert
+  assert(NumNodes<LoadNonVolatileOperation>(*subregion) == 1);
+  assert(NumNodes<StoreNonVolatileOperation>(*subregion) == 1);
+  assert(!ThetaLoopVarIsInvariant(lvs));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/ScalarPromotionTests-KeepAliasedLocations",
+    KeepAliasedLocations)
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/SlpVectorizer.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunSlpVectorizer(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::llvm::SlpVectorizer slpVectorizer(128);
+  slpVectorizer.Run(rvsdgModule, statisticsCollector);
+
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+}
+
+template<class OPERATION>
+static size_t
+NumNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numNodes = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (jlm::rvsdg::is<OPERATION>(&node))
+      numNodes++;
+  }
+
+  return numNodes;
+}
+
+/**
+ * Creates a chain of stores that stores \p values to a[0], a[1], ... on the memory state \p s.
+ *
+ * @return The memory state of the last store.
+ */
+static jlm::rvsdg::output *
+CreateStoreChain(
+    jlm::rvsdg::output & a,
+    const std::vector<jlm::rvsdg::output *> & values,
+    jlm::rvsdg::output & s)
+{
+  using namespace jlm::llvm;
+
+  auto region = a.region();
+  auto state = &s;
+  for (size_t n = 0; n < values.size(); n++)
+  {
+    auto index = jlm::rvsdg::create_bitconstant(region, 32, n);
+    auto address = GetElementPtrOperation::Create(
+        &a,
+        { index },
+        std::static_pointer_cast<const jlm::rvsdg::ValueType>(values[n]->Type()),
+        PointerType::Create());
+    state = StoreNonVolatileNode::Create(address, values[n], { state }, 4)[0];
+  }
+
+  return state;
+}
+
+static int
+VectorizeAdjacentLoadsAndStores()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  bitadd_op add(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto b = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "b");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+
+  // a[k] = b[k] + 1 for k = 0..3, where the loads are sequenced on the memory state
+  jlm::rvsdg::output * state = s;
+  std::vector<jlm::rvsdg::output *> values;
+  for (size_t k = 0; k < 4; k++)
+  {
+    auto index = create_bitconstant(&rootRegion, 32, k);
+    auto address = GetElementPtrOperation::Create(b, { index }, bt32, PointerType::Create());
+    auto load = LoadNonVolatileNode::Create(address, { state }, bt32, 4);
+    auto one = create_bitconstant(&rootRegion, 32, 1);
+    values.push_back(SimpleNode::Create(rootRegion, add, { load[0], one }).output(0));
+    state = load[1];
+  }
+
+  auto & sExport = jlm::llvm::GraphExport::Create(*CreateStoreChain(*a, values, *state), "s");
+
+  // Act
+  RunSlpVectorizer(rvsdgModule);
+
+  // Assert
+  assert(NumNodes<StoreNonVolatileOperation>(rootRegion) == 1);
+  assert(NumNodes<LoadNonVolatileOperation>(rootRegion) == 1);
+  assert(NumNodes<bitadd_op>(rootRegion) == 0);
+
+  auto storeNode = TryGetOwnerNode<StoreNonVolatileNode>(*sExport.origin());
+  assert(storeNode && is<FixedVectorType>(storeNode->GetStoredValueInput().Type()));
+
+  auto addNode = TryGetOwnerNode<SimpleNode>(*storeNode->GetStoredValueInput().origin());
+  assert(is<vectorbinary_op>(addNode));
+
+  auto loadNode = TryGetOwnerNode<LoadNonVolatileNode>(*addNode->input(0)->origin());
+  assert(loadNode && loadNode->input(1)->origin() == s);
+  assert(TryGetOwnerNode<LoadNonVolatileNode>(*storeNode->input(2)->origin()) == loadNode);
+  assert(is<constantvector_op>(TryGetOwnerNode<SimpleNode>(*addNode->input(1)->origin())));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/SlpVectorizerTests-VectorizeAdjacentLoadsAndStores",
+    VectorizeAdjacentLoadsAndStores)
+
+static int
+KeepUnprofitablePackings()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto a = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "a");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+
+  // The stored values need to be gathered into a vector
+  std::vector<jlm::rvsdg::output *> values;
+  for (size_t k = 0; k < 4; k++)
+    values.push_back(&jlm::tests::GraphImport::Create(graph, bt32, "x"));
+
+  jlm::llvm::GraphExport::Create(*CreateStoreChain(*a, values, *s), "s");
+
+  // Act
+  RunSlpVectorizer(rvsdgModule);
+
+  // Assert
+  assert(NumNodes<StoreNonVolatileOperation>(rootRegion) == 4);
+  assert(NumNodes<insertelement_op>(rootRegion) == 0);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/SlpVectorizerTests-KeepUnprofitablePackings",
+    KeepUnprofitablePackings)
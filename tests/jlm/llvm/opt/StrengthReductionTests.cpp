@@ -0,0 +1,176 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/StrengthReduction.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/view.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+RunStrengthReduction(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::llvm::StrengthReduction strengthReduction;
+  strengthReduction.Run(rvsdgModule, statisticsCollector);
+
+  jlm::rvsdg::view(&rvsdgModule.Rvsdg().GetRootRegion(), stdout);
+}
+
+template<class OPERATION>
+static size_t
+NumNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numNodes = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (jlm::rvsdg::is<OPERATION>(&node))
+      numNodes++;
+  }
+
+  return numNodes;
+}
+
+static int
+ReduceMultiplication()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  bitadd_op add(32);
+  bitmul_op mul(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, bt32, "x");
+  auto s = &jlm::tests::GraphImport::Create(graph, bt32, "s");
+  auto zero = create_bitconstant(&rootRegion, 32, 0);
+
+  auto theta = ThetaNode::create(&rootRegion);
+  auto subregion = theta->subregion();
+  auto lvc = theta->AddLoopVar(c);
+  auto lvx = theta->AddLoopVar(x);
+  auto lvs = theta->AddLoopVar(s);
+  auto lvi = theta->AddLoopVar(zero);
+
+  // s = s + i * x, i = i + 4
+  auto four = create_bitconstant(subregion, 32, 4);
+  auto i = SimpleNode::Create(*subregion, add, { lvi.pre, four }).output(0);
+  auto product = SimpleNode::Create(*subregion, mul, { lvi.pre, lvx.pre }).output(0);
+  auto sum = SimpleNode::Create(*subregion, add, { lvs.pre, product }).output(0);
+
+  lvi.post->divert_to(i);
+  lvs.post->divert_to(sum);
+  theta->set_predicate(lvc.pre);
+
+  jlm::llvm::GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunStrengthReduction(rvsdgModule);
+
+  // Assert
+  // The product is a new loop variable with start 0 * x and step 4 * x
+  assert(NumNodes<bitmul_op>(*subregion) == 0);
+  assert(NumNodes<bitmul_op>(rootRegion) == 2);
+
+  auto sumNode = TryGetOwnerNode<SimpleNode>(*lvs.post->origin());
+  auto productLoopVar = theta->MapPreLoopVar(*sumNode->input(1)->origin());
+  auto updateNode = TryGetOwnerNode<SimpleNode>(*productLoopVar.post->origin());
+  assert(is<bitadd_op>(updateNode));
+  assert(updateNode->input(0)->origin() == productLoopVar.pre);
+
+  auto stepLoopVar = theta->MapPreLoopVar(*updateNode->input(1)->origin());
+  assert(ThetaLoopVarIsInvariant(stepLoopVar));
+  auto stepNode = TryGetOwnerNode<SimpleNode>(*stepLoopVar.input->origin());
+  assert(is<bitmul_op>(stepNode) && stepNode->input(1)->origin() == x);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/StrengthReductionTests-ReduceMultiplication",
+    ReduceMultiplication)
+
+static int
+ReduceGetElementPtr()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto bt32 = bittype::Create(32);
+  auto pointerType = PointerType::Create();
+  bitsub_op sub(32);
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "c");
+  auto a = &jlm::tests::GraphImport::Create(graph, pointerType, "a");
+  auto n = &jlm::tests::GraphImport::Create(graph, bt32, "n");
+  auto s = &jlm::tests::GraphImport::Create(graph, jlm::tests::statetype::Create(), "s");
+
+  auto theta = ThetaNode::create(&rootRegion);
+  auto subregion = theta->subregion();
+  auto lvc = theta->AddLoopVar(c);
+  auto lva = theta->AddLoopVar(a);
+  auto lvs = theta->AddLoopVar(s);
+  auto lvi = theta->AddLoopVar(n);
+
+  // The address of a[i] is used by a test operation, i = i - 2
+  auto two = create_bitconstant(subregion, 32, 2);
+  auto i = SimpleNode::Create(*subregion, sub, { lvi.pre, two }).output(0);
+  auto address = GetElementPtrOperation::Create(lva.pre, { lvi.pre }, bt32, pointerType);
+  auto state = jlm::tests::create_testop(subregion, { address, lvs.pre }, { lvs.pre->Type() });
+
+  lvi.post->divert_to(i);
+  lvs.post->divert_to(state[0]);
+  theta->set_predicate(lvc.pre);
+
+  jlm::llvm::GraphExport::Create(*lvs.output, "s");
+
+  // Act
+  RunStrengthReduction(rvsdgModule);
+
+  // Assert
+  // The address is a new loop variable with start &a[n] that is advanced by -2 elements
+  assert(NumNodes<GetElementPtrOperation>(rootRegion) == 1);
+  assert(NumNodes<bitsub_op>(rootRegion) == 1);
+
+  auto testNode = TryGetOwnerNode<SimpleNode>(*lvs.post->origin());
+  auto addressLoopVar = theta->MapPreLoopVar(*testNode->input(0)->origin());
+  auto startNode = TryGetOwnerNode<SimpleNode>(*addressLoopVar.input->origin());
+  assert(is<GetElementPtrOperation>(startNode));
+  assert(startNode->input(0)->origin() == a && startNode->input(1)->origin() == n);
+
+  auto updateNode = TryGetOwnerNode<SimpleNode>(*addressLoopVar.post->origin());
+  assert(is<GetElementPtrOperation>(updateNode));
+  assert(updateNode->input(0)->origin() == addressLoopVar.pre);
+  assert(ThetaLoopVarIsInvariant(theta->MapPreLoopVar(*updateNode->input(1)->origin())));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/StrengthReductionTests-ReduceGetElementPtr",
+    ReduceGetElementPtr)
@@ -17,6 +17,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
 
 static void
 RunDeadNodeElimination(jlm::llvm::RvsdgModule & rvsdgModule)
@@ -444,6 +445,117 @@ TestDelta()
   assert(deltaNode->ninputs() == 1);
 }
 
+static void
+TestLambdasInParallel()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto vt = jlm::tests::valuetype::Create();
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(rvsdg, vt, "x");
+
+  const size_t numLambdas = 16;
+  std::vector<jlm::rvsdg::LambdaNode *> lambdaNodes;
+  std::vector<jlm::rvsdg::ThetaNode *> thetaNodes;
+  for (size_t n = 0; n < numLambdas; n++)
+  {
+    auto lambdaNode = jlm::rvsdg::LambdaNode::Create(
+        rvsdg.GetRootRegion(),
+        LlvmLambdaOperation::Create(
+            jlm::rvsdg::FunctionType::Create({ vt }, { vt }),
+            jlm::util::strfmt("f", n),
+            linkage::external_linkage));
+    auto argument = lambdaNode->GetFunctionArguments()[0];
+    auto contextVariable = lambdaNode->AddContextVar(*x).inner;
+
+    auto thetaNode = jlm::rvsdg::ThetaNode::create(lambdaNode->subregion());
+    auto loopVar = thetaNode->AddLoopVar(argument);
+    auto deadLoopVar = thetaNode->AddLoopVar(contextVariable);
+    jlm::tests::create_testop(thetaNode->subregion(), { loopVar.pre, deadLoopVar.pre }, { vt });
+
+    jlm::tests::create_testop(lambdaNode->subregion(), { contextVariable }, { vt });
+    auto result = jlm::tests::create_testop(lambdaNode->subregion(), { loopVar.output }, { vt });
+
+    auto output = lambdaNode->finalize({ result[0] });
+    GraphExport::Create(*output, jlm::util::strfmt("f", n));
+
+    lambdaNodes.push_back(lambdaNode);
+    thetaNodes.push_back(thetaNode);
+  }
+
+  // A lambda node that is not exported is dead
+  auto deadLambdaNode = jlm::rvsdg::LambdaNode::Create(
+      rvsdg.GetRootRegion(),
+      LlvmLambdaOperation::Create(
+          jlm::rvsdg::FunctionType::Create({ vt }, { vt }),
+          "g",
+          linkage::internal_linkage));
+  deadLambdaNode->finalize({ deadLambdaNode->GetFunctionArguments()[0] });
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  DeadNodeElimination deadNodeElimination;
+  jlm::rvsdg::TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &deadNodeElimination },
+      4);
+
+  // Assert
+  for (size_t n = 0; n < numLambdas; n++)
+  {
+    assert(lambdaNodes[n]->subregion()->nnodes() == 2);
+    assert(thetaNodes[n]->subregion()->nnodes() == 1);
+    assert(thetaNodes[n]->GetLoopVars().size() == 1);
+    assert(lambdaNodes[n]->GetContextVars().empty());
+  }
+
+  // The dead lambda node and the unused import are removed outside of the lambda subregions
+  assert(rvsdg.GetRootRegion().nnodes() == numLambdas);
+  assert(rvsdg.GetRootRegion().narguments() == 0);
+}
+
+static void
+TestStructuralNodeOrder()
+{
+  using namespace jlm::llvm;
+
+  auto vt = jlm::tests::valuetype::Create();
+  auto ct = jlm::rvsdg::ControlType::Create(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto c = &jlm::tests::GraphImport::Create(graph, ct, "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, vt, "x");
+
+  // The second output of gamma1 is only used by a dead node, which in turn is only used by a dead
+  // entry variable of gamma2.
+  auto gamma1 = jlm::rvsdg::GammaNode::create(c, 2);
+  auto ev = gamma1->AddEntryVar(x);
+  gamma1->AddExitVar(ev.branchArgument);
+  gamma1->AddExitVar(ev.branchArgument);
+
+  auto n = jlm::tests::create_testop(&graph.GetRootRegion(), { gamma1->output(1) }, { vt })[0];
+
+  auto gamma2 = jlm::rvsdg::GammaNode::create(c, 2);
+  gamma2->AddEntryVar(n);
+  auto ev2 = gamma2->AddEntryVar(gamma1->output(0));
+  gamma2->AddExitVar(ev2.branchArgument);
+
+  GraphExport::Create(*gamma2->output(0), "y");
+
+  //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
+  RunDeadNodeElimination(rm);
+  //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
+
+  assert(graph.GetRootRegion().nnodes() == 2);
+  assert(gamma1->noutputs() == 1);
+  assert(gamma2->ninputs() == 2);
+}
+
 static int
 TestDeadNodeElimination()
 {
@@ -456,6 +568,8 @@ TestDeadNodeElimination()
   TestLambda();
   TestPhi();
   TestDelta();
+  TestLambdasInParallel();
+  TestStructuralNodeOrder();
 
   return 0;
 }
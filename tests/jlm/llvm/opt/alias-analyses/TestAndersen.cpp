@@ -995,6 +995,120 @@ TestStatistics()
 }
 JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/alias-analyses/TestAndersen-TestStatistics", TestStatistics)
 
+static int
+TestAdaptiveConfiguration()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::LoadTest1 test;
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      { jlm::util::Statistics::Id::AndersenAnalysis });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  Andersen andersen;
+  andersen.SetConfiguration(Andersen::Configuration::NaiveSolverConfiguration());
+  andersen.EnableAdaptiveConfiguration(true);
+
+  // Act
+  auto ptg = andersen.Analyze(test.module(), statisticsCollector);
+
+  // Assert
+  assert(andersen.IsAdaptiveConfigurationEnabled());
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  const auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+
+  // The built-in model picks the default configuration for small modules
+  const auto configString = statistics.GetMeasurementValue<std::string>("Configuration");
+  assert(configString == Andersen::Configuration::DefaultConfiguration().ToString());
+  assert(statistics.GetMeasurementValue<double>("LoadStoreRatio") == 1.0);
+  assert(statistics.HasMeasurement("#InitialLargestScc"));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestAndersen-TestAdaptiveConfiguration",
+    TestAdaptiveConfiguration)
+
+static int
+TestFieldSensitivity()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::StructFieldsTest test;
+  Andersen andersen;
+  andersen.EnableFieldSensitivity(true);
+
+  // Act
+  const auto ptg = andersen.Analyze(test.module());
+
+  // Assert
+  assert(andersen.IsFieldSensitivityEnabled());
+
+  auto & lambda = ptg->GetLambdaNode(test.GetLambda());
+  auto & allocaA = ptg->GetAllocaNode(test.GetAllocaA());
+  auto & allocaB = ptg->GetAllocaNode(test.GetAllocaB());
+  auto & allocaS = ptg->GetAllocaNode(test.GetAllocaS());
+
+  // The fields s.y and s.z get their own nodes, while the alloca node represents s.x
+  const auto & fieldNodes = ptg->GetFieldNodes(allocaS);
+  assert(fieldNodes.size() == 2);
+  assert(ptg->NumFieldNodes() == 2);
+  assert(&fieldNodes[0]->GetParent() == &allocaS);
+  auto & fieldY = *fieldNodes[0];
+  auto & fieldZ = *fieldNodes[1];
+  assert(fieldZ.GetFieldIndex() == 2);
+  assert(ptg->GetFieldNodes(allocaA).empty());
+
+  assert(TargetsExactly(allocaS, { &allocaA }));
+  assert(TargetsExactly(fieldY, {}));
+  assert(TargetsExactly(fieldZ, { &allocaB }));
+
+  auto & gepZ = ptg->GetRegisterNode(*test.GetGepZ().output(0));
+  assert(TargetsExactly(gepZ, { &fieldZ }));
+  auto & loadedPointer = ptg->GetRegisterNode(test.GetLoadedPointer());
+  assert(TargetsExactly(loadedPointer, { &allocaB }));
+
+  // Loading the whole struct accesses all its fields, without its address pointing to them
+  auto & structLoad = test.GetStructLoad();
+  auto & structAddress = ptg->GetRegisterNode(*structLoad.input(0)->origin());
+  assert(TargetsExactly(structAddress, { &allocaS }));
+  auto & accessedFieldNodes = ptg->GetAccessedFieldNodes(*structLoad.input(0));
+  assert(accessedFieldNodes.Size() == 2);
+  assert(accessedFieldNodes.Contains(&fieldY) && accessedFieldNodes.Contains(&fieldZ));
+  auto & loadZ = *jlm::rvsdg::output::GetNode(test.GetLoadedPointer());
+  assert(ptg->GetAccessedFieldNodes(*loadZ.input(0)).IsEmpty());
+  auto & loadedStruct = ptg->GetRegisterNode(*structLoad.output(0));
+  assert(TargetsExactly(loadedStruct, { &allocaA, &allocaB }));
+
+  assert(EscapedIsExactly(*ptg, { &lambda }));
+
+  // Arrange some more
+  Andersen cappedAndersen;
+  cappedAndersen.EnableFieldSensitivity(true);
+  cappedAndersen.SetMaxFieldsPerObject(2);
+
+  // Act
+  const auto cappedPtg = cappedAndersen.Analyze(test.module());
+
+  // Assert that memory objects with more fields than the maximum are not split
+  assert(cappedAndersen.GetMaxFieldsPerObject() == 2);
+  assert(cappedPtg->NumFieldNodes() == 0);
+
+  auto & cappedAllocaS = cappedPtg->GetAllocaNode(test.GetAllocaS());
+  auto & cappedAllocaA = cappedPtg->GetAllocaNode(test.GetAllocaA());
+  auto & cappedAllocaB = cappedPtg->GetAllocaNode(test.GetAllocaB());
+  assert(TargetsExactly(cappedAllocaS, { &cappedAllocaA, &cappedAllocaB }));
+  auto & cappedGepZ = cappedPtg->GetRegisterNode(*test.GetGepZ().output(0));
+  assert(TargetsExactly(cappedGepZ, { &cappedAllocaS }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestAndersen-TestFieldSensitivity",
+    TestFieldSensitivity)
+
 static int
 TestConfiguration()
 {
@@ -1043,6 +1157,40 @@ TestConfiguration()
   // Assert
   assert(configString.find("OnlineCD") == std::string::npos);
   assert(configString.find("HybridCD") != std::string::npos);
+  assert(configString.find("SBV") == std::string::npos);
+
+  // Arrange some more
+  config.SetPointsToSetRepresentation(PointsToSet::Representation::SparseBitVector);
+
+  // Act
+  configString = config.ToString();
+
+  // Assert
+  assert(config.GetPointsToSetRepresentation() == PointsToSet::Representation::SparseBitVector);
+  assert(configString.find("SBV") != std::string::npos);
+
+  // Arrange some more
+  config.SetPointsToSetRepresentation(PointsToSet::Representation::Shared);
+
+  // Act
+  configString = config.ToString();
+
+  // Assert
+  assert(configString.find("SBV") == std::string::npos);
+  assert(configString.find("SharedPTS") != std::string::npos);
+
+  // Arrange some more
+  config.SetSolver(Andersen::Configuration::Solver::WavePropagation);
+  config.SetNumThreads(8);
+
+  // Act
+  configString = config.ToString();
+
+  // Assert
+  assert(config.GetNumThreads() == 8);
+  assert(configString.find("Solver=WavePropagation") != std::string::npos);
+  assert(configString.find("Threads=8") != std::string::npos);
+  assert(configString.find("HybridCD") == std::string::npos);
 
   return 0;
 }
@@ -0,0 +1,234 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "TestRvsdgs.hpp"
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/AndersenConfigurationModel.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+
+using namespace jlm::llvm::aa;
+using Feature = ConstraintSetFeatures::Feature;
+
+static void
+TestFeatureNames()
+{
+  for (size_t n = 0; n < static_cast<size_t>(Feature::COUNT); n++)
+  {
+    const auto feature = static_cast<Feature>(n);
+    assert(ConstraintSetFeatures::GetFeature(ConstraintSetFeatures::GetName(feature)) == feature);
+  }
+
+  assert(ConstraintSetFeatures::GetFeature("#NotAFeature") == Feature::COUNT);
+  assert(!ConstraintSetFeatures::IsAddedToStatistics(Feature::NumPointerObjects));
+  assert(ConstraintSetFeatures::IsAddedToStatistics(Feature::InitialLargestScc));
+}
+
+static void
+TestExtractFeatures()
+{
+  jlm::tests::NAllocaNodesTest rvsdg(3);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto reg0 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  const auto reg1 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(1));
+  const auto alloca2 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(2), true);
+  const auto reg2 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(2));
+  const auto dummy0 = set.CreateDummyRegisterPointerObject();
+  const auto dummy1 = set.CreateDummyRegisterPointerObject();
+  set.MarkAsEscaped(alloca1);
+
+  PointerObjectConstraintSet constraints(set);
+  constraints.AddPointerPointeeConstraint(reg0, alloca0);
+  constraints.AddPointerPointeeConstraint(reg2, alloca2);
+
+  // A cycle of three PointerObjects, and an edge that is not part of a cycle
+  constraints.AddConstraint(SupersetConstraint(dummy0, reg0));
+  constraints.AddConstraint(SupersetConstraint(dummy1, dummy0));
+  constraints.AddConstraint(SupersetConstraint(reg0, dummy1));
+  constraints.AddConstraint(SupersetConstraint(reg2, reg1));
+
+  constraints.AddConstraint(StoreConstraint(reg0, reg1));
+  constraints.AddConstraint(LoadConstraint(dummy0, reg0));
+  constraints.AddConstraint(LoadConstraint(dummy1, reg1));
+
+  const auto features = ConstraintSetFeatures::Extract(constraints);
+  assert(features.GetValue(Feature::NumPointerObjects) == 8);
+  assert(features.GetValue(Feature::NumMemoryPointerObjects) == 3);
+  assert(features.GetValue(Feature::NumBaseConstraints) == 2);
+  assert(features.GetValue(Feature::NumSupersetConstraints) == 4);
+  assert(features.GetValue(Feature::NumStoreConstraints) == 1);
+  assert(features.GetValue(Feature::NumLoadConstraints) == 2);
+  assert(features.GetValue(Feature::NumFunctionCallConstraints) == 0);
+  assert(features.GetValue(Feature::InitialLargestScc) == 3);
+  assert(features.GetValue(Feature::InitialSccNodes) == 3);
+  assert(features.GetValue(Feature::LoadStoreRatio) == 2.0);
+  assert(features.GetValue(Feature::EscapedFraction) == 1.0 / 3);
+}
+
+static void
+TestBuiltinModel()
+{
+  const auto & model = AndersenConfigurationModel::GetBuiltinModel();
+  assert(model.NumNodes() > 0);
+
+  // The built-in model must pick the default configuration for small modules
+  ConstraintSetFeatures features;
+  features.SetValue(Feature::NumPointerObjects, 100);
+  assert(
+      model.Predict(features).ToString()
+      == Andersen::Configuration::DefaultConfiguration().ToString());
+
+  // Every prediction must be one of the valid configurations
+  const auto allConfigs = Andersen::Configuration::GetAllConfigurations();
+  features.SetValue(Feature::NumPointerObjects, 1e9);
+  const auto config = model.Predict(features).ToString();
+  assert(std::any_of(
+      allConfigs.begin(),
+      allConfigs.end(),
+      [&](const Andersen::Configuration & validConfig)
+      {
+        return validConfig.ToString() == config;
+      }));
+}
+
+static void
+TestModelFromString()
+{
+  const auto defaultConfig = Andersen::Configuration::DefaultConfiguration();
+  const auto naiveConfig = Andersen::Configuration::NaiveSolverConfiguration();
+
+  const auto text = "# A comment\n"
+                    "split #StoreConstraints 10.5 1 2\n"
+                    "\n"
+                    "leaf "
+                  + naiveConfig.ToString() + "\nleaf " + defaultConfig.ToString() + "\n";
+  const auto model = AndersenConfigurationModel::FromString(text);
+  assert(model.NumNodes() == 3);
+
+  ConstraintSetFeatures features;
+  features.SetValue(Feature::NumStoreConstraints, 10);
+  assert(model.Predict(features).ToString() == naiveConfig.ToString());
+  features.SetValue(Feature::NumStoreConstraints, 10.5);
+  assert(model.Predict(features).ToString() == defaultConfig.ToString());
+
+  // Printing and parsing the model again gives the same model
+  const auto copy = AndersenConfigurationModel::FromString(model.ToString());
+  assert(copy.ToString() == model.ToString());
+
+  // Malformed models are rejected
+  const auto IsRejected = [](const std::string & modelText)
+  {
+    try
+    {
+      (void)AndersenConfigurationModel::FromString(modelText);
+      return false;
+    }
+    catch (jlm::util::error &)
+    {
+      return true;
+    }
+  };
+  assert(IsRejected(""));
+  assert(IsRejected("leaf NotAConfiguration\n"));
+  assert(IsRejected("split #NotAFeature 1 1 2\n"));
+  assert(IsRejected("split #StoreConstraints 1 0 1\nleaf " + defaultConfig.ToString() + "\n"));
+  assert(IsRejected("split #StoreConstraints 1 1 2\nleaf " + defaultConfig.ToString() + "\n"));
+  assert(IsRejected("node\n"));
+}
+
+static void
+TestReadTrainingSamples()
+{
+  const auto defaultConfig = Andersen::Configuration::DefaultConfiguration().ToString();
+  const auto naiveConfig = Andersen::Configuration::NaiveSolverConfiguration().ToString();
+
+  std::string features;
+  for (size_t n = 0; n < static_cast<size_t>(Feature::COUNT); n++)
+    features += std::string(" ") + ConstraintSetFeatures::GetName(static_cast<Feature>(n)) + ":"
+              + std::to_string(n + 1);
+
+  std::stringstream statistics;
+  statistics << "AndersenAnalysis a.ll" << features << " Configuration:" << defaultConfig
+             << " OVSTimer[ns]:100 ConstraintSolvingWorklistTimer[ns]:200 OtherTimer[ns]:5\n";
+  statistics << "AndersenAnalysis a.ll Configuration:" << naiveConfig
+             << " ConstraintSolvingNaiveTimer[ns]:1000\n";
+  statistics << "AndersenAnalysis a.ll Configuration:" << naiveConfig
+             << " ConstraintSolvingNaiveTimer[ns]:900\n";
+  statistics << "SomeOtherStatistics a.ll Configuration:" << naiveConfig << " Timer[ns]:1\n";
+  // A sample that lacks features is dropped
+  statistics << "AndersenAnalysis b.ll #PointerObjects:10 Configuration:" << defaultConfig
+             << " OVSTimer[ns]:1\n";
+
+  const auto samples = AndersenConfigurationModel::ReadTrainingSamples(statistics);
+  assert(samples.size() == 1);
+  assert(samples[0].Features.GetValue(Feature::NumPointerObjects) == 1);
+  assert(samples[0].Features.GetValue(Feature::EscapedFraction) == 11);
+  assert(samples[0].SolvingTimes.size() == 2);
+  assert(samples[0].SolvingTimes.at(defaultConfig) == 300);
+  assert(samples[0].SolvingTimes.at(naiveConfig) == 900);
+}
+
+static void
+TestTrain()
+{
+  const auto defaultConfig = Andersen::Configuration::DefaultConfiguration();
+  const auto naiveConfig = Andersen::Configuration::NaiveSolverConfiguration();
+
+  // The naive solver is fastest for few store constraints, and the default for many
+  std::vector<AndersenConfigurationModel::TrainingSample> samples;
+  for (size_t n = 0; n < 20; n++)
+  {
+    AndersenConfigurationModel::TrainingSample sample;
+    sample.Features.SetValue(Feature::NumStoreConstraints, n);
+    sample.Features.SetValue(Feature::NumPointerObjects, n % 3);
+    sample.SolvingTimes[naiveConfig.ToString()] = n < 8 ? 100 : 1000;
+    sample.SolvingTimes[defaultConfig.ToString()] = 500;
+    samples.push_back(std::move(sample));
+  }
+  // A configuration that is not measured for all samples is never picked
+  samples[0].SolvingTimes["SBV_" + defaultConfig.ToString()] = 1;
+
+  const auto model = AndersenConfigurationModel::Train(samples, 3, 2);
+  assert(model.NumNodes() == 3);
+  for (const auto & sample : samples)
+  {
+    const auto & expected =
+        sample.Features.GetValue(Feature::NumStoreConstraints) < 8 ? naiveConfig : defaultConfig;
+    assert(model.Predict(sample.Features).ToString() == expected.ToString());
+  }
+
+  // With a depth of 0, the model picks the configuration with the smallest total slowdown
+  const auto leafModel = AndersenConfigurationModel::Train(samples, 0, 1);
+  assert(leafModel.NumNodes() == 1);
+  assert(leafModel.Predict(samples[0].Features).ToString() == naiveConfig.ToString());
+
+  // The trained model can be parsed again
+  const auto copy = AndersenConfigurationModel::FromString(model.ToString());
+  assert(copy.Predict(samples[3].Features).ToString() == naiveConfig.ToString());
+}
+
+static int
+TestAndersenConfigurationModel()
+{
+  TestFeatureNames();
+  TestExtractFeatures();
+  TestBuiltinModel();
+  TestModelFromString();
+  TestReadTrainingSamples();
+  TestTrain();
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestAndersenConfigurationModel",
+    TestAndersenConfigurationModel)
@@ -39,13 +39,13 @@ TestTracksDifferences()
   differencePropagation.Initialize();
 
   // Assert
-  assert(differencePropagation.GetNewPointees(r0) == (util::HashSet<PointerObjectIndex>{ a0, a3 }));
+  assert(differencePropagation.GetNewPointees(r0) == (PointsToSet{ a0, a3 }));
 
   // Act 2 - add another pointer/pointee relation: r1 -> a1
   differencePropagation.AddToPointsToSet(r1, a1);
 
   // Assert that a1 is a new pointee of r1
-  assert(differencePropagation.GetNewPointees(r1) == (util::HashSet<PointerObjectIndex>{ a1 }));
+  assert(differencePropagation.GetNewPointees(r1) == (PointsToSet{ a1 }));
 
   // Act 3 - clear difference tracking for r1
   differencePropagation.ClearNewPointees(r1);
@@ -62,7 +62,7 @@ TestTracksDifferences()
 
   // Assert that only a0 and a2 were new
   assert(new0 && !new1 && new2);
-  assert(differencePropagation.GetNewPointees(r1) == (util::HashSet<PointerObjectIndex>{ a0, a2 }));
+  assert(differencePropagation.GetNewPointees(r1) == (PointsToSet{ a0, a2 }));
 
   // Act 5 - make r0 point to a superset of r1, making r0 now point to a0, a1, a2, a3
   // First mark the existing pointees of r0 (a0 and a3) as seen
@@ -70,7 +70,7 @@ TestTracksDifferences()
   differencePropagation.MakePointsToSetSuperset(r0, r1);
 
   // Assert that only a1 and a2 are new to r0, as it has already marked a0 and a3 as seen
-  assert(differencePropagation.GetNewPointees(r0) == (util::HashSet<PointerObjectIndex>{ a1, a2 }));
+  assert(differencePropagation.GetNewPointees(r0) == (PointsToSet{ a1, a2 }));
 
   // Act 6 - give nodes r0 and r1 flags
   set.MarkAsPointeesEscaping(r0);
@@ -99,7 +99,7 @@ TestTracksDifferences()
   // Assert that all pointees that were new to either node, are also new to the root
   // a0 and a2 were still marked as new to node r1 at the time of unification.
   // a3 is not new to r0, but r1 has never seen it, so it must be regarded as new by the union.
-  util::HashSet<PointerObjectIndex> subset{ a0, a2, a3 };
+  PointsToSet subset{ a0, a2, a3 };
   assert(subset.IsSubsetOf(differencePropagation.GetNewPointees(root)));
 
   // Neither flag has been seen by both nodes, so they are both new to the unification
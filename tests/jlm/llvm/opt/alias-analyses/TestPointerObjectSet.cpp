@@ -10,7 +10,9 @@
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 static bool
 StringContains(std::string_view haystack, std::string_view needle)
@@ -279,6 +281,67 @@ TestMakePointsToSetSuperset()
   assert(set.GetPointsToSet(reg0).Contains(alloca2));
 }
 
+// Test that shared points-to sets are hash-consed, and that operations on them are memoized
+static void
+TestSharedPointsToSets()
+{
+  using namespace jlm::llvm::aa;
+
+  const size_t numAllocaNodes = 8;
+  jlm::tests::NAllocaNodesTest rvsdg(numAllocaNodes);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  set.SetPointsToSetRepresentation(PointsToSet::Representation::Shared);
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), false);
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), false);
+  const auto reg0 = set.CreateDummyRegisterPointerObject();
+  const auto reg1 = set.CreateDummyRegisterPointerObject();
+  const auto reg2 = set.CreateDummyRegisterPointerObject();
+
+  const auto & store = *set.GetSharedPointsToSetStore();
+  assert(store.NumSets() == 1);
+
+  // Inserted items are collected outside the store until the sets are compared
+  assert(set.AddToPointsToSet(reg0, alloca0));
+  assert(set.AddToPointsToSet(reg1, alloca1));
+  assert(set.AddToPointsToSet(reg2, alloca0));
+  assert(!set.AddToPointsToSet(reg2, alloca0));
+  assert(store.NumSets() == 1);
+  assert(set.GetPointsToSet(reg0) == set.GetPointsToSet(reg2));
+  assert(store.NumSets() == 2);
+
+  // Both reg0 and reg2 become { alloca0, alloca1 }, but the union is only computed once
+  assert(set.MakePointsToSetSuperset(reg0, reg1));
+  assert(set.MakePointsToSetSuperset(reg2, reg1));
+  assert(store.NumCacheHits() == 1 && store.NumCacheMisses() == 1);
+  assert(set.GetPointsToSet(reg0) == set.GetPointsToSet(reg2));
+  assert(set.GetPointsToSet(reg0).Size() == 2);
+  assert(set.GetPointsToSet(reg1).IsSubsetOf(set.GetPointsToSet(reg0)));
+  assert(!set.MakePointsToSetSuperset(reg2, reg1));
+
+  // The empty set, { alloca0 }, { alloca1 } and { alloca0, alloca1 }
+  assert(store.NumSets() == 4);
+  assert(store.NumBytes() > 0);
+
+  // The new pointees of reg1 can be collected in a shared set as well
+  auto newPointees = set.CreateEmptyPointsToSet();
+  assert(set.MakePointsToSetSuperset(reg1, reg0, newPointees));
+  assert(newPointees == PointsToSet({ alloca0 }));
+
+  // Growing a set item by item only adds the final set to the store
+  const auto numSets = store.NumSets();
+  const auto reg3 = set.CreateDummyRegisterPointerObject();
+  std::vector<PointerObjectIndex> allocas = { alloca0, alloca1 };
+  for (size_t n = 2; n < numAllocaNodes; n++)
+    allocas.push_back(set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(n), false));
+  for (auto alloca : allocas)
+    assert(set.AddToPointsToSet(reg3, alloca));
+  assert(set.GetPointsToSet(reg3).Size() == numAllocaNodes);
+  assert(set.GetPointsToSet(reg3) == set.GetPointsToSet(reg3));
+  assert(store.NumSets() == numSets + 1);
+}
+
 static void
 TestClonePointerObjectSet()
 {
@@ -736,6 +799,188 @@ TestAddRegisterContentEscapedConstraint()
   assert(set.HasEscaped(alloca1));
 }
 
+static void
+TestFieldMemoryObjects()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+
+  // struct { int * a; int b; int c[4]; int * d; }
+  const auto fields = set.CreateFieldMemoryObjects(
+      alloca0,
+      { { 0, 8, false, true },
+        { 8, 4, false, true },
+        { 12, 16, true, true },
+        { 32, 8, false, true } });
+  assert(fields.size() == 4);
+  assert(fields[0] == alloca0);
+  assert(set.NumFieldMemoryObjects() == 3);
+  assert(set.NumMemoryPointerObjects() == 5);
+  assert(set.IsFieldMemoryObject(alloca0));
+  assert(set.IsFieldMemoryObject(fields[3]));
+  assert(!set.IsFieldMemoryObject(alloca1));
+  assert(set.GetFieldMemoryObjects(fields[2]) == fields);
+  assert(set.GetFieldMemoryObjects(alloca1).empty());
+  assert(set.GetMemoryObjectField(fields[2]).IsArray);
+  assert(set.GetMemoryObjectField(fields[3]).Offset == 32);
+  assert(set.GetPointerObjectKind(fields[1]) == PointerObjectKind::AllocaMemoryObject);
+
+  auto GetFieldsAtOffset =
+      [&](PointerObjectIndex pointee, std::optional<int64_t> offset, uint64_t accessSize)
+  {
+    std::vector<PointerObjectIndex> targets;
+    set.GetFieldsAtOffset(pointee, offset, accessSize, targets);
+    std::sort(targets.begin(), targets.end());
+    return targets;
+  };
+  using Targets = std::vector<PointerObjectIndex>;
+
+  // Offsets to the start of a field target only that field
+  assert(GetFieldsAtOffset(alloca0, 0, 0) == Targets({ alloca0 }));
+  assert(GetFieldsAtOffset(alloca0, 8, 0) == Targets({ fields[1] }));
+  assert(GetFieldsAtOffset(fields[1], 24, 0) == Targets({ fields[3] }));
+  assert(GetFieldsAtOffset(fields[3], -32, 0) == Targets({ alloca0 }));
+
+  // Pointers into arrays may point anywhere in the array, and stay in the array
+  assert(GetFieldsAtOffset(alloca0, 20, 0) == Targets({ fields[2] }));
+  assert(GetFieldsAtOffset(fields[2], 8, 0) == Targets({ fields[2] }));
+  assert(GetFieldsAtOffset(fields[2], -12, 0) == Targets({ fields[2] }));
+
+  // Unknown offsets, offsets into the middle of scalars, and offsets outside the object,
+  // may target any field
+  assert(GetFieldsAtOffset(alloca0, std::nullopt, 0) == fields);
+  assert(GetFieldsAtOffset(fields[1], std::nullopt, 0) == fields);
+  assert(GetFieldsAtOffset(alloca0, 4, 0) == fields);
+  assert(GetFieldsAtOffset(alloca0, 100, 0) == fields);
+  assert(GetFieldsAtOffset(fields[1], -100, 0) == fields);
+
+  // Accesses target all fields they overlap with
+  assert(GetFieldsAtOffset(alloca0, 0, 8) == Targets({ alloca0 }));
+  assert(GetFieldsAtOffset(alloca0, 0, 16) == Targets({ alloca0, fields[1], fields[2] }));
+  assert(GetFieldsAtOffset(fields[2], 0, 4) == Targets({ fields[2] }));
+  assert(GetFieldsAtOffset(fields[1], 0, 1000) == Targets({ fields[1], fields[2], fields[3] }));
+  assert(GetFieldsAtOffset(alloca0, 8, 8) == Targets({ fields[1], fields[2] }));
+
+  // Memory objects that are not split are their own only target
+  assert(GetFieldsAtOffset(alloca1, 8, 0) == Targets({ alloca1 }));
+  assert(GetFieldsAtOffset(alloca1, std::nullopt, 16) == Targets({ alloca1 }));
+
+  // All fields of a memory object escape together
+  set.MarkAsEscaped(fields[2]);
+  for (const auto field : fields)
+    assert(set.HasEscaped(field));
+  assert(!set.HasEscaped(alloca1));
+}
+
+static void
+TestFieldOffsetConstraint()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(3);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  const auto alloca2 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(2), true);
+
+  // struct { int * a; int * b; }
+  const auto fields =
+      set.CreateFieldMemoryObjects(alloca0, { { 0, 8, false, true }, { 8, 8, false, true } });
+
+  const auto reg0 = set.CreateDummyRegisterPointerObject();
+  const auto reg1 = set.CreateDummyRegisterPointerObject();
+  const auto reg2 = set.CreateDummyRegisterPointerObject();
+  const auto gepB = set.CreateDummyRegisterPointerObject();
+  const auto loadedA = set.CreateDummyRegisterPointerObject();
+  const auto loadedB = set.CreateDummyRegisterPointerObject();
+  const auto loadedStruct = set.CreateDummyRegisterPointerObject();
+
+  PointerObjectConstraintSet constraints(set);
+  constraints.AddPointerPointeeConstraint(reg0, alloca0);
+  constraints.AddPointerPointeeConstraint(reg1, alloca1);
+  constraints.AddPointerPointeeConstraint(reg2, alloca2);
+
+  // gepB = &reg0->b
+  FieldOffsetConstraint gepConstraint(gepB, reg0, 8, 0);
+  assert(gepConstraint.GetOffset() == 8);
+  constraints.AddConstraint(gepConstraint);
+
+  // reg0->a = reg1; reg0->b = reg2
+  constraints.AddConstraint(StoreConstraint(reg0, reg1));
+  constraints.AddConstraint(StoreConstraint(gepB, reg2));
+  constraints.AddConstraint(LoadConstraint(loadedA, reg0));
+  constraints.AddConstraint(LoadConstraint(loadedB, gepB));
+
+  // Loading the whole struct through a copy of reg0 accesses both fields
+  const auto structAddress = set.CreateDummyRegisterPointerObject();
+  constraints.AddConstraint(SupersetConstraint(structAddress, reg0));
+  constraints.AddConstraint(FieldOffsetConstraint(structAddress, structAddress, 0, 16));
+  constraints.AddConstraint(LoadConstraint(loadedStruct, structAddress));
+
+  // Every solver configuration must find the same solution as the naive solver
+  auto [naiveSet, naiveConstraints] = constraints.Clone();
+  naiveConstraints->SolveNaively();
+  for (const auto & config : Andersen::Configuration::GetAllConfigurations())
+  {
+    auto [configSet, configConstraints] = constraints.Clone();
+    configSet->SetPointsToSetRepresentation(config.GetPointsToSetRepresentation());
+    if (config.IsOfflineVariableSubstitutionEnabled())
+      configConstraints->PerformOfflineVariableSubstitution(config.IsHybridCycleDetectionEnabled());
+    if (config.IsOfflineConstraintNormalizationEnabled())
+      configConstraints->NormalizeConstraints();
+
+    using Solver = Andersen::Configuration::Solver;
+    if (config.GetSolver() == Solver::Naive)
+      configConstraints->SolveNaively();
+    else if (config.GetSolver() == Solver::Worklist)
+      configConstraints->SolveUsingWorklist(
+          config.GetWorklistSoliverPolicy(),
+          config.IsOnlineCycleDetectionEnabled(),
+          config.IsHybridCycleDetectionEnabled(),
+          config.IsLazyCycleDetectionEnabled(),
+          config.IsDifferencePropagationEnabled(),
+          config.IsPreferImplicitPointeesEnabled());
+    else
+      configConstraints->SolveUsingWavePropagation(config.GetNumThreads());
+
+    assert(configSet->HasIdenticalSolAs(*naiveSet));
+  }
+
+  auto & solution = *naiveSet;
+  assert(solution.GetPointsToSet(gepB).Size() == 1);
+  assert(solution.IsPointingTo(gepB, fields[1]));
+  assert(solution.GetPointsToSet(alloca0).Size() == 1);
+  assert(solution.IsPointingTo(alloca0, alloca1));
+  assert(solution.GetPointsToSet(fields[1]).Size() == 1);
+  assert(solution.IsPointingTo(fields[1], alloca2));
+  assert(solution.GetPointsToSet(loadedA).Size() == 1);
+  assert(solution.IsPointingTo(loadedA, alloca1));
+  assert(solution.GetPointsToSet(loadedB).Size() == 1);
+  assert(solution.IsPointingTo(loadedB, alloca2));
+  assert(solution.IsPointingTo(structAddress, fields[1]));
+  assert(solution.IsPointingTo(loadedStruct, alloca1));
+  assert(solution.IsPointingTo(loadedStruct, alloca2));
+
+  // If the base points to external, so does the result
+  constraints.AddPointsToExternalConstraint(reg0);
+  // Making the second field escape makes the whole memory object escape
+  constraints.AddRegisterContentEscapedConstraint(gepB);
+  constraints.SolveNaively();
+  assert(set.IsPointingToExternal(gepB));
+  assert(set.HasEscaped(alloca0));
+  assert(set.HasEscaped(fields[1]));
+  assert(set.HasEscaped(alloca1));
+  assert(set.HasEscaped(alloca2));
+}
+
 static void
 TestDrawSubsetGraph()
 {
@@ -822,9 +1067,11 @@ TestDrawSubsetGraph()
 }
 
 // Tests crating a ConstraintSet with multiple different constraints and calling Solve()
-template<bool useWorklist, typename... Args>
+template<jlm::llvm::aa::Andersen::Configuration::Solver solver, typename... Args>
 static void
-TestPointerObjectConstraintSetSolve(Args... args)
+TestPointerObjectConstraintSetSolve(
+    jlm::llvm::aa::PointsToSet::Representation representation,
+    Args... args)
 {
   using namespace jlm::llvm::aa;
 
@@ -833,6 +1080,7 @@ TestPointerObjectConstraintSetSolve(Args... args)
   rvsdg.InitializeTest();
 
   PointerObjectSet set;
+  set.SetPointsToSetRepresentation(representation);
   PointerObjectIndex reg[11];
   for (unsigned int & i : reg)
     i = set.CreateDummyRegisterPointerObject();
@@ -890,10 +1138,15 @@ TestPointerObjectConstraintSetSolve(Args... args)
   constraints.AddConstraint(LoadConstraint(reg[10], reg[8]));
 
   // Find a solution to all the constraints
-  if constexpr (useWorklist)
+  using Solver = Andersen::Configuration::Solver;
+  if constexpr (solver == Solver::Worklist)
   {
     constraints.SolveUsingWorklist(args...);
   }
+  else if constexpr (solver == Solver::WavePropagation)
+  {
+    constraints.SolveUsingWavePropagation(args...);
+  }
   else
   {
     static_assert(sizeof...(args) == 0, "The naive solver takes no arguments");
@@ -952,6 +1205,61 @@ TestPointerObjectConstraintSetSolve(Args... args)
   assert(set.IsPointingToExternal(reg[10]));
 }
 
+// Tests that wave propagation visits wide topological levels with several threads,
+// and finds the same solution as the naive solver
+static void
+TestWavePropagationParallelLevels()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  const auto source = set.CreateDummyRegisterPointerObject();
+
+  PointerObjectConstraintSet constraints(set);
+  constraints.AddPointerPointeeConstraint(source, alloca0);
+
+  // Two levels of 1000 registers each, where every second register in the second level is
+  // also a superset of the register loaded from its predecessor
+  constexpr size_t numRegisters = 1000;
+  std::vector<PointerObjectIndex> level1, level2;
+  for (size_t i = 0; i < numRegisters; i++)
+  {
+    level1.push_back(set.CreateDummyRegisterPointerObject());
+    level2.push_back(set.CreateDummyRegisterPointerObject());
+    constraints.AddConstraint(SupersetConstraint(level1[i], source));
+    constraints.AddConstraint(SupersetConstraint(level2[i], level1[i]));
+    if (i % 2 == 0)
+      constraints.AddConstraint(LoadConstraint(level2[i], level1[i]));
+  }
+
+  // Storing through the first register of the second level makes alloca0 point to alloca1
+  constraints.AddConstraint(StoreConstraint(level2[0], level1[1]));
+  constraints.AddPointerPointeeConstraint(level1[1], alloca1);
+  constraints.AddPointsToExternalConstraint(level1.back());
+
+  auto [naiveSet, naiveConstraints] = constraints.Clone();
+  naiveConstraints->SolveNaively();
+
+  // Act
+  auto statistics = constraints.SolveUsingWavePropagation(4);
+
+  // Assert
+  assert(statistics.NumThreads == 4);
+  assert(statistics.NumParallelTopologicalLevels >= 2);
+  assert(set.HasIdenticalSolAs(*naiveSet));
+
+  assert(set.IsPointingTo(level2[numRegisters - 1], alloca0));
+  assert(set.IsPointingTo(level2[0], alloca1));
+  assert(!set.IsPointingTo(level2[3], alloca1));
+  assert(set.IsPointingToExternal(level2.back()));
+  assert(!set.IsPointingToExternal(level2.front()));
+}
+
 static void
 TestClonePointerObjectConstraintSet()
 {
@@ -996,6 +1304,7 @@ TestPointerObjectSet()
   TestPointerObjectUnificationPointees();
   TestAddToPointsToSet();
   TestMakePointsToSetSuperset();
+  TestSharedPointsToSets();
   TestClonePointerObjectSet();
   TestSupersetConstraint();
   TestStoreConstraintDirectly();
@@ -1006,21 +1315,35 @@ TestPointerObjectSet()
   TestFunctionCallConstraint();
   TestAddPointsToExternalConstraint();
   TestAddRegisterContentEscapedConstraint();
+  TestFieldMemoryObjects();
+  TestFieldOffsetConstraint();
   TestDrawSubsetGraph();
-  TestPointerObjectConstraintSetSolve<false>();
+  using Solver = jlm::llvm::aa::Andersen::Configuration::Solver;
+  using Representation = jlm::llvm::aa::PointsToSet::Representation;
+  TestPointerObjectConstraintSetSolve<Solver::Naive>(Representation::HashSet);
+  TestPointerObjectConstraintSetSolve<Solver::Naive>(Representation::SparseBitVector);
+  TestPointerObjectConstraintSetSolve<Solver::Naive>(Representation::Shared);
+
+  for (auto representation :
+       { Representation::HashSet, Representation::SparseBitVector, Representation::Shared })
+  {
+    TestPointerObjectConstraintSetSolve<Solver::WavePropagation>(representation, 1);
+    TestPointerObjectConstraintSetSolve<Solver::WavePropagation>(representation, 4);
+  }
 
   auto allConfigs = jlm::llvm::aa::Andersen::Configuration::GetAllConfigurations();
   for (const auto & config : allConfigs)
   {
     // Ignore all configs that enable features that do not affect SolveUsingWorklist()
-    if (config.GetSolver() != jlm::llvm::aa::Andersen::Configuration::Solver::Worklist)
+    if (config.GetSolver() != Solver::Worklist)
       continue;
     if (config.IsOfflineVariableSubstitutionEnabled())
       continue;
     if (config.IsOfflineConstraintNormalizationEnabled())
       continue;
 
-    TestPointerObjectConstraintSetSolve<true>(
+    TestPointerObjectConstraintSetSolve<Solver::Worklist>(
+        config.GetPointsToSetRepresentation(),
         config.GetWorklistSoliverPolicy(),
         config.IsOnlineCycleDetectionEnabled(),
         config.IsHybridCycleDetectionEnabled(),
@@ -1029,6 +1352,7 @@ TestPointerObjectSet()
         config.IsPreferImplicitPointeesEnabled());
   }
 
+  TestWavePropagationParallelLevels();
   TestClonePointerObjectConstraintSet();
   return 0;
 }
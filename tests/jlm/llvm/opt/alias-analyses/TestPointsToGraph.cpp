@@ -317,6 +317,60 @@ TestIsSupergraphOf()
   import0.AddEdge(lambda0);
   assert(graph0->IsSupergraphOf(*graph1));
   assert(graph1->IsSupergraphOf(*graph0));
+
+  // Field nodes correspond when they have the same index in corresponding memory nodes
+  auto & field0 = PointsToGraph::FieldNode::Create(*graph0, delta0, 1);
+  assert(graph0->IsSupergraphOf(*graph1));
+  assert(!graph1->IsSupergraphOf(*graph0));
+  auto & field1 = PointsToGraph::FieldNode::Create(*graph1, delta1, 1);
+  assert(graph1->IsSupergraphOf(*graph0));
+
+  field0.AddEdge(alloca0);
+  assert(!graph1->IsSupergraphOf(*graph0));
+  field1.AddEdge(alloca1);
+  assert(graph0->IsSupergraphOf(*graph1));
+  assert(graph1->IsSupergraphOf(*graph0));
+}
+
+static void
+TestFieldNodes()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::AllMemoryNodesTest rvsdg;
+  rvsdg.InitializeTest();
+
+  auto pointsToGraph = PointsToGraph::Create();
+  auto & allocaNode = PointsToGraph::AllocaNode::Create(*pointsToGraph, rvsdg.GetAllocaNode());
+  auto & deltaNode = PointsToGraph::DeltaNode::Create(*pointsToGraph, rvsdg.GetDeltaNode());
+
+  // Act
+  auto & field1 = PointsToGraph::FieldNode::Create(*pointsToGraph, allocaNode, 1);
+  auto & field2 = PointsToGraph::FieldNode::Create(*pointsToGraph, allocaNode, 2);
+  field1.AddEdge(deltaNode);
+
+  // Assert
+  assert(pointsToGraph->NumFieldNodes() == 2);
+  assert(pointsToGraph->NumMemoryNodes() == 5);
+  assert(pointsToGraph->NumEdges().first == 1);
+
+  const auto & fieldNodes = pointsToGraph->GetFieldNodes(allocaNode);
+  assert(fieldNodes.size() == 2);
+  assert(fieldNodes[0] == &field1 && fieldNodes[1] == &field2);
+  assert(pointsToGraph->GetFieldNodes(deltaNode).empty());
+
+  assert(&field2.GetParent() == &allocaNode);
+  assert(field2.GetFieldIndex() == 2);
+  assert(field2.DebugString() == allocaNode.DebugString() + ":field2");
+
+  size_t numIteratedFieldNodes = 0;
+  for ([[maybe_unused]] auto & fieldNode : pointsToGraph->FieldNodes())
+    numIteratedFieldNodes++;
+  assert(numIteratedFieldNodes == 2);
+
+  auto dot = PointsToGraph::ToDot(*pointsToGraph);
+  assert(dot.find(":field1") != std::string::npos);
 }
 
 static int
@@ -325,6 +379,7 @@ TestPointsToGraph()
   TestNodeIterators();
   TestRegisterNodeIteration();
   TestIsSupergraphOf();
+  TestFieldNodes();
 
   return 0;
 }
@@ -20,7 +20,7 @@
 static jlm::util::StatisticsCollector statisticsCollector;
 
 static inline void
-test_simple()
+test_simple(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -52,7 +52,7 @@ test_simple()
   GraphExport::Create(*b4, "b4");
 
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
 
@@ -62,7 +62,7 @@ test_simple()
 }
 
 static inline void
-test_gamma()
+test_gamma(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -105,7 +105,7 @@ test_gamma()
   GraphExport::Create(*gamma->output(2), "y");
 
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
 
@@ -126,7 +126,7 @@ test_gamma()
 }
 
 static inline void
-test_theta()
+test_theta(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -162,7 +162,7 @@ test_theta()
   GraphExport::Create(*lv4.output, "lv4");
 
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
 
@@ -177,7 +177,7 @@ test_theta()
 }
 
 static inline void
-test_theta2()
+test_theta2(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -210,7 +210,7 @@ test_theta2()
   GraphExport::Create(*lv3.output, "lv3");
 
   //	jlm::rvsdg::view(graph, stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph, stdout);
 
@@ -219,7 +219,7 @@ test_theta2()
 }
 
 static inline void
-test_theta3()
+test_theta3(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -263,7 +263,7 @@ test_theta3()
   GraphExport::Create(*lv4.output, "lv4");
 
   //	jlm::rvsdg::view(graph, stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph, stdout);
 
@@ -276,7 +276,7 @@ test_theta3()
 }
 
 static inline void
-test_theta4()
+test_theta4(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -317,7 +317,7 @@ test_theta4()
   GraphExport::Create(*theta->output(4), "lv5");
 
   //	jlm::rvsdg::view(graph, stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph, stdout);
 
@@ -327,7 +327,7 @@ test_theta4()
 }
 
 static inline void
-test_theta5()
+test_theta5(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -361,7 +361,7 @@ test_theta5()
   auto & ex4 = GraphExport::Create(*theta->output(4), "lv4");
 
   //	jlm::rvsdg::view(graph, stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph, stdout);
 
@@ -372,7 +372,7 @@ test_theta5()
 }
 
 static inline void
-test_lambda()
+test_lambda(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -398,7 +398,7 @@ test_lambda()
   GraphExport::Create(*output, "f");
 
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
 
@@ -407,7 +407,7 @@ test_lambda()
 }
 
 static inline void
-test_phi()
+test_phi(jlm::llvm::cne::Mode mode)
 {
   using namespace jlm::llvm;
 
@@ -450,7 +450,7 @@ test_phi()
   GraphExport::Create(*phi->output(1), "f2");
 
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
-  jlm::llvm::cne cne;
+  jlm::llvm::cne cne(mode);
   cne.Run(rm, statisticsCollector);
   //	jlm::rvsdg::view(graph.GetRootRegion(), stdout);
 
@@ -459,20 +459,156 @@ test_phi()
       == jlm::rvsdg::AssertGetOwnerNode<jlm::rvsdg::LambdaNode>(*f2).input(0)->origin());
 }
 
+static inline void
+test_theta_swapped_loop_variables()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto vt = jlm::tests::valuetype::Create();
+  auto ct = jlm::rvsdg::ControlType::Create(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ct, "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, vt, "x");
+
+  auto theta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  auto region = theta->subregion();
+
+  auto lv0 = theta->AddLoopVar(c);
+  auto lv1 = theta->AddLoopVar(x);
+  auto lv2 = theta->AddLoopVar(x);
+
+  // The loop variables swap their values in every iteration, which is only congruent if assumed
+  // optimistically
+  auto u1 = jlm::tests::create_testop(region, { lv2.pre }, { vt })[0];
+  auto u2 = jlm::tests::create_testop(region, { lv1.pre }, { vt })[0];
+  lv1.post->divert_to(u1);
+  lv2.post->divert_to(u2);
+
+  theta->set_predicate(lv0.pre);
+
+  auto & ex1 = GraphExport::Create(*lv1.output, "lv1");
+  auto & ex2 = GraphExport::Create(*lv2.output, "lv2");
+
+  // Act
+  jlm::llvm::cne cne(jlm::llvm::cne::Mode::ValueNumbering);
+  cne.Run(rm, statisticsCollector);
+
+  // Assert
+  assert(ex1.origin() == ex2.origin());
+  assert(lv2.post->origin() == lv1.post->origin());
+}
+
+static inline void
+test_theta_nested_refinement()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto vt = jlm::tests::valuetype::Create();
+  auto ct = jlm::rvsdg::ControlType::Create(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  auto c = &jlm::tests::GraphImport::Create(graph, ct, "c");
+  auto x = &jlm::tests::GraphImport::Create(graph, vt, "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, vt, "y");
+
+  auto outerTheta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  auto lv0 = outerTheta->AddLoopVar(c);
+  auto lv1 = outerTheta->AddLoopVar(x);
+  auto lv2 = outerTheta->AddLoopVar(x);
+  auto lv3 = outerTheta->AddLoopVar(y);
+  auto lv4 = outerTheta->AddLoopVar(x);
+  auto lv5 = outerTheta->AddLoopVar(x);
+  auto lv6 = outerTheta->AddLoopVar(y);
+  auto lv7 = outerTheta->AddLoopVar(y);
+
+  // lv1 and lv2 are refuted in the first iteration of the outer theta node
+  auto u = jlm::tests::create_testop(outerTheta->subregion(), { lv1.pre }, { vt })[0];
+  lv1.post->divert_to(u);
+
+  // The inputs of this theta node do not change between the iterations of the outer theta node
+  auto innerTheta1 = jlm::rvsdg::ThetaNode::create(outerTheta->subregion());
+  auto ilv0 = innerTheta1->AddLoopVar(lv0.pre);
+  auto ilv1 = innerTheta1->AddLoopVar(lv3.pre);
+  auto ilv2 = innerTheta1->AddLoopVar(lv3.pre);
+  auto u1 = jlm::tests::create_testop(innerTheta1->subregion(), { ilv2.pre }, { vt })[0];
+  auto u2 = jlm::tests::create_testop(innerTheta1->subregion(), { ilv1.pre }, { vt })[0];
+  ilv1.post->divert_to(u1);
+  ilv2.post->divert_to(u2);
+  innerTheta1->set_predicate(ilv0.pre);
+  lv6.post->divert_to(ilv1.output);
+  lv7.post->divert_to(ilv2.output);
+
+  // The inputs of this theta node are split after the first iteration of the outer theta node
+  auto innerTheta2 = jlm::rvsdg::ThetaNode::create(outerTheta->subregion());
+  auto jlv0 = innerTheta2->AddLoopVar(lv0.pre);
+  auto jlv1 = innerTheta2->AddLoopVar(lv1.pre);
+  auto jlv2 = innerTheta2->AddLoopVar(lv2.pre);
+  innerTheta2->set_predicate(jlv0.pre);
+  lv4.post->divert_to(jlv1.output);
+  lv5.post->divert_to(jlv2.output);
+
+  outerTheta->set_predicate(lv0.pre);
+
+  auto & ex1 = GraphExport::Create(*lv1.output, "lv1");
+  auto & ex2 = GraphExport::Create(*lv2.output, "lv2");
+  auto & ex3 = GraphExport::Create(*lv3.output, "lv3");
+  auto & ex4 = GraphExport::Create(*lv4.output, "lv4");
+  auto & ex5 = GraphExport::Create(*lv5.output, "lv5");
+  auto & ex6 = GraphExport::Create(*lv6.output, "lv6");
+  auto & ex7 = GraphExport::Create(*lv7.output, "lv7");
+
+  // Act
+  jlm::llvm::cne cne(jlm::llvm::cne::Mode::ValueNumbering);
+  cne.Run(rm, statisticsCollector);
+
+  // Assert
+  assert(ex1.origin() != ex2.origin());
+  assert(ex4.origin() != ex5.origin());
+  assert(ex3.origin() == lv3.output);
+  assert(ilv2.post->origin() == ilv1.post->origin());
+  assert(lv7.post->origin() == lv6.post->origin());
+  assert(ex6.origin() == ex7.origin());
+}
+
+static void
+verify(jlm::llvm::cne::Mode mode)
+{
+  test_simple(mode);
+  test_gamma(mode);
+  test_theta(mode);
+  test_theta2(mode);
+  test_theta3(mode);
+  test_theta4(mode);
+  test_theta5(mode);
+  test_lambda(mode);
+  test_phi(mode);
+}
+
 static int
 verify()
 {
-  test_simple();
-  test_gamma();
-  test_theta();
-  test_theta2();
-  test_theta3();
-  test_theta4();
-  test_theta5();
-  test_lambda();
-  test_phi();
+  verify(jlm::llvm::cne::Mode::Pairwise);
 
   return 0;
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/test-cne", verify)
+
+static int
+verifyValueNumbering()
+{
+  verify(jlm::llvm::cne::Mode::ValueNumbering);
+  test_theta_swapped_loop_variables();
+  test_theta_nested_refinement();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/test-cne-ValueNumbering", verifyValueNumbering)
@@ -398,6 +398,85 @@ test_nested_theta()
   assert(thetas.size() == 3 && nthetas(thetas[0]->subregion()) == 8);
 }
 
+static jlm::rvsdg::ThetaNode *
+create_counting_theta(jlm::rvsdg::Region * region, size_t niterations)
+{
+  auto init = jlm::rvsdg::create_bitconstant(region, 32, 0);
+  auto step = jlm::rvsdg::create_bitconstant(region, 32, 1);
+  auto end = jlm::rvsdg::create_bitconstant(region, 32, niterations);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(region);
+  auto lv_init = theta->AddLoopVar(init);
+  auto lv_step = theta->AddLoopVar(step);
+  auto lv_end = theta->AddLoopVar(end);
+
+  auto add = jlm::rvsdg::bitadd_op::create(32, lv_init.pre, lv_step.pre);
+  auto compare = jlm::rvsdg::bitult_op::create(32, add, lv_end.pre);
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, compare);
+  theta->set_predicate(match);
+  lv_init.post->divert_to(add);
+
+  return theta;
+}
+
+static inline void
+test_size_budget()
+{
+  {
+    jlm::llvm::RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto & rootRegion = rm.Rvsdg().GetRootRegion();
+
+    auto otheta = create_counting_theta(&rootRegion, 8);
+    create_counting_theta(otheta->subregion(), 4);
+
+    //	jlm::rvsdg::view(rm.Rvsdg(), stdout);
+    jlm::llvm::loopunroll loopunroll(4, 200);
+    loopunroll.Run(rm, statisticsCollector);
+    //	jlm::rvsdg::view(rm.Rvsdg(), stdout);
+
+    /*
+      The inner theta fits the budget when fully unrolled. Afterwards, the outer theta
+      is an innermost theta and also fits the budget when fully unrolled.
+    */
+    assert(find_thetas(&rootRegion).empty());
+  }
+
+  {
+    jlm::llvm::RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto & rootRegion = rm.Rvsdg().GetRootRegion();
+
+    create_counting_theta(&rootRegion, 100);
+
+    jlm::llvm::loopunroll loopunroll(4, 7);
+    loopunroll.Run(rm, statisticsCollector);
+
+    /*
+      The body of the theta has three nodes. The budget only permits an unroll factor
+      of two, which is a multiple of the number of iterations.
+    */
+    auto thetas = find_thetas(&rootRegion);
+    assert(thetas.size() == 1);
+    assert(thetas[0]->subregion()->nnodes() >= 6 && thetas[0]->subregion()->nnodes() < 12);
+  }
+
+  {
+    jlm::llvm::RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto & rootRegion = rm.Rvsdg().GetRootRegion();
+
+    auto theta = create_counting_theta(&rootRegion, 100);
+
+    jlm::llvm::loopunroll loopunroll(4, 5);
+    loopunroll.Run(rm, statisticsCollector);
+
+    /*
+      The budget does not permit any unrolling.
+    */
+    auto thetas = find_thetas(&rootRegion);
+    assert(thetas.size() == 1 && thetas[0] == theta);
+    assert(theta->subregion()->nnodes() == 3);
+  }
+}
+
 static int
 verify()
 {
@@ -406,6 +485,7 @@ verify()
   test_nested_theta();
   test_known_boundaries();
   test_unknown_boundaries();
+  test_size_budget();
 
   return 0;
 }
@@ -7,10 +7,12 @@
 #include <test-registry.hpp>
 #include <test-types.hpp>
 
+#include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/util/AnnotationMap.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <unordered_map>
 
 static int
 IteratorRanges()
@@ -487,3 +489,131 @@ BottomNodeTests()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/rvsdg/RegionTests-BottomNodeTests", BottomNodeTests)
+
+static int
+BatchEditTests()
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::tests;
+
+  auto valueType = valuetype::Create();
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  auto & import = jlm::tests::GraphImport::Create(rvsdg, valueType, "i");
+
+  // A chain of nodes n1 -> n2 -> n3 and a couple of users of the import
+  auto n1 = test_op::create(&rootRegion, {}, { valueType });
+  auto n2 = test_op::create(&rootRegion, { n1->output(0) }, { valueType });
+  auto n3 = test_op::create(&rootRegion, { n2->output(0) }, { valueType });
+  std::vector<Node *> users;
+  for (size_t n = 0; n < 10; n++)
+    users.push_back(test_op::create(&rootRegion, { &import }, { valueType }));
+  assert(users[0]->depth() == 0);
+
+  // Act & Assert
+  {
+    BatchEdit batchEdit(rootRegion);
+    assert(rootRegion.IsBatchEditing());
+
+    {
+      // Batch edits can be nested
+      BatchEdit nestedBatchEdit(rootRegion);
+      import.divert_users(n3->output(0));
+    }
+    assert(rootRegion.IsBatchEditing());
+
+    // The depths are only updated once the batch edit ends
+    for (auto user : users)
+      assert(user->depth() == 0);
+  }
+  assert(!rootRegion.IsBatchEditing());
+
+  assert(n3->depth() == 2);
+  for (auto user : users)
+    assert(user->depth() == 3);
+
+  // Diverting the head of the chain updates the depths of all its transitive successors
+  {
+    BatchEdit batchEdit(rootRegion);
+    auto n0 = test_op::create(&rootRegion, {}, { valueType });
+    auto n00 = test_op::create(&rootRegion, { n0->output(0) }, { valueType });
+    n1->output(0)->divert_users(n00->output(0));
+  }
+
+  assert(n2->depth() == 2 && n3->depth() == 3);
+  for (auto user : users)
+    assert(user->depth() == 4);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/RegionTests-BatchEditTests", BatchEditTests)
+
+static int
+BatchEditDepthPropagationTests()
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::tests;
+
+  auto valueType = valuetype::Create();
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  auto & import = jlm::tests::GraphImport::Create(rvsdg, valueType, "i");
+
+  // A long chain c1 -> c2 -> c3 and a short chain s1, both feeding into a node join. The node
+  // bottom sits on top of join, and the node side depends on the import and the long chain.
+  auto c1 = test_op::create(&rootRegion, { &import }, { valueType });
+  auto c2 = test_op::create(&rootRegion, { c1->output(0) }, { valueType });
+  auto c3 = test_op::create(&rootRegion, { c2->output(0) }, { valueType });
+  auto s1 = test_op::create(&rootRegion, { &import }, { valueType });
+  auto join = test_op::create(&rootRegion, { c3->output(0), s1->output(0) }, { valueType });
+  auto bottom = test_op::create(&rootRegion, { join->output(0) }, { valueType });
+  auto side = test_op::create(&rootRegion, { &import, c3->output(0) }, { valueType });
+  assert(join->depth() == 3 && bottom->depth() == 4 && side->depth() == 3);
+
+  std::unordered_map<Node *, size_t> numDepthChanges;
+  auto callback = on_node_depth_change.connect(
+      [&](Node * node, size_t)
+      {
+        numDepthChanges[node]++;
+      });
+
+  // Act
+  // Both chains get deeper, such that join is reached over two paths of different lengths
+  {
+    BatchEdit batchEdit(rootRegion);
+    auto n0 = test_op::create(&rootRegion, {}, { valueType });
+    auto n1 = test_op::create(&rootRegion, { n0->output(0) }, { valueType });
+    import.divert_users(n1->output(0));
+  }
+
+  // Assert
+  assert(c3->depth() == 4 && s1->depth() == 2);
+  assert(join->depth() == 5 && bottom->depth() == 6 && side->depth() == 5);
+  for (auto node : { c1, c2, c3, s1, join, bottom, side })
+    assert(numDepthChanges[node] >= 1);
+
+  // Act
+  // Diverting the short chain to a shallower node does not change the depth of join, and nothing
+  // is propagated beyond it
+  numDepthChanges.clear();
+  {
+    BatchEdit batchEdit(rootRegion);
+    auto n2 = test_op::create(&rootRegion, {}, { valueType });
+    join->input(1)->divert_to(n2->output(0));
+  }
+
+  // Assert
+  assert(join->depth() == 5 && bottom->depth() == 6);
+  assert(numDepthChanges.empty());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/RegionTests-BatchEditDepthPropagationTests",
+    BatchEditDepthPropagationTests)
@@ -7,6 +7,9 @@
 #include <test-registry.hpp>
 #include <test-types.hpp>
 
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
 #include <jlm/rvsdg/NodeNormalization.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/view.hpp>
@@ -183,3 +186,105 @@ NormalizeSimpleOperationCne_Failure()
 JLM_UNIT_TEST_REGISTER(
     "jlm/rvsdg/NormalizeSimpleOperationCne_Failure",
     NormalizeSimpleOperationCne_Failure)
+
+static int
+OperationComputeHash()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  bitconstant_op constant1(bitvalue_repr(32, 42));
+  bitconstant_op constant2(bitvalue_repr(32, 42));
+  bitconstant_op constant3(bitvalue_repr(32, 43));
+  bitconstant_op constant4(bitvalue_repr(64, 42));
+
+  match_op match1(32, { { 0, 1 } }, 0, 2);
+  match_op match2(32, { { 0, 1 } }, 0, 2);
+  match_op match3(32, { { 1, 1 } }, 0, 2);
+
+  bitadd_op add1(32);
+  bitadd_op add2(32);
+  bitsub_op sub(32);
+
+  // Act & Assert
+  assert(constant1 == constant2);
+  assert(constant1.ComputeHash() == constant2.ComputeHash());
+  assert(constant1.ComputeHash() != constant3.ComputeHash());
+  assert(constant1.ComputeHash() != constant4.ComputeHash());
+
+  assert(match1 == match2);
+  assert(match1.ComputeHash() == match2.ComputeHash());
+  assert(match1.ComputeHash() != match3.ComputeHash());
+
+  assert(add1 == add2);
+  assert(add1.ComputeHash() == add2.ComputeHash());
+  assert(add1.ComputeHash() != sub.ComputeHash());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/OperationComputeHash", OperationComputeHash)
+
+static int
+SimpleNodeHashConsing()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph graph;
+  const auto valueType = jlm::tests::valuetype::Create();
+  auto & rootRegion = graph.GetRootRegion();
+
+  auto v1 = &jlm::tests::GraphImport::Create(graph, valueType, "v1");
+  auto v2 = &jlm::tests::GraphImport::Create(graph, valueType, "v2");
+
+  auto & existingNode = CreateOpNode<jlm::tests::unary_op>({ v1 }, valueType, valueType);
+
+  // Act
+  rootRegion.EnableHashConsing();
+
+  auto & unaryNode1 = CreateOpNode<jlm::tests::unary_op>({ v1 }, valueType, valueType);
+  auto & unaryNode2 = CreateOpNode<jlm::tests::unary_op>({ v2 }, valueType, valueType);
+  auto & unaryNode3 = CreateOpNode<jlm::tests::unary_op>({ v2 }, valueType, valueType);
+  auto & nullaryNode1 = CreateOpNode<jlm::tests::NullaryOperation>(rootRegion, valueType);
+  auto & nullaryNode2 = CreateOpNode<jlm::tests::NullaryOperation>(rootRegion, valueType);
+
+  // Assert
+  assert(rootRegion.GetHashConsingTable() != nullptr);
+  assert(&unaryNode1 == &existingNode);
+  assert(&unaryNode2 == &unaryNode3);
+  assert(&unaryNode1 != &unaryNode2);
+  assert(&nullaryNode1 == &nullaryNode2);
+  assert(rootRegion.nnodes() == 3);
+  assert(rootRegion.GetHashConsingTable()->NumNodes() == 3);
+
+  // Removed nodes are no longer found
+  remove(&unaryNode2);
+  assert(rootRegion.GetHashConsingTable()->NumNodes() == 2);
+  CreateOpNode<jlm::tests::unary_op>({ v2 }, valueType, valueType);
+  assert(rootRegion.nnodes() == 3);
+  assert(rootRegion.GetHashConsingTable()->NumNodes() == 3);
+
+  // Nodes with diverted operands are only returned for their new operands
+  auto v3 = &jlm::tests::GraphImport::Create(graph, valueType, "v3");
+  existingNode.input(0)->divert_to(v3);
+  auto & unaryNode5 = CreateOpNode<jlm::tests::unary_op>({ v1 }, valueType, valueType);
+  auto & unaryNode6 = CreateOpNode<jlm::tests::unary_op>({ v3 }, valueType, valueType);
+  assert(&unaryNode5 != &existingNode);
+  assert(&unaryNode6 == &existingNode);
+
+  // Nodes with state operands or results are never hash-consed
+  const auto stateType = jlm::tests::statetype::Create();
+  auto s = &jlm::tests::GraphImport::Create(graph, stateType, "s");
+  auto & stateNode1 = CreateOpNode<jlm::tests::unary_op>({ s }, stateType, stateType);
+  auto & stateNode2 = CreateOpNode<jlm::tests::unary_op>({ s }, stateType, stateType);
+  assert(&stateNode1 != &stateNode2);
+
+  rootRegion.DisableHashConsing();
+  auto & nullaryNode3 = CreateOpNode<jlm::tests::NullaryOperation>(rootRegion, valueType);
+  assert(&nullaryNode3 != &nullaryNode1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/SimpleNodeHashConsing", SimpleNodeHashConsing)
@@ -0,0 +1,403 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/RvsdgModule.hpp>
+#include <jlm/rvsdg/Transformation.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <optional>
+#include <vector>
+
+/**
+ * Lambda-local transformation that only counts the lambda nodes it is applied to.
+ */
+class CountingTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  ~CountingTransformation() noexcept override = default;
+
+  explicit CountingTransformation(
+      bool hasPartOutsideLambdas = false,
+      std::optional<jlm::util::Statistics::Id> statisticsId = std::nullopt)
+      : HasPartOutsideLambdas_(hasPartOutsideLambdas),
+        StatisticsId_(statisticsId)
+  {}
+
+  void
+  Run(jlm::rvsdg::RvsdgModule &, jlm::util::StatisticsCollector &) override
+  {
+    NumRuns_++;
+  }
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(jlm::rvsdg::LambdaNode &) const override
+  {
+    NumLambdaRuns_++;
+  }
+
+  [[nodiscard]] bool
+  HasPartOutsideLambdas() const noexcept override
+  {
+    return HasPartOutsideLambdas_;
+  }
+
+  void
+  RunOutsideLambdas(jlm::rvsdg::RvsdgModule &, jlm::util::StatisticsCollector &) override
+  {
+    NumLambdaRunsBeforeOutside_.push_back(NumLambdaRuns_);
+  }
+
+  [[nodiscard]] std::optional<jlm::util::Statistics::Id>
+  GetStatisticsId() const noexcept override
+  {
+    return StatisticsId_;
+  }
+
+  [[nodiscard]] size_t
+  NumRuns() const noexcept
+  {
+    return NumRuns_;
+  }
+
+  [[nodiscard]] size_t
+  NumLambdaRuns() const noexcept
+  {
+    return NumLambdaRuns_;
+  }
+
+  /**
+   * @return The number of lambda node runs before each run of the part outside of lambda nodes.
+   */
+  [[nodiscard]] const std::vector<size_t> &
+  NumLambdaRunsBeforeOutside() const noexcept
+  {
+    return NumLambdaRunsBeforeOutside_;
+  }
+
+private:
+  bool HasPartOutsideLambdas_;
+  std::optional<jlm::util::Statistics::Id> StatisticsId_;
+  size_t NumRuns_ = 0;
+  std::vector<size_t> NumLambdaRunsBeforeOutside_;
+  mutable std::atomic<size_t> NumLambdaRuns_ = 0;
+};
+
+/**
+ * Lambda-local transformation that bypasses the unary operation feeding the first function
+ * result of a lambda node, if any.
+ */
+class BypassTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  ~BypassTransformation() noexcept override = default;
+
+  void
+  Run(jlm::rvsdg::RvsdgModule &, jlm::util::StatisticsCollector &) override
+  {
+    JLM_UNREACHABLE("Expected transformation to be applied per lambda node.");
+  }
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(jlm::rvsdg::LambdaNode & lambdaNode) const override
+  {
+    auto & result = *lambdaNode.GetFunctionResults()[0];
+    auto node = jlm::rvsdg::TryGetOwnerNode<jlm::rvsdg::SimpleNode>(*result.origin());
+    if (node == nullptr)
+      return;
+
+    result.divert_to(node->input(0)->origin());
+    remove(node);
+  }
+};
+
+/**
+ * Creates a node that uses the origin of \p result and diverts \p result to the node. The
+ * result is then diverted back to its original origin and the node is removed again, which leaves
+ * the RVSDG unchanged.
+ */
+static void
+CreateAndRemoveNode(jlm::rvsdg::input & result)
+{
+  const auto origin = result.origin();
+  auto node = jlm::tests::unary_op::create(result.region(), origin->Type(), origin, origin->Type());
+  result.divert_to(node->output(0));
+  result.divert_to(origin);
+  remove(node);
+}
+
+/**
+ * Lambda-local transformation that creates and removes nodes without a net effect on the RVSDG.
+ */
+class ChurnTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  ~ChurnTransformation() noexcept override = default;
+
+  void
+  Run(jlm::rvsdg::RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector &) override
+  {
+    CreateAndRemoveNode(*rvsdgModule.Rvsdg().GetRootRegion().result(0));
+  }
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(jlm::rvsdg::LambdaNode & lambdaNode) const override
+  {
+    CreateAndRemoveNode(*lambdaNode.GetFunctionResults()[0]);
+  }
+};
+
+/**
+ * Creates a module with the exported lambda nodes f and g. The function result of f is its
+ * argument, while the function result of g is computed by a unary operation.
+ */
+static std::unique_ptr<jlm::rvsdg::RvsdgModule>
+CreateModule()
+{
+  using namespace jlm::rvsdg;
+
+  auto rvsdgModule = std::make_unique<RvsdgModule>(jlm::util::filepath(""));
+  auto & rootRegion = rvsdgModule->Rvsdg().GetRootRegion();
+
+  auto valueType = jlm::tests::valuetype::Create();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  auto f = LambdaNode::Create(rootRegion, std::make_unique<LambdaOperation>(functionType));
+  auto fOutput = f->finalize({ f->GetFunctionArguments()[0] });
+  jlm::tests::GraphExport::Create(*fOutput, "f");
+
+  auto g = LambdaNode::Create(rootRegion, std::make_unique<LambdaOperation>(functionType));
+  auto unaryNode = jlm::tests::unary_op::create(
+      g->subregion(),
+      valueType,
+      g->GetFunctionArguments()[0],
+      valueType);
+  auto gOutput = g->finalize({ unaryNode->output(0) });
+  jlm::tests::GraphExport::Create(*gOutput, "g");
+
+  return rvsdgModule;
+}
+
+static int
+SkipUnchangedLambdas()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto rvsdgModule = CreateModule();
+  CountingTransformation counting;
+  BypassTransformation bypass;
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  TransformationSequence::CreateAndRun(
+      *rvsdgModule,
+      statisticsCollector,
+      { &counting, &counting, &bypass, &counting },
+      1,
+      true);
+
+  // Assert
+  // The second application is skipped for both lambda nodes, as the first one did not modify them.
+  // The third application is only performed for g, which was modified by the bypass.
+  assert(counting.NumRuns() == 0);
+  assert(counting.NumLambdaRuns() == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-SkipUnchangedLambdas",
+    SkipUnchangedLambdas)
+
+static int
+WithoutSkippingUnchangedLambdas()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto rvsdgModule = CreateModule();
+  CountingTransformation counting;
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  TransformationSequence::CreateAndRun(*rvsdgModule, statisticsCollector, { &counting, &counting });
+  TransformationSequence::CreateAndRun(
+      *rvsdgModule,
+      statisticsCollector,
+      { &counting, &counting },
+      2);
+
+  // Assert
+  assert(counting.NumRuns() == 2);
+  assert(counting.NumLambdaRuns() == 4);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-WithoutSkippingUnchangedLambdas",
+    WithoutSkippingUnchangedLambdas)
+
+static int
+PartOutsideLambdas()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto rvsdgModule = CreateModule();
+  CountingTransformation counting;
+  CountingTransformation countingWithOutsidePart(true);
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  TransformationSequence::CreateAndRun(
+      *rvsdgModule,
+      statisticsCollector,
+      { &countingWithOutsidePart, &counting, &countingWithOutsidePart },
+      2);
+
+  // Assert
+  // The part outside of the lambda nodes is applied after each application to all lambda nodes,
+  // and before the subsequent transformations are applied to any lambda node.
+  assert(counting.NumLambdaRuns() == 2);
+  assert(countingWithOutsidePart.NumRuns() == 0);
+  assert(countingWithOutsidePart.NumLambdaRunsBeforeOutside() == std::vector<size_t>({ 2, 4 }));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-PartOutsideLambdas",
+    PartOutsideLambdas)
+
+static int
+DemandedStatistics()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto rvsdgModule = CreateModule();
+  CountingTransformation counting(false, jlm::util::Statistics::Id::DeadNodeElimination);
+
+  jlm::util::StatisticsCollectorSettings settings(
+      { jlm::util::Statistics::Id::DeadNodeElimination });
+  jlm::util::StatisticsCollector statisticsCollector(std::move(settings));
+
+  // Act
+  TransformationSequence::CreateAndRun(*rvsdgModule, statisticsCollector, { &counting }, 2);
+
+  // Assert
+  // Lambda-local transformations only collect statistics when applied to the entire module
+  assert(counting.NumRuns() == 1);
+  assert(counting.NumLambdaRuns() == 0);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-DemandedStatistics",
+    DemandedStatistics)
+
+static int
+FixpointGroup()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto rvsdgModule = CreateModule();
+  auto & rootRegion = rvsdgModule->Rvsdg().GetRootRegion();
+  auto & g = AssertGetOwnerNode<LambdaNode>(*rootRegion.result(1)->origin());
+
+  CountingTransformation counting;
+  BypassTransformation bypass;
+  RepeatUntilFixpoint group({ &bypass, &counting }, 10);
+
+  jlm::util::StatisticsCollectorSettings settings({ jlm::util::Statistics::Id::RvsdgOptimization });
+  jlm::util::StatisticsCollector statisticsCollector(std::move(settings));
+
+  // Act
+  TransformationSequence::CreateAndRun(*rvsdgModule, statisticsCollector, { &group }, 2, true);
+
+  // Assert
+  // The first iteration bypasses the unary operation in g, and the second iteration does not
+  // modify the RVSDG any longer. In the second iteration, the counting transformation is skipped
+  // for both lambda nodes.
+  assert(g.subregion()->nnodes() == 0);
+  assert(counting.NumLambdaRuns() == 2);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<size_t>("#FixpointIterations") == 2);
+  assert(statistics.GetMeasurementValue<size_t>("#SkippedLambdaRuns") == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-FixpointGroup",
+    FixpointGroup)
+
+static int
+FixpointGroupWithoutNetModifications()
+{
+  using namespace jlm::rvsdg;
+
+  for (const auto skipUnchangedLambdas : { false, true })
+  {
+    // Arrange
+    auto rvsdgModule = CreateModule();
+    ChurnTransformation churn;
+    CountingTransformation counting;
+    RepeatUntilFixpoint group({ &churn, &counting }, 10);
+
+    jlm::util::StatisticsCollectorSettings settings(
+        { jlm::util::Statistics::Id::RvsdgOptimization });
+    jlm::util::StatisticsCollector statisticsCollector(std::move(settings));
+
+    // Act
+    TransformationSequence::CreateAndRun(
+        *rvsdgModule,
+        statisticsCollector,
+        { &group },
+        1,
+        skipUnchangedLambdas);
+
+    // Assert
+    // Nodes that are created and removed again are no net modification, such that the group
+    // reaches its fixpoint after the first iteration.
+    auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+    assert(statistics.GetMeasurementValue<size_t>("#FixpointIterations") == 1);
+    assert(rvsdgModule->Rvsdg().GetRootRegion().nnodes() == 2);
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/TransformationSequenceTests-FixpointGroupWithoutNetModifications",
+    FixpointGroupWithoutNetModifications)
@@ -11,6 +11,8 @@
 #include <jlm/rvsdg/NodeNormalization.hpp>
 #include <jlm/rvsdg/view.hpp>
 
+#include <stdexcept>
+
 static int
 types_bitstring_arithmetic_test_bitand()
 {
@@ -2259,6 +2261,67 @@ types_bitstring_test_value_representation()
   return 0;
 }
 
+static int
+ValueRepresentationWideBitstrings()
+{
+  using namespace jlm::rvsdg;
+
+  const bitvalue_repr one(128, 1);
+  const bitvalue_repr minusOne(128, -1);
+
+  // Carries and shifts across word boundaries
+  assert(minusOne.add(one) == 0);
+  assert(one.shl(64)[64] == '1' && one.shl(64)[0] == '0');
+  assert(one.shl(64).shr(64) == 1);
+  assert(minusOne.shl(64).ashr(64) == -1);
+  assert(one.shl(63).mul(bitvalue_repr(128, 4)) == one.shl(65));
+  assert(bitvalue_repr(100, -7).mul(bitvalue_repr(100, -3)) == 21);
+
+  // Comparisons
+  assert(minusOne.slt(bitvalue_repr(128, 0)) == '1');
+  assert(minusOne.ult(bitvalue_repr(128, 0)) == '0');
+  assert(one.shl(64).ugt(one.shl(63)) == '1');
+
+  // Division
+  assert(one.shl(100).udiv(one.shl(40)) == one.shl(60));
+  assert(bitvalue_repr(128, 1000).umod(bitvalue_repr(128, 7)) == 6);
+  assert(bitvalue_repr(100, -7).sdiv(bitvalue_repr(100, 2)) == -3);
+  assert(bitvalue_repr(100, -7).smod(bitvalue_repr(100, 2)) == -1);
+  assert(bitvalue_repr(8, 5).udiv(bitvalue_repr(8, 0)) == -1);
+  assert(bitvalue_repr(8, 5).umod(bitvalue_repr(8, 0)) == 5);
+
+  // High halves of products
+  assert(bitvalue_repr(64, -1).umulh(bitvalue_repr(64, -1)) == -2);
+  assert(bitvalue_repr(64, -1).smulh(bitvalue_repr(64, -1)) == 0);
+
+  // Conversions
+  assert(bitvalue_repr(128, -5).to_int() == -5);
+  assert(bitvalue_repr(128, 5).to_uint() == 5);
+  assert(bitvalue_repr(8, -1).zext(120).to_uint() == 255);
+  assert(bitvalue_repr(std::string(70, '1').c_str()) == bitvalue_repr(70, -1));
+  assert(bitvalue_repr(70, -1).str() == std::string(70, '1'));
+  try
+  {
+    one.shl(127).to_uint();
+    assert(false);
+  }
+  catch (const std::range_error &)
+  {}
+
+  // Unknown bits are evaluated bit by bit
+  assert(bitvalue_repr("1D00").add(bitvalue_repr("1000")) == std::string("0DD0"));
+  assert(bitvalue_repr("X000").mul(bitvalue_repr("1000")) == std::string("X000"));
+  auto wide = bitvalue_repr("0D1X").concat(bitvalue_repr::repeat(64, 'D'));
+  assert(wide.slice(1, 67) == "D1X" + std::string(63, 'D'));
+  assert(!wide.is_known() && !wide.is_defined());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/rvsdg/bitstring/bitstring-ValueRepresentationWideBitstrings",
+    ValueRepresentationWideBitstrings);
+
 static int
 RunTests()
 {
@@ -9,6 +9,8 @@
 
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <algorithm>
+
 static void
 test_initialization()
 {
@@ -89,12 +91,47 @@ test_order_enforcement_traversal()
   assert(!has_active_trackers(&graph));
 }
 
+static void
+test_const_traversal()
+{
+  using namespace jlm::rvsdg;
+
+  jlm::rvsdg::Graph graph;
+  auto type = jlm::tests::valuetype::Create();
+
+  auto n1 = jlm::tests::test_op::create(&graph.GetRootRegion(), {}, { type, type });
+  auto n2 = jlm::tests::test_op::create(&graph.GetRootRegion(), { n1->output(0) }, { type });
+  auto n3 = jlm::tests::test_op::create(
+      &graph.GetRootRegion(),
+      { n1->output(1), n2->output(0) },
+      { type });
+  auto n4 = jlm::tests::test_op::create(&graph.GetRootRegion(), {}, { type });
+
+  jlm::tests::GraphExport::Create(*n3->output(0), "n3");
+  jlm::tests::GraphExport::Create(*n4->output(0), "n4");
+
+  std::vector<const Node *> nodes;
+  for (const auto & node : BottomUpConstTraverser(&graph.GetRootRegion()))
+    nodes.push_back(node);
+
+  auto position = [&](const Node * node)
+  {
+    return std::find(nodes.begin(), nodes.end(), node) - nodes.begin();
+  };
+
+  assert(nodes.size() == 4);
+  assert(position(n3) < position(n2));
+  assert(position(n2) < position(n1));
+  assert(!has_active_trackers(&graph));
+}
+
 static int
 test_main()
 {
   test_initialization();
   test_basic_traversal();
   test_order_enforcement_traversal();
+  test_const_traversal();
 
   return 0;
 }
@@ -8,6 +8,7 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+#include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/view.hpp>
 
 static bool
@@ -170,3 +171,113 @@ Copy()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/rvsdg/test-graph-Copy", Copy)
+
+static int
+NumAllocatedBytes()
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::tests;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  Graph graph;
+  assert(graph.NumAllocatedBytes() == 0);
+
+  // Act & Assert
+  auto & argument = RegionArgument::Create(graph.GetRootRegion(), nullptr, valueType);
+  auto numBytesArgument = graph.NumAllocatedBytes();
+  assert(numBytesArgument > 0);
+
+  auto node = test_op::create(&graph.GetRootRegion(), { &argument }, { valueType });
+  auto numBytesNode = graph.NumAllocatedBytes();
+  assert(numBytesNode > numBytesArgument);
+
+  auto structuralNode = structural_node::create(&graph.GetRootRegion(), 2);
+  StructuralInput::create(structuralNode, node->output(0), valueType);
+  assert(graph.NumAllocatedBytes() > numBytesNode);
+
+  // The copy of the region is allocated from the same graph
+  auto numBytesBeforeCopy = graph.NumAllocatedBytes();
+  SubstitutionMap smap;
+  node->copy(&graph.GetRootRegion(), smap);
+  assert(graph.NumAllocatedBytes() > numBytesBeforeCopy);
+
+  // Pruning returns the memory of the dead nodes to the allocator
+  graph.PruneNodes();
+  assert(graph.NumAllocatedBytes() == numBytesArgument);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/test-graph-NumAllocatedBytes", NumAllocatedBytes)
+
+static int
+DenseIds()
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::tests;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  Graph graph;
+  auto & argument = RegionArgument::Create(graph.GetRootRegion(), nullptr, valueType);
+  auto node1 = test_op::create(&graph.GetRootRegion(), { &argument }, { valueType });
+  auto node2 = test_op::create(&graph.GetRootRegion(), { &argument }, { valueType, valueType });
+
+  // Act & Assert
+  assert(graph.NumNodeIds() == 2);
+  assert(graph.NumOutputIds() == 4);
+  assert(node1->GetId() != node2->GetId());
+  assert(argument.GetId() != node1->output(0)->GetId());
+  assert(node2->output(0)->GetId() != node2->output(1)->GetId());
+
+  DenseNodeMap<int> nodeMap;
+  assert(nodeMap.Insert(*node1, 1));
+  assert(!nodeMap.Insert(*node1, 2));
+  nodeMap[*node2] = 3;
+  assert(nodeMap.Size() == 2);
+  assert(nodeMap.Lookup(*node1) == 1 && nodeMap.Lookup(*node2) == 3);
+
+  DenseOutputMap<const Node *> outputMap(graph.NumOutputIds());
+  for (size_t n = 0; n < node2->noutputs(); n++)
+    outputMap[*node2->output(n)] = node2;
+  assert(outputMap.Size() == 2);
+  assert(!outputMap.Contains(argument));
+
+  size_t numEntries = 0;
+  for (auto & [output, producer] : outputMap)
+  {
+    assert(producer == node2 && output::GetNode(*output) == node2);
+    numEntries++;
+  }
+  assert(numEntries == 2);
+
+  // The identifiers of removed nodes and outputs are recycled
+  nodeMap.Remove(*node1);
+  auto nodeId = node1->GetId();
+  remove(node1);
+  auto node3 = test_op::create(&graph.GetRootRegion(), { &argument }, { valueType });
+  assert(node3->GetId() == nodeId);
+  assert(graph.NumNodeIds() == 2);
+  assert(graph.NumOutputIds() == 4);
+  assert(!nodeMap.Contains(*node3));
+
+  // Entries of destroyed nodes are not reported for nodes that reuse their identifier, even if
+  // they are allocated at the same address
+  nodeMap[*node3] = 4;
+  const auto node3Id = node3->GetDenseId();
+  remove(node3);
+  auto node4 = test_op::create(&graph.GetRootRegion(), { &argument }, { valueType });
+  assert(node4->GetId() == node3Id.Index);
+  assert(node4->GetDenseId().Generation != node3Id.Generation);
+  assert(!nodeMap.Contains(*node4));
+  nodeMap[*node4] = 5;
+  assert(nodeMap.Lookup(*node4) == 5);
+  assert(nodeMap.Size() == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/test-graph-DenseIds", DenseIds)
@@ -216,6 +216,53 @@ TestRemoveInputsWhere()
   assert(node.ninputs() == 0);
 }
 
+/**
+ * Test output::begin(), output::end(), output::nusers(), and output::divert_users()
+ */
+static void
+TestOutputUsers()
+{
+  // Arrange
+  jlm::rvsdg::Graph rvsdg;
+  auto valueType = jlm::tests::valuetype::Create();
+  auto x = &jlm::tests::GraphImport::Create(rvsdg, valueType, "x");
+  auto y = &jlm::tests::GraphImport::Create(rvsdg, valueType, "y");
+
+  auto & node1 = jlm::tests::SimpleNode::Create(rvsdg.GetRootRegion(), { x, x }, {});
+  auto & node2 = jlm::tests::SimpleNode::Create(rvsdg.GetRootRegion(), { y, x }, {});
+
+  // Act & Assert
+  // Users are iterated in the order they were added
+  assert(x->nusers() == 3);
+  std::vector<jlm::rvsdg::input *> users(x->begin(), x->end());
+  assert(users.size() == 3);
+  assert(users[0] == node1.input(0));
+  assert(users[1] == node1.input(1));
+  assert(users[2] == node2.input(1));
+
+  node1.input(1)->divert_to(y);
+  assert(x->nusers() == 2);
+  assert(y->nusers() == 2);
+  users = std::vector<jlm::rvsdg::input *>(y->begin(), y->end());
+  assert(users[0] == node2.input(0));
+  assert(users[1] == node1.input(1));
+
+  x->divert_users(y);
+  assert(x->nusers() == 0);
+  assert(x->begin() == x->end());
+  assert(y->nusers() == 4);
+
+  node1.RemoveInputsWhere(
+      [](const jlm::rvsdg::input &)
+      {
+        return true;
+      });
+  assert(y->nusers() == 2);
+  users = std::vector<jlm::rvsdg::input *>(y->begin(), y->end());
+  assert(users[0] == node2.input(0));
+  assert(users[1] == node2.input(1));
+}
+
 static int
 test_nodes()
 {
@@ -223,6 +270,7 @@ test_nodes()
   test_node_depth();
   TestRemoveOutputsWhere();
   TestRemoveInputsWhere();
+  TestOutputUsers();
 
   return 0;
 }
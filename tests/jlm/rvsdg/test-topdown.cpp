@@ -9,6 +9,8 @@
 
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <algorithm>
+
 static void
 test_initialization()
 {
@@ -199,6 +201,43 @@ test_mutable_traverse()
   test(&graph, n1, n2, n3);
 }
 
+static void
+test_const_traversal()
+{
+  using namespace jlm::rvsdg;
+
+  jlm::rvsdg::Graph graph;
+  auto type = jlm::tests::valuetype::Create();
+  auto i = &jlm::tests::GraphImport::Create(graph, type, "i");
+
+  auto n1 = jlm::tests::test_op::create(&graph.GetRootRegion(), { i }, { type });
+  auto n2 = jlm::tests::test_op::create(&graph.GetRootRegion(), { i, n1->output(0) }, { type });
+  auto n3 = jlm::tests::test_op::create(&graph.GetRootRegion(), { n1->output(0) }, { type });
+  auto n4 = jlm::tests::test_op::create(
+      &graph.GetRootRegion(),
+      { n2->output(0), n3->output(0) },
+      { type });
+  auto n5 = jlm::tests::test_op::create(&graph.GetRootRegion(), {}, { type });
+
+  jlm::tests::GraphExport::Create(*n4->output(0), "n4");
+  jlm::tests::GraphExport::Create(*n5->output(0), "n5");
+
+  std::vector<const Node *> nodes;
+  for (const auto & node : TopDownConstTraverser(&graph.GetRootRegion()))
+    nodes.push_back(node);
+
+  auto position = [&](const Node * node)
+  {
+    return std::find(nodes.begin(), nodes.end(), node) - nodes.begin();
+  };
+
+  assert(nodes.size() == 5);
+  assert(position(n1) < position(n2) && position(n1) < position(n3));
+  assert(position(n2) < position(n4) && position(n3) < position(n4));
+  assert(position(n5) < position(n2));
+  assert(!has_active_trackers(&graph));
+}
+
 static int
 test_main()
 {
@@ -207,6 +246,7 @@ test_main()
   test_order_enforcement_traversal();
   test_traversal_insertion();
   test_mutable_traverse();
+  test_const_traversal();
 
   return 0;
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/DenseIdMap.hpp>
+
+#include <cassert>
+#include <string>
+
+namespace
+{
+
+struct Key
+{
+  jlm::util::DenseId Id;
+};
+
+struct IdOfKey
+{
+  const jlm::util::DenseId &
+  operator()(const Key & key) const noexcept
+  {
+    return key.Id;
+  }
+};
+
+}
+
+static int
+TestDenseIdAllocator()
+{
+  using namespace jlm::util;
+
+  DenseIdAllocator allocator;
+  assert(allocator.NumIds() == 0);
+
+  auto id0 = allocator.Allocate();
+  auto id1 = allocator.Allocate();
+  auto id2 = allocator.Allocate();
+  assert(id0.Index == 0 && id1.Index == 1 && id2.Index == 2);
+  assert(id0.Generation == 0 && id1.Generation == 0 && id2.Generation == 0);
+  assert(allocator.NumIds() == 3);
+
+  // Released indices are recycled with a new generation
+  allocator.Release(id1);
+  assert(allocator.NumUsedIds() == 2);
+  auto id3 = allocator.Allocate();
+  assert(id3.Index == id1.Index && id3.Generation == 1);
+  assert(allocator.NumIds() == 3);
+  assert(allocator.NumUsedIds() == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestDenseIdMap-TestDenseIdAllocator", TestDenseIdAllocator)
+
+static int
+TestDenseIdMap()
+{
+  using namespace jlm::util;
+
+  Key key0{ { 0, 0 } }, key5{ { 5, 0 } }, otherKey5{ { 5, 1 } };
+
+  DenseIdMap<Key, std::string, IdOfKey> map;
+  assert(map.Size() == 0);
+  assert(!map.Contains(key0));
+
+  assert(map.Insert(key5, "five"));
+  assert(!map.Insert(key5, "FIVE"));
+  assert(map.Contains(key5));
+  assert(map.Lookup(key5) == "five");
+  assert(!map.Contains(otherKey5));
+
+  map[key0] += "zero";
+  assert(map.Size() == 2);
+  assert(map.Lookup(key0) == "zero");
+
+  size_t numEntries = 0;
+  for (auto & [key, value] : map)
+  {
+    assert(map.Lookup(*key) == value);
+    numEntries++;
+  }
+  assert(numEntries == 2);
+
+  // A key that reuses the identifier of another key replaces its entry
+  assert(map.Insert(otherKey5, "other five"));
+  assert(!map.Contains(key5));
+  assert(map.Size() == 2);
+
+  assert(map.Remove(otherKey5));
+  assert(!map.Remove(otherKey5));
+  assert(map.Size() == 1);
+
+  // A key at the same address whose identifier has a new generation is a different key
+  assert(map.Insert(key5, "five"));
+  key5.Id.Generation++;
+  assert(!map.Contains(key5));
+  map[key5] = "new five";
+  assert(map.Lookup(key5) == "new five");
+  assert(map.Size() == 2);
+  key5.Id.Generation++;
+  assert(!map.Remove(key5));
+  assert(map.Size() == 2);
+
+  map.Clear();
+  assert(map.Size() == 0);
+  assert(!map.Contains(key0));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestDenseIdMap-TestDenseIdMap", TestDenseIdMap)
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SlabAllocator.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace jlm::util;
+
+static void
+TestSmallAllocations()
+{
+  SlabAllocator allocator;
+  assert(allocator.NumBytesInUse() == 0);
+  assert(allocator.NumSlabs() == 0);
+
+  // Arrange & Act
+  auto p1 = allocator.Allocate(1);
+  auto p2 = allocator.Allocate(SlabAllocator::Granularity);
+  auto p3 = allocator.Allocate(SlabAllocator::Granularity + 1);
+
+  // Assert
+  assert(reinterpret_cast<uintptr_t>(p1) % SlabAllocator::Granularity == 0);
+  assert(reinterpret_cast<uintptr_t>(p2) % SlabAllocator::Granularity == 0);
+  assert(reinterpret_cast<uintptr_t>(p3) % SlabAllocator::Granularity == 0);
+  assert(p1 != p2 && p2 != p3 && p1 != p3);
+  assert(allocator.NumBytesInUse() == 4 * SlabAllocator::Granularity);
+  assert(allocator.NumSlabs() == 1);
+
+  // Blocks of the same size class are recycled
+  allocator.Deallocate(p2, SlabAllocator::Granularity);
+  assert(allocator.NumBytesInUse() == 3 * SlabAllocator::Granularity);
+  auto p4 = allocator.Allocate(SlabAllocator::Granularity - 1);
+  assert(p4 == p2);
+
+  allocator.Deallocate(p1, 1);
+  allocator.Deallocate(p3, SlabAllocator::Granularity + 1);
+  allocator.Deallocate(p4, SlabAllocator::Granularity - 1);
+  assert(allocator.NumBytesInUse() == 0);
+}
+
+static void
+TestLargeAllocations()
+{
+  SlabAllocator allocator;
+
+  // Arrange & Act
+  auto size = SlabAllocator::MaxSmallSize + 1;
+  auto ptr = allocator.Allocate(size);
+  std::memset(ptr, 0xff, size);
+
+  // Assert
+  assert(allocator.NumSlabs() == 0);
+  assert(allocator.NumBytesInUse() >= size);
+  assert(allocator.NumBytesReserved() == allocator.NumBytesInUse());
+
+  allocator.Deallocate(ptr, size);
+  assert(allocator.NumBytesInUse() == 0);
+  assert(allocator.NumBytesReserved() == 0);
+}
+
+static void
+TestManyAllocations()
+{
+  SlabAllocator allocator;
+
+  // Arrange & Act
+  std::vector<void *> blocks;
+  for (size_t n = 0; n < 10000; n++)
+  {
+    auto size = 1 + n % SlabAllocator::MaxSmallSize;
+    auto ptr = allocator.Allocate(size);
+    std::memset(ptr, static_cast<int>(n), size);
+    blocks.push_back(ptr);
+  }
+
+  // Assert
+  assert(allocator.NumSlabs() > 1);
+  assert(allocator.NumBytesReserved() >= allocator.NumBytesInUse());
+
+  for (size_t n = 0; n < blocks.size(); n++)
+  {
+    auto size = 1 + n % SlabAllocator::MaxSmallSize;
+    assert(*static_cast<unsigned char *>(blocks[n]) == static_cast<unsigned char>(n));
+    allocator.Deallocate(blocks[n], size);
+  }
+  assert(allocator.NumBytesInUse() == 0);
+
+  // Freed blocks are reused instead of allocating new slabs
+  auto numSlabs = allocator.NumSlabs();
+  for (size_t n = 0; n < blocks.size(); n++)
+  {
+    blocks[n] = allocator.Allocate(1 + n % SlabAllocator::MaxSmallSize);
+  }
+  assert(allocator.NumSlabs() == numSlabs);
+
+  // Blocks released during teardown are only accounted for
+  allocator.BeginTeardown();
+  for (size_t n = 0; n < blocks.size(); n++)
+  {
+    allocator.Deallocate(blocks[n], 1 + n % SlabAllocator::MaxSmallSize);
+  }
+  assert(allocator.NumBytesInUse() == 0);
+}
+
+static int
+TestSlabAllocator()
+{
+  TestSmallAllocations();
+  TestLargeAllocations();
+  TestManyAllocations();
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSlabAllocator", TestSlabAllocator)
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <cassert>
+#include <vector>
+
+static int
+TestInsertAndRemove()
+{
+  jlm::util::SparseBitVector<uint32_t> set({ 0, 1, 63, 64, 127, 128, 1000 });
+
+  assert(set.Size() == 7);
+  assert(set.NumChunks() == 3);
+  assert(set.Contains(63) && set.Contains(64) && set.Contains(1000));
+  assert(!set.Contains(2) && !set.Contains(999) && !set.Contains(100000));
+
+  assert(set.Insert(500));
+  assert(!set.Insert(500));
+  assert(set.Size() == 8);
+
+  assert(set.Remove(1000));
+  assert(!set.Remove(1000));
+  assert(!set.Contains(1000));
+  assert(set.Size() == 7);
+
+  // Items are iterated in ascending order
+  std::vector<uint32_t> items(set.Items().begin(), set.Items().end());
+  assert(items == std::vector<uint32_t>({ 0, 1, 63, 64, 127, 128, 500 }));
+
+  // Removing the last item of a chunk removes the chunk
+  assert(set.Remove(500));
+  assert(set.NumChunks() == 2);
+
+  set.Clear();
+  assert(set.IsEmpty());
+  assert(set.Items().begin() == set.Items().end());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSparseBitVector-TestInsertAndRemove", TestInsertAndRemove)
+
+static int
+TestSetOperations()
+{
+  using SparseBitVector = jlm::util::SparseBitVector<uint32_t, 256>;
+
+  SparseBitVector set({ 1, 2, 300, 5000 });
+  SparseBitVector other({ 2, 3, 301, 4000, 6000 });
+
+  // Union
+  SparseBitVector newItems({ 7 });
+  assert(set.UnionWith(other, &newItems));
+  assert(set == SparseBitVector({ 1, 2, 3, 300, 301, 4000, 5000, 6000 }));
+  assert(newItems == SparseBitVector({ 3, 7, 301, 4000, 6000 }));
+  assert(!set.UnionWith(other));
+  assert(other.IsSubsetOf(set));
+  assert(!set.IsSubsetOf(other));
+
+  // Difference
+  set.DifferenceWith(other);
+  assert(set == SparseBitVector({ 1, 300, 5000 }));
+  assert(set.Size() == 3 && set.NumChunks() == 3);
+
+  // Intersection
+  SparseBitVector intersection({ 1, 4000, 5000 });
+  intersection.IntersectWith(set);
+  assert(intersection == SparseBitVector({ 1, 5000 }));
+  assert(intersection.Size() == 2 && intersection.NumChunks() == 2);
+
+  // Union that clears the other set
+  assert(intersection.UnionWithAndClear(other));
+  assert(other.IsEmpty());
+  assert(intersection.Size() == 7);
+  assert(intersection != set);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSparseBitVector-TestSetOperations", TestSetOperations)
+
+static int
+TestAgainstHashSet()
+{
+  // Compare against HashSet on pseudo-random sets with clustered and scattered items
+  jlm::util::SparseBitVector<uint32_t> sparseSets[2];
+  jlm::util::HashSet<uint32_t> hashSets[2];
+
+  uint32_t seed = 42;
+  for (size_t n = 0; n < 2000; n++)
+  {
+    seed = seed * 1103515245 + 12345;
+    auto item = (seed >> 8) % (n % 2 ? 300 : 100000);
+    sparseSets[n % 3 == 0].Insert(item);
+    hashSets[n % 3 == 0].Insert(item);
+  }
+
+  assert(sparseSets[0].UnionWith(sparseSets[1]) == hashSets[0].UnionWith(hashSets[1]));
+  assert(sparseSets[0].Size() == hashSets[0].Size());
+  for (auto item : sparseSets[0].Items())
+    assert(hashSets[0].Contains(item));
+
+  sparseSets[0].DifferenceWith(sparseSets[1]);
+  hashSets[0].DifferenceWith(hashSets[1]);
+  assert(sparseSets[0].Size() == hashSets[0].Size());
+  for (auto item : hashSets[0].Items())
+    assert(sparseSets[0].Contains(item));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSparseBitVector-TestAgainstHashSet", TestAgainstHashSet)
+
+static int
+TestInsertWhileIterating()
+{
+  jlm::util::SparseBitVector<uint32_t> set({ 1, 2 });
+
+  // Adding items in new chunks reallocates the chunks, which must not invalidate the iterator
+  std::vector<uint32_t> items;
+  for (auto item : set.Items())
+  {
+    items.push_back(item);
+    if (item < 1000)
+      set.UnionWith(jlm::util::SparseBitVector<uint32_t>({ item * 1000, item * 1000 + 1 }));
+  }
+
+  assert(set.Size() == 6);
+  assert(items == std::vector<uint32_t>({ 1, 2, 1000, 1001, 2000, 2001 }));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/util/TestSparseBitVector-TestInsertWhileIterating",
+    TestInsertWhileIterating)
+
+static int
+TestInsertInFrontWhileIterating()
+{
+  jlm::util::SparseBitVector<uint32_t> set({ 1000, 1001 });
+
+  // Inserting chunks in front of the current item moves the chunk of the current item,
+  // which must neither produce items that are not in the set, nor visit items twice
+  std::vector<uint32_t> items;
+  for (auto item : set.Items())
+  {
+    items.push_back(item);
+    if (item == 1000)
+    {
+      set.UnionWith(jlm::util::SparseBitVector<uint32_t>({ 5, 999, 1002 }));
+      set.Insert(3);
+    }
+  }
+
+  assert(set.Size() == 6);
+  assert(items == std::vector<uint32_t>({ 1000, 1001, 1002 }));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/util/TestSparseBitVector-TestInsertInFrontWhileIterating",
+    TestInsertInFrontWhileIterating)
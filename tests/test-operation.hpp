@@ -263,7 +263,7 @@ public:
   static structural_node *
   create(rvsdg::Region * parent, size_t nsubregions)
   {
-    return new structural_node(parent, nsubregions);
+    return new (*parent) structural_node(parent, nsubregions);
   }
 
   virtual structural_node *
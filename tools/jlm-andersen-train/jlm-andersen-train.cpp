@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/AndersenConfigurationModel.hpp>
+
+#include <llvm/Support/CommandLine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+using namespace jlm::llvm::aa;
+
+/**
+ * @return the geometric mean slowdown of picking a configuration with \p pick for each sample,
+ * compared to the fastest measured configuration of the sample.
+ */
+template<typename PickFunctor>
+static double
+GeometricMeanSlowdown(
+    const std::vector<AndersenConfigurationModel::TrainingSample> & samples,
+    PickFunctor pick)
+{
+  double sumLogSlowdowns = 0;
+  for (const auto & sample : samples)
+  {
+    double fastest = std::numeric_limits<double>::infinity();
+    for (const auto & [configuration, solvingTime] : sample.SolvingTimes)
+      fastest = std::min(fastest, solvingTime);
+
+    const auto solvingTime = sample.SolvingTimes.at(pick(sample).ToString());
+    sumLogSlowdowns += std::log(std::max(solvingTime, 1.0) / std::max(fastest, 1.0));
+  }
+
+  return std::exp(sumLogSlowdowns / samples.size());
+}
+
+int
+main(int argc, char ** argv)
+{
+  using namespace ::llvm;
+
+  cl::list<std::string> inputFiles(
+      cl::Positional,
+      cl::OneOrMore,
+      cl::desc("<statistics files from running Andersen with JLM_ANDERSEN_TEST_ALL_CONFIGS>"));
+
+  cl::opt<size_t> maxDepth(
+      "max-depth",
+      cl::init(3),
+      cl::desc("Maximum depth of the decision tree."),
+      cl::value_desc("depth"));
+
+  cl::opt<size_t> minSamplesPerLeaf(
+      "min-samples-per-leaf",
+      cl::init(5),
+      cl::desc("Minimum number of training samples in each leaf of the decision tree."),
+      cl::value_desc("count"));
+
+  cl::ParseCommandLineOptions(
+      argc,
+      argv,
+      "Trains the model used by adaptive configuration of Andersen's alias analysis.\n"
+      "The model is written to stdout, and can be used by setting JLM_ANDERSEN_CONFIG_MODEL.\n");
+
+  try
+  {
+    std::vector<AndersenConfigurationModel::TrainingSample> samples;
+    for (const auto & inputFile : inputFiles)
+    {
+      std::ifstream statistics(inputFile);
+      if (!statistics.is_open())
+        throw jlm::util::error("Unable to open statistics file " + inputFile);
+
+      auto fileSamples = AndersenConfigurationModel::ReadTrainingSamples(statistics);
+      std::move(fileSamples.begin(), fileSamples.end(), std::back_inserter(samples));
+    }
+
+    if (samples.empty())
+      throw jlm::util::error("No training samples found in the statistics files");
+
+    auto model = AndersenConfigurationModel::Train(samples, maxDepth, minSamplesPerLeaf);
+    std::cout << model.ToString();
+
+    const auto modelSlowdown = GeometricMeanSlowdown(
+        samples,
+        [&](const AndersenConfigurationModel::TrainingSample & sample)
+        {
+          return model.Predict(sample.Features);
+        });
+    std::cerr << "Trained on " << samples.size() << " samples, giving " << model.NumNodes()
+              << " nodes" << std::endl;
+    std::cerr << "Geometric mean slowdown of model: " << modelSlowdown << std::endl;
+
+    const auto defaultConfiguration = Andersen::Configuration::DefaultConfiguration().ToString();
+    const bool hasDefault = std::all_of(
+        samples.begin(),
+        samples.end(),
+        [&](const AndersenConfigurationModel::TrainingSample & sample)
+        {
+          return sample.SolvingTimes.count(defaultConfiguration) != 0;
+        });
+    if (hasDefault)
+    {
+      const auto defaultSlowdown = GeometricMeanSlowdown(
+          samples,
+          [](const AndersenConfigurationModel::TrainingSample &)
+          {
+            return Andersen::Configuration::DefaultConfiguration();
+          });
+      std::cerr << "Geometric mean slowdown of default configuration: " << defaultSlowdown
+                << std::endl;
+    }
+  }
+  catch (jlm::util::error & e)
+  {
+    std::cerr << e.what() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}